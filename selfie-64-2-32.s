@@ -0,0 +1,64233 @@
+lui t0,0x4F
+addi t0,t0,624
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,3
+addi t0,zero,4
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sw a0,-4(gp)
+lw t0,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,sp,8
+sw t0,4(sp)
+jal ra,59922
+addi sp,sp,-4
+sw a0,0(sp)
+lw a0,0(sp)
+addi sp,sp,4
+addi a7,zero,93
+ecall
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+lw a3,0(sp)
+addi sp,sp,4
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+lw t0,0(sp)
+addi sp,sp,4
+addi t0,t0,3
+addi t1,zero,4
+remu t1,t0,t1
+sub t0,t0,t1
+lw t1,-4(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sw a0,-4(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-8(gp)
+beq t0,zero,2
+jal zero,121
+addi t0,zero,-184
+add t0,gp,t0
+sw t0,-8(gp)
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-24(gp)
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-28(gp)
+lw t0,-24(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10428
+addi t0,a0,0
+sw t0,-32(gp)
+lw t0,-32(gp)
+addi t1,zero,1
+sw t1,0(t0)
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-32(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-32(gp)
+lw t2,-4(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sw t0,-36(gp)
+lw t0,-24(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7430
+addi t0,a0,0
+sw t0,-44(gp)
+lw t0,-44(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-40(gp)
+addi t0,zero,4
+sw t0,-56(gp)
+addi t0,zero,4
+sw t0,-60(gp)
+lw t0,-36(gp)
+sw t0,-64(gp)
+lw t0,-44(gp)
+sw t0,-68(gp)
+addi t0,zero,4
+sw t0,-72(gp)
+lw t0,-72(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-76(gp)
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10363
+addi t0,a0,0
+sw t0,-80(gp)
+lw t0,-80(gp)
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-24(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8176
+addi t0,a0,0
+sw t0,-84(gp)
+addi t0,zero,80
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8170
+addi t0,a0,0
+sw t0,-88(gp)
+lw t0,-92(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8164
+addi t0,a0,0
+sw t0,-96(gp)
+addi t0,zero,255
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8158
+addi t0,a0,0
+sw t0,-100(gp)
+addi t0,zero,4
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10330
+addi t0,a0,0
+sw t0,-104(gp)
+lw t0,-104(gp)
+addi t1,zero,0
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-140(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-428(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10294
+addi t0,a0,0
+sw t0,-432(gp)
+lw t0,-436(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8110
+addi t0,a0,0
+sw t0,-480(gp)
+lw t0,-432(gp)
+lw t1,-296(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-516
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-300(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-528
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-304(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-536
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-308(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-548
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-312(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-560
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-316(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-564
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-320(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-572
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-324(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-580
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-328(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-588
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-332(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-596
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-336(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-604
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-340(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-608
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-344(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-612
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-348(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-616
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-352(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-620
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-356(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-624
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-360(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-628
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-364(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-632
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-368(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-636
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-372(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-640
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-376(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-644
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-380(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-648
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-384(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-652
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-388(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-656
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-392(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-660
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-396(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-664
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-400(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-668
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-404(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-672
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-408(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-676
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-412(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-680
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-416(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-684
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-420(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-692
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-424(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-704
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-432(gp)
+lw t1,-428(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-712
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-188(gp)
+sw t0,-448(gp)
+lw t0,-292(gp)
+sw t0,-500(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-452(gp)
+addi t0,zero,1
+sw t0,-456(gp)
+jal ra,10345
+addi t0,zero,0
+sw t0,-460(gp)
+addi t0,zero,0
+sw t0,-464(gp)
+addi t0,zero,0
+sw t0,-468(gp)
+addi t0,zero,0
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9967
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-760(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9855
+addi t0,a0,0
+sw t0,-764(gp)
+addi t0,zero,0
+sw t0,-768(gp)
+addi t0,zero,0
+sw t0,-772(gp)
+addi t0,zero,0
+sw t0,-776(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-796(gp)
+addi t0,zero,0
+sw t0,-800(gp)
+addi t0,zero,0
+sw t0,-804(gp)
+addi t0,zero,0
+sw t0,-808(gp)
+addi t0,zero,0
+sw t0,-812(gp)
+addi t0,zero,0
+sw t0,-816(gp)
+addi t0,zero,0
+sw t0,-820(gp)
+addi t0,zero,0
+sw t0,-824(gp)
+addi t0,zero,0
+sw t0,-472(gp)
+jal ra,10521
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+addi t0,zero,-828
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-844
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7444
+addi t0,a0,0
+sw t0,-832(gp)
+addi t0,zero,-852
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7437
+addi t0,a0,0
+sw t0,-836(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9543
+addi t0,a0,0
+sw t0,-992(gp)
+lw t0,-992(gp)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-868(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1004
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-872(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-876(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1012
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-880(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-884(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1020
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-892(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1028
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1032
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1036
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1044
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-912(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-916(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1052
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-920(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1060
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-928(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-932(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1068
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-936(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-940(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1076
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-944(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-948(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1084
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-952(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-956(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1092
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-960(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-964(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1100
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-968(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-972(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1108
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-976(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-980(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1116
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-984(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-992(gp)
+lw t1,-988(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1124
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9265
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1528(gp)
+addi t0,zero,0
+sw t0,-1532(gp)
+addi t0,zero,0
+sw t0,-1536(gp)
+addi t0,zero,0
+sw t0,-1540(gp)
+addi t0,zero,0
+sw t0,-1544(gp)
+addi t0,zero,0
+sw t0,-1548(gp)
+addi t0,zero,0
+sw t0,-1552(gp)
+addi t0,zero,0
+sw t0,-1556(gp)
+addi t0,zero,0
+sw t0,-1560(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1452(gp)
+addi t0,zero,0
+sw t0,-1456(gp)
+addi t0,zero,0
+sw t0,-1460(gp)
+addi t0,zero,0
+sw t0,-1464(gp)
+addi t0,zero,0
+sw t0,-1468(gp)
+addi t0,zero,0
+sw t0,-1472(gp)
+addi t0,zero,0
+sw t0,-1476(gp)
+addi t0,zero,0
+sw t0,-1480(gp)
+addi t0,zero,0
+sw t0,-1484(gp)
+addi t0,zero,0
+sw t0,-1488(gp)
+addi t0,zero,0
+sw t0,-1492(gp)
+addi t0,zero,0
+sw t0,-1496(gp)
+addi t0,zero,0
+sw t0,-1500(gp)
+addi t0,zero,0
+sw t0,-1504(gp)
+addi t0,zero,0
+sw t0,-1508(gp)
+addi t0,zero,0
+sw t0,-1512(gp)
+addi t0,zero,0
+sw t0,-1516(gp)
+addi t0,zero,0
+sw t0,-1520(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,3
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9031
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8591
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1888(gp)
+addi t1,zero,4
+lw t2,-72(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-1892(gp)
+lw t0,-1888(gp)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-1900(gp)
+lw t0,8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,8(s0)
+jal zero,9
+lw t0,8(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sw t0,8(s0)
+lw t0,8(s0)
+lw t1,-1872(gp)
+mul t0,t0,t1
+sw t0,-1908(gp)
+lw t0,-1912(gp)
+lw t1,-1892(gp)
+lw t2,-1888(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-1912(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,-1992(gp)
+lw t1,-1968(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2004
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1972(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sw t1,0(t0)
+jal zero,17
+lw t0,-1992(gp)
+lw t1,-1968(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2012
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1972(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1988(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8011
+addi t0,a0,0
+sw t0,-1992(gp)
+lw t0,-1992(gp)
+lw t1,-1936(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2020
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1940(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2028
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1944(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1948(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2036
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1952(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1956(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1960(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1964(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sw t1,0(t0)
+jal ra,-126
+lw t0,-1992(gp)
+lw t1,-1976(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2028
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1980(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1984(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1992(gp)
+lw t1,-1988(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2008
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,2004(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8072
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1996(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,2004(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8056
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1992(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,4
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7600
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1940(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7328
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1936(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1976(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1604
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1592
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1572
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1564
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1960(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1548
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1528
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1952(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1512
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1948(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1492
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1944(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1468
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1940(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1448
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1872(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1868(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sw t1,1864(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1856(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1852(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1848(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1836(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1832(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1828(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1816(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1812(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1804(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1800(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7248
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1796(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1792(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7226
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1788(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7208
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1784(t0)
+lw t0,-1528(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1784(t1)
+sw t1,1780(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7178
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1780(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7153
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1776(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7135
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1772(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7111
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1672(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7097
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1668(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,-872(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1664(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1660(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1656(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1652(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1648(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1644(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1640(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1636(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1632(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1628(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1624(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1620(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-2282
+jal ra,-336
+jal ra,-275
+jal ra,-131
+jal ra,-43
+jal ra,23029
+addi t0,zero,0
+sw t0,-1928(gp)
+addi t0,zero,0
+sw t0,-1932(gp)
+addi t0,zero,0
+sw t0,-1612(gp)
+addi t0,zero,0
+sw t0,-1616(gp)
+addi t0,zero,0
+sw t0,-1620(gp)
+addi t0,zero,0
+sw t0,-1624(gp)
+addi t0,zero,0
+sw t0,-1628(gp)
+addi t0,zero,0
+sw t0,-1632(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1444(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6770
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,21
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,26
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,32
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,33
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,34
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,35
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,36
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,37
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,38
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,39
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,40
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,41
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,42
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,21
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,26
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,32
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,33
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,34
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,35
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,36
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,37
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,38
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,39
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,40
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,41
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,42
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,38613
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1372(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1364(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1356(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1348(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1340(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1336(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4422
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,4
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3948
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1324(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,4(sp)
+jal ra,38985
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1320(t0)
+jal zero,-25
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1292(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1284(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1268(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1244(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1236(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1212(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1204(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1196(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1188(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1180(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,3
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3712
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1072(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3512
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1068(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,816
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1084(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,808
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1080(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,800
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1076(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,792
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1072(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,784
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,896(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3429
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,892(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,892(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,900(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,780
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,892(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,896(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,768
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,764(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,51477
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,752(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,4
+addi t1,zero,4
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1148(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7161
+lw t0,-24(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lw t0,-24(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sw t0,-12(gp)
+addi t0,zero,0
+sw t0,-16(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1148(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7183
+jal ra,18870
+addi t0,a0,0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10775
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,629
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,736(t1)
+sw t1,728(t0)
+jal zero,43
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-104(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-7213
+lw t0,-104(gp)
+lw t0,0(t0)
+lw t1,-1324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,744(t1)
+sw t1,728(t0)
+jal zero,21
+lw t0,-104(gp)
+lw t0,0(t0)
+lw t1,-1340(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,740(t1)
+sw t1,728(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,736(t1)
+sw t1,728(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,748(t1)
+sw t1,728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,724(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,740(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-120(gp)
+sw t0,-128(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-124(gp)
+sw t0,-128(gp)
+jal zero,3
+lw t0,-116(gp)
+sw t0,-128(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,35
+lw t0,-12(gp)
+beq t0,zero,26
+addi t0,zero,4
+sw t0,-56(gp)
+addi t0,zero,4
+sw t0,-60(gp)
+lw t0,-36(gp)
+sw t0,-64(gp)
+lw t0,-44(gp)
+sw t0,-68(gp)
+addi t0,zero,4
+sw t0,-72(gp)
+lw t0,-72(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-76(gp)
+addi t0,zero,20
+sw t0,-440(gp)
+lw t0,-1284(gp)
+sw t0,-1344(gp)
+addi t0,zero,64
+sw t0,-1384(gp)
+addi t0,zero,64
+sw t0,-1396(gp)
+addi t0,zero,56
+sw t0,-1400(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1148(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7336
+jal zero,50
+lw t0,-12(gp)
+beq t0,zero,24
+lw t0,-48(gp)
+sw t0,-56(gp)
+lw t0,-48(gp)
+sw t0,-60(gp)
+lw t0,-52(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,207
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-64(gp)
+lw t0,-52(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,197
+addi t0,a0,0
+sw t0,-68(gp)
+lw t0,-48(gp)
+sw t0,-72(gp)
+jal zero,11
+addi t0,zero,4
+sw t0,-56(gp)
+addi t0,zero,4
+sw t0,-60(gp)
+lw t0,-36(gp)
+sw t0,-64(gp)
+lw t0,-44(gp)
+sw t0,-68(gp)
+addi t0,zero,4
+sw t0,-72(gp)
+lw t0,-72(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-76(gp)
+addi t0,zero,10
+sw t0,-440(gp)
+lw t0,-1288(gp)
+sw t0,-1344(gp)
+addi t0,zero,52
+sw t0,-1384(gp)
+addi t0,zero,52
+sw t0,-1396(gp)
+addi t0,zero,32
+sw t0,-1400(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-1570
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,36596
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,752(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sw t1,1428(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-81
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-113
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-32(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,21
+lui t0,0xFFFFF
+addi t0,t0,704
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,2757
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1148(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7589
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,2
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-145
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-169
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+lw t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-203
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-58
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,39
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-44(gp)
+add t0,t0,t1
+lw t1,12(s0)
+lw t2,-44(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,135
+lw t0,8(s0)
+lw t1,-44(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,12(s0)
+lw t1,-44(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,127
+jal zero,35
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-51
+addi t0,a0,0
+beq t0,zero,21
+lw t0,12(s0)
+addi t1,zero,1
+sub t1,zero,t1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lw t0,-44(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-115
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,99
+jal zero,7
+lw t0,-44(gp)
+lw t1,12(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,92
+jal zero,84
+lw t0,12(s0)
+lw t1,-44(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,82
+jal zero,74
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-96
+addi t0,a0,0
+beq t0,zero,38
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-166
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,48
+jal zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-177
+addi t0,a0,0
+lw t1,12(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,37
+jal zero,29
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-141
+addi t0,a0,0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-199
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,14
+jal zero,6
+lw t0,8(s0)
+lw t1,12(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1116(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7998
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-464
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-482
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-517
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+lw t0,12(s0)
+lw t1,-24(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-537
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-384
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-420
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-67
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-519
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-539
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2356
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-15
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-291
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-257
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-22
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-270
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-343
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-356
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-322
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-330
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-42
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,64
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-410
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,34
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-430
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-439
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-64
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-478
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,zero,1
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-498
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,116
+lw t0,-12(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,660
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1681
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8665
+lw t0,-8(s0)
+lw t1,-36(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-8(s0)
+addi t1,zero,10
+mul t0,t0,t1
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,63
+lw t0,-8(s0)
+lw t1,-36(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+lw t0,-12(s0)
+lw t1,-36(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+lw t0,-8(s0)
+addi t1,zero,10
+mul t0,t0,t1
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1626
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8720
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1606
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8740
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-620
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-119
+lw t0,-16(s0)
+beq t0,zero,32
+lw t0,-8(s0)
+lw t1,-44(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+lw t0,-8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,26
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1561
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8785
+jal zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,48
+sw t0,8(sp)
+jal ra,-653
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,22
+lw t0,20(s0)
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-1002
+addi t0,a0,0
+beq t0,zero,12
+lw t0,16(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+sub t0,zero,t0
+sw t0,8(s0)
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-702
+jal zero,13
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-715
+lw t0,8(s0)
+lw t1,16(s0)
+divu t0,t0,t1
+sw t0,8(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-46
+lw t0,16(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-8(s0)
+beq t0,zero,13
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,45
+sw t0,8(sp)
+jal ra,-740
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-756
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+jal zero,18
+lw t0,-4(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,48
+sw t0,8(sp)
+jal ra,-774
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-787
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-510
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1356
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+lw t1,8(s0)
+lw t2,12(s0)
+remu t1,t1,t2
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1371
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+lw t2,12(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t1,t0
+beq t0,zero,29
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi t1,zero,4
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1415
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-85
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,47
+jal zero,45
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,zero,4
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1444
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-114
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1469
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1497
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1521
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-203
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-66
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-231
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-70
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-241
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,748(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,1040
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-9298
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-1261
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-152(gp)
+beq t0,zero,14
+lw t0,-152(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-156(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-1176
+lw t0,-156(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-156(gp)
+jal zero,52
+lw t0,-80(gp)
+beq t0,zero,44
+lw t0,-80(gp)
+lw t1,8(s0)
+sw t1,0(t0)
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-89
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-148(gp)
+lw t1,-108(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-108(gp)
+sw t0,-148(gp)
+lui t0,0xFFFFF
+addi t0,t0,560
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-144(gp)
+sw t0,8(sp)
+jal ra,954
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9392
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9399
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,552
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17
+jal zero,29
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1312
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-117
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-25
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,548
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,871
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,532
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,849
+jal zero,49
+lw t0,8(s0)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,520
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,836
+jal zero,36
+lw t0,8(s0)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,508
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,823
+jal zero,23
+lw t0,8(s0)
+lw t1,-204(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,488
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,810
+jal zero,10
+lui t0,0xFFFFF
+addi t0,t0,480
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,801
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,472
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,782
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-783
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-179
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-809
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-205
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1967
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-308
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,12(s0)
+jal zero,-12
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-857
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-253
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-884
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+lw t0,-192(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-366
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,8(s0)
+jal zero,-12
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-925
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-321
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,468
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,597
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-973
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-369
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,549
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-1021
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,460
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,501
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1731
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-466
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,303
+jal zero,298
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1753
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-564
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,281
+jal zero,276
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1775
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1789
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-365
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,245
+jal zero,76
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1813
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-363
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,221
+jal zero,52
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-273
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,195
+jal zero,26
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1863
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-251
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,169
+jal zero,164
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1887
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-227
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,145
+jal zero,140
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1911
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1925
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1762
+addi t0,a0,0
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,3
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1955
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-483
+lw t0,12(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,75
+jal zero,70
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1981
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1995
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1832
+addi t0,a0,0
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-2011
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,3
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-2025
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-463
+lw t0,12(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+lw t0,12(s0)
+beq t0,zero,4
+lw t0,12(s0)
+sw t0,-152(gp)
+jal zero,3
+lw t0,-100(gp)
+sw t0,-152(gp)
+addi t0,zero,0
+sw t0,-156(gp)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2095
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2111
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2122
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+lw a0,0(t0)
+addi t0,t0,4
+sw t0,20(s0)
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-419
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,9
+addi t0,zero,37
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-947
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,15
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2157
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-962
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-87
+lw t0,-152(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-156(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2137
+lw t0,-156(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-156(gp)
+lw t0,12(s0)
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-152(gp)
+jal zero,16
+lw t0,-152(gp)
+sw t0,12(s0)
+addi t0,zero,0
+sw t0,-152(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-1053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,12
+add t0,s0,t0
+sw t0,-4(s0)
+addi t0,zero,1
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-174
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,16
+add t0,s0,t0
+sw t0,-4(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-207
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,16
+add t0,s0,t0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-240
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-148(gp)
+lw t1,-108(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-88(gp)
+sw t0,4(sp)
+jal ra,-117
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-88(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-10456
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+lw t1,8(s0)
+lw t2,12(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+lw t1,12(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1428(t0)
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4519
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10499
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,29
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lw t0,-80(gp)
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,432
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-225
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1124(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10571
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1428(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sw t1,1428(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-87
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1428(t0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-147
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,12(s0)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-15
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-187
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,724(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-73
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1428(t0)
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4706
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10687
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,420
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1200
+jal zero,10
+lw t0,-432(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1210
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-504(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-442
+addi sp,sp,16
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-39
+lui t0,0xFFFFF
+addi t0,t0,372
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-469
+addi sp,sp,4
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-70
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1361
+lui t0,0xFFFFF
+addi t0,t0,356
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-502
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1371
+lui t0,0xFFFFF
+addi t0,t0,348
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-512
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-508(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-10870
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-80(gp)
+lw t0,0(t0)
+sw t0,-448(gp)
+lw t0,-452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-452(gp)
+jal zero,29
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-188(gp)
+sw t0,-448(gp)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-504(gp)
+sw t0,8(sp)
+jal ra,-572
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10918
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-448(gp)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-448(gp)
+lw t1,-204(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-448(gp)
+lw t1,-208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+lw t0,-448(gp)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-59
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,156
+lw t0,-4(s0)
+beq t0,zero,23
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,16
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-448(gp)
+addi a0,t0,0
+jal zero,140
+jal zero,6
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-167
+jal zero,131
+lw t0,-8(s0)
+beq t0,zero,58
+lw t0,-448(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-181
+lw t0,-448(gp)
+lw t1,-260(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sw t0,-8(s0)
+jal zero,-19
+lw t0,-8(s0)
+beq t0,zero,30
+lw t0,-448(gp)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal zero,19
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,268
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-288
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11082
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-226
+jal zero,72
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,17
+lw t0,-448(gp)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-245
+jal zero,53
+lw t0,-448(gp)
+lw t1,-260(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-253
+lw t0,-448(gp)
+lw t1,-260(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-460(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-460(gp)
+lw t0,-464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-464(gp)
+jal ra,-270
+jal zero,24
+lw t0,-448(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,-460(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-460(gp)
+lw t0,-464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-464(gp)
+jal ra,-288
+jal zero,6
+lw t0,-376(gp)
+sw t0,-500(gp)
+lw t0,-448(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+lw t0,-448(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-156
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2931
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2887
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-448(gp)
+lw t1,-212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-448(gp)
+lw t1,-220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-302
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-476(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-432(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-2755
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,106
+jal zero,104
+lw t0,-316(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-316(gp)
+addi a0,t0,0
+jal zero,96
+jal zero,94
+lw t0,-320(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-320(gp)
+addi a0,t0,0
+jal zero,86
+jal zero,84
+lw t0,-324(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-324(gp)
+addi a0,t0,0
+jal zero,76
+jal zero,74
+lw t0,-328(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-328(gp)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+lw t0,-332(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-332(gp)
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-336(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-336(gp)
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-416(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-103
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-420(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-424(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-428(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-292(gp)
+sw t0,-500(gp)
+addi t0,zero,0
+sw t0,-476(gp)
+addi t0,zero,0
+sw t0,-484(gp)
+addi t0,zero,0
+sw t0,-492(gp)
+addi t0,zero,0
+sw t0,-488(gp)
+jal ra,-424
+addi t0,a0,0
+lw t1,-188(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,601
+lw t0,-500(gp)
+lw t1,-376(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,592
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3187
+addi t0,a0,0
+beq t0,zero,56
+addi t0,zero,0
+sw t0,-4(s0)
+jal ra,-269
+addi t0,a0,0
+beq t0,zero,33
+lw t0,-4(s0)
+lw t1,-436(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,248
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-663
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11457
+lw t0,-480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-448(gp)
+sw t0,8(sp)
+jal ra,-3298
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-609
+jal zero,-34
+lw t0,-480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3312
+lw t0,-480(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3096
+addi t0,a0,0
+sw t0,-476(gp)
+jal ra,-208
+addi t0,a0,0
+sw t0,-500(gp)
+jal zero,531
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3194
+addi t0,a0,0
+beq t0,zero,133
+lw t0,-448(gp)
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-641
+addi t0,zero,0
+sw t0,-492(gp)
+jal zero,120
+lw t0,-440(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3176
+addi t0,a0,0
+sw t0,-484(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3218
+addi t0,a0,0
+beq t0,zero,42
+lw t0,-4(s0)
+lw t1,-440(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+lw t0,-496(gp)
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,220
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-745
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,188
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-752
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11546
+lw t0,-484(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-448(gp)
+sw t0,8(sp)
+jal ra,-3387
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-698
+jal zero,-46
+lw t0,-484(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3401
+lw t0,-484(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2979
+addi t0,a0,0
+sw t0,-492(gp)
+lw t0,-496(gp)
+beq t0,zero,18
+lw t0,-492(gp)
+lw t1,-68(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,152
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-798
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11592
+jal zero,32
+lw t0,-492(gp)
+lw t1,-64(gp)
+sltu t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,112
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-815
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11609
+jal zero,15
+lw t0,-492(gp)
+lw t1,-68(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,9
+lw t0,-492(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-76(gp)
+sw t0,4(sp)
+jal ra,-3564
+addi t0,a0,0
+sw t0,-492(gp)
+lw t0,-296(gp)
+sw t0,-500(gp)
+jal zero,393
+lw t0,-448(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-773
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,60
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-858
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11652
+jal zero,3
+lw t0,-448(gp)
+sw t0,-492(gp)
+jal ra,-795
+lw t0,-448(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-802
+jal zero,22
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-216(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-855
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11680
+jal zero,5
+lw t0,-216(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-866
+lw t0,-300(gp)
+sw t0,-500(gp)
+jal zero,332
+lw t0,-448(gp)
+lw t1,-220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+jal ra,-834
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3366
+addi t0,a0,0
+sw t0,-488(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+jal ra,-492
+addi t0,a0,0
+beq t0,zero,40
+lw t0,-4(s0)
+lw t1,-444(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,44
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-930
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11724
+lw t0,-448(gp)
+lw t1,-284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,299
+lw t0,-488(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-448(gp)
+sw t0,8(sp)
+jal ra,-3572
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-883
+jal zero,-41
+lw t0,-448(gp)
+lw t1,-220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-891
+jal zero,11
+lw t0,-220(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-938
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11763
+lw t0,-488(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3604
+lw t0,-304(gp)
+sw t0,-500(gp)
+jal zero,246
+lw t0,-448(gp)
+lw t1,-224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-920
+lw t0,-340(gp)
+sw t0,-500(gp)
+jal zero,236
+lw t0,-448(gp)
+lw t1,-228(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-930
+lw t0,-344(gp)
+sw t0,-500(gp)
+jal zero,226
+lw t0,-448(gp)
+lw t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-940
+lw t0,-348(gp)
+sw t0,-500(gp)
+jal zero,216
+lw t0,-448(gp)
+lw t1,-236(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-950
+lw t0,-352(gp)
+sw t0,-500(gp)
+jal zero,206
+lw t0,-448(gp)
+lw t1,-240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-960
+lw t0,-356(gp)
+sw t0,-500(gp)
+jal zero,196
+lw t0,-448(gp)
+lw t1,-244(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-970
+lw t0,-360(gp)
+sw t0,-500(gp)
+jal zero,186
+lw t0,-448(gp)
+lw t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-980
+lw t0,-364(gp)
+sw t0,-500(gp)
+jal zero,176
+lw t0,-448(gp)
+lw t1,-252(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-990
+lw t0,-368(gp)
+sw t0,-500(gp)
+jal zero,166
+lw t0,-448(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1000
+lw t0,-372(gp)
+sw t0,-500(gp)
+jal zero,156
+lw t0,-448(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1010
+lw t0,-380(gp)
+sw t0,-500(gp)
+jal zero,146
+lw t0,-448(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1020
+lw t0,-448(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1027
+lw t0,-388(gp)
+sw t0,-500(gp)
+jal zero,3
+lw t0,-384(gp)
+sw t0,-500(gp)
+jal zero,126
+lw t0,-448(gp)
+lw t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1040
+lw t0,-448(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1047
+jal zero,5
+lw t0,-268(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1094
+lw t0,-392(gp)
+sw t0,-500(gp)
+jal zero,104
+lw t0,-448(gp)
+lw t1,-276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1062
+lw t0,-448(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1069
+lw t0,-400(gp)
+sw t0,-500(gp)
+jal zero,3
+lw t0,-396(gp)
+sw t0,-500(gp)
+jal zero,84
+lw t0,-448(gp)
+lw t1,-280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1082
+lw t0,-448(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1089
+lw t0,-408(gp)
+sw t0,-500(gp)
+jal zero,3
+lw t0,-404(gp)
+sw t0,-500(gp)
+jal zero,64
+lw t0,-448(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1102
+lw t0,-448(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1109
+lw t0,-448(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1116
+jal zero,5
+lw t0,-288(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1163
+jal zero,5
+lw t0,-288(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1168
+lw t0,-412(gp)
+sw t0,-500(gp)
+jal zero,30
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-1237
+lui t0,0xFFFFF
+addi t0,t0,16
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1665
+lw t0,-448(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2534
+jal ra,-2551
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12019
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-1178
+lw t0,-448(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-200(gp)
+sw t0,-448(gp)
+jal zero,67
+lw t0,-448(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-196(gp)
+sw t0,-448(gp)
+jal zero,58
+lw t0,-448(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-192(gp)
+sw t0,-448(gp)
+jal zero,49
+lw t0,-448(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-216(gp)
+sw t0,-448(gp)
+jal zero,40
+lw t0,-448(gp)
+lw t1,-220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-220(gp)
+sw t0,-448(gp)
+jal zero,31
+lw t0,-448(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-264(gp)
+sw t0,-448(gp)
+jal zero,22
+lw t0,-448(gp)
+lw t1,-284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-284(gp)
+sw t0,-448(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-16
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1320
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12114
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+lw t1,8(s0)
+lw t1,0(t1)
+lw t2,8(s0)
+lw t2,0(t2)
+lw t3,8(s0)
+lw t3,0(t3)
+lw t4,8(s0)
+lw t4,0(t4)
+lw t5,8(s0)
+lw t5,0(t5)
+lw t6,-760(gp)
+divu t5,t5,t6
+add t4,t4,t5
+lw t5,-760(gp)
+divu t4,t4,t5
+add t3,t3,t4
+lw t4,-760(gp)
+divu t3,t3,t4
+add t2,t2,t3
+lw t3,-760(gp)
+divu t2,t2,t3
+add t1,t1,t2
+lw t2,-760(gp)
+divu t1,t1,t2
+add t0,t0,t1
+lw t1,-760(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-11638
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-11461
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-11450
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-11439
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,24(s0)
+sw t0,4(sp)
+jal ra,-11428
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,28(s0)
+sw t0,4(sp)
+jal ra,-11417
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,32(s0)
+sw t0,4(sp)
+jal ra,-11406
+lw t0,8(s0)
+lw t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-876(gp)
+sw t0,4(sp)
+jal ra,-11401
+lw t0,-764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-105
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-11537
+lw t0,-8(s0)
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,15
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-896(gp)
+sw t0,4(sp)
+jal ra,-11432
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-768(gp)
+sw t0,4(sp)
+jal ra,-11553
+lw t0,-4(s0)
+sw t0,-768(gp)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-772(gp)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lw t0,-776(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-776(gp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11685
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11737
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3796
+addi t0,a0,0
+beq t0,zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11764
+addi t0,a0,0
+sw t0,8(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-222
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-768(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-716(gp)
+sw t0,8(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-716(gp)
+sw t0,4(sp)
+jal ra,-80
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11825
+addi t0,a0,0
+lw t1,-728(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11780
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11794
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8490
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6743
+addi t0,a0,0
+lw t1,-1156(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-760(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,-764(gp)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+addi t0,a0,0
+beq t0,zero,32
+addi t0,zero,1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11940
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1770
+lui t0,0xFFFFF
+addi t0,t0,-40
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11971
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2204
+addi sp,sp,4
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11998
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-48
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-64
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+lw t1,-860(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-780(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-780(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-60
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1802
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12596
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lw t0,-780(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-880(gp)
+lw t1,-780(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+lw t0,-972(gp)
+lw t1,-780(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-84
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1846
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12640
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+lw t0,-780(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-892(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-64
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-84
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1890
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12684
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+lw t1,-860(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-780(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-976(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-108
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-60
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1934
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12728
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+lw t1,8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+lw t0,-780(gp)
+lw t1,8(s0)
+sub t0,t0,t1
+sw t0,-780(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-116
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1968
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12762
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-300(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,162
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-500(gp)
+lw t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-500(gp)
+lw t1,-396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-500(gp)
+lw t1,-404(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-500(gp)
+lw t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-500(gp)
+lw t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-380(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,53
+jal zero,51
+lw t0,-500(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,43
+jal zero,41
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+lw t0,-500(gp)
+lw t1,-336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,26
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-277
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-340(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5694
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-500(gp)
+lw t1,-324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-500(gp)
+lw t1,-316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-500(gp)
+lw t1,-332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-500(gp)
+lw t1,-328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-285
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-2549
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2585
+lui t0,0xFFFFF
+addi t0,t0,356
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2981
+lw t0,-500(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2595
+lui t0,0xFFFFF
+addi t0,t0,348
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2991
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-2591
+lui t0,0xFFFFF
+addi t0,t0,-136
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3019
+lw t0,-500(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2633
+lui t0,0xFFFFF
+addi t0,t0,348
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3029
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-500(gp)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1987
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13426
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-2683
+lui t0,0xFFFFF
+addi t0,t0,-152
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-3113
+addi sp,sp,4
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-2714
+lui t0,0xFFFFF
+addi t0,t0,-180
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-476(gp)
+sw t0,8(sp)
+jal ra,-3146
+addi sp,sp,8
+lw t0,-472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-560
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3172
+jal zero,45
+lw t0,8(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-192
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3185
+jal zero,32
+lw t0,8(s0)
+lw t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-580
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3197
+jal zero,20
+lw t0,8(s0)
+lw t1,-748(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-204
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3210
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-212
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3217
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-220
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-2813
+lui t0,0xFFFFF
+addi t0,t0,-236
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3241
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+lui t0,0xFFFFF
+addi t0,t0,356
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3251
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+lui t0,0xFFFFF
+addi t0,t0,348
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3261
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,143
+jal ra,-465
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-280
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13632
+jal zero,2
+jal ra,-2232
+jal zero,-18
+jal ra,-868
+addi t0,a0,0
+beq t0,zero,79
+jal ra,257
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,65
+lw t0,-476(gp)
+sw t0,-8(s0)
+jal ra,-2248
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,102
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,266
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-12892
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13034
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13022
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13104
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,8143
+lw t0,-1508(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1508(gp)
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-325
+jal zero,7
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2621
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+jal zero,42
+lw t0,-500(gp)
+lw t1,-324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2321
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2328
+lw t0,-740(gp)
+sw t0,-4(s0)
+jal zero,3
+lw t0,-744(gp)
+sw t0,-4(s0)
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-476(gp)
+sw t0,-8(s0)
+jal ra,-2342
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2581
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-457
+jal zero,2
+jal ra,-417
+jal zero,-146
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,61
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-716(gp)
+sw t0,4(sp)
+jal ra,-1450
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+lw t0,-1548(gp)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-1548(gp)
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-716(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1548(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-1648
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-796(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-796(gp)
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,-220
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-3064
+lui t0,0xFFFFF
+addi t0,t0,-280
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-3494
+addi sp,sp,4
+jal zero,51
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,-756(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-476(gp)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-716(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,16(s0)
+sw t0,24(sp)
+jal ra,-1695
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2458
+jal zero,25
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-567
+lw t0,-756(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-288
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-716(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,16(s0)
+sw t0,24(sp)
+jal ra,-1721
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-736(gp)
+sw t0,-4(s0)
+jal ra,-1136
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-2505
+jal ra,-1140
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2509
+jal zero,-4
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-740(gp)
+sw t0,-4(s0)
+jal ra,-2519
+jal zero,-9
+jal zero,5
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-629
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-500(gp)
+lw t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-2548
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-2555
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,48
+jal zero,12
+lw t0,8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-736(gp)
+sw t0,4(sp)
+jal ra,-411
+lw t0,-500(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-496(gp)
+jal ra,-2580
+jal ra,65
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-496(gp)
+beq t0,zero,8
+addi t0,zero,0
+sw t0,-496(gp)
+lw t0,-4(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,10
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-119
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-748(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,8(s0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-471
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-659
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-1268
+addi t0,a0,0
+beq t0,zero,8
+lw t0,-492(gp)
+sw t0,-4(s0)
+jal ra,-2657
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-724
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-888
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-744
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14096
+jal zero,2
+jal ra,-2696
+jal zero,-18
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,357
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-735
+jal zero,56
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lw t0,-476(gp)
+sw t0,-4(s0)
+jal ra,-2721
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,334
+jal zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2893
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-763
+jal zero,28
+lw t0,-500(gp)
+lw t1,-316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1614
+jal zero,20
+lw t0,-500(gp)
+lw t1,-332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1740
+jal zero,12
+lw t0,-500(gp)
+lw t1,-328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,3075
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-791
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,12
+sw t0,8(sp)
+jal ra,-6453
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,20
+sw t0,8(sp)
+jal ra,-6463
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6654
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-6170
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6961
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6684
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,7027
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-6205
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6926
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-6214
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13628
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-6295
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6861
+addi t0,a0,0
+beq t0,zero,25
+jal ra,-1736
+jal ra,-1706
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-138
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-1715
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13641
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1725
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6918
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13695
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-1796
+jal ra,-1766
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13692
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,7060
+jal zero,11
+jal ra,-1780
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-1784
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,7049
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13769
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2027
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-995
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14433
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13805
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-211
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13839
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-1908
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13890
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,56
+lw t0,-372(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1117
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-476(gp)
+sw t0,8(s0)
+jal ra,-3132
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-94
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,29
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3146
+jal ra,115
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1177
+jal zero,14
+jal ra,-1217
+jal ra,-1987
+jal ra,-1957
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,6651
+lw t0,-740(gp)
+sw t0,-20(s0)
+jal ra,-1968
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-500(gp)
+lw t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-3179
+lw t0,-4(s0)
+beq t0,zero,15
+lw t0,-20(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-740(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+sw t0,4(sp)
+jal ra,-1032
+jal zero,3
+lw t0,-736(gp)
+sw t0,-20(s0)
+jal ra,66
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-20(s0)
+lw t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+jal ra,-1049
+lw t0,-12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-2015
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6869
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1889
+lw t0,-808(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-808(gp)
+jal zero,5
+lw t0,-384(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1335
+lw t0,-4(s0)
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1904
+jal zero,18
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13983
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1922
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,236
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-1838
+addi t0,a0,0
+beq t0,zero,221
+lw t0,-500(gp)
+sw t0,-8(s0)
+jal ra,-3276
+jal ra,227
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1130
+lw t0,-736(gp)
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2054
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2103
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2061
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6569
+jal ra,-2110
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6498
+jal ra,-2074
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2078
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2126
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6677
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2000
+jal zero,160
+lw t0,-8(s0)
+lw t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-2096
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2145
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2103
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6527
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2022
+jal ra,-2156
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+jal ra,-2162
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6641
+jal zero,128
+lw t0,-8(s0)
+lw t1,-396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2128
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2132
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2180
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6623
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2054
+jal zero,106
+lw t0,-8(s0)
+lw t1,-404(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2150
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2199
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2157
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6601
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2076
+jal zero,84
+lw t0,-8(s0)
+lw t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2172
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2221
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2179
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6579
+jal ra,-2228
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6380
+jal ra,-2192
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2241
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2199
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6431
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2118
+jal zero,42
+lw t0,-8(s0)
+lw t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+jal ra,-2214
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2218
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2266
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6537
+jal ra,-2270
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6338
+jal ra,-2234
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2283
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2241
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6389
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2160
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,182
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2006
+addi t0,a0,0
+beq t0,zero,167
+lw t0,-500(gp)
+sw t0,-8(s0)
+jal ra,-3518
+jal ra,173
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+lw t0,-4(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-12(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-2340
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-56(gp)
+sw t0,4(sp)
+jal ra,2704
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-328
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4167
+jal zero,16
+lw t0,-12(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2316
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-56(gp)
+sw t0,4(sp)
+jal ra,2683
+lw t0,-740(gp)
+sw t0,-4(s0)
+jal ra,-2325
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2329
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2377
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6266
+jal zero,96
+lw t0,-8(s0)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+lw t0,-4(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+lw t0,-12(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-2400
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-56(gp)
+sw t0,4(sp)
+jal ra,2644
+jal ra,-2362
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2366
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2414
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6261
+jal zero,34
+jal ra,-2374
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2378
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2426
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6249
+jal ra,-2430
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-56(gp)
+sw t0,8(sp)
+jal ra,6178
+jal ra,-2394
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2398
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2446
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6293
+lw t0,-736(gp)
+sw t0,-4(s0)
+jal zero,25
+lw t0,-12(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-368
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4278
+jal zero,12
+jal ra,-2421
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2425
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2473
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6202
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2347
+jal zero,-168
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,91
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2160
+addi t0,a0,0
+beq t0,zero,76
+lw t0,-500(gp)
+sw t0,-8(s0)
+jal ra,-3706
+jal ra,82
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1560
+lw t0,-8(s0)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2482
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2486
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2534
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6173
+jal zero,36
+lw t0,-8(s0)
+lw t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2500
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2504
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2552
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6187
+jal zero,18
+lw t0,-8(s0)
+lw t1,-380(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2518
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2522
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2570
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6201
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2444
+jal zero,-77
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+jal ra,-1930
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-1860
+lw t0,-500(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15212
+jal zero,2
+jal ra,-3812
+jal zero,-18
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3822
+jal ra,-2457
+addi t0,a0,0
+beq t0,zero,8
+lw t0,-748(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1222
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,11
+jal ra,-571
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1863
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,221
+lw t0,-500(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sw t0,-12(s0)
+addi t0,zero,1
+sw t0,-496(gp)
+jal ra,-3853
+addi t0,zero,0
+sw t0,-496(gp)
+jal zero,3
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-500(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sw t0,-16(s0)
+jal ra,-3867
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-500(gp)
+lw t1,-336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-3877
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1905
+jal ra,-1388
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1912
+jal ra,-2720
+lw t0,-8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2696
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-56(gp)
+sw t0,8(sp)
+jal ra,5912
+jal zero,10
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-60(gp)
+sw t0,8(sp)
+jal ra,5902
+lw t0,-736(gp)
+sw t0,-8(s0)
+jal zero,83
+jal ra,-2262
+addi t0,a0,0
+beq t0,zero,5
+jal ra,397
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,76
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lw t0,-476(gp)
+sw t0,-20(s0)
+jal ra,-3933
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,32
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1679
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-2783
+lw t0,-8(s0)
+lw t1,-744(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+jal ra,-2758
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-904(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5850
+jal zero,10
+jal ra,-2768
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5840
+jal zero,23
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3984
+jal ra,-723
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2015
+jal zero,8
+jal ra,-2055
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,181
+lw t0,-736(gp)
+sw t0,-8(s0)
+lw t0,-16(s0)
+beq t0,zero,24
+lw t0,-8(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-740(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-1852
+jal ra,-2813
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2817
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,6016
+lw t0,-736(gp)
+sw t0,-8(s0)
+lw t0,-12(s0)
+beq t0,zero,24
+lw t0,-8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-736(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-1877
+lw t0,-736(gp)
+sw t0,-8(s0)
+jal ra,-2840
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+jal ra,-2846
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,5829
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-7476
+addi t0,a0,0
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,5727
+jal zero,17
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1322
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,5710
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-484(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-720(gp)
+sw t0,4(sp)
+jal ra,-3194
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+lw t0,-1548(gp)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-1548(gp)
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-484(gp)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+lw t0,8(s0)
+sw t0,20(sp)
+lw t0,-1548(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-3392
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1548(gp)
+sub t0,zero,t0
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+jal ra,6273
+lw t0,-1520(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1520(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1232
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-7585
+addi t0,a0,0
+beq t0,zero,10
+jal ra,-3022
+jal ra,-2992
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-129
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14955
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+jal ra,-3022
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14948
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3032
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,5611
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-488(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-724(gp)
+sw t0,4(sp)
+jal ra,-3323
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lw t0,-1548(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-488(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7316
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-5198
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1548(gp)
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-488(gp)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-724(gp)
+sw t0,12(sp)
+lw t0,-740(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1548(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-3537
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6167
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+lw t0,-804(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-804(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-2939
+addi t0,a0,0
+beq t0,zero,10
+lw t0,-492(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-151
+jal ra,-1684
+lw t0,-736(gp)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+lw t0,-500(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-100
+jal ra,-4342
+lw t0,-740(gp)
+addi a0,t0,0
+jal zero,11
+jal zero,9
+jal ra,-2409
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-173
+lw t0,-736(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-500(gp)
+lw t1,-316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+jal ra,-4373
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,97
+jal ra,-4380
+jal ra,-1119
+lw t0,-1536(gp)
+sw t0,-4(s0)
+jal ra,-3184
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5744
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3063
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+jal ra,-4403
+lw t0,-500(gp)
+lw t1,-356(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4410
+jal ra,-2724
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1741
+jal zero,-4
+lw t0,-360(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2415
+jal zero,2
+jal ra,-1748
+lw t0,-500(gp)
+lw t1,-320(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-4428
+lw t0,-1536(gp)
+sw t0,-8(s0)
+lw t0,-864(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,5730
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5812
+lw t0,-500(gp)
+lw t1,-356(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4447
+jal ra,-2761
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1778
+jal zero,-4
+lw t0,-360(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2452
+jal zero,2
+jal ra,-1785
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,5842
+jal zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5783
+jal zero,5
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2578
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2583
+jal zero,5
+lw t0,-316(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2588
+lw t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-816(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1536(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-500(gp)
+lw t1,-332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+jal ra,-4511
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+jal ra,-4518
+jal ra,-1257
+lw t0,-1536(gp)
+sw t0,-8(s0)
+jal ra,-3322
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5606
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3201
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-4541
+lw t0,-500(gp)
+lw t1,-356(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4548
+jal ra,-2862
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1879
+jal zero,-4
+lw t0,-360(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2553
+jal zero,2
+jal ra,-1886
+jal zero,5
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2668
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2673
+jal zero,5
+lw t0,-332(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2678
+lw t0,-864(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t1,-1536(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,5584
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5661
+lw t0,-812(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-812(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-392
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7503
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-400
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7637
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-428
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7523
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-436
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7657
+addi t0,a0,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-464
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7543
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-472
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7677
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-480
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7577
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,60
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-496
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7591
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-516
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7609
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-540
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7623
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-564
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7637
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,5040
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-868(gp)
+sw t0,8(sp)
+jal ra,5303
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,5023
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-896(gp)
+sw t0,8(sp)
+jal ra,5286
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5007
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lw t0,8(s0)
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-8217
+addi t0,a0,0
+beq t0,zero,11
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,4985
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-592
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5452
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16246
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-896(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4950
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5164
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,4934
+lw t0,-868(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5148
+lw t0,-72(gp)
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-8295
+addi t0,a0,0
+beq t0,zero,12
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,4906
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-620
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5531
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16325
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-768(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-500(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,104
+jal ra,-4947
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,96
+jal ra,-3587
+addi t0,a0,0
+beq t0,zero,88
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2465
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2601
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+lw t1,-72(gp)
+mul t0,t0,t1
+lw t1,-8(s0)
+addi t2,zero,1
+sub t1,t1,t2
+lw t2,-72(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-15584
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3265
+addi t0,a0,0
+beq t0,zero,50
+jal ra,-4989
+lw t0,-500(gp)
+lw t1,-412(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4996
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,38
+jal ra,-3634
+addi t0,a0,0
+beq t0,zero,31
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2512
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2648
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+lw t1,-72(gp)
+mul t0,t0,t1
+lw t1,-8(s0)
+addi t2,zero,1
+sub t1,t1,t2
+lw t2,-72(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-15633
+jal zero,5
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3140
+jal zero,-54
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3065
+jal zero,5
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3150
+jal zero,2
+jal ra,-5048
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3157
+lw t0,-4(s0)
+beq t0,zero,4
+lw t0,-8(s0)
+sub t0,zero,t0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-728(gp)
+sw t0,4(sp)
+jal ra,-4141
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+lw t0,-8(s0)
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-4334
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,17
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15877
+addi t0,a0,0
+lw t1,-748(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15749
+lw t0,-500(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15899
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15908
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2978
+jal ra,-5139
+jal zero,208
+lw t0,-500(gp)
+lw t1,-356(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,201
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4128
+addi t0,a0,0
+beq t0,zero,72
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-15828
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15938
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15947
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-3017
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15819
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15925
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15934
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,5146
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-15810
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-832(gp)
+sw t0,4(sp)
+jal ra,-8103
+addi t0,a0,0
+beq t0,zero,3
+lw t0,-504(gp)
+sw t0,-1524(gp)
+lw t0,-800(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-800(gp)
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-551
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9190
+addi t0,a0,0
+beq t0,zero,18
+lui t0,0xFFFFF
+addi t0,t0,-220
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-5882
+lui t0,0xFFFFF
+addi t0,t0,-660
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-6312
+addi sp,sp,4
+jal ra,-5251
+addi t0,zero,0
+sw t0,-16(s0)
+jal ra,-3888
+addi t0,a0,0
+beq t0,zero,20
+lw t0,-16(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-16(s0)
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2770
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,-2907
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3298
+jal zero,-21
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-516
+lw t0,-12(s0)
+sw t0,-784(gp)
+addi t0,zero,0
+sw t0,-788(gp)
+lw t0,12(s0)
+sw t0,-792(gp)
+jal ra,-3599
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2616
+jal zero,-4
+addi t0,zero,0
+sw t0,-792(gp)
+lw t0,12(s0)
+lw t1,-744(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4511
+lw t0,-788(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,5037
+addi t0,zero,0
+sw t0,-788(gp)
+lw t0,-4(s0)
+beq t0,zero,11
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sub t0,zero,t0
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-474
+jal zero,9
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-483
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4851
+lw t0,-360(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3369
+jal zero,2
+jal ra,-3409
+addi t0,zero,0
+sw t0,-784(gp)
+addi t0,zero,0
+sw t0,-768(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-780(gp)
+sw t0,-4(s0)
+lw t0,-780(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,4438
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-4184
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4700
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4058
+jal zero,-26
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-780(gp)
+lw t1,8(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-4243
+jal ra,-4213
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4617
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,4387
+jal zero,-22
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16278
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-672
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8344
+addi t0,a0,0
+beq t0,zero,3
+jal ra,469
+jal zero,24
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-680
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8356
+addi t0,a0,0
+beq t0,zero,3
+jal ra,574
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-688
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8368
+addi t0,a0,0
+beq t0,zero,2
+jal ra,667
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16262
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3482
+lw t0,-748(gp)
+sw t0,-4(s0)
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-456(gp)
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+lw t0,16(s0)
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-4770
+lw t0,-868(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,4630
+jal zero,81
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16317
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16285
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-16161
+lw t0,-868(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,4601
+jal zero,52
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16308
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3976
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2229
+addi t0,a0,0
+lw t1,-1156(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-868(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16329
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,4572
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-16206
+jal zero,13
+lw t0,-868(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16350
+addi t0,a0,0
+lw t1,-1536(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,4549
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-5634
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-732(gp)
+sw t0,4(sp)
+jal ra,-4711
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-215
+addi t0,a0,0
+addi a0,t0,0
+jal zero,178
+jal ra,-297
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-4240
+addi t0,a0,0
+beq t0,zero,65
+jal ra,-2399
+lw t0,-1536(gp)
+sw t0,-12(s0)
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4145
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-4477
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4407
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4351
+addi t0,zero,1
+sw t0,-16(s0)
+lw t0,-500(gp)
+lw t1,-340(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5693
+jal ra,-2432
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-4502
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4382
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4376
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-27
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+lw t1,-72(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sw t0,4(sp)
+jal ra,4661
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,82
+jal ra,-5733
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-728(gp)
+sw t0,4(sp)
+jal ra,-4810
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+jal ra,-252
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16517
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9341
+addi t0,a0,0
+beq t0,zero,32
+lw t0,-20(s0)
+sub t0,zero,t0
+sw t0,-20(s0)
+lw t0,-16(s0)
+lw t1,-20(s0)
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-16(s0)
+lw t1,-20(s0)
+sub t0,t0,t1
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,4027
+jal zero,11
+lw t0,-16(s0)
+lw t1,-20(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-724
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6414
+jal zero,12
+lw t0,-16(s0)
+lw t1,-20(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-776
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6426
+jal zero,7
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3921
+lw t0,-736(gp)
+sw t0,-24(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-420
+lw t0,-820(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-820(gp)
+lw t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-328(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3871
+lw t0,-500(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-2591
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-792(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-792(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-3706
+lw t0,-792(gp)
+lw t1,-744(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4675
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3936
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4551
+jal zero,20
+lw t0,-792(gp)
+lw t1,-744(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lw t0,-792(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-744(gp)
+sw t0,4(sp)
+jal ra,-3736
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3912
+lw t0,-864(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-788(gp)
+sw t0,4(sp)
+jal ra,4256
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t0,t1
+sw t0,-788(gp)
+lw t0,-824(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-824(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-784(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16695
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9517
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9907
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-820
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6570
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+lw t0,-476(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5002
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+jal ra,-5974
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-5981
+addi t0,zero,2
+lw t1,-72(gp)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-784(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16747
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-72(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1821
+jal ra,-4800
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-896(gp)
+sw t0,4(sp)
+jal ra,-4806
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3837
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16754
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-4819
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4065
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4693
+jal zero,6
+lw t0,-476(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4001
+jal ra,-6032
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4141
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+lw t0,-476(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5099
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+jal ra,-6071
+lw t0,-500(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-6078
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16820
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-4916
+jal ra,-4886
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-896(gp)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,3944
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4898
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3935
+jal ra,-4904
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4908
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,3703
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-4919
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3965
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4793
+jal zero,5
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4235
+jal zero,6
+lw t0,-476(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4106
+jal ra,-6137
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4246
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-784(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16914
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9736
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10126
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-864
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6789
+lw t0,-500(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-6182
+lw t0,-352(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4210
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4295
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-5033
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,3604
+jal ra,-5013
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,3595
+jal ra,-5022
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-5028
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3743
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-5037
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3638
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4911
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-4966
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,3553
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-4980
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3638
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,21
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,3481
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-9
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1304(gp)
+sw t0,-1532(gp)
+lw t0,-1536(gp)
+lw t1,-72(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,3454
+lw t0,-1532(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-7248
+addi t0,a0,0
+sw t0,-1544(gp)
+lw t0,-1544(gp)
+lw t1,-1548(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1536(gp)
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-1536(gp)
+jal ra,-5252
+addi t0,a0,0
+beq t0,zero,10
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3470
+jal zero,185
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10202
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10213
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2199
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6998
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17792
+lw t0,-876(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-5194
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3417
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5070
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3405
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1596(gp)
+sw t0,8(sp)
+jal ra,3397
+jal ra,3802
+lw t0,-904(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-229
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1596(gp)
+sw t0,8(sp)
+jal ra,3382
+jal ra,3787
+lw t0,-836(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-716(gp)
+sw t0,4(sp)
+jal ra,-5512
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17166
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17192
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-904(gp)
+sw t0,8(sp)
+jal ra,3628
+jal ra,-5291
+jal ra,-5261
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3569
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,3338
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-5284
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3600
+jal ra,-5288
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,2
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,3318
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-5304
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3580
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5178
+lw t0,-832(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-728(gp)
+sw t0,4(sp)
+jal ra,-5588
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-832(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17285
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1034
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,3276
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-904(gp)
+sw t0,8(sp)
+jal ra,3539
+lw t0,-1456(gp)
+lw t1,-1536(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sw t0,-1456(gp)
+lw t0,-8(s0)
+sw t0,-1536(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-112(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-17957
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-9929
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-16(s0)
+addi t0,zero,1
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+sw t0,-504(gp)
+lw t0,-504(gp)
+sw t0,-1524(gp)
+jal ra,-16623
+lw t0,-1296(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7320
+addi t0,a0,0
+sw t0,-1528(gp)
+lw t0,-1300(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7326
+addi t0,a0,0
+sw t0,-1540(gp)
+lw t0,-1296(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7338
+addi t0,a0,0
+sw t0,-1552(gp)
+lw t0,-1300(gp)
+lw t1,-72(gp)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7348
+addi t0,a0,0
+sw t0,-1556(gp)
+jal ra,-17216
+jal ra,-16631
+jal ra,-372
+jal ra,5936
+jal ra,6049
+jal ra,6756
+jal ra,7136
+jal ra,7513
+jal ra,8088
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,6
+jal ra,25046
+jal ra,25093
+lw t0,-1536(gp)
+sw t0,-16(s0)
+jal ra,25138
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-672
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9689
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-732(gp)
+sw t0,12(sp)
+lw t0,-744(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5927
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-680
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9711
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-732(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5949
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9733
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-732(gp)
+sw t0,12(sp)
+lw t0,-744(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5971
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-832(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5987
+lw t0,-4(s0)
+beq t0,zero,264
+jal ra,40398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,253
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,40417
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-10041
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,234
+jal ra,40431
+addi t0,a0,0
+sw t0,-504(gp)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-996
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-7862
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1060
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-504(gp)
+sw t0,8(sp)
+lw t0,-76(gp)
+sw t0,12(sp)
+lw t0,-24(gp)
+sw t0,16(sp)
+jal ra,-7879
+addi sp,sp,16
+lw t0,-504(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-256
+addi t0,a0,0
+sw t0,-508(gp)
+lw t0,-508(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-10402
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-504(gp)
+sw t0,8(sp)
+jal ra,-7906
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18252
+jal ra,-17746
+jal ra,-17396
+jal ra,-17023
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1560(gp)
+sw t0,4(sp)
+jal ra,-16935
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-504(gp)
+sw t0,4(sp)
+jal ra,-16928
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-16917
+lw t0,-12(s0)
+sw t0,-1560(gp)
+jal ra,-4672
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-16909
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-7955
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1240
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-456(gp)
+sw t0,12(sp)
+lw t0,-464(gp)
+sw t0,16(sp)
+jal ra,-7972
+addi sp,sp,16
+lui t0,0xFFFFF
+addi t0,t0,-1300
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-452(gp)
+lw t1,-460(gp)
+sub t0,t0,t1
+sw t0,8(sp)
+lw t0,-452(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+lw t1,-460(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-9117
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-452(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+lw t1,-460(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-9099
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-468(gp)
+sw t0,20(sp)
+jal ra,-8009
+addi sp,sp,20
+lui t0,0xFFFFF
+addi t0,t0,-1364
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-796(gp)
+sw t0,8(sp)
+lw t0,-800(gp)
+sw t0,12(sp)
+lw t0,-804(gp)
+sw t0,16(sp)
+jal ra,-8026
+addi sp,sp,16
+lui t0,0xFFFFF
+addi t0,t0,-1428
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-808(gp)
+sw t0,8(sp)
+lw t0,-812(gp)
+sw t0,12(sp)
+lw t0,-816(gp)
+sw t0,16(sp)
+lw t0,-820(gp)
+sw t0,20(sp)
+lw t0,-824(gp)
+sw t0,24(sp)
+jal ra,-8047
+addi sp,sp,24
+lw t0,-472(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+addi t0,t0,-1500
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-472(gp)
+sw t0,8(sp)
+lw t0,-504(gp)
+sw t0,12(sp)
+jal ra,-8067
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18413
+jal zero,-264
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1544
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-504(gp)
+sw t0,8(sp)
+jal ra,-8093
+addi sp,sp,8
+jal ra,3515
+jal ra,-731
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,5
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,24805
+lw t0,-772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-8118
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1604
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-772(gp)
+sw t0,8(sp)
+lw t0,-776(gp)
+lw t1,-772(gp)
+divu t0,t0,t1
+sw t0,12(sp)
+jal ra,-8135
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1692
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-8146
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1764
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1536(gp)
+lw t1,-1548(gp)
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-1548(gp)
+sw t0,16(sp)
+jal ra,-8169
+addi sp,sp,16
+jal ra,1889
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-8181
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-8192
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1508(gp)
+sw t0,8(sp)
+lw t0,-1508(gp)
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,12(sp)
+jal ra,-8209
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+lw t0,-1516(gp)
+sw t0,12(sp)
+jal ra,-8224
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1920
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1520(gp)
+sw t0,8(sp)
+lw t0,-1520(gp)
+lw t1,-72(gp)
+mul t0,t0,t1
+sw t0,12(sp)
+jal ra,-8241
+addi sp,sp,12
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-992(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-8284
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-872(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+lw t1,-896(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,8(s0)
+lw t1,-868(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-876(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-904(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,8(s0)
+lw t1,-932(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-884(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+lw t0,8(s0)
+lw t1,-892(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+lw t0,8(s0)
+lw t1,-976(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1672(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-36(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1672(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1672(t1)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,12(s0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-64(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+jal ra,15949
+lui t0,0xFFFFF
+addi t0,t0,-1964
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8500
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-236
+jal ra,-9386
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1940(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,16971
+jal zero,21
+jal ra,15928
+lui t0,0xFFFFF
+addi t0,t0,-2004
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8521
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-257
+jal ra,-9407
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1944(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,16950
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-114
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-76(gp)
+sw t0,4(sp)
+jal ra,-10815
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-36(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1668(t1)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-24(gp)
+lw t1,-76(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+sw t0,4(sp)
+jal ra,-80
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-10986
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11552
+addi t0,a0,0
+beq t0,zero,43
+lui t0,0xFFFFF
+addi t0,t0,-2020
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-456(gp)
+sw t0,4(sp)
+jal ra,-8244
+lui t0,0xFFFFE
+addi t0,t0,2040
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11464
+addi t0,a0,0
+sub t0,zero,t0
+sw t0,8(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11473
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,12(sp)
+jal ra,-8693
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19039
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11367
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11375
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11383
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11391
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11399
+addi t0,a0,0
+lw t1,28(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,28
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11375
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11397
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,15
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11419
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,3
+sw t0,8(sp)
+jal ra,-11441
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11463
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11485
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-142
+addi t0,a0,0
+sw t0,-1276(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-128
+addi t0,a0,0
+sw t0,-1260(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-114
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-100
+addi t0,a0,0
+sw t0,-1272(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-86
+addi t0,a0,0
+sw t0,-1264(gp)
+addi t0,zero,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-312
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11191
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11619
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11627
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11635
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11643
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,12
+sw t0,8(sp)
+jal ra,-11619
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11303
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1276(gp)
+lw t0,-864(gp)
+sw t0,-1260(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-242
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-228
+addi t0,a0,0
+sw t0,-1272(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-214
+addi t0,a0,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+addi t0,a0,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-447
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11326
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11708
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11718
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11774
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11782
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11790
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11798
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11806
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11784
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11794
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11850
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11488
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1276(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-448
+addi t0,a0,0
+sw t0,-1260(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-434
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-420
+addi t0,a0,0
+sw t0,-1272(gp)
+lw t0,-864(gp)
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+addi t0,a0,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-633
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-11512
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11894
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+addi t0,zero,6
+sw t0,8(sp)
+jal ra,-11904
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-11914
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,11
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11924
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,6
+sw t0,4(sp)
+jal ra,-11980
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11988
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11996
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-12004
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-12012
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12020
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-12028
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,31
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12006
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,6
+sw t0,8(sp)
+jal ra,-12016
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-12026
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12036
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12092
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,6
+sw t0,4(sp)
+jal ra,-12100
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-12108
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12116
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-11752
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1276(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-712
+addi t0,a0,0
+sw t0,-1260(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-698
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-684
+addi t0,a0,0
+sw t0,-1272(gp)
+lw t0,-864(gp)
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-130
+addi t0,a0,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-897
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-11776
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12158
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+jal ra,-12168
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,11
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12178
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-12188
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,10
+sw t0,4(sp)
+jal ra,-12244
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12252
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-12260
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-12268
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-12276
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,31
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12254
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+jal ra,-12264
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12274
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-12284
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-12340
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12348
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,10
+sw t0,4(sp)
+jal ra,-12356
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12364
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-12000
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1276(gp)
+lw t0,-864(gp)
+sw t0,-1260(gp)
+lw t0,-864(gp)
+sw t0,-1256(gp)
+addi t0,zero,0
+sw t0,-1272(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-118
+addi t0,a0,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-1132
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-12011
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-12439
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-12447
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,20
+sw t0,8(sp)
+jal ra,-12423
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-12107
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1276(gp)
+lw t0,-864(gp)
+sw t0,-1260(gp)
+lw t0,-864(gp)
+sw t0,-1256(gp)
+addi t0,zero,0
+sw t0,-1272(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1006
+addi t0,a0,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-54
+addi t0,a0,0
+sw t0,-1268(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1452(gp)
+lw t1,-1456(gp)
+add t0,t0,t1
+lw t1,-1460(gp)
+add t0,t0,t1
+lw t1,-1464(gp)
+add t0,t0,t1
+lw t1,-1468(gp)
+add t0,t0,t1
+lw t1,-1472(gp)
+add t0,t0,t1
+lw t1,-1476(gp)
+add t0,t0,t1
+lw t1,-1480(gp)
+add t0,t0,t1
+lw t1,-1484(gp)
+add t0,t0,t1
+lw t1,-1488(gp)
+add t0,t0,t1
+lw t1,-1492(gp)
+add t0,t0,t1
+lw t1,-1496(gp)
+add t0,t0,t1
+lw t1,-1500(gp)
+add t0,t0,t1
+lw t1,-1504(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1852(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1848(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1840(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1836(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1828(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1824(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1820(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1816(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1812(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1808(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1804(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,2016
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,14437
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-11121
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-131
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-11102
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-10010
+addi sp,sp,16
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1928(t0)
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,2000
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-11165
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-11145
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-10053
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10074
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,1956
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10085
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1928(t0)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10096
+jal ra,-10978
+lui t0,0xFFFFE
+addi t0,t0,1928
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10107
+addi sp,sp,4
+lw t0,-1452(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1852(t0)
+sw t0,4(sp)
+lw t0,-1936(gp)
+sw t0,8(sp)
+jal ra,-101
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10124
+lw t0,-1456(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1848(t0)
+sw t0,4(sp)
+lw t0,-1940(gp)
+sw t0,8(sp)
+jal ra,-117
+jal ra,-11016
+lui t0,0xFFFFE
+addi t0,t0,1908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10145
+addi sp,sp,4
+lw t0,-1484(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+sw t0,4(sp)
+lw t0,-1968(gp)
+sw t0,8(sp)
+jal ra,-139
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10162
+lw t0,-1488(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1816(t0)
+sw t0,4(sp)
+lw t0,-1972(gp)
+sw t0,8(sp)
+jal ra,-155
+jal ra,-11054
+lui t0,0xFFFFE
+addi t0,t0,1892
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10183
+addi sp,sp,4
+lw t0,-1460(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+lw t0,-1944(gp)
+sw t0,8(sp)
+jal ra,-177
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10200
+lw t0,-1464(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+sw t0,4(sp)
+lw t0,-1948(gp)
+sw t0,8(sp)
+jal ra,-193
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10216
+lw t0,-1468(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+sw t0,4(sp)
+lw t0,-1952(gp)
+sw t0,8(sp)
+jal ra,-209
+jal ra,-11108
+lui t0,0xFFFFE
+addi t0,t0,1892
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10237
+addi sp,sp,4
+lw t0,-1472(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+sw t0,4(sp)
+lw t0,-1956(gp)
+sw t0,8(sp)
+jal ra,-231
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10254
+lw t0,-1476(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+sw t0,4(sp)
+lw t0,-1960(gp)
+sw t0,8(sp)
+jal ra,-247
+jal ra,-11146
+lui t0,0xFFFFE
+addi t0,t0,1876
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10275
+addi sp,sp,4
+lw t0,-1480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1824(t0)
+sw t0,4(sp)
+lw t0,-1964(gp)
+sw t0,8(sp)
+jal ra,-269
+jal ra,-11168
+lui t0,0xFFFFE
+addi t0,t0,1860
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10297
+addi sp,sp,4
+lw t0,-1492(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1812(t0)
+sw t0,4(sp)
+lw t0,-1976(gp)
+sw t0,8(sp)
+jal ra,-291
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10314
+lw t0,-1496(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1808(t0)
+sw t0,4(sp)
+lw t0,-1980(gp)
+sw t0,8(sp)
+jal ra,-307
+lui t0,0xFFFFE
+addi t0,t0,1924
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10330
+lw t0,-1500(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1804(t0)
+sw t0,4(sp)
+lw t0,-1984(gp)
+sw t0,8(sp)
+jal ra,-323
+jal ra,-11222
+lui t0,0xFFFFE
+addi t0,t0,1844
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-10351
+addi sp,sp,4
+lw t0,-1504(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1988(gp)
+sw t0,4(sp)
+jal ra,-384
+jal ra,-11240
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-52(gp)
+sw t0,8(sp)
+jal ra,-12980
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+lw t0,-52(gp)
+sw t0,8(sp)
+jal ra,-13002
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-12(gp)
+beq t0,zero,53
+lw t0,-16(gp)
+beq t0,zero,13
+lw t0,16(s0)
+beq t0,zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,50
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,t0,0
+jal zero,28
+jal zero,15
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-12(gp)
+beq t0,zero,109
+lw t0,-16(gp)
+beq t0,zero,13
+lw t0,16(s0)
+beq t0,zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+jal zero,104
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-48(gp)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,-13188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,-12781
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,40
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,-13224
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-48(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-181
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,10
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1528(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-216
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1296(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1816
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10202
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20996
+lw t0,-1528(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-183
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1528(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-276
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1540(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-298
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1300(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1788
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10284
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21078
+lw t0,-1540(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-265
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1536(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-130
+lw t0,-1552(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-1552(gp)
+lw t1,-1536(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1552(gp)
+lw t1,-1536(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-456(gp)
+sw t1,0(t0)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,-1536(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1164(gp)
+sw t0,8(sp)
+lw t0,-864(gp)
+sw t0,12(sp)
+lw t0,-1132(gp)
+sw t0,16(sp)
+jal ra,-1880
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-31
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-1144(gp)
+sw t0,8(sp)
+jal ra,-1101
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-114
+lw t0,-1452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1452(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1168(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1132(gp)
+sw t0,16(sp)
+jal ra,-1951
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-144
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1224(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1172(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2221
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-176
+lw t0,-1460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1460(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1232(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1176(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2253
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-208
+lw t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1464(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1228(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1180(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2285
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-240
+lw t0,-1468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1236(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1184(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2317
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-272
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1240(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1188(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2349
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-304
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1244(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1192(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1140(gp)
+sw t0,20(sp)
+jal ra,-2381
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-336
+lw t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1480(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1196(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1128(gp)
+sw t0,16(sp)
+jal ra,-2175
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-368
+jal zero,17
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1204(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1128(gp)
+sw t0,16(sp)
+jal ra,-2192
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-385
+lw t0,-1484(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1484(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1200(gp)
+sw t0,12(sp)
+lw t0,-1136(gp)
+sw t0,16(sp)
+jal ra,-2090
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+jal zero,17
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1208(gp)
+sw t0,12(sp)
+lw t0,-1136(gp)
+sw t0,16(sp)
+jal ra,-2107
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-434
+lw t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1488(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1212(gp)
+sw t0,12(sp)
+lw t0,-1148(gp)
+sw t0,16(sp)
+jal ra,-1951
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-464
+lw t0,-1492(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1492(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-1156(gp)
+sw t0,8(sp)
+jal ra,-1713
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-490
+lw t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1496(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1216(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1152(gp)
+sw t0,16(sp)
+jal ra,-2327
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-520
+lw t0,-1500(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1500(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1248(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1220(gp)
+sw t0,8(sp)
+lw t0,-864(gp)
+sw t0,12(sp)
+lw t0,-1160(gp)
+sw t0,16(sp)
+jal ra,-2357
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-550
+lw t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1504(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-711
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+lw t1,8(s0)
+sub t0,t0,t1
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2556
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2540
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2524
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2486
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-2095
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-727
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-765
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,8(s0)
+sub t0,t0,t1
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2544
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2528
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1873
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-769
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-812
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1791
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-68
+lw t0,-4(s0)
+sw t0,8(s0)
+jal zero,-23
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-843
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2664
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2648
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2632
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2616
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-2545
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-857
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1300(gp)
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-794
+lw t0,-1556(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-1556(gp)
+lw t1,-1300(gp)
+lw t2,12(s0)
+add t1,t1,t2
+lw t2,-72(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21312
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13536
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-11418
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-1163
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21254
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21338
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-91
+lw t0,-8(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-34
+lw t0,-1512(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1512(gp)
+lw t0,-1516(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-1516(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1548(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1300(gp)
+lw t1,-1548(gp)
+sub t0,t0,t1
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-937
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-918
+lw t0,-1556(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,-1556(gp)
+lw t1,-4(s0)
+lw t2,-72(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1556(gp)
+lw t2,-1300(gp)
+lw t3,-1548(gp)
+sub t2,t2,t3
+lw t3,-4(s0)
+add t2,t2,t3
+lw t3,-72(gp)
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-4(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-47
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+sw t0,-4(s0)
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-1888(gp)
+sltu t0,t1,t0
+beq t0,zero,17
+lw t0,12(s0)
+lw t1,-1888(gp)
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,-4(s0)
+lw t1,-1888(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+jal zero,-19
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-4(s0)
+lw t1,12(s0)
+addi t2,zero,1
+sub t1,t1,t2
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11388
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-82
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1396(gp)
+lw t1,-1404(gp)
+lw t2,-1400(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1304(gp)
+sw t0,-1380(gp)
+addi t0,zero,2
+sw t0,-1404(gp)
+lw t0,-1280(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-55
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1324(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1328(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-14464
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1332(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14476
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1336(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+jal ra,-14488
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1359
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1348(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-14510
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1352(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14522
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1356(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+jal ra,-14534
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1405
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1360(gp)
+sw t0,12(sp)
+jal ra,-1415
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1364(gp)
+sw t0,12(sp)
+jal ra,-1425
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1368(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1372(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14576
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1447
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1376(gp)
+sw t0,12(sp)
+jal ra,-1457
+lw t0,-1344(gp)
+lw t1,-1284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,112
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1380(gp)
+sw t0,12(sp)
+jal ra,-1473
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1384(gp)
+sw t0,12(sp)
+jal ra,-1483
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1388(gp)
+sw t0,12(sp)
+jal ra,-1493
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1392(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1396(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14644
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1400(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+jal ra,-14656
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1527
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,56
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1404(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1408(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14678
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1412(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14690
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1416(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+jal ra,-14702
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1573
+jal zero,107
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1380(gp)
+sw t0,12(sp)
+jal ra,-1584
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,28
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1384(gp)
+sw t0,12(sp)
+jal ra,-1594
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1388(gp)
+sw t0,12(sp)
+jal ra,-1604
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,36
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1392(gp)
+sw t0,12(sp)
+jal ra,-1614
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1396(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1400(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14765
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1636
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,44
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1404(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1408(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14787
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1658
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1412(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1416(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14809
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1680
+lw t0,-1312(gp)
+sw t0,-1420(gp)
+lw t0,-1316(gp)
+sw t0,-1424(gp)
+lw t0,-1280(gp)
+sw t0,-1428(gp)
+lw t0,-1532(gp)
+sw t0,-1432(gp)
+lw t0,-1532(gp)
+sw t0,-1436(gp)
+lw t0,-1536(gp)
+sw t0,-1440(gp)
+lw t0,-1536(gp)
+sw t0,-1444(gp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,41
+lw t0,-1320(gp)
+sw t0,-1424(gp)
+lw t0,-1280(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-12055
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1428(gp)
+lw t0,-1544(gp)
+sw t0,-1432(gp)
+lw t0,-1544(gp)
+sw t0,-1436(gp)
+lw t0,-1548(gp)
+sw t0,-1440(gp)
+lw t0,-1548(gp)
+sw t0,-1444(gp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,11
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1396(gp)
+lw t1,-1400(gp)
+lw t2,12(s0)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1344(gp)
+lw t1,-1284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,0
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1420(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1424(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14911
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1782
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,8
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1428(gp)
+sw t0,12(sp)
+jal ra,-1794
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,16
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1432(gp)
+sw t0,12(sp)
+jal ra,-1806
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,24
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1436(gp)
+sw t0,12(sp)
+jal ra,-1818
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,32
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1440(gp)
+sw t0,12(sp)
+jal ra,-1830
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,40
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1444(gp)
+sw t0,12(sp)
+jal ra,-1842
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1448(gp)
+sw t0,12(sp)
+jal ra,-1854
+jal zero,97
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,0
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1420(gp)
+sw t0,12(sp)
+jal ra,-1867
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,4
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1428(gp)
+sw t0,12(sp)
+jal ra,-1879
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,8
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1432(gp)
+sw t0,12(sp)
+jal ra,-1891
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,12
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1436(gp)
+sw t0,12(sp)
+jal ra,-1903
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,16
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1440(gp)
+sw t0,12(sp)
+jal ra,-1915
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,20
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1444(gp)
+sw t0,12(sp)
+jal ra,-1927
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,24
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1424(gp)
+sw t0,12(sp)
+jal ra,-1939
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,28
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1448(gp)
+sw t0,12(sp)
+jal ra,-1951
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2046
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15068
+addi t0,a0,0
+lw t1,-1324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,84
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15082
+addi t0,a0,0
+lw t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15096
+addi t0,a0,0
+lw t1,-1332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15110
+addi t0,a0,0
+lw t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2112
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15132
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,1
+sw t0,-16(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,12
+lw t0,-8(s0)
+lw t1,-1288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sw t0,-16(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1344(gp)
+lw t1,-1284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,93
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2174
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15194
+addi t0,a0,0
+lw t1,-1396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2196
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15216
+addi t0,a0,0
+lw t1,-1400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2218
+addi t0,a0,0
+sw t0,-1380(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,56
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2228
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15248
+addi t0,a0,0
+sw t0,-1404(gp)
+addi t0,zero,0
+sw t0,-20(gp)
+lw t0,-1380(gp)
+lw t1,-1304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-1404(gp)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sw t0,-20(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,103
+jal zero,98
+lw t0,-1344(gp)
+lw t1,-1288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2272
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15292
+addi t0,a0,0
+lw t1,-1396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2294
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15314
+addi t0,a0,0
+lw t1,-1400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2316
+addi t0,a0,0
+sw t0,-1380(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,44
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2326
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15346
+addi t0,a0,0
+sw t0,-1404(gp)
+addi t0,zero,0
+sw t0,-20(gp)
+lw t0,-1380(gp)
+lw t1,-1304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-1404(gp)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sw t0,-20(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1344(gp)
+lw t1,-1284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,111
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2384
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2394
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2404
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2417
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,56
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2438
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-15458
+addi t0,a0,0
+sw t0,-1420(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2456
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-15476
+addi t0,a0,0
+sw t0,-1424(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2474
+addi t0,a0,0
+sw t0,-1428(gp)
+lw t0,-4(s0)
+sw t0,-1432(gp)
+lw t0,-8(s0)
+sw t0,-1440(gp)
+lw t0,-12(s0)
+sw t0,-1444(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,105
+jal zero,100
+lw t0,-1344(gp)
+lw t1,-1288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2500
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2510
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2520
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2533
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2554
+addi t0,a0,0
+sw t0,-1420(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2564
+addi t0,a0,0
+sw t0,-1428(gp)
+lw t0,-4(s0)
+sw t0,-1432(gp)
+lw t0,-8(s0)
+sw t0,-1440(gp)
+lw t0,-12(s0)
+sw t0,-1444(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2580
+addi t0,a0,0
+sw t0,-1424(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-128(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-23334
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-15306
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+sw t0,-1524(gp)
+lw t0,-1536(gp)
+lw t1,-1548(gp)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,1748
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13062
+addi sp,sp,8
+jal zero,178
+lw t0,-1524(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-136(gp)
+sw t0,4(sp)
+jal ra,-65
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15588
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1704
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13092
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23438
+jal ra,-1318
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1280(gp)
+sw t0,8(sp)
+jal ra,-23436
+addi t0,a0,0
+lw t1,-1280(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1644
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13127
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23473
+lw t0,-1536(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-13000
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-1528(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1476
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1528(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-23482
+addi t0,a0,0
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1588
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13173
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23519
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1540(gp)
+sw t0,4(sp)
+lw t0,-1548(gp)
+sw t0,8(sp)
+jal ra,-23514
+addi t0,a0,0
+lw t1,-1548(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1532
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13205
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23551
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1280(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+lw t1,-1548(gp)
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-76(gp)
+sw t0,16(sp)
+lw t0,-1548(gp)
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-13240
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-44
+lw t0,8(s0)
+sw t0,-1524(gp)
+lw t0,-1524(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5631
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15777
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13281
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23627
+jal ra,-22236
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1036(t0)
+lw t0,-1308(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-1292(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13131
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1292(gp)
+sw t0,4(sp)
+jal ra,-1637
+addi t0,a0,0
+sw t0,-1308(gp)
+lw t0,-1308(gp)
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-23656
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,296
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-891
+addi t0,a0,0
+beq t0,zero,290
+jal ra,-16378
+jal ra,-21233
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-1396(gp)
+addi t1,zero,8
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,-23684
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1396(gp)
+addi t2,zero,8
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,266
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-798
+addi t0,a0,0
+beq t0,zero,260
+addi t0,zero,0
+sw t0,-16(s0)
+addi t0,zero,0
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+addi t0,zero,0
+sw t0,-28(s0)
+lw t0,-8(s0)
+lw t1,-1396(gp)
+add t0,t0,t1
+sw t0,-32(s0)
+addi t0,zero,0
+sw t0,-36(s0)
+lw t0,-36(s0)
+lw t1,-1404(gp)
+sltu t0,t0,t1
+beq t0,zero,67
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-32(s0)
+sw t0,4(sp)
+lw t0,-1400(gp)
+sw t0,8(sp)
+jal ra,-23726
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,-32(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-629
+addi t0,a0,0
+beq t0,zero,36
+lw t0,-1420(gp)
+lw t1,-1312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-1424(gp)
+lw t1,-1316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-1428(gp)
+sw t0,-16(s0)
+lw t0,-1440(gp)
+sw t0,-20(s0)
+lw t0,-1432(gp)
+sw t0,-1532(gp)
+lw t0,-1444(gp)
+sw t0,-1536(gp)
+jal zero,15
+lw t0,-1424(gp)
+lw t1,-1320(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-1428(gp)
+sw t0,-24(s0)
+lw t0,-1440(gp)
+sw t0,-28(s0)
+lw t0,-1432(gp)
+sw t0,-1544(gp)
+lw t0,-1444(gp)
+sw t0,-1548(gp)
+lw t0,-32(s0)
+lw t1,-1400(gp)
+add t0,t0,t1
+sw t0,-32(s0)
+lw t0,-36(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-36(s0)
+jal zero,-69
+lw t0,-20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,172
+lw t0,-20(s0)
+lw t1,-1536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,166
+lw t0,-28(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,162
+lw t0,-16(s0)
+lw t1,-20(s0)
+add t0,t0,t1
+lw t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,154
+lw t0,-8(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,-1528(gp)
+jal ra,-1712
+addi t0,a0,0
+sw t0,-40(s0)
+lw t0,-16(s0)
+lw t1,-20(s0)
+add t0,t0,t1
+lw t1,-40(s0)
+sub t0,t0,t1
+sw t0,-44(s0)
+lw t0,-44(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+lw t1,-1292(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,133
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-44(s0)
+sw t0,8(sp)
+jal ra,-23837
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-15791
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-44(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,107
+lw t0,-40(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-40(s0)
+lw t0,-8(s0)
+lw t1,-24(s0)
+add t0,t0,t1
+sw t0,-1540(gp)
+lw t0,-24(s0)
+lw t1,-28(s0)
+add t0,t0,t1
+lw t1,-40(s0)
+sub t0,t0,t1
+sw t0,-44(s0)
+lw t0,-44(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+lw t1,-1292(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,85
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-44(s0)
+sw t0,8(sp)
+jal ra,-23885
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-15839
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-44(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+lw t0,-40(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-40(s0)
+lui t0,0xFFFFE
+addi t0,t0,1420
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-40(s0)
+sw t0,8(sp)
+jal ra,-13582
+addi sp,sp,8
+lw t0,-20(gp)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,1384
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-20(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,4(sp)
+lw t0,-76(gp)
+sw t0,8(sp)
+jal ra,-13599
+addi sp,sp,8
+jal zero,12
+lui t0,0xFFFFE
+addi t0,t0,1348
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-20(s0)
+sw t0,4(sp)
+lw t0,-76(gp)
+sw t0,8(sp)
+jal ra,-13611
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,1308
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-28(s0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13622
+addi sp,sp,8
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1248
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+jal ra,-13636
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23982
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1240
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15615
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-744(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-11853
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2583
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-2813
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1580(gp)
+sw t0,8(sp)
+jal ra,-2821
+jal ra,-2416
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,1228
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13722
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11285
+lui t0,0xFFFFE
+addi t0,t0,1220
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13732
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19735
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-15985
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-18711
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1212
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15729
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-11967
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2697
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-2927
+lw t0,-908(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2713
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-2943
+lw t0,-912(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2729
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-2959
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1584(gp)
+sw t0,8(sp)
+jal ra,-2967
+jal ra,-2562
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2600
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lw t0,20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-92(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,20(s0)
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,12(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,20(s0)
+sltu t0,t0,t1
+beq t0,zero,237
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,6267
+addi t0,a0,0
+beq t0,zero,212
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,18732
+addi t0,a0,0
+beq t0,zero,187
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6218
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,25241
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19899
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,6268
+addi t0,a0,0
+beq t0,zero,148
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,18752
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,20(s0)
+lw t1,-8(s0)
+lw t2,12(s0)
+sub t1,t1,t2
+sub t0,t0,t1
+lw t1,-72(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+lw t1,-72(gp)
+divu t0,t0,t1
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,20(s0)
+lw t1,-8(s0)
+lw t2,12(s0)
+sub t1,t1,t2
+sub t0,t0,t1
+lw t1,-72(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+lw t1,-72(gp)
+divu t0,t0,t1
+sw t0,-12(s0)
+lw t0,24(s0)
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,24552
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19953
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,6238
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,89
+lw t0,24(s0)
+beq t0,zero,24
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,4310
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-3597
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,5605
+jal zero,17
+lw t0,16(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5576
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-3542
+lw t0,-4(s0)
+beq t0,zero,31
+addi t0,zero,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-72(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,-20(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-16253
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,95
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-20(s0)
+jal zero,-27
+lw t0,-8(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-12(s0)
+jal zero,-91
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1168
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14086
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,58
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1112
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14103
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1072
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14120
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,24
+jal zero,-241
+lw t0,-4(s0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,1020
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14139
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14169
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10902
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14178
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10829
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14187
+lw t0,-912(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10884
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14197
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10874
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20204
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20215
+addi t0,a0,0
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20226
+addi t0,a0,0
+lw t1,-912(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-1564(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,900
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+jal ra,-14252
+addi sp,sp,16
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14119
+addi t0,a0,0
+lw t1,-1608(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14129
+addi t0,a0,0
+sw t0,-1608(gp)
+lw t0,-1608(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14103
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1608(gp)
+sw t0,4(sp)
+jal ra,-2609
+addi t0,a0,0
+sw t0,-1604(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20286
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1604(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-24637
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20309
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-16604
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-1612(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1612(gp)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-16845
+addi t0,a0,0
+beq t0,zero,83
+lw t0,-12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+lw t0,-1604(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1604(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-16975
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1604(gp)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-527
+addi t0,a0,0
+beq t0,zero,6
+lw t0,-1616(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-1616(gp)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20398
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-16646
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20444
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19642
+lw t0,-1564(gp)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,840
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-14449
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14460
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10611
+jal ra,-15346
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16437
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-12675
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3405
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-3635
+lw t0,-908(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3421
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-3651
+lw t0,-912(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3437
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-3667
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1588(gp)
+sw t0,8(sp)
+jal ra,-3675
+jal ra,-3270
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3308
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,812
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14584
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10487
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14593
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10414
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14602
+lw t0,-912(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10469
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14612
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10459
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20619
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20630
+addi t0,a0,0
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20641
+addi t0,a0,0
+lw t1,-912(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-1568(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,712
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+jal ra,-14667
+addi sp,sp,16
+lw t0,-12(s0)
+lw t1,-1608(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,23
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14542
+addi t0,a0,0
+sw t0,-1608(gp)
+lw t0,-1608(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14516
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1608(gp)
+sw t0,4(sp)
+jal ra,-3022
+addi t0,a0,0
+sw t0,-1604(gp)
+lw t0,-1604(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-1620(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1620(gp)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1604(gp)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-860
+addi t0,a0,0
+beq t0,zero,37
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20726
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1604(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-15809
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-16981
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-1624(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-1624(gp)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20762
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-17010
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20808
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-20006
+lw t0,-1568(gp)
+beq t0,zero,33
+lui t0,0xFFFFE
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20811
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-17106
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-14830
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14841
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10230
+jal ra,-15727
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,644
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16818
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-13056
+lw t0,-908(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3786
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4016
+lw t0,-912(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3802
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4032
+lw t0,-916(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3818
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4048
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1600(gp)
+sw t0,8(sp)
+jal ra,-4056
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1592(gp)
+sw t0,8(sp)
+jal ra,-4064
+jal ra,-3659
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3697
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-1113
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,48
+lui t0,0xFFFFE
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14999
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10008
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15008
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9999
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15017
+lw t0,-912(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9990
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15026
+lw t0,-916(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10013
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15036
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10035
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21043
+addi t0,a0,0
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21054
+addi t0,a0,0
+lw t1,-912(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21065
+addi t0,a0,0
+lw t1,-916(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-1628(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1628(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-96(gp)
+sw t0,8(sp)
+jal ra,-127
+addi t0,a0,0
+beq t0,zero,47
+lw t0,-1632(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-96(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17080
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1632(gp)
+lw t0,-8(s0)
+lw t1,-116(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+lw t0,-128(gp)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21112
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-96(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-25445
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21136
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-17384
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21182
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-20380
+lw t0,-1572(gp)
+beq t0,zero,37
+lui t0,0xFFFFE
+addi t0,t0,548
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-96(gp)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lw t0,-12(s0)
+sw t0,16(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21191
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-17486
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-15208
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15219
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9852
+jal ra,-16105
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,540
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17197
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-740(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-13435
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-480
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17219
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-740(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-13457
+lw t0,-1548(gp)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-1548(gp)
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-836(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-716(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1548(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-13478
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25001
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24989
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25071
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3824
+lw t0,-1508(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1508(gp)
+jal ra,-13096
+jal ra,-13066
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4236
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4466
+jal ra,-13083
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-8092
+jal ra,-13121
+jal ra,-13091
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25017
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25042
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-4269
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13111
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-13069
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-4471
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1596(gp)
+sw t0,8(sp)
+jal ra,-4509
+jal ra,-4104
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13130
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4203
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4215
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13110
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4228
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4556
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4248
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25107
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25133
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-904(gp)
+sw t0,8(sp)
+jal ra,-4313
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13204
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4593
+addi t0,zero,2
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13080
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4229
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21290
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,4654
+addi t0,a0,0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,17071
+addi t0,a0,0
+beq t0,zero,25
+lw t0,-1576(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,500
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-15532
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-20544
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,20
+lw t0,-1576(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,452
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-15556
+addi sp,sp,8
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21576
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21378
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-105
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,444
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15608
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9399
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15618
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9389
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21628
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-904(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21644
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21300
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-20536
+jal zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21671
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21704
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-20902
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15703
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9304
+jal ra,-16589
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26031
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26037
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+lw t0,-4(s0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFE
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+lw t0,16(s0)
+sw t0,16(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-16968
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-16948
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-15800
+addi sp,sp,24
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-496
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17772
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-740(gp)
+sw t0,16(sp)
+addi t0,zero,2
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-14010
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4740
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4970
+lw t0,-908(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4756
+lw t0,-872(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-872(gp)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-4986
+lw t0,-932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-1636(gp)
+sw t0,8(sp)
+jal ra,-4994
+jal ra,-4589
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-928(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-5003
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4635
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21620
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-928(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21623
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-928(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1324(t1)
+sw t1,0(t0)
+lw t0,-928(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7325
+lw t0,-1640(gp)
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,372
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21641
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21647
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-15974
+addi sp,sp,12
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFE
+addi t0,t0,340
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15990
+addi sp,sp,4
+jal ra,-16873
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1324(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1864(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,30
+lui t0,0xFFFFE
+addi t0,t0,328
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16021
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8986
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16030
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9041
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16040
+lw t0,-928(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9031
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7508
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7512
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,20001
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,19863
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,20587
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-196
+jal ra,11426
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16103
+lw t0,-928(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8904
+jal ra,-16989
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,20550
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-233
+jal ra,11505
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,19941
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1716(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16008
+addi t0,a0,0
+sw t0,-1720(gp)
+lw t0,-1720(gp)
+lw t1,-1704(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,324
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1720(gp)
+lw t1,-1708(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,316
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1720(gp)
+lw t1,-1712(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,308
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1720(gp)
+lw t1,-1716(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,300
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1728(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16054
+addi t0,a0,0
+sw t0,-1732(gp)
+lw t0,-1732(gp)
+lw t1,-1724(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,292
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1732(gp)
+lw t1,-1728(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,284
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1744(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16082
+addi t0,a0,0
+sw t0,-1748(gp)
+lw t0,-1748(gp)
+lw t1,-1736(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,276
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1748(gp)
+lw t1,-1740(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,268
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-1748(gp)
+lw t1,-1744(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,260
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-18137
+addi t0,a0,0
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,23
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-24
+lui t0,0xFFFFE
+addi t0,t0,236
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-16333
+addi sp,sp,8
+lw t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24821
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24810
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24782
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24720
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24709
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24698
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24687
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1644(gp)
+beq t0,zero,29
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-62
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+lw t0,-1648(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1772(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+lw t0,-1648(gp)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-82
+addi t0,zero,0
+sw t0,-1808(gp)
+addi t0,zero,0
+sw t0,-1812(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25280
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25249
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16292
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-25002
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+jal ra,-24724
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-16(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25193
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25301
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16337
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24555
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16166
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24893
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-25063
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-25052
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,24(s0)
+sw t0,4(sp)
+jal ra,-25041
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24962
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24951
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-137
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25012
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24865
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24854
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-251
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-25480
+addi t0,a0,0
+sw t0,-1768(gp)
+lw t0,-1768(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+lw t0,-1656(gp)
+sw t0,8(sp)
+lw t0,-1664(gp)
+sw t0,12(sp)
+lw t0,-1672(gp)
+sw t0,16(sp)
+jal ra,-85
+jal ra,-25495
+addi t0,a0,0
+sw t0,-1764(gp)
+lw t0,-1764(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+lw t0,-1660(gp)
+sw t0,8(sp)
+lw t0,-1668(gp)
+sw t0,12(sp)
+lw t0,-1676(gp)
+sw t0,16(sp)
+jal ra,-100
+lw t0,-1648(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,53
+jal ra,-25514
+addi t0,a0,0
+sw t0,-1772(gp)
+lw t0,-1772(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+lw t0,-1680(gp)
+sw t0,8(sp)
+lw t0,-1688(gp)
+sw t0,12(sp)
+lw t0,-1696(gp)
+sw t0,16(sp)
+jal ra,-119
+lw t0,-1768(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1772(gp)
+sw t0,4(sp)
+jal ra,-25042
+lw t0,-1764(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1772(gp)
+sw t0,4(sp)
+jal ra,-25048
+lw t0,-1648(gp)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,22
+jal ra,-25545
+addi t0,a0,0
+sw t0,-1776(gp)
+lw t0,-1776(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+lw t0,-1684(gp)
+sw t0,8(sp)
+lw t0,-1692(gp)
+sw t0,12(sp)
+lw t0,-1700(gp)
+sw t0,16(sp)
+jal ra,-150
+lw t0,-1772(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1776(gp)
+sw t0,4(sp)
+jal ra,-25073
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25541
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25510
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25572
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25392
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,44
+lw t0,-8(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24823
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24782
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24737
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24726
+lw t0,-12(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-46
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25218
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1644(gp)
+beq t0,zero,25
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-105
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-109
+lw t0,-1648(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1772(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-117
+lw t0,-1648(gp)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-125
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25671
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25659
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-37
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25714
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25738
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25748
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-47
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25848
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-127
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25834
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25785
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-25488
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1816(gp)
+lui t1,0x196
+addi t1,t1,1549
+mul t0,t0,t1
+lui t1,0x3C6EF
+addi t1,t1,863
+add t0,t0,t1
+sw t0,-1816(gp)
+lw t0,-1816(gp)
+lui t1,0x10
+addi t1,t1,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,1
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,12(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,41
+lw t0,16(s0)
+lw t1,-8(s0)
+lw t2,-12(s0)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+addi t0,zero,2
+lw t1,-4(s0)
+mul t0,t0,t1
+sw t0,-4(s0)
+jal zero,18
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+addi t0,zero,2
+lw t1,-4(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sw t0,-12(s0)
+jal zero,-43
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,1
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,12(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,28
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+beq t0,zero,12
+addi t0,zero,2
+lw t1,-4(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,5
+addi t0,zero,2
+lw t1,-4(s0)
+mul t0,t0,t1
+sw t0,-4(s0)
+lw t0,-12(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sw t0,-12(s0)
+jal zero,-30
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26040
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,12(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25460
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,99
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-34
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26081
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-113
+addi t0,a0,0
+addi a0,t0,0
+jal zero,75
+jal zero,21
+lw t0,-1752(gp)
+lw t1,-1716(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26102
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,54
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26119
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,12(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25486
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25498
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,3
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-44
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25582
+addi t0,a0,0
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25573
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26215
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,12(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,14
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-32
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26245
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-595
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-579
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26282
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26325
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26149
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t0,0(t0)
+sw t0,-20(s0)
+lw t0,-12(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-153
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-134
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26344
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,107
+lw t0,-12(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-24(s0)
+lw t0,20(s0)
+beq t0,zero,95
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26327
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26021
+lw t0,-24(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25708
+addi t0,a0,0
+lw t1,-1804(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26291
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-25991
+lw t0,-24(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25672
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26176
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-25890
+lw t0,-24(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25558
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26428
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+jal ra,-526
+jal zero,16
+lw t0,-1752(gp)
+lw t1,-1712(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-24(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-594
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25660
+lw t0,-16(s0)
+lw t1,-20(s0)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi a0,t0,0
+jal zero,49
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+jal ra,-437
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-12(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-24(s0)
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26485
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+jal ra,-583
+lw t0,-16(s0)
+lw t1,-20(s0)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25757
+lw t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26500
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25899
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-789
+addi t0,a0,0
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1856
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-27
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25878
+addi t0,a0,0
+beq t0,zero,31
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26401
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26111
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25918
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,151
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25774
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,137
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25998
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-129
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-976
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25896
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1804(gp)
+sw t0,4(sp)
+jal ra,-25851
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-920
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25846
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-824
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25890
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25828
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-25949
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+jal ra,-460
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26128
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26678
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26374
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-174
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26634
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26643
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,6
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-102
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,16(s0)
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1756(gp)
+lw t1,-1728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-25998
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26675
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26383
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-100
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1760(gp)
+lw t1,-1740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26861
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,61
+lw t0,-1760(gp)
+lw t1,-1744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,53
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1149
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26655
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1170
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-26383
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26660
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-26385
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1991
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1984
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,16(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+lw t3,-72(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,16(s0)
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-734
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26402
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-436
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-26159
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26814
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26526
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1374
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1248
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-863
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27073
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-26349
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-26308
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-26263
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1644(gp)
+beq t0,zero,31
+lw t0,-1812(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1768(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-100
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-114
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1812(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27150
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26549
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1439
+addi t0,a0,0
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,1221
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-23
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27172
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-538
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26617
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1476
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-16(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27213
+addi t0,a0,0
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1728(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1772(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,10331
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-432
+lw t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27260
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-626
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26705
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1564
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-202
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-548
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27317
+addi t0,a0,0
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1728(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1772(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,10227
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-536
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1764(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-200
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1768(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-222
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1768(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,16(s0)
+sw t0,12(sp)
+jal ra,-158
+lw t0,-1652(gp)
+beq t0,zero,17
+lw t0,-1808(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-444
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1808(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,224
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-18698
+addi sp,sp,12
+lui t0,0xFFFFE
+addi t0,t0,188
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-19835
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-19815
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-19853
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-19833
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-18741
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,172
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27412
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27399
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-18777
+addi sp,sp,16
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,144
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27409
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27396
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27421
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27409
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-19948
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27437
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27425
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-19936
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-18844
+addi sp,sp,24
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-18865
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,100
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-18876
+addi sp,sp,4
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27658
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27646
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,84
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-220
+lui t0,0xFFFFE
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27624
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-18907
+addi sp,sp,4
+jal ra,-19790
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27690
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27678
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,48
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-252
+lui t0,0xFFFFE
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27656
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-18939
+addi sp,sp,4
+lw t0,-1652(gp)
+beq t0,zero,10
+lui t0,0xFFFFE
+addi t0,t0,16
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1808(gp)
+sw t0,4(sp)
+jal ra,-18950
+addi sp,sp,4
+jal ra,-19833
+lui t0,0xFFFFE
+addi t0,t0,-16
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1812(gp)
+sw t0,8(sp)
+jal ra,-18964
+addi sp,sp,8
+lw t0,-1648(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,54
+lui t0,0xFFFFE
+addi t0,t0,-60
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-18979
+addi sp,sp,4
+lw t0,-1772(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27761
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1772(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27749
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,-76
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-323
+jal ra,-19880
+lw t0,-1648(gp)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,20
+lw t0,-1776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27784
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27772
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,-92
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-346
+jal ra,-19903
+lui t0,0xFFFFE
+addi t0,t0,-152
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1720(gp)
+lw t1,-1752(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lw t0,-1732(gp)
+lw t1,-1756(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-1748(gp)
+lw t1,-1760(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,16(sp)
+jal ra,-19053
+addi sp,sp,16
+lui t0,0xFFFFE
+addi t0,t0,-200
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-19064
+addi sp,sp,4
+lw t0,-1768(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,84
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-324
+lw t0,-1648(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,9
+lw t0,-1772(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-76
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-336
+lw t0,-1648(gp)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,9
+lw t0,-1776(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-92
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-348
+lw t0,-1760(gp)
+lw t1,-1736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lui t0,0xFFFFE
+addi t0,t0,-240
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-19112
+addi sp,sp,4
+lw t0,-1768(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,84
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-337
+lw t0,-1764(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,48
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-345
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1820(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-6140
+addi t0,a0,0
+sw t0,-1828(gp)
+lw t0,-1828(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-21663
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-292
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1820(gp)
+sw t0,8(sp)
+jal ra,-19167
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29513
+lw t0,-1792(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19006
+addi t0,a0,0
+sw t0,-1832(gp)
+lw t0,-1832(gp)
+lw t1,-1784(gp)
+sw t1,0(t0)
+lw t0,-1832(gp)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1788(gp)
+sw t1,0(t0)
+lw t0,-1780(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,-1836(gp)
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18840
+addi t0,a0,0
+sw t0,-1840(gp)
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18848
+addi t0,a0,0
+sw t0,-1844(gp)
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18856
+addi t0,a0,0
+sw t0,-1848(gp)
+addi t0,zero,0
+sw t0,-1852(gp)
+addi t0,zero,0
+sw t0,-1856(gp)
+addi t0,zero,0
+sw t0,-1860(gp)
+addi t0,zero,1
+sw t0,-1824(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1828(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1832(gp)
+sw t0,4(sp)
+lw t0,-1836(gp)
+sw t0,8(sp)
+jal ra,-29570
+addi t0,a0,0
+lw t1,-1836(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-344
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1820(gp)
+sw t0,8(sp)
+jal ra,-19261
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29607
+lw t0,-1860(gp)
+lw t1,-1836(gp)
+add t0,t0,t1
+sw t0,-1860(gp)
+addi t0,zero,0
+sw t0,-1836(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1836(gp)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-1832(gp)
+lw t1,-1836(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+jal zero,37
+lw t0,-1832(gp)
+lw t1,-1836(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1832(gp)
+lw t2,-1836(gp)
+addi t3,zero,4
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1836(gp)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-21982
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-1836(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1836(gp)
+lw t0,-1836(gp)
+lw t1,-1792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-117
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+lw t0,8(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+lw t0,8(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sw t0,8(s0)
+jal zero,-18
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-102
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1840(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1848(gp)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-44(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sw t0,-4(s0)
+jal zero,9
+addi t0,zero,0
+lw t1,-4(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,2
+mul t0,t0,t1
+lw t1,8(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-77
+lw t0,-1844(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+lw t0,-1848(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1840(gp)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-1856(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1856(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+lw t1,-1788(gp)
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1852(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1852(gp)
+lw t0,-1844(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,31
+lw t0,-1840(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,-1844(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1844(gp)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-130
+lw t0,-1840(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,-1844(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1844(gp)
+lw t1,-1796(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1796(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-168
+lw t0,-1844(gp)
+lw t1,-1800(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-1800(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-181
+jal ra,-338
+addi t0,zero,0
+sw t0,-1824(gp)
+lui t0,0xFFFFE
+addi t0,t0,-412
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1852(gp)
+sw t0,8(sp)
+lw t0,-1856(gp)
+sw t0,12(sp)
+lw t0,-1860(gp)
+sw t0,16(sp)
+lw t0,-1820(gp)
+sw t0,20(sp)
+jal ra,-19590
+addi sp,sp,20
+addi t0,zero,0
+sw t0,-1820(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1900(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-1900(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22574
+addi t0,a0,0
+beq t0,zero,9
+lw t0,12(s0)
+lw t1,16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,70
+jal zero,68
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,552
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-104
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+lw t1,-1924(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,263
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,-8(s0)
+lw t0,0(t0)
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-1928(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1928(gp)
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,51
+lw t0,-1932(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1932(gp)
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-154
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,28
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-12(s0)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-115
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+lw t1,-1896(gp)
+sltu t0,t0,t1
+beq t0,zero,49
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-244
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-296
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lw t1,-1900(gp)
+mul t0,t0,t1
+sw t0,12(s0)
+jal zero,23
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-269
+addi t0,a0,0
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,11
+jal zero,5
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,12(s0)
+jal zero,-51
+lw t0,-1896(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22868
+addi t0,a0,0
+beq t0,zero,9
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+jal zero,55
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-362
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,17095
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-386
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-385
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1920(gp)
+lw t1,8(s0)
+lw t2,-1916(gp)
+remu t1,t1,t2
+addi t2,zero,2
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1920(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-1916(gp)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19911
+addi t0,a0,0
+sw t0,-1920(gp)
+lw t0,-1920(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1916(gp)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-19819
+lw t0,8(s0)
+sw t0,-1924(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1924(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1888(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1888(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1884(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,8(s0)
+lw t1,12(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-339
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-96
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-471
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+lw t2,-1888(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+lw t1,-1892(gp)
+lw t2,-1888(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-1864(gp)
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-496
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+lw t0,-12(s0)
+sw t0,20(sp)
+jal ra,-20268
+addi sp,sp,20
+lw t0,-12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-73
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-695
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-98
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2020
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-715
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,74
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-142
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,24(s0)
+beq t0,zero,15
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2066
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-762
+jal zero,12
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-785
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,16(s0)
+lw t0,12(s0)
+addi t1,zero,4
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,12(s0)
+lw t1,-1888(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,7
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,20(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,20(s0)
+jal zero,-76
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1824(gp)
+beq t0,zero,7
+lw t0,-1800(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-973
+lw t0,-1644(gp)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-233
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1838
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-183
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1824(gp)
+beq t0,zero,7
+lw t0,-1800(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1019
+lw t0,-1644(gp)
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-279
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-1864
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-206
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1824(gp)
+beq t0,zero,7
+lw t0,-1796(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1062
+lw t0,-1644(gp)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-322
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1949
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-272
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1552(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lw t0,-88(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-504
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1552(gp)
+lw t1,8(s0)
+lw t2,12(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-20559
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20498
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1928(t0)
+beq t0,zero,62
+lw t0,-88(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-520
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+jal ra,-20599
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20538
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-84
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,123
+jal zero,22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-20637
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20575
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,101
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1900(t0)
+beq t0,zero,42
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-532
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-20629
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-143
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-20653
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1908(t0)
+beq t0,zero,47
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-532
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-20674
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-544
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+sw t0,8(sp)
+jal ra,-20702
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-186
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-556
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3611
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12570
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-23058
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-20797
+addi sp,sp,12
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20736
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-564
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20858
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4149
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20878
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4129
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3952
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-23576
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1852(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1852(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1852(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1852(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12347
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1452(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2000(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,2004(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-423
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,-1256(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,-1268(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-568
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21032
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20970
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-584
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3333
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12848
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12854
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1268(gp)
+sw t0,20(sp)
+jal ra,-21075
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21014
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21137
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3934
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21147
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3924
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21167
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3904
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1268(gp)
+sw t0,4(sp)
+jal ra,-12752
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1848(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1848(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1848(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1848(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12624
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-667
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-596
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3130
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13051
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13057
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13063
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-21282
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21221
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21343
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3728
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21352
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3719
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21362
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3709
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12841
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12845
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12828
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1460(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12941
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12945
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1840(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1840(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1840(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1840(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12928
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1464(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13041
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13045
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+mul t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1836(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1836(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1836(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1836(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13028
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1468(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1260(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,86
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13153
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13157
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1832(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1832(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13140
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1956(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,3700
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1260(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,86
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13276
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13280
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+remu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1828(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1828(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1828(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1828(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13263
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1956(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,3577
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13387
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13391
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1824(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1824(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1824(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1824(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13379
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1480(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1422
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-612
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2375
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13806
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1268(gp)
+sw t0,16(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13814
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-22033
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21972
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22106
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2901
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22115
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-1959
+addi t0,a0,0
+beq t0,zero,87
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3000
+addi t0,a0,0
+beq t0,zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1944
+addi t0,a0,0
+beq t0,zero,51
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13808
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-636
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1880
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-22163
+addi sp,sp,8
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-656
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1900
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-22183
+addi sp,sp,8
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2887
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22197
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-732
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22207
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-752
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22217
+addi sp,sp,4
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2073
+addi t0,a0,0
+beq t0,zero,36
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2886
+addi t0,a0,0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-2058
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22259
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2812
+lui t0,0xFFFFE
+addi t0,t0,-768
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-22271
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2138
+addi t0,a0,0
+beq t0,zero,28
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2821
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2123
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2526
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13805
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2200
+addi t0,a0,0
+beq t0,zero,142
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2759
+addi t0,a0,0
+beq t0,zero,127
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2185
+addi t0,a0,0
+beq t0,zero,104
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1966
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1820(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1820(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1820(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1820(t0)
+lw t0,-1264(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-13884
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1484(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1484(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1784(t0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1784(t1)
+lw t2,-12(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2362
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,2989
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2980
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2971
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1923
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-612
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1874
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14307
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1268(gp)
+sw t0,16(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14315
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-22534
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22473
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22607
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2400
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22616
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2455
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22626
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2470
+addi t0,a0,0
+beq t0,zero,83
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2569
+addi t0,a0,0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2455
+addi t0,a0,0
+beq t0,zero,47
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14319
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-788
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2391
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-22674
+addi sp,sp,8
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-804
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2411
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-22694
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22704
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-732
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22714
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-752
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-22724
+addi sp,sp,4
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2580
+addi t0,a0,0
+beq t0,zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2459
+addi t0,a0,0
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2533
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-824
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-22764
+addi sp,sp,4
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2306
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2635
+addi t0,a0,0
+beq t0,zero,25
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2404
+addi t0,a0,0
+beq t0,zero,19
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2478
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2539
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2032
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14299
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-2694
+addi t0,a0,0
+beq t0,zero,158
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2345
+addi t0,a0,0
+beq t0,zero,143
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2419
+addi t0,a0,0
+beq t0,zero,124
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-14440
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2604
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1260(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2440
+jal zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1816(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1816(t0)
+lw t0,-1644(gp)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1260(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2468
+jal zero,9
+lw t0,-1824(gp)
+beq t0,zero,7
+lw t0,-1800(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-3484
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1488(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1780(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2872
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,2479
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2470
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2461
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1992(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2004(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2769
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2480
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-584
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1317
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14864
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14870
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+sw t0,4(sp)
+jal ra,-25619
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-23099
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23038
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1908(t0)
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-832
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-23097
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23192
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1879
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23201
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1870
+lui t0,0xFFFFE
+addi t0,t0,-848
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-23215
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-864
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-23236
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1604
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14725
+lw t0,-1260(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14729
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+lw t2,-1260(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-1268(gp)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1812(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1812(t0)
+lw t0,-1492(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1492(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2726
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-876
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1071
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15110
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+sw t0,4(sp)
+jal ra,-25859
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-23339
+addi sp,sp,12
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23278
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1908(t0)
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-832
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-23337
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-564
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23432
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1570
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23446
+lui t0,0xFFFFE
+addi t0,t0,-888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-23456
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-246
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23478
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1529
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-1268(gp)
+add t1,t1,t2
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1800(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1800(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1796(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1796(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,4734
+jal zero,78
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-26096
+addi t0,a0,0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-1268(gp)
+add t1,t1,t2
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1792(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1792(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1788(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1788(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-1268(gp)
+add t1,t1,t2
+sw t1,1884(t0)
+lw t0,-1268(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1808(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1808(t0)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15038
+lw t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1496(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3071
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-612
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,726
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15455
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1268(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+sw t0,4(sp)
+jal ra,-26204
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15471
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-23690
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23629
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23751
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1256
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23761
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1241
+addi t0,zero,-608
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23775
+lui t0,0xFFFFE
+addi t0,t0,-888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-23785
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15261
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1268(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-26443
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-26473
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1264(gp)
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1804(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1804(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4570
+jal zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-1264(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,4404
+lw t0,-1264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15290
+lw t0,-1500(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1500(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3323
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-88(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,474
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-23920
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23859
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,869
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-932(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15461
+lw t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1504(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-932(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1912(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2000(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,2004(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+jal ra,-24922
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,129
+lw t0,-4(s0)
+lw t1,-1636(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-24072
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1104(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34418
+jal zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-1008
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-24094
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1104(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34440
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,984(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-24116
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1104(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34462
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+jal ra,-8129
+jal zero,45
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15600
+lw t0,-4(s0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lw t0,-4(s0)
+lw t1,-1596(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15614
+lw t0,-912(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15618
+lw t0,-4(s0)
+lw t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-916(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15628
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15549
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,1304
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2000(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,2004(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1992(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2004(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1556(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-504
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1556(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-1536(gp)
+sub t1,t1,t2
+lw t2,-72(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-24209
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-532
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,8(sp)
+jal ra,-24240
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-524
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-24259
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1908(t0)
+beq t0,zero,5
+jal ra,-58
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1072
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-24300
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,17
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1080
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-24317
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-532
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1536(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13711
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-24343
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1992(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1940(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3433
+addi t0,a0,0
+addi a0,t0,0
+jal zero,175
+jal zero,173
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2446
+addi t0,a0,0
+addi a0,t0,0
+jal zero,162
+jal zero,160
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1958
+addi t0,a0,0
+addi a0,t0,0
+jal zero,149
+jal zero,147
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3227
+addi t0,a0,0
+addi a0,t0,0
+jal zero,136
+jal zero,134
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3240
+addi t0,a0,0
+addi a0,t0,0
+jal zero,123
+jal zero,121
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3253
+addi t0,a0,0
+addi a0,t0,0
+jal zero,110
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3266
+addi t0,a0,0
+addi a0,t0,0
+jal zero,97
+jal zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3279
+addi t0,a0,0
+addi a0,t0,0
+jal zero,84
+jal zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3292
+addi t0,a0,0
+addi a0,t0,0
+jal zero,71
+jal zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1493
+addi t0,a0,0
+addi a0,t0,0
+jal zero,58
+jal zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1260
+addi t0,a0,0
+addi a0,t0,0
+jal zero,45
+jal zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-927
+addi t0,a0,0
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1936(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3825
+addi t0,a0,0
+addi a0,t0,0
+jal zero,19
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-701
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,23628
+addi t0,a0,0
+sw t0,-1996(gp)
+lw t0,-1536(gp)
+lw t1,-1548(gp)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-1128
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1996(gp)
+sw t0,8(sp)
+jal ra,-24667
+addi sp,sp,8
+jal zero,180
+lw t0,-1996(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-11670
+addi t0,a0,0
+sw t0,-2000(gp)
+lw t0,-2000(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-27193
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1176
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1996(gp)
+sw t0,8(sp)
+jal ra,-24697
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35043
+lw t0,-1996(gp)
+sw t0,-144(gp)
+lw t0,-2000(gp)
+sw t0,-148(gp)
+jal ra,-34855
+jal ra,-31726
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1928(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1908(t0)
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14123
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+jal ra,1020
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-302
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,548
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-24693
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,-54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-1536(gp)
+sub t0,t0,t1
+lw t1,-1548(gp)
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-449
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-148(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,548
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-24735
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+lw t2,-72(gp)
+add t1,t1,t2
+sw t1,1884(t0)
+jal zero,-39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1908(t0)
+addi t0,zero,0
+sw t0,-144(gp)
+lw t0,-108(gp)
+sw t0,-148(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1284
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-76(gp)
+sw t0,16(sp)
+lw t0,-1548(gp)
+sw t0,20(sp)
+lw t0,-1996(gp)
+sw t0,24(sp)
+jal ra,-24847
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1996(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2004(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1992(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2004(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,2000(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,2000(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2004(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,2000(t0)
+sw t0,-4(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,2004(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1916(t0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,2000(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1996(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,2000(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,2004(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,1884(t0)
+jal ra,673
+jal ra,797
+jal ra,1869
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1912(t0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+jal ra,655
+jal ra,779
+jal ra,1892
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,2000(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,2000(t0)
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1916(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16775
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-25036
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1308
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16807
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-25068
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16748
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-78
+jal zero,32
+lui t0,0xFFFFE
+addi t0,t0,-1324
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16850
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+jal ra,-25120
+addi sp,sp,12
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7306
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1640(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1640(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7341
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1632(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1632(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7361
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1624(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1624(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7226
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1636(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1636(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7261
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1628(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1628(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,7281
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1620(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1620(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-5106
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5180
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,12919
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-25351
+addi sp,sp,4
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1344
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25368
+addi sp,sp,4
+jal zero,109
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1364
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25386
+addi sp,sp,4
+jal zero,91
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1372
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25404
+addi sp,sp,4
+jal zero,73
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1364
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25422
+addi sp,sp,4
+jal zero,55
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1384
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25440
+addi sp,sp,4
+jal zero,37
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1948(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1364
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-25458
+addi sp,sp,4
+jal zero,19
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1388
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25474
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17210
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31265
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1976(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31278
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFE
+addi t0,t0,-1424
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31203
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-25530
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-205
+lui t0,0xFFFFE
+addi t0,t0,-1464
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25543
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31320
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31310
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-229
+jal ra,-26443
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1100(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35907
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-30564
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-30555
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-1424
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31283
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-25610
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-285
+lui t0,0xFFFFE
+addi t0,t0,-1516
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-25627
+addi sp,sp,4
+jal ra,-1186
+jal ra,-26511
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+sw t0,4(sp)
+jal ra,-5488
+addi t0,a0,0
+beq t0,zero,85
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,6726
+addi t0,a0,0
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lw t1,-72(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-5172
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15327
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-5199
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15332
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+jal zero,32
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-251
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14943
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16901
+addi t0,a0,0
+sw t0,-1252(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1876(t0)
+lw t0,-1252(gp)
+lw t1,-1132(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-16752
+lw t0,-1272(gp)
+lw t1,-1168(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1940(gp)
+sw t1,1876(t0)
+jal zero,237
+lw t0,-1252(gp)
+lw t1,-1128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-16770
+lw t0,-16(gp)
+beq t0,zero,12
+lw t0,-1272(gp)
+lw t1,-1196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1968(gp)
+sw t1,1876(t0)
+jal zero,11
+lw t0,-1272(gp)
+lw t1,-1204(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1968(gp)
+sw t1,1876(t0)
+jal zero,206
+lw t0,-1252(gp)
+lw t1,-1136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-16615
+lw t0,-16(gp)
+beq t0,zero,12
+lw t0,-1272(gp)
+lw t1,-1200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1972(gp)
+sw t1,1876(t0)
+jal zero,11
+lw t0,-1272(gp)
+lw t1,-1208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1972(gp)
+sw t1,1876(t0)
+jal zero,175
+lw t0,-1252(gp)
+lw t1,-1140(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+jal ra,-16972
+lw t0,-1272(gp)
+lw t1,-1172(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,-1276(gp)
+lw t1,-1224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1944(gp)
+sw t1,1876(t0)
+jal zero,22
+lw t0,-1276(gp)
+lw t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1948(gp)
+sw t1,1876(t0)
+jal zero,11
+lw t0,-1276(gp)
+lw t1,-1228(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1952(gp)
+sw t1,1876(t0)
+jal zero,51
+lw t0,-1272(gp)
+lw t1,-1184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1276(gp)
+lw t1,-1236(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1956(gp)
+sw t1,1876(t0)
+jal zero,34
+lw t0,-1272(gp)
+lw t1,-1188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1276(gp)
+lw t1,-1240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1960(gp)
+sw t1,1876(t0)
+jal zero,17
+lw t0,-1272(gp)
+lw t1,-1192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-1276(gp)
+lw t1,-1244(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1964(gp)
+sw t1,1876(t0)
+jal zero,78
+lw t0,-1252(gp)
+lw t1,-1148(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-16479
+lw t0,-1272(gp)
+lw t1,-1212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1976(gp)
+sw t1,1876(t0)
+jal zero,60
+lw t0,-1252(gp)
+lw t1,-1156(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-16249
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1980(gp)
+sw t1,1876(t0)
+jal zero,48
+lw t0,-1252(gp)
+lw t1,-1152(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-16959
+lw t0,-1272(gp)
+lw t1,-1216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1984(gp)
+sw t1,1876(t0)
+jal zero,30
+lw t0,-1252(gp)
+lw t1,-1144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-16173
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1936(gp)
+sw t1,1876(t0)
+jal zero,18
+lw t0,-1252(gp)
+lw t1,-1160(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-16989
+lw t0,-1272(gp)
+lw t1,-1220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1988(gp)
+sw t1,1876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1928(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-569
+jal zero,30
+lw t0,-108(gp)
+sw t0,-148(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1596
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+sw t0,12(sp)
+lw t0,-1252(gp)
+sw t0,16(sp)
+jal ra,-26076
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1112(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36422
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31545
+addi t0,a0,0
+lw t1,12(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31992
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1988(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32032
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32027
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1856(t0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1988(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31660
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lw t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,6161
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-146
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-33798
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,19
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t0,t1
+sw t0,16(s0)
+jal zero,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-188
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-33742
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32175
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,45
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-218
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33999
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,20
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34011
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,792
+addi t0,a0,0
+beq t0,zero,2
+jal zero,8
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-33797
+jal zero,-55
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-224
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,124
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34054
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+lw t0,-1644(gp)
+beq t0,zero,3
+jal ra,-740
+jal zero,11
+lw t0,-1824(gp)
+beq t0,zero,9
+lw t0,-1796(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-6921
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34081
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34078
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34067
+addi t0,a0,0
+sw t0,-1264(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34054
+addi t0,a0,0
+sw t0,-1256(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34041
+addi t0,a0,0
+sw t0,-1260(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34028
+addi t0,a0,0
+sw t0,-1268(gp)
+jal zero,54
+jal ra,-801
+jal ra,-677
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29340
+addi t0,a0,0
+beq t0,zero,41
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+sw t0,4(sp)
+jal ra,-34011
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1880(t0)
+sw t0,4(sp)
+jal ra,-34006
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1264(gp)
+sw t0,4(sp)
+jal ra,-33995
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1256(gp)
+sw t0,4(sp)
+jal ra,-33984
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1260(gp)
+sw t0,4(sp)
+jal ra,-33973
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1268(gp)
+sw t0,4(sp)
+jal ra,-33962
+jal zero,3
+jal ra,-852
+jal ra,-728
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,3
+jal ra,161
+jal zero,2
+jal ra,363
+jal zero,152
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1940(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5349
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4200
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3716
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5184
+jal zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5094
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5004
+jal zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4914
+jal zero,70
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4801
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4688
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3359
+jal zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3138
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2844
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1936(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5737
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2664
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1728(t0)
+beq t0,zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2183
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1940(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5796
+jal ra,-5508
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4417
+jal ra,-4360
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3931
+jal ra,-3877
+jal zero,121
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5829
+jal ra,-5346
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5840
+jal ra,-5257
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5851
+jal ra,-5168
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5862
+jal ra,-5079
+jal zero,77
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5873
+jal ra,-4967
+jal zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5884
+jal ra,-4855
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3540
+jal ra,-3527
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5906
+jal ra,-3307
+jal zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5917
+jal ra,-3014
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1936(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5928
+jal ra,-5908
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2856
+jal ra,-2836
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3813
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,13
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2680
+jal zero,2
+jal ra,-5878
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-2437
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1940(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5762
+jal ra,-5713
+jal ra,-5734
+jal zero,161
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4817
+jal ra,-4566
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4681
+jal zero,146
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4331
+jal ra,-4087
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4189
+jal zero,131
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5598
+jal ra,-5560
+jal ra,-5776
+jal zero,119
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5610
+jal ra,-5472
+jal ra,-5788
+jal zero,107
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5622
+jal ra,-5384
+jal ra,-5800
+jal zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5634
+jal ra,-5296
+jal ra,-5812
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5646
+jal ra,-5185
+jal ra,-5824
+jal zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5658
+jal ra,-5074
+jal ra,-5836
+jal zero,59
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3821
+jal ra,-3747
+jal ra,-3783
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3593
+jal ra,-3528
+jal ra,-3554
+jal zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3286
+jal ra,-3236
+jal ra,-3566
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1936(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6191
+jal ra,-6131
+jal ra,-6173
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3059
+jal zero,2
+jal ra,-27934
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1864(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32865
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1960(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-1626
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1864(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,8(s0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,8(s0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1051
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34771
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,23
+jal zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34798
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34826
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34952
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34949
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1880(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34938
+addi t0,a0,0
+sw t0,-1264(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34925
+addi t0,a0,0
+sw t0,-1256(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34912
+addi t0,a0,0
+sw t0,-1260(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34899
+addi t0,a0,0
+sw t0,-1268(gp)
+lw t0,-1824(gp)
+beq t0,zero,9
+lw t0,-1796(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-7850
+jal ra,-821
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+beq t0,zero,4
+lw t0,-8(s0)
+sw t0,-4(s0)
+jal zero,9
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1988(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(s0)
+jal zero,-82
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+lw t2,-8(s0)
+sub t1,t1,t2
+sw t1,1864(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-309
+jal zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+lw t2,-8(s0)
+sub t1,t1,t2
+sw t1,1864(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30308
+addi t0,a0,0
+beq t0,zero,95
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-253
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-198
+jal zero,68
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1319
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+jal ra,-1111
+jal ra,-962
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+sw t0,-16(s0)
+jal ra,-404
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,36
+lw t0,-16(s0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-34947
+addi t0,zero,0
+sw t0,-8(s0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-376
+addi t0,a0,0
+beq t0,zero,9
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-34964
+addi t0,zero,0
+sw t0,-8(s0)
+jal zero,-101
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1860(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32981
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1856(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33421
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1988(t1)
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27209
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1856(t0)
+sw t0,4(sp)
+jal ra,-32282
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,8(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+jal ra,-1255
+jal ra,-1106
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+beq t0,zero,4
+lw t0,-4(s0)
+sw t0,8(s0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+lw t0,-4(s0)
+sw t0,8(s0)
+jal zero,-27
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-122
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1896(t0)
+beq t0,zero,3
+jal ra,-253
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30553
+addi t0,a0,0
+beq t0,zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-36(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-84
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-95
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+lw t2,-4(s0)
+sub t1,t1,t2
+sw t1,1864(t0)
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-658
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+lw t2,-4(s0)
+sub t1,t1,t2
+sw t1,1864(t0)
+jal ra,-1381
+jal ra,-1232
+jal ra,-670
+jal zero,-78
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1860(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,-36(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1536(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,67
+lw t0,8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-16(s0)
+lw t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17177
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18924
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-16(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-16(s0)
+sw t0,-8(s0)
+lw t0,-12(s0)
+sw t0,-4(s0)
+jal zero,8
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-73
+lw t0,-4(s0)
+lw t1,-36(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-36(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+sw t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-36(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,77
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lui t0,0xFFFFE
+addi t0,t0,-1620
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-29028
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-29008
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+jal ra,-27918
+addi sp,sp,16
+lw t0,-1552(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-504
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1552(gp)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-27941
+addi sp,sp,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1632
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27952
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1644
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-27981
+addi sp,sp,12
+lw t0,12(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,-36(gp)
+sw t0,8(sp)
+lw t0,20(s0)
+sw t0,12(sp)
+jal ra,-152
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,20(s0)
+sw t0,12(sp)
+jal ra,-157
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,20(s0)
+sw t0,12(sp)
+jal ra,-162
+jal ra,-28894
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-35467
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-35322
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-35315
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-35287
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-35276
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-35265
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-35254
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35478
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35337
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-35360
+jal zero,13
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1756(t0)
+sw t0,4(sp)
+jal ra,-35352
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1756(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33795
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34143
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-109
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1744(t0)
+lw t0,-1552(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,106
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1536(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27808
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1744(t0)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-760(gp)
+sltu t0,t0,t1
+beq t0,zero,82
+lw t0,-764(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,65
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37926
+addi t0,a0,0
+lw t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37879
+addi t0,a0,0
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26127
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1744(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37902
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38013
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38036
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-68
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-84
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-18402
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35593
+addi t0,a0,0
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1760(t2)
+divu t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1748(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1760(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-35493
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1748(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35728
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35682
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-35556
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1752(t0)
+jal zero,78
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35741
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-32
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1744(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34089
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,8(s0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1744(t0)
+lw t1,8(s0)
+lw t2,-1532(gp)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-399
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-35638
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35868
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35786
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-200
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35892
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1752(t0)
+jal zero,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35901
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-39
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35922
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35931
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,-612
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-28463
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35903
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35924
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-28496
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-532
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35932
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-28523
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35928
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,36
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-138
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1652
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35958
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-28587
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36069
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36063
+addi t0,a0,0
+sw t0,8(s0)
+jal zero,-70
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-15705
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1764(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-31232
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+sw t0,8(sp)
+jal ra,-28738
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39084
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+sw t0,-144(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+sw t0,-148(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1756(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-155
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-144(gp)
+lw t0,-108(gp)
+sw t0,-148(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1788
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1760(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+sw t0,16(sp)
+jal ra,-28785
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1756(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1768(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+lw t1,-1532(gp)
+sub t0,t0,t1
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+lw t0,8(s0)
+lw t1,12(s0)
+lw t2,-1532(gp)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+lw t2,12(s0)
+lw t3,-1532(gp)
+sub t2,t2,t3
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1984(t3)
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1776(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-66
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1704(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1700(t0)
+sw t0,8(sp)
+jal ra,-39221
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1700(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1836
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+sw t0,8(sp)
+jal ra,-28916
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1716(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1700(t2)
+add t1,t1,t2
+sw t1,1716(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1700(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1700(t0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1700(t1)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1700(t1)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1704(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1700(t2)
+addi t3,zero,4
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1700(t0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-31661
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1700(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1700(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1700(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1740(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-159
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-31264
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-31275
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-127
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-25
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,9
+sw t0,16(sp)
+jal ra,-30640
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-60
+addi t0,zero,58
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-163
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,101
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1696(t1)
+sltu t0,t0,t1
+beq t0,zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1692(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1688(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1688(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-77
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-124
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1684(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1680(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1676(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-117
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,5
+sw t0,16(sp)
+jal ra,-30753
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-173
+addi t0,zero,58
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-276
+jal zero,27
+lui t0,0xFFFFE
+addi t0,t0,-1892
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-184
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,5
+sw t0,16(sp)
+jal ra,-30780
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-200
+addi t0,zero,58
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-303
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1696(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38314
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38308
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-1552(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1696(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1552(gp)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1696(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-44
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28968
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1692(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28984
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1688(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29000
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1684(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29016
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1680(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29032
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1676(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38449
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38443
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,219
+lw t0,-1552(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1692(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1692(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1776(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1688(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t1,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1688(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1776(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1684(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1684(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1784(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1680(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1680(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1780(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,70
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18936
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20683
+addi t0,a0,0
+lw t1,-1128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1684(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1684(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1784(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1680(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1680(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1780(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1676(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1676(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1772(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-233
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1936
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+sw t0,12(sp)
+jal ra,-29602
+addi sp,sp,8
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,1
+sw t0,-8(s0)
+addi t0,zero,1
+sw t0,-12(s0)
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1696(t1)
+sltu t0,t0,t1
+beq t0,zero,122
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1692(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,106
+lw t0,-12(s0)
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-12(s0)
+jal zero,18
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,-608
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-29643
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1988
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1692(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1688(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,16(sp)
+jal ra,-29681
+addi sp,sp,12
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2028
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1684(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1680(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1676(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,16(sp)
+jal ra,-29725
+addi sp,sp,12
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-126
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2032
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-29749
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38906
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-592
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31838
+addi t0,a0,0
+addi t1,zero,5
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31864
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1724(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2040
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-29841
+addi sp,sp,4
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22251
+addi t0,a0,0
+sw t0,-508(gp)
+lw t0,-508(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-32397
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-29901
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40247
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-16915
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-32442
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,2008
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+sw t0,8(sp)
+jal ra,-29948
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40294
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1740(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29789
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1716(t0)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-859
+lui t0,0xFFFFD
+addi t0,t0,2000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-935
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-939
+lw t0,-200(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1042
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-877
+lui t0,0xFFFFD
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-953
+lw t0,-200(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1056
+addi t0,zero,0
+sw t0,-24(s0)
+addi t0,zero,1
+sw t0,-28(s0)
+lw t0,-508(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1740(t0)
+sw t0,8(sp)
+jal ra,-40348
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-32531
+addi t0,a0,0
+beq t0,zero,70
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,51
+lw t0,-28(s0)
+beq t0,zero,11
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+lw t0,-24(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-927
+addi t0,zero,0
+sw t0,-28(s0)
+lw t0,-8(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-32663
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1123
+lw t0,-20(s0)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sw t0,-28(s0)
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-53
+lw t0,-508(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1740(t0)
+sw t0,8(sp)
+jal ra,-40424
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-76
+lw t0,-28(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-200(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1159
+jal ra,-1226
+lui t0,0xFFFFD
+addi t0,t0,1876
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1716(t0)
+sw t0,8(sp)
+lw t0,-24(s0)
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+sw t0,20(sp)
+jal ra,-30125
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1712(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1708(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-30085
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,1708(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1708(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-524
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,1708(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1712(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1712(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39289
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-385
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1728(t0)
+lw t0,-1560(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,1792
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-30244
+addi sp,sp,4
+jal zero,149
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-17253
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1732(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-32780
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+sw t0,8(sp)
+jal ra,-30286
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40632
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+sw t0,-144(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+sw t0,-148(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1740(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30139
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1724
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-30267
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1708(t0)
+lw t0,-1560(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-148
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1708(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1716
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-30294
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,1708(t0)
+addi t0,zero,0
+sw t0,-144(gp)
+lw t0,-108(gp)
+sw t0,-148(gp)
+lui t0,0xFFFFD
+addi t0,t0,1640
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1708(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1712(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+sw t0,16(sp)
+jal ra,-30393
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1736(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+lw t1,20(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,48
+lw t0,20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sw t0,20(s0)
+lui t0,0xFFFFD
+addi t0,t0,1608
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+lw t0,16(s0)
+lw t1,20(s0)
+add t0,t0,t1
+sw t0,16(sp)
+lw t0,16(s0)
+sw t0,20(sp)
+lw t0,20(s0)
+sw t0,24(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-31628
+addi t0,a0,0
+sw t0,28(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-31608
+addi t0,a0,0
+sw t0,32(sp)
+jal ra,-30460
+addi sp,sp,32
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22226
+addi t0,a0,0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1592
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1672(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+jal ra,-97
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFD
+addi t0,t0,1532
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-30522
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1516
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1624(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1620(t0)
+sw t0,12(sp)
+jal ra,-136
+lw t0,-876(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-77
+lui t0,0xFFFFD
+addi t0,t0,1500
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1640(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1636(t0)
+sw t0,12(sp)
+jal ra,-157
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-856(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22280
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1664(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1672(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1664(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1660(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1668(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1660(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-140
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1484
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1664(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1660(t0)
+sw t0,12(sp)
+jal ra,-225
+lui t0,0xFFFFD
+addi t0,t0,1468
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1632(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1628(t0)
+sw t0,12(sp)
+jal ra,-242
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-856(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22293
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1656(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1672(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1656(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1652(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1668(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1652(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-225
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1452
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1656(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1652(t0)
+sw t0,12(sp)
+jal ra,-310
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-856(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22332
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1648(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1672(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1648(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1644(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1668(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1644(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-293
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1436
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-828
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1648(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1644(t0)
+sw t0,12(sp)
+jal ra,-378
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,115
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36521
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,97
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36532
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36802
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36523
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37054
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10563
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35715
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36998
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10579
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35646
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37068
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10595
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35730
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37066
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10611
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35729
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37064
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10627
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35728
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36966
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-118
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFD
+addi t0,t0,1356
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36599
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-21075
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36609
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32078
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-21088
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36622
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32063
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-21101
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36635
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32160
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-21114
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36648
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32145
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-30997
+addi sp,sp,24
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36729
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36685
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36659
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36650
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36641
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37121
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-65
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+lui t0,0xFFFFD
+addi t0,t0,1252
+add t0,gp,t0
+addi sp,sp,-32
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36748
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-32276
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36763
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32232
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36775
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32216
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36784
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-32312
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,24(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36798
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-32298
+addi t0,a0,0
+sw t0,28(sp)
+jal ra,-31150
+addi sp,sp,28
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-31173
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1236
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-31184
+addi sp,sp,4
+jal ra,-21316
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,42
+lui t0,0xFFFFD
+addi t0,t0,1180
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+jal ra,-21326
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-21329
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-21293
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32329
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-21339
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-21303
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32311
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-31219
+addi sp,sp,12
+lui t0,0xFFFFD
+addi t0,t0,1164
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-31230
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+jal ra,5838
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32422
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,5829
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32403
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1908(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,5817
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32384
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1908(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,5808
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32365
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1908(gp)
+lw t1,-1872(gp)
+divu t0,t0,t1
+sw t0,20(sp)
+jal ra,-31277
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,57
+lui t0,0xFFFFD
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,892(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,884(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,856(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,860(t0)
+sw t0,20(sp)
+jal ra,-31317
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,884(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,976
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,852(t0)
+sw t0,4(sp)
+jal ra,-31338
+addi sp,sp,4
+jal ra,-32221
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1284(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,880
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1284(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1280(t0)
+sw t0,12(sp)
+jal ra,-31364
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,50
+lui t0,0xFFFFD
+addi t0,t0,764
+add t0,gp,t0
+addi sp,sp,-32
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1244(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1240(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1236(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1248(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32579
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1248(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32561
+addi t0,a0,0
+sw t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+lw t1,-1872(gp)
+divu t0,t0,t1
+sw t0,28(sp)
+jal ra,-31419
+addi sp,sp,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1192(t1)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lui t0,0xFFFFD
+addi t0,t0,656
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1192(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1188(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+sw t0,24(sp)
+jal ra,-31460
+addi sp,sp,24
+jal ra,-673
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,572
+lui t0,0xFFFFF
+addi t0,t0,-996
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-31481
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,636
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37171
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-31498
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37160
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,189
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-587
+lui t0,0xFFFFD
+addi t0,t0,592
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37086
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-32709
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37098
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-32693
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-31545
+addi sp,sp,12
+lui t0,0xFFFFD
+addi t0,t0,492
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37349
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37375
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32754
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37371
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37397
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32748
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37241
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37152
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32794
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37164
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-32778
+addi t0,a0,0
+sw t0,24(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37423
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37449
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-31509
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37199
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32782
+addi t0,a0,0
+sw t0,28(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37455
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37481
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-31541
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37231
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32786
+addi t0,a0,0
+sw t0,32(sp)
+jal ra,-31694
+addi sp,sp,32
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37318
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37306
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37297
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,160
+lui t0,0xFFFFD
+addi t0,t0,452
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37355
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37343
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37334
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-31759
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37478
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-31782
+addi sp,sp,4
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,612
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37507
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37473
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-31800
+addi sp,sp,4
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37462
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+lui t0,0xFFFFD
+addi t0,t0,412
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37475
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37444
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37432
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37423
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-33027
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-31851
+addi sp,sp,4
+jal ra,-32734
+lui t0,0xFFFFD
+addi t0,t0,344
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37485
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37472
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37459
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-31881
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,70
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37188
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,62
+lui t0,0xFFFFD
+addi t0,t0,300
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37205
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37230
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-31918
+addi sp,sp,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37200
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,30
+lui t0,0xFFFFD
+addi t0,t0,236
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37213
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37219
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37606
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,-31955
+addi sp,sp,8
+jal ra,-32838
+lw t0,-1644(gp)
+beq t0,zero,77
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37392
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37380
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37371
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37362
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,39
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37430
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37418
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,208
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13340
+jal ra,-32897
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37411
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37399
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,180
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13359
+jal ra,-32916
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38091
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-575
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,-996
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32056
+addi sp,sp,4
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2825
+jal ra,-22192
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,113
+jal ra,-22007
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32077
+addi sp,sp,4
+lw t0,-1552(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,116
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32093
+addi sp,sp,4
+jal zero,12
+lui t0,0xFFFFD
+addi t0,t0,60
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32105
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,48
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1800(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1796(t0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-4159
+lui t0,0xFFFFD
+addi t0,t0,36
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1792(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1788(t0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-4175
+lui t0,0xFFFFD
+addi t0,t0,24
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-1484(gp)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1784(t0)
+sw t0,8(sp)
+lw t0,-1128(gp)
+sw t0,12(sp)
+jal ra,-4189
+lui t0,0xFFFFD
+addi t0,t0,12
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-1488(gp)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1780(t0)
+sw t0,8(sp)
+lw t0,-1136(gp)
+sw t0,12(sp)
+jal ra,-4203
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32176
+addi sp,sp,4
+jal ra,-1671
+lw t0,-1612(gp)
+lw t1,-1620(gp)
+add t0,t0,t1
+lw t1,-1628(gp)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,53
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32196
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32207
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,-48
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1612(gp)
+sw t0,4(sp)
+lw t0,-1616(gp)
+sw t0,8(sp)
+jal ra,-16458
+lui t0,0xFFFFD
+addi t0,t0,-64
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1620(gp)
+sw t0,4(sp)
+lw t0,-1624(gp)
+sw t0,8(sp)
+jal ra,-16468
+lui t0,0xFFFFD
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1628(gp)
+sw t0,4(sp)
+lw t0,-1632(gp)
+sw t0,8(sp)
+jal ra,-16478
+lw t0,-1928(gp)
+lw t1,-1932(gp)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32254
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,-124
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-32265
+addi sp,sp,4
+lw t0,-1928(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1932(gp)
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,-140
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13601
+jal ra,-33158
+lw t0,-1644(gp)
+beq t0,zero,2
+jal ra,-13429
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,748(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32307
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-156
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32324
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,740(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-164
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32341
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-172
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32358
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,732(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-184
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32375
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-212
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32382
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38284
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38298
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38290
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38303
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38317
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38309
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38512
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-872(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,12(s0)
+lw t1,-1884(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38364
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38359
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38388
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38611
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-872(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-200
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-155
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1888(gp)
+lw t1,12(s0)
+lw t2,-1888(gp)
+remu t1,t1,t2
+sub t0,t0,t1
+lw t1,-72(gp)
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-259
+addi t0,a0,0
+beq t0,zero,18
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38557
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38545
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-227
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,30
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38529
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,-72(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+lw t1,-72(gp)
+divu t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-516
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34735
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-30973
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-872(gp)
+sw t0,8(sp)
+jal ra,-21895
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-21557
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-540
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34783
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-31021
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-876(gp)
+sw t0,8(sp)
+jal ra,-21943
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-21605
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-564
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34831
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-728(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sw t0,24(sp)
+jal ra,-31069
+jal ra,-22059
+jal ra,-22060
+jal ra,-22061
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-21648
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1536(gp)
+sw t0,-4(s0)
+lw t0,8(s0)
+sw t0,-1536(gp)
+lw t0,-904(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1548(gp)
+sw t0,4(sp)
+jal ra,-27792
+lw t0,-1456(gp)
+lw t1,-1536(gp)
+lw t2,8(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sw t0,-1456(gp)
+lw t0,-4(s0)
+sw t0,-1536(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38951
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38756
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,140
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-196
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32981
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7974
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38782
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33007
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8000
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39014
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,1261
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33042
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8035
+jal ra,-33928
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,193
+addi t0,a0,0
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,5462
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39043
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,177
+addi t0,a0,0
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38868
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-12777
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38726
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-37962
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39118
+addi t0,a0,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1984(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-38318
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17546
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1416(t0)
+sw t0,4(sp)
+jal ra,820
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1416(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33001
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-70
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-37706
+addi t0,a0,0
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39201
+addi t0,a0,0
+lw t1,-872(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39084
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-134
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1396(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39114
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39102
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-174
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1392(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39116
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-204
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1388(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39127
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-234
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1384(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38891
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-264
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1380(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38902
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-294
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1376(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38913
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-324
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1428(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38924
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-354
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37980
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1396(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37980
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+sw t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33271
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1392(t1)
+sw t1,1388(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-414
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1384(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38315
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-441
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1380(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38325
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-468
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1376(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38335
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-495
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1436(t1)
+sw t1,1428(t0)
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1436(t0)
+sw t0,4(sp)
+jal ra,-38349
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-210
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1436(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-37996
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+addi t2,zero,2
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,1416(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-575
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,4
+sw t1,1412(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-72(gp)
+sw t1,1412(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-244
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-190
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-169
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-148
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-125
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-373
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38197
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38250
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-229
+jal zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38261
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38192
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-454
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38202
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-283
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,14
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38289
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-69
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-720
+addi t0,a0,0
+beq t0,zero,6
+lw t0,12(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39832
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-13665
+addi t0,a0,0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39844
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-13590
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-771
+addi t0,a0,0
+beq t0,zero,5
+lw t0,12(s0)
+lw t1,16(s0)
+sw t1,0(t0)
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39882
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-13715
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,4605
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39900
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-13624
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38398
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38388
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-85
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-18
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-871
+addi t0,a0,0
+beq t0,zero,25
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33758
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,12(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1388(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1388(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39812
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-18541
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+lw t2,12(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-328
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-146
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38539
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,10
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1372(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1372(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1352(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1352(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-89
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1340(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1340(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,112
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-194
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1043
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-855
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38603
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-684
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-38602
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38591
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1408(t0)
+sw t0,4(sp)
+jal ra,-38582
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1364(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1364(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1348(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1348(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1416(t2)
+add t1,t1,t2
+sw t1,1344(t0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1352(t1)
+lw t2,12(s0)
+sub t1,t1,t2
+sw t1,1352(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-890
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1424(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,551
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-734
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-916
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-747
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1412(t0)
+sw t0,4(sp)
+jal ra,-34196
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1079
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,96
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1064
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1048
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1285
+addi t0,a0,0
+beq t0,zero,18
+lw t0,12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1416(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38884
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+lw t0,12(s0)
+lw t1,-8(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38883
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38932
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-67
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-654
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1390
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37411
+addi t0,a0,0
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-14361
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37423
+addi t0,a0,0
+beq t0,zero,2
+jal zero,74
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-182
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,59
+jal zero,23
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38967
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+sw t0,4(sp)
+jal ra,-38917
+jal zero,2
+jal zero,36
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39027
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39017
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-120
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-16
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+sub t0,t0,t1
+sw t0,16(s0)
+lw t0,12(s0)
+lw t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-164
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+add t0,t0,t1
+sw t0,12(s0)
+jal zero,-20
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1314
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1492
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1880(gp)
+lw t1,-1876(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-72
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1472
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1448
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-88
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39191
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1197
+jal zero,11
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39202
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-39133
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1369
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-39147
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1201
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1336(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39204
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,1336(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1459
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39287
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39240
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-135
+jal zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1408(t0)
+sw t0,4(sp)
+jal ra,-39199
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-12(s0)
+sw t0,-8(s0)
+jal zero,-44
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-215
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1356(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1356(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-272
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36086
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36068
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1372(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1368(t0)
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1360(t0)
+sw t0,24(sp)
+jal ra,-34932
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,-340
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36129
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36111
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+sw t0,4(sp)
+jal ra,-36095
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+sw t0,4(sp)
+jal ra,-36079
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1360(t0)
+sw t0,24(sp)
+jal ra,-34991
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,-392
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36188
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36170
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+sw t0,16(sp)
+jal ra,-35026
+addi sp,sp,16
+lui t0,0xFFFFD
+addi t0,t0,-480
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1344(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36227
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1344(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36213
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1344(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-36201
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1344(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-36189
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1364(t1)
+add t0,t0,t1
+sw t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1368(t0)
+sw t0,28(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1364(t0)
+sw t0,32(sp)
+jal ra,-35113
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,-552
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36310
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36292
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+sw t0,4(sp)
+jal ra,-36276
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1348(t0)
+sw t0,4(sp)
+jal ra,-36260
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1368(t0)
+sw t0,24(sp)
+jal ra,-35172
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,-624
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36369
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-36351
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+sw t0,4(sp)
+jal ra,-36335
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+sw t0,4(sp)
+jal ra,-36319
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1364(t0)
+sw t0,24(sp)
+jal ra,-35231
+addi sp,sp,24
+lw t0,8(s0)
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,-636
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35240
+jal ra,-36122
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1316(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-41871
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1316(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1316(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41330
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1316(t0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,4(sp)
+jal ra,-40529
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40522
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-40537
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1320(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1316(t0)
+sw t0,4(sp)
+jal ra,-40577
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1316(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41408
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41417
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41409
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40601
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41416
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41425
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41447
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40637
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40630
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41461
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1883
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35083
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40638
+lw t0,-1904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38346
+addi t0,a0,0
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1896(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35101
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40639
+jal zero,15
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1896(gp)
+lw t1,-1900(gp)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35116
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40654
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40643
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41453
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40636
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1884(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15372
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40629
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41435
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40622
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,136
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41509
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41966
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15259
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40632
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41529
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41968
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15279
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40635
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41549
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41970
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15299
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40638
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41569
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41972
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15319
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40641
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41589
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41974
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15339
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40644
+lw t0,-92(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37632
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41615
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41874
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15365
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-20692
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-40559
+jal zero,23
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1976(t0)
+sw t0,4(sp)
+jal ra,-40653
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40642
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1164(t0)
+sw t0,4(sp)
+jal ra,-40633
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-40622
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-40611
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40583
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40572
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40561
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40550
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40539
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40528
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40517
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40421
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40410
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40399
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40388
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40530
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40519
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40508
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1440(t0)
+sw t0,4(sp)
+jal ra,-40499
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40488
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40409
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40398
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40387
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40376
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40365
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40354
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-591
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-419
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1332(t0)
+beq t0,zero,26
+lui t0,0xFFFFD
+addi t0,t0,-684
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41541
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41549
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-35876
+addi sp,sp,12
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41620
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41611
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41981
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-68
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-140
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1644(gp)
+beq t0,zero,81
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44775
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41434
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-40693
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44776
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41435
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-40696
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44815
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41436
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-40699
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44816
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41437
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-40702
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,4(sp)
+jal ra,-41299
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41808
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,131
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41819
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42089
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41810
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42662
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15847
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41847
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1444(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,3424
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41863
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,3410
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42722
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42190
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-15871
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42183
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-856(gp)
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-15855
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42538
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42544
+addi t0,a0,0
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-15875
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42342
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42348
+addi t0,a0,0
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-15895
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-26365
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41899
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-41134
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-267
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+jal ra,-7994
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+sw t0,4(sp)
+jal ra,-40882
+lw t0,-1880(gp)
+lw t1,-1876(gp)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42276
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-872(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41856
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-41106
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42349
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-16416
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-16282
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42182
+addi t0,a0,0
+lw t1,-72(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16268
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42376
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-106
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41579
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42373
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-100
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41578
+jal zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42371
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-139
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41578
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42368
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-133
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41577
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,2146
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-740
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,16(s0)
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42179
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-36506
+addi sp,sp,16
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,20(s0)
+sw t0,-12(s0)
+lw t0,20(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,140
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+sw t0,8(sp)
+jal ra,-16872
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16926
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lw t1,-1900(gp)
+mul t0,t0,t1
+sw t0,-12(s0)
+jal zero,28
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-16373
+addi t0,a0,0
+beq t0,zero,10
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-16357
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,11
+lw t0,20(s0)
+lw t1,-1888(gp)
+lw t2,-4(s0)
+lw t3,-1888(gp)
+remu t2,t2,t3
+sub t1,t1,t2
+addi t2,zero,4
+divu t1,t1,t2
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16997
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,36
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16480
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16850
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42599
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-16862
+addi t0,a0,0
+lw t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+jal ra,-278
+lw t0,-4(s0)
+addi t1,zero,4
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1888(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-8(s0)
+jal zero,7
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+sw t0,20(s0)
+jal zero,-142
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42396
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,225
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42407
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42677
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42398
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43271
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16438
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41930
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43266
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16451
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42741
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-856(gp)
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-16413
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43096
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43102
+addi t0,a0,0
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-16433
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43296
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16499
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43290
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16511
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43284
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16523
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-20(s0)
+sw t0,12(sp)
+lw t0,-24(s0)
+sw t0,16(sp)
+jal ra,-303
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42535
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1444(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,2736
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43342
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-24(s0)
+sw t0,8(sp)
+jal ra,-16541
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43318
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16575
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43312
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16587
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-20(s0)
+sw t0,12(sp)
+lw t0,-24(s0)
+sw t0,16(sp)
+jal ra,-367
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43336
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+jal ra,-16589
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43024
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43030
+addi t0,a0,0
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-16577
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42939
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42932
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1872(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42925
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1868(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16890
+lw t0,8(s0)
+sw t0,-1804(gp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-27091
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42625
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-41860
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-993
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42342
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8894
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41619
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42366
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1752(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1308(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1312(t0)
+lw t1,-1872(gp)
+add t0,t0,t1
+lw t1,-1908(gp)
+lw t2,-1912(gp)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1308(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1304(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1296(t1)
+lw t1,0(t1)
+sw t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1304(t1)
+lw t2,-1892(gp)
+sub t1,t1,t2
+sw t1,1304(t0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1892(gp)
+sw t0,4(sp)
+jal ra,-36860
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,126
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1308(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,88
+jal ra,-124
+addi t0,a0,0
+beq t0,zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1872(gp)
+lw t2,-1892(gp)
+lw t3,-1888(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+sw t1,1308(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1308(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36804
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1308(t2)
+add t1,t1,t2
+sw t1,1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1892(gp)
+sw t0,4(sp)
+jal ra,-37046
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1300(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+lw t1,-4(s0)
+sltu t0,t1,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1308(t1)
+lw t2,-1892(gp)
+sub t1,t1,t2
+sw t1,1308(t0)
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+jal ra,1679
+jal ra,-114
+addi t0,a0,0
+addi a0,t0,0
+jal zero,49
+jal zero,18
+lui t0,0xFFFFD
+addi t0,t0,-776
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-37227
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1120(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47573
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1300(t1)
+lw t2,-1892(gp)
+add t1,t1,t2
+sw t1,1300(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1308(t1)
+lw t2,-1892(gp)
+sub t1,t1,t2
+sw t1,1308(t0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1892(gp)
+sw t0,4(sp)
+jal ra,-36984
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1296(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1304(t1)
+lw t2,-1892(gp)
+add t1,t1,t2
+sw t1,1304(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43287
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,148
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,709
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2012
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43042
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-12(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-1904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40241
+addi t0,a0,0
+beq t0,zero,34
+lw t0,-12(s0)
+beq t0,zero,31
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1896(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,-4(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-4(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2278
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-27
+jal zero,68
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1896(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17766
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lw t0,-12(s0)
+beq t0,zero,31
+addi t0,zero,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-1900(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,-8(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-8(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2219
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-20(s0)
+jal zero,-27
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-171
+lw t0,-16(s0)
+lw t1,-1900(gp)
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-64
+lw t0,-4(s0)
+lw t1,-1924(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17392
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-42638
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43458
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-17291
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40384
+addi t0,a0,0
+beq t0,zero,30
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17367
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,1656
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17383
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-417
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1159
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43503
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-17227
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-72(gp)
+sw t0,8(sp)
+jal ra,-11335
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17424
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41690
+addi t0,a0,0
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41796
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17445
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+lw t2,-1888(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+lw t1,-1892(gp)
+lw t2,-1888(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17998
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41842
+addi t0,a0,0
+lw t1,-1532(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,114
+jal zero,39
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41836
+addi t0,a0,0
+lw t1,-1536(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,101
+jal zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41830
+addi t0,a0,0
+lw t1,-1544(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,88
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41824
+addi t0,a0,0
+lw t1,-1548(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,75
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-133
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27012
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+lw t0,-4(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-32
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1548(gp)
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1544(gp)
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-168
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27025
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,10
+lw t0,-4(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-32
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-155
+addi t0,a0,0
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42012
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-20
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42020
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17669
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41959
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41949
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41970
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-1488
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1284(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1284(t0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-57
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41979
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-41850
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42408
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-42156
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-41979
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-41968
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1544(gp)
+sw t0,4(sp)
+jal ra,-41957
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1548(gp)
+sw t0,4(sp)
+jal ra,-41946
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43734
+addi t0,a0,0
+lw t1,-1532(gp)
+sub t0,t0,t1
+lw t1,-1888(gp)
+divu t0,t0,t1
+sw t0,4(sp)
+jal ra,-41943
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42085
+addi t0,a0,0
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37770
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-1532(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17818
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42108
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,29
+lw t0,-8(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43955
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-18220
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-39
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-41992
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-41981
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+sw t0,4(sp)
+jal ra,-42104
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1292(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-42551
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43296
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,179
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42276
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17925
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42215
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,153
+addi t0,a0,0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44065
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-18132
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-40
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-42635
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42224
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-42095
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42233
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42286
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42276
+addi t0,a0,0
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42290
+addi t0,a0,0
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-898
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42430
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1292(t0)
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42443
+addi t0,a0,0
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42452
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-15
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42462
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42317
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44228
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-18491
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1232(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,118
+jal zero,13
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1421
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,105
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43542
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,90
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42524
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18173
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,73
+jal zero,24
+lw t0,12(s0)
+lw t1,-8(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42472
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,49
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42470
+addi t0,a0,0
+lw t1,12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,23
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44345
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-18608
+addi t0,a0,0
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44380
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-18643
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-1310
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1232(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1184(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1184(t0)
+jal zero,38
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1892(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+lw t2,-12(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1402
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1280(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44449
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-18514
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44461
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-18384
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+beq t0,zero,24
+lui t0,0xFFFFD
+addi t0,t0,-860
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44186
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-38513
+addi sp,sp,20
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18402
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-303
+addi t0,a0,0
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18414
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-156
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1260(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1260(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42537
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1260(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38423
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1260(t0)
+sw t0,4(sp)
+jal ra,-42487
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1260(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-81
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-42498
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42487
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-42476
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-42537
+jal zero,21
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42638
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42550
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-42558
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1268(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1252(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1252(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42624
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,57
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42671
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44710
+addi t0,a0,0
+lw t1,-1924(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42666
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18701
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lw t0,-4(s0)
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42690
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1252(t2)
+mul t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42766
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42757
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42744
+addi t0,a0,0
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1236(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1236(t0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18689
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-6450
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1268(t0)
+jal zero,31
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-141
+addi t0,a0,0
+beq t0,zero,22
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-42679
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44841
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-18764
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1268(t0)
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,10
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-87
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-28
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1248(t0)
+lw t1,-1892(gp)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1272(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+jal ra,-133
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,-920
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-38936
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1120(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49282
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42892
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42879
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44939
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-19202
+addi t0,a0,0
+sw t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1256(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1256(t0)
+sw t0,-20(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-20(s0)
+lw t1,0(t1)
+sw t1,1256(t0)
+jal zero,7
+lw t0,-1892(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38816
+addi t0,a0,0
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-28(s0)
+lw t0,-28(s0)
+lw t1,-1892(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-20(s0)
+lw t1,-28(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-16(s0)
+lw t2,-28(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-28(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-28(s0)
+jal zero,-22
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44999
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-19064
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45011
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-18934
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43003
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1268(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1268(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43025
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42937
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1252(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1252(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1264(t0)
+lw t1,-12(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1276(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-24(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+sw t0,4(sp)
+jal ra,-42899
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-24(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42970
+lw t0,-24(s0)
+lw t1,-4(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1248(t1)
+lw t2,-1892(gp)
+add t1,t1,t2
+sw t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1240(t0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1853
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-984
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-16(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44821
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-39148
+addi sp,sp,16
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,158
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1264(t0)
+lw t1,12(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1276(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43143
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,113
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43134
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43187
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43199
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-43111
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43134
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-646
+jal ra,-2154
+addi t0,a0,0
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+lw t1,-1892(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-20(s0)
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-16(s0)
+lw t2,-24(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal zero,-22
+lw t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1256(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-16(s0)
+sw t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1248(t1)
+lw t2,-1892(gp)
+sub t1,t1,t2
+sw t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1244(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1244(t0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+jal ra,-2953
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+lw t0,-12(s0)
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43282
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-135
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,213
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1252(t0)
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,70
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43333
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43324
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,-8(s0)
+lw t1,-4(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1268(t0)
+jal zero,23
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43363
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-43275
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1268(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1268(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1252(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1252(t0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-824
+jal zero,3
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-20(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-20(s0)
+jal zero,-72
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1264(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1264(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1276(t2)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,109
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-12(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,92
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43413
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43447
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43459
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-43371
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43394
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1256(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-16(s0)
+sw t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1248(t1)
+lw t2,-1892(gp)
+sub t1,t1,t2
+sw t1,1248(t0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-923
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-12(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+jal zero,7
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43503
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,9
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43512
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-95
+lw t0,-12(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-119
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19448
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,16(s0)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19461
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19459
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1087
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-32
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1184(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1180(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1184(t1)
+sw t1,1180(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1232(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1184(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1184(t0)
+jal zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,182
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2416
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+lw t1,8(s0)
+lw t2,-1892(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1228(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43484
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43512
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43562
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1208(t0)
+jal zero,4
+jal ra,-43590
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+lw t1,8(s0)
+lw t2,-1892(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1228(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-43538
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-43531
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-43520
+lw t0,-8(s0)
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43579
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-43535
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-175
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,109
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43618
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-43574
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1184(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1184(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43635
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+lw t1,8(s0)
+lw t2,-1892(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1228(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43703
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,30
+lw t0,-8(s0)
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43715
+addi t0,a0,0
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43724
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-15
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43734
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-43684
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+sw t0,4(sp)
+jal ra,-43692
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1208(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1892(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-4(s0)
+addi t1,zero,31
+mul t0,t0,t1
+lw t1,8(s0)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-21
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1892(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,12(s0)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,10
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-28
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1200(t0)
+lw t1,8(s0)
+lw t2,-1892(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1224(t2)
+remu t1,t1,t2
+addi t2,zero,2
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+lw t0,-4(s0)
+lw t1,8(s0)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+sw t0,4(sp)
+jal ra,-131
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+lw t1,20(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1224(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+lw t1,16(s0)
+sw t1,0(t0)
+jal zero,81
+jal zero,14
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-175
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,67
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-462
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46206
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-20271
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46218
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-20141
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2977
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1192(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1192(t0)
+jal ra,-637
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+beq t0,zero,24
+lui t0,0xFFFFD
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,16(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45956
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-40283
+addi sp,sp,20
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,12(s0)
+lw t1,16(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,99
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46286
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-20549
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,77
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2093
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-341
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-260
+addi t0,a0,0
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+jal ra,-209
+jal zero,40
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-667
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-380
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1224(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-12(s0)
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,12(s0)
+jal zero,-103
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46139
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal zero,85
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46489
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-40176
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,49
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46445
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46438
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46425
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-195
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46416
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46403
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-211
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46558
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-52
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1188(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1188(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46494
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46519
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-20677
+addi t0,a0,0
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1308(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1304(t1)
+add t0,t0,t1
+lw t1,-1892(gp)
+divu t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1312(t0)
+lw t1,-1908(gp)
+lw t2,-1912(gp)
+mul t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-8(s0)
+lw t1,-1908(gp)
+lw t2,-1912(gp)
+mul t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1312(t2)
+sub t1,t1,t2
+lw t2,-1892(gp)
+divu t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+sw t0,8(sp)
+jal ra,-4243
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1196(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1196(t0)
+jal ra,-992
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-31
+jal zero,18
+jal ra,-3599
+addi t0,a0,0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-3532
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-4274
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+lw t0,-1912(gp)
+lw t1,-1892(gp)
+lw t2,-1888(gp)
+divu t1,t1,t2
+add t0,t0,t1
+sw t0,-1912(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1380(gp)
+sw t0,4(sp)
+jal ra,-45872
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20540
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45831
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46641
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45824
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-45779
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-45768
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1544(gp)
+sw t0,4(sp)
+jal ra,-45757
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1548(gp)
+sw t0,4(sp)
+jal ra,-45746
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1544(gp)
+lw t1,-1548(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1888(gp)
+sw t0,4(sp)
+jal ra,-40578
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45743
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46537
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45736
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1288(t0)
+beq t0,zero,16
+jal ra,-2991
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2963
+jal zero,67
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46648
+addi t0,a0,0
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30098
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3304
+lw t0,-4(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-26
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1548(gp)
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46639
+addi t0,a0,0
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30105
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3333
+lw t0,-4(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1288(t0)
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2930
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42818
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-40700
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,16(s0)
+lw t1,-4(s0)
+sub t0,t0,t1
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-30458
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3400
+lw t0,-8(s0)
+lw t1,-72(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-26
+lw t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1880(gp)
+lw t1,-1876(gp)
+mul t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40729
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-99
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-30
+lw t0,-4(s0)
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3478
+lw t0,-4(s0)
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3490
+lw t0,-12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+lw t0,-4(s0)
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-3515
+jal zero,-25
+lw t0,-4(s0)
+lw t1,-72(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-3528
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47001
+addi t0,a0,0
+lw t1,-872(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47012
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43022
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43029
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43041
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43068
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43054
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lw t0,-12(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-43308
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,3
+addi t0,zero,46
+sw t0,-12(s0)
+jal zero,-32
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,8(s0)
+sw t0,-16(s0)
+jal zero,30
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43124
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,-16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-43348
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-43314
+jal zero,-22
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1072
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+lw t0,16(s0)
+sw t0,16(sp)
+jal ra,-41124
+addi sp,sp,12
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43164
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43190
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-43407
+addi t0,a0,0
+addi t1,zero,62
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,62
+sw t0,8(sp)
+jal ra,-43384
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,12
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-43397
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,-40
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43241
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43252
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43279
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1080
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-41254
+addi sp,sp,8
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-655
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-78
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-46224
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47001
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6995
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,6878
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6891
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-453
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+lw t1,-1588(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,8(s0)
+lw t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-28395
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-43918
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-1128
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-41422
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51768
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47415
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-21544
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-1896(gp)
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47435
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-21566
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,-22
+lw t0,-16(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41300
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47460
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-21589
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-1896(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+lw t0,-12(s0)
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-20(s0)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47487
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-21618
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,-29
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41354
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1044(t1)
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-72(gp)
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1892(gp)
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47576
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47458
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47454
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47450
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47446
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47442
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47438
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-16(s0)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-51997
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1048(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,102
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47687
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52021
+addi t0,a0,0
+lw t1,-856(gp)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52039
+addi t0,a0,0
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+lw t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,53
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47714
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-21982
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1892(gp)
+sw t0,8(sp)
+jal ra,-52076
+addi t0,a0,0
+lw t1,-1892(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-1192
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-41767
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52113
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal zero,-55
+lw t0,-16(s0)
+addi a0,t0,0
+jal zero,21
+lui t0,0xFFFFD
+addi t0,t0,-1236
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-41794
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52140
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1040(t0)
+sw t0,4(sp)
+jal ra,-433
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1320
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+lw t1,-856(gp)
+add t0,t0,t1
+lw t1,-4(s0)
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+lw t1,-4(s0)
+lw t2,-1892(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47529
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1040(t0)
+sw t0,20(sp)
+jal ra,-41860
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1040(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1036(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34259
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-44405
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1364
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+sw t0,8(sp)
+jal ra,-41911
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52257
+jal ra,-50866
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41759
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-30269
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1032(t0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52294
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1048(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,255
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1044(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,244
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-72(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,231
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1892(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,218
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41853
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-30361
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1028(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41875
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-30383
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+lw t1,-1892(gp)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41899
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1892(gp)
+sw t0,4(sp)
+jal ra,-41937
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1020(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1020(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-1892(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-30419
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1028(t0)
+sw t0,4(sp)
+lw t0,-856(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52438
+addi t0,a0,0
+lw t1,-856(gp)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,113
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1024(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52458
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,93
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1020(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+lw t1,-1892(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-52478
+addi t0,a0,0
+lw t1,-8(s0)
+lw t2,-1892(gp)
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-1532(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-1536(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-1544(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-1548(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+sw t0,-1524(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1432
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1048(t0)
+lw t1,-856(gp)
+add t0,t0,t1
+lw t1,-8(s0)
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+lw t1,-8(s0)
+lw t2,-1892(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+sw t0,16(sp)
+jal ra,-42221
+addi sp,sp,16
+jal zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1488
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+sw t0,8(sp)
+jal ra,-42237
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52583
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-47478
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-856(gp)
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48278
+addi t0,a0,0
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1028(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1668(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-35
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22184
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47475
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48285
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47468
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-47423
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-47412
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1544(gp)
+sw t0,4(sp)
+jal ra,-47401
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1548(gp)
+sw t0,4(sp)
+jal ra,-47390
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-47386
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1032(t0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-47382
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1032(t1)
+addi t2,zero,10
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1024(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1020(t0)
+lw t1,-4(s0)
+lw t2,-1892(gp)
+addi t3,zero,4
+divu t2,t2,t3
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-6057
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22278
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9883
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47979
+addi t0,a0,0
+lw t1,-1888(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-47225
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-66
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1032(t2)
+addi t3,zero,10
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+lw t3,-1892(gp)
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,1312(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-1234
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47380
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,21
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44499
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1496
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-42472
+addi sp,sp,4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1500
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-1489
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,972(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,968(t0)
+sw t0,8(sp)
+jal ra,-52871
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,968(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1544
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+sw t0,8(sp)
+jal ra,-42566
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52912
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,960(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,968(t2)
+add t1,t1,t2
+sw t1,960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,968(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,968(t0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,972(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,968(t1)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,972(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,968(t1)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,972(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,968(t2)
+addi t3,zero,4
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,968(t0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-45311
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,968(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,968(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,968(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1008(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-159
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+lw t0,8(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-117
+lw t0,8(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sw t0,8(s0)
+jal zero,-18
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-126
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-29737
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,988(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-45264
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1588
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+sw t0,8(sp)
+jal ra,-42770
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53116
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1016(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42613
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1012(t1)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-72(gp)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1016(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-53139
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1016(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1544
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+sw t0,8(sp)
+jal ra,-42836
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53182
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42681
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,972(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,968(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1016(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sw t1,960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,956(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,948(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,984(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-33032
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48679
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,952(t0)
+sw t0,4(sp)
+jal ra,-449
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1547
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1000(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-252
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-256
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,952(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,948(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1048(t2)
+lw t3,-856(gp)
+add t2,t2,t3
+lw t3,-8(s0)
+add t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t2,-8(s0)
+lw t3,-1892(gp)
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,948(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,952(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33123
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,980(t2)
+add t1,t1,t2
+sw t1,976(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-36(gp)
+sw t1,976(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,996(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-332
+jal ra,-33155
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-337
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-341
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49036
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-354
+lw t0,12(s0)
+lw t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49055
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-45350
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-45587
+addi t0,a0,0
+beq t0,zero,35
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,29
+lw t0,-1604(gp)
+lw t1,-8(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-45707
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-515
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-31
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,956(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,956(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-606
+lui t0,0xFFFFD
+addi t0,t0,-1660
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,960(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,956(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+sw t0,16(sp)
+jal ra,-43155
+addi sp,sp,16
+lui t0,0xFFFFD
+addi t0,t0,-1748
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,948(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,952(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-701
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,952(t0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-715
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-43202
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,984(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,992(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,964(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,972(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+sw t0,8(sp)
+jal ra,-53585
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,968(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,964(t0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,968(t0)
+sw t0,4(sp)
+jal ra,-45776
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,968(t0)
+addi t0,zero,0
+addi a0,t0,0
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,972(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,964(t1)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,964(t0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-45907
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,964(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,964(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,960(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,960(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+jal ra,-126
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,128
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-46013
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-12(s0)
+addi t1,zero,7
+add t0,t0,t1
+sw t0,-12(s0)
+jal ra,-155
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-29
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-46035
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35783
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,988(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-45933
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-1792
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-43437
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53783
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1016(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43280
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,988(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1016(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-53803
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1016(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lw t0,-4(s0)
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1012(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-72(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43336
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,972(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,968(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,964(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1016(t1)
+addi t2,zero,4
+mul t1,t1,t2
+sw t1,960(t0)
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-43541
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53887
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,-228
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1004(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,165
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-242
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,944(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-251
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,940(t0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,996(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-268
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,936(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,940(t0)
+lw t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,122
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,936(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-45904
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-46141
+addi t0,a0,0
+beq t0,zero,102
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-43499
+addi t0,a0,0
+lw t1,-1608(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-43509
+addi t0,a0,0
+sw t0,-1608(gp)
+lw t0,-1608(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43483
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1608(gp)
+sw t0,4(sp)
+jal ra,-31989
+addi t0,a0,0
+sw t0,-1604(gp)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,66
+lw t0,-12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,-1604(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-470
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,38
+lw t0,-1604(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1604(gp)
+lw t2,-12(s0)
+addi t3,zero,4
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-495
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-46373
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-68
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,932(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-366
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,916(t0)
+jal ra,-218
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1004(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,924(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,940(t1)
+sw t1,920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,944(t1)
+sw t1,916(t0)
+jal ra,-258
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-40
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,920(t0)
+sw t0,4(sp)
+jal ra,-1342
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1958
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-450
+jal ra,-294
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1004(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,940(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1004(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-333
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-39
+lui t0,0xFFFFD
+addi t0,t0,-1924
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,920(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,916(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+sw t0,20(sp)
+jal ra,-43917
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1924(t1)
+sw t1,912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1920(t1)
+sw t1,908(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1916(t1)
+sw t1,904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,956(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,928(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,916(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34104
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,924(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,76
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,60
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+lw t1,-36(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,48
+lui t0,0xFFFFD
+addi t0,t0,-1980
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49715
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50063
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-44048
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,912(t1)
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,908(t1)
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,904(t1)
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-36(gp)
+sw t1,924(t0)
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-2044
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,916(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34235
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-44111
+addi sp,sp,12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+sw t0,4(sp)
+jal ra,-49074
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-583
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-594
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-11
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,996(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,208
+jal zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,916(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34308
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-109
+addi t0,a0,0
+addi a0,t0,0
+jal zero,180
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,940(t0)
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-124
+addi t0,a0,0
+addi a0,t0,0
+jal zero,165
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,956(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,956(t0)
+lw t0,12(s0)
+lw t1,-1596(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10588
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11290
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28670
+jal zero,106
+lw t0,12(s0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30542
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,120
+jal zero,90
+lw t0,12(s0)
+lw t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,936(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-46552
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-46789
+addi t0,a0,0
+beq t0,zero,22
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50287
+addi t0,a0,0
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+lw t0,-1604(gp)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-30441
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50305
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,936(t1)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50340
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49538
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,2036
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44339
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19268
+jal ra,-45225
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50347
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,936(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-282
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+lw t1,-36(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFC
+addi t0,t0,1980
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,924(t0)
+sw t0,8(sp)
+jal ra,-44405
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,1908
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,960(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,956(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+sw t0,16(sp)
+jal ra,-44428
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,928(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,932(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1976(t0)
+sw t0,4(sp)
+jal ra,-49444
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50082
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49320
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50471
+addi t0,a0,0
+lw t1,-932(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3145
+addi t0,a0,0
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2687
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,928(t0)
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-374
+addi t0,a0,0
+addi a0,t0,0
+jal zero,120
+lw t0,-4(s0)
+lw t1,-1596(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10880
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11582
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28962
+jal zero,71
+lw t0,-4(s0)
+lw t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30387
+jal zero,60
+lw t0,-4(s0)
+lw t1,-1588(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29983
+jal zero,49
+lw t0,-4(s0)
+lw t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29579
+jal zero,38
+lw t0,-4(s0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30867
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,1876
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-44587
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+sw t0,4(sp)
+jal ra,-49550
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,984(t0)
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1598
+lw t0,-4(s0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1976(t0)
+sw t0,4(sp)
+jal ra,-49636
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50255
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49495
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50416
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-5516
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi a0,t0,0
+jal zero,137
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+jal ra,-7662
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-5802
+jal ra,-7670
+addi t0,a0,0
+beq t0,zero,93
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-6470
+addi t0,a0,0
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-6319
+jal zero,72
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1196(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1196(t0)
+jal ra,-5121
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7649
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-8398
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24619
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-12224
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50320
+addi t0,a0,0
+lw t1,-1888(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49566
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,1828
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-44800
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1120(t0)
+sw t0,4(sp)
+jal ra,-49763
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1976(t0)
+sw t0,4(sp)
+jal ra,-49822
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1792
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-44848
+addi sp,sp,4
+jal ra,-19945
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1164(t0)
+sw t0,4(sp)
+jal ra,-49812
+jal zero,20
+lui t0,0xFFFFC
+addi t0,t0,1768
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-44869
+addi sp,sp,4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1116(t0)
+sw t0,4(sp)
+jal ra,-49832
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1976(t0)
+sw t0,4(sp)
+jal ra,-49890
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50490
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49732
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,868(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1216(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1220(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+jal ra,-4536
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50739
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,984(t0)
+beq t0,zero,14
+jal ra,-35105
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,976(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2091
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-556
+addi t0,a0,0
+addi a0,t0,0
+jal zero,92
+jal zero,90
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-380
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-209
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,58
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-157
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+jal zero,42
+lui t0,0xFFFFC
+addi t0,t0,1724
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50740
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-45067
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50827
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-19746
+jal ra,-45960
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1096(t0)
+sw t0,4(sp)
+jal ra,-50041
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-49707
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,876(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,872(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-49728
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,872(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50497
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,872(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,860(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,884(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+sw t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50563
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,852(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,852(t0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50563
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50570
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,-12(s0)
+sw t0,-4(s0)
+lw t0,-16(s0)
+sw t0,-8(s0)
+lw t0,-12(s0)
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50604
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-41
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50619
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-49885
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-8(s0)
+sw t1,872(t0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+sw t0,4(sp)
+jal ra,-49905
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+lw t1,8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50626
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-49898
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,856(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,876(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,872(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,868(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1164(t1)
+sw t1,864(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,860(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,852(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-46
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-311
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,880(t1)
+sltu t0,t0,t1
+beq t0,zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9595
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4134
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51113
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47427
+addi t0,a0,0
+addi t1,zero,21
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47453
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1716
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51136
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-45432
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-50375
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,888(t1)
+remu t0,t0,t1
+sw t0,4(sp)
+jal ra,-50062
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11827
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-394
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-85
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-313
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,876(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,868(t0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,868(t0)
+jal ra,-397
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-442
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-356
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-424
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,868(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-35703
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-50122
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1164(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51327
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,864(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8311
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,464
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49155
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,836(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8348
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,876(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51010
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,844(t0)
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,828(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,828(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+sw t0,-504(gp)
+lw t0,-504(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38109
+addi t0,a0,0
+sw t0,-508(gp)
+lw t0,-508(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-48255
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-504(gp)
+sw t0,8(sp)
+jal ra,-45759
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56105
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,848(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45602
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,840(t0)
+addi t0,zero,0
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,832(t0)
+jal ra,-45265
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,246
+addi t0,zero,0
+sw t0,-16(s0)
+jal ra,-45209
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,131
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-200(gp)
+sw t0,-448(gp)
+jal zero,121
+jal ra,-45191
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-45292
+jal zero,116
+lw t0,-92(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47825
+addi t0,a0,0
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+jal ra,-45204
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-200(gp)
+sw t0,-448(gp)
+jal zero,42
+lw t0,-24(s0)
+lw t1,-92(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-20(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+lw t0,-448(gp)
+sw t0,8(sp)
+jal ra,-48023
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal ra,-45334
+jal zero,24
+lui t0,0xFFFFC
+addi t0,t0,1628
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+sw t0,12(sp)
+jal ra,-45873
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56219
+jal zero,-57
+lw t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,848(t1)
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-4(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-20(s0)
+sw t1,0(t0)
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,32
+lui t0,0xFFFFC
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,832(t0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,848(t0)
+sw t0,16(sp)
+jal ra,-45923
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56269
+jal zero,-136
+lw t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,832(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,832(t0)
+jal ra,-49498
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-49391
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,832(t0)
+sw t0,4(sp)
+jal ra,-49386
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-49375
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45803
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-49370
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-49359
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+lw t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49471
+addi t0,a0,0
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+lw t2,-24(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal zero,-24
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-8(s0)
+sw t1,840(t0)
+jal zero,7
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-49467
+lw t0,-8(s0)
+sw t0,-12(s0)
+lw t0,-448(gp)
+lw t1,-188(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-45514
+jal zero,-249
+lui t0,0xFFFFC
+addi t0,t0,1508
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,832(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,828(t0)
+sw t0,16(sp)
+jal ra,-46059
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,832(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,844(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49565
+addi t0,a0,0
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32845
+lw t0,-72(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,824(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lui t0,0xFFFFC
+addi t0,t0,1420
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49630
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-46118
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56464
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-10301
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5487
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-4907
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48142
+addi t0,a0,0
+addi t1,zero,21
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48168
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-51068
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51845
+addi t0,a0,0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1716
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49697
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-46152
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49667
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51873
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49704
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49691
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-5331
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-49598
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1127
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+sw t0,-1524(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-883
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-72(gp)
+sw t1,824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,840(t1)
+sw t1,836(t0)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,828(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-196
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49815
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,836(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-37
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1108
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+addi t0,zero,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,840(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,150
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49789
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFC
+addi t0,t0,1404
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49861
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52028
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-46355
+addi sp,sp,12
+addi t0,zero,1
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49861
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFC
+addi t0,t0,1400
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49856
+addi t0,a0,0
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-46387
+addi sp,sp,4
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-20(s0)
+jal zero,-34
+lui t0,0xFFFFC
+addi t0,t0,1372
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52135
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-48691
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-46413
+addi sp,sp,4
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51695
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,1324
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52088
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51714
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-46440
+addi sp,sp,8
+jal ra,-47323
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52179
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1164(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51741
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50003
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-153
+lui t0,0xFFFFC
+addi t0,t0,1292
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,832(t0)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+jal ra,-46492
+addi sp,sp,12
+lw t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,21
+lui t0,0xFFFFC
+addi t0,t0,1220
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-36633
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,832(t1)
+divu t0,t0,t1
+sw t0,4(sp)
+lw t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,832(t1)
+divu t0,t0,t1
+sw t0,8(sp)
+jal ra,-46516
+addi sp,sp,8
+jal ra,-47399
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,928(t0)
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2583
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-30439
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52274
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52285
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+jal zero,49
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1623
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1034
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,864(t0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-4(s0)
+jal zero,15
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1102
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-964
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-92
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,1
+beq t0,zero,48
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,4(sp)
+jal ra,-56939
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1697
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1108
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,864(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,7
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1172
+addi t0,a0,0
+sw t0,8(s0)
+jal zero,-48
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-36(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+lw t0,-4(s0)
+lw t1,12(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sw t0,-4(s0)
+jal zero,24
+lw t0,-4(s0)
+lw t1,-36(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,-4(s0)
+addi t1,zero,10
+divu t0,t0,t1
+lw t1,12(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-4(s0)
+jal zero,7
+lw t0,-4(s0)
+addi t1,zero,100
+divu t0,t0,t1
+lw t1,12(s0)
+mul t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sw t0,12(s0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+jal zero,7
+addi t0,zero,0
+sw t0,12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,116
+lw t0,12(s0)
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-30654
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-57067
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52498
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52509
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-8(s0)
+jal zero,74
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1847
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1258
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,864(t0)
+addi a0,t0,0
+jal zero,47
+lw t0,12(s0)
+beq t0,zero,4
+lw t0,-4(s0)
+sw t0,-8(s0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,33
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1333
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,12(s0)
+beq t0,zero,17
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1892(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sw t0,12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,9
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sw t0,12(s0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+jal zero,-116
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,122
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-30786
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52621
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52632
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+jal zero,91
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52700
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52696
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-8715
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFC
+addi t0,t0,1724
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52642
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-46969
+addi sp,sp,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52745
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52733
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-21652
+jal ra,-47866
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1096(t0)
+addi a0,t0,0
+jal zero,28
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2035
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52739
+addi t0,a0,0
+addi a0,t0,0
+jal zero,9
+lw t0,-8(s0)
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+sw t0,-4(s0)
+jal zero,-122
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6508
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-152
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-170
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-1296(gp)
+sw t0,-1536(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,832(t1)
+sw t1,880(t0)
+lw t0,-1536(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFC
+addi t0,t0,1184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47100
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,1099
+jal zero,110
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1084(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,748(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47134
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,1065
+jal zero,76
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1064(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+sw t0,8(s0)
+jal zero,55
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1060(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-54899
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+sw t0,8(s0)
+jal zero,33
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1056(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-30591
+addi t0,zero,1
+sw t0,-1644(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+sw t0,8(s0)
+jal zero,17
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1052(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1896(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,102
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+jal zero,65
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1076(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+jal zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,1032
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47317
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,882
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,113
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,64
+lw t0,-1644(gp)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,920
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47453
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,746
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,99
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,43
+lw t0,-1644(gp)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1220(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,808
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47561
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,638
+jal ra,-54584
+jal ra,-54211
+jal ra,-51236
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1276(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47228
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1264(t0)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,647
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49346
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-55545
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10526
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1232(t0)
+jal zero,18
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10544
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1228(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47305
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1212(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47321
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1204(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47339
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1477
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1324(t0)
+jal zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-11900
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1324(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1036(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5498
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6457
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2365
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1324(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1928(t0)
+lui t0,0xFFFFC
+addi t0,t0,728
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-24(gp)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-76(gp)
+sw t0,16(sp)
+lw t0,-1524(gp)
+sw t0,20(sp)
+lw t0,-1908(gp)
+lw t1,-1872(gp)
+divu t0,t0,t1
+sw t0,24(sp)
+jal ra,-47803
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,23
+lui t0,0xFFFFC
+addi t0,t0,696
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,892(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,884(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-47831
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFC
+addi t0,t0,672
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+lw t1,-1872(gp)
+divu t0,t0,t1
+sw t0,4(sp)
+jal ra,-47850
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+sw t0,4(sp)
+jal ra,-47867
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14215
+lui t0,0xFFFFC
+addi t0,t0,588
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1424(t0)
+sw t0,4(sp)
+jal ra,-47888
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,572
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47899
+jal zero,7
+lui t0,0xFFFFC
+addi t0,t0,552
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47906
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,536
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47920
+jal zero,7
+lui t0,0xFFFFC
+addi t0,t0,520
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47927
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1896(t0)
+beq t0,zero,7
+lui t0,0xFFFFC
+addi t0,t0,488
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47938
+lui t0,0xFFFFC
+addi t0,t0,400
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-47948
+addi sp,sp,4
+lw t0,-1820(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-28820
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+jal ra,-19825
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1748(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5266
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-4162
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1488
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,73
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1084(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1395
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,56
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1023
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,39
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1076(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1018
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,22
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1072(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-1386
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFC
+addi t0,t0,312
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-48098
+addi sp,sp,4
+lui t0,0xFFFFC
+addi t0,t0,240
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-24(gp)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-76(gp)
+sw t0,16(sp)
+lw t0,-1524(gp)
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+sw t0,4(sp)
+jal ra,-50412
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-48134
+addi sp,sp,24
+lw t0,-1824(gp)
+beq t0,zero,2
+jal ra,-28599
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-19453
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-17934
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,984(t0)
+beq t0,zero,2
+jal ra,-5031
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,928(t0)
+beq t0,zero,2
+jal ra,-3784
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-1863
+jal ra,-17015
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1928(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1924(t0)
+lui t0,0xFFFFC
+addi t0,t0,152
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-48199
+addi sp,sp,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,764(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,760(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+lw t1,8(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,760(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,756(t0)
+jal ra,-79
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,764(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,764(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,760(t1)
+addi t2,zero,1
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,760(t0)
+lw t1,8(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1160(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1156(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1152(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-48403
+addi sp,sp,4
+lui t0,0xFFFFC
+addi t0,t0,-40
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48410
+lui t0,0xFFFFC
+addi t0,t0,-68
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-48418
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-219
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1160(t0)
+addi a0,t0,0
+jal zero,962
+jal zero,960
+lui t0,0xFFFFC
+addi t0,t0,-156
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-48452
+addi sp,sp,4
+lui t0,0xFFFFC
+addi t0,t0,-200
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-8(gp)
+sw t0,8(sp)
+jal ra,-48465
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,-264
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+lw t0,-24(gp)
+sw t0,8(sp)
+lw t0,-28(gp)
+sw t0,12(sp)
+jal ra,-48480
+addi sp,sp,12
+jal ra,-16195
+jal ra,-49364
+lui t0,0xFFFFC
+addi t0,t0,-156
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-48493
+addi sp,sp,4
+jal ra,-58629
+jal ra,-57901
+jal ra,-57878
+jal ra,-55672
+jal ra,-56350
+jal ra,-289
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,882
+jal ra,-232
+jal ra,902
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-268
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50342
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-40861
+jal zero,849
+jal ra,-310
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,871
+jal zero,836
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-272
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50369
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-273
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35515
+jal zero,818
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-276
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50387
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23928
+jal zero,801
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-280
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50404
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23945
+jal zero,784
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-284
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50421
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-325
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35354
+jal zero,766
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-292
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50439
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-347
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1040(t0)
+jal zero,744
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-300
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50461
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-365
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6770
+jal zero,726
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-308
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50479
+addi t0,a0,0
+beq t0,zero,5
+jal ra,-383
+addi t0,a0,0
+sw t0,-1820(gp)
+jal zero,710
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-316
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50495
+addi t0,a0,0
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-403
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50426
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1760(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1760(t0)
+jal ra,-486
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,695
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-440
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1768(t0)
+jal zero,651
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-328
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50554
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-462
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1736(t0)
+jal zero,629
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-336
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50576
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-484
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,992(t0)
+jal ra,-551
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,630
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-505
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50528
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,980(t0)
+jal zero,582
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-344
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50623
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-531
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,932(t0)
+jal ra,-598
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,583
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,932(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-553
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50576
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-5088
+jal zero,535
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-352
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50670
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-578
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,844(t0)
+jal ra,-645
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,536
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,844(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-600
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-50623
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3173
+jal zero,488
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51781
+addi t0,a0,0
+beq t0,zero,477
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-356
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50723
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1841
+addi t0,a0,0
+addi a0,t0,0
+jal zero,495
+jal zero,454
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-360
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50745
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1064(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1863
+addi t0,a0,0
+addi a0,t0,0
+jal zero,473
+jal zero,432
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-364
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50767
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1060(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1885
+addi t0,a0,0
+addi a0,t0,0
+jal zero,451
+jal zero,410
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-368
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50789
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1907
+addi t0,a0,0
+addi a0,t0,0
+jal zero,429
+jal zero,388
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-376
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50811
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1929
+addi t0,a0,0
+addi a0,t0,0
+jal zero,407
+jal zero,366
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-384
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50833
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1076(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1951
+addi t0,a0,0
+addi a0,t0,0
+jal zero,385
+jal zero,344
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-388
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50855
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1056(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1973
+addi t0,a0,0
+addi a0,t0,0
+jal zero,363
+jal zero,322
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-396
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50877
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1052(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1995
+addi t0,a0,0
+addi a0,t0,0
+jal zero,341
+jal zero,300
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-400
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50899
+addi t0,a0,0
+beq t0,zero,13
+addi t0,zero,2
+sw t0,-1648(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1056(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2019
+addi t0,a0,0
+addi a0,t0,0
+jal zero,317
+jal zero,276
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-404
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50923
+addi t0,a0,0
+beq t0,zero,13
+addi t0,zero,3
+sw t0,-1648(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1056(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2043
+addi t0,a0,0
+addi a0,t0,0
+jal zero,293
+jal zero,252
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-416
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50947
+addi t0,a0,0
+beq t0,zero,24
+jal ra,-851
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1720(gp)
+sw t0,4(sp)
+lw t0,-1716(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-32845
+addi t0,a0,0
+sw t0,-1752(gp)
+lw t0,-1752(gp)
+lw t1,-1716(gp)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,258
+jal zero,217
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-424
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-50982
+addi t0,a0,0
+beq t0,zero,24
+jal ra,-886
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1732(gp)
+sw t0,4(sp)
+lw t0,-1728(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-32880
+addi t0,a0,0
+sw t0,-1756(gp)
+lw t0,-1756(gp)
+lw t1,-1728(gp)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,223
+jal zero,182
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-436
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51017
+addi t0,a0,0
+beq t0,zero,24
+jal ra,-921
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1748(gp)
+sw t0,4(sp)
+lw t0,-1744(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-32915
+addi t0,a0,0
+sw t0,-1760(gp)
+lw t0,-1760(gp)
+lw t1,-1744(gp)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,188
+jal zero,147
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-448
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51052
+addi t0,a0,0
+beq t0,zero,76
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-960
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,892(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,896(t0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-32958
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,884(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,884(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,896(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,139
+jal zero,13
+jal ra,-1055
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,126
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1009
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51032
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,880(t0)
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-456
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51139
+addi t0,a0,0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1047
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51070
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-1872(gp)
+mul t1,t1,t2
+sw t1,1272(t0)
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-464
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51167
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1075
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51098
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1220(t0)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,41
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1152(t0)
+addi a0,t0,0
+jal zero,35
+jal ra,-1158
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,-552
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-49383
+addi sp,sp,4
+jal zero,-885
+lui t0,0xFFFFC
+addi t0,t0,152
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,752(t0)
+sw t0,4(sp)
+jal ra,-49395
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1164(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-560
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51248
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,0
+sw t0,-16(gp)
+jal ra,-52469
+jal ra,-57324
+jal ra,-58376
+jal ra,-1157
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-568
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51267
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,1
+sw t0,-16(gp)
+jal ra,-52488
+jal ra,-57343
+jal ra,-58395
+jal ra,-1176
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-572
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51286
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1436(t1)
+sw t1,1432(t0)
+jal ra,-1196
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-580
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51306
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1436(t1)
+sw t1,1432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sw t1,1420(t0)
+jal ra,-1222
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,756(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-584
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-51332
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sw t1,1420(t0)
+jal ra,-1242
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sw t1,1432(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1197
+addi t0,a0,0
+beq t0,zero,5
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1153
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1152(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1160(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1164(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-52812
+jal ra,-59873
+jal ra,-52787
+jal ra,-52636
+jal ra,-52953
+jal ra,-33428
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1175
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-624
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-82
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+.4byte 0x28205B20
+.4byte 0x206D2D20
+.4byte 0x642D207C
+.4byte 0x2D207C20
+.4byte 0x207C2072
+.4byte 0x2920792D
+.4byte 0x342D3020
+.4byte 0x20363930
+.4byte 0x202E2E2E
+.4byte 0x5D
+.4byte 0x726E2D
+.4byte 0x67726E2D
+.4byte 0x63
+.4byte 0x63672D
+.4byte 0x34366D2D
+.4byte 0x0
+.4byte 0x32336D2D
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0xA
+.4byte 0x6465642D
+.4byte 0x7075
+.4byte 0x6177732D
+.4byte 0x70
+.4byte 0x6863732D
+.4byte 0x6C756465
+.4byte 0x65
+.4byte 0x6572702D
+.4byte 0x63746566
+.4byte 0x68
+.4byte 0x6972772D
+.4byte 0x6574
+.4byte 0x7065722D
+.4byte 0x6563616C
+.4byte 0x0
+.4byte 0x334C2D
+.4byte 0x324C2D
+.4byte 0x74696A2D
+.4byte 0x0
+.4byte 0x314C2D
+.4byte 0x626F6D2D
+.4byte 0x0
+.4byte 0x6E696D2D
+.4byte 0x0
+.4byte 0x792D
+.4byte 0x722D
+.4byte 0x642D
+.4byte 0x6D2D
+.4byte 0x7461622D
+.4byte 0x6863
+.4byte 0x7065722D
+.4byte 0x79616C
+.4byte 0x676F6C2D
+.4byte 0x0
+.4byte 0x6E6E612D
+.4byte 0x7461746F
+.4byte 0x65
+.4byte 0x6174732D
+.4byte 0x736B63
+.4byte 0x6172742D
+.4byte 0x6563
+.4byte 0x7365722D
+.4byte 0x656D75
+.4byte 0x616E732D
+.4byte 0x70
+.4byte 0x6C2D
+.4byte 0x532D
+.4byte 0x732D
+.4byte 0x6F2D
+.4byte 0x632D
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x6E612073
+.4byte 0x6C252064
+.4byte 0x69622D75
+.4byte 0x6F702074
+.4byte 0x65746E69
+.4byte 0x68207372
+.4byte 0x6574736F
+.4byte 0x6E6F2064
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x73696874
+.4byte 0x20736920
+.4byte 0x20656874
+.4byte 0x666C6573
+.4byte 0x73206569
+.4byte 0x65747379
+.4byte 0x7266206D
+.4byte 0x25206D6F
+.4byte 0x69772073
+.4byte 0xA6874
+.4byte 0x203A7325
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0xA
+.4byte 0x2D207C20
+.4byte 0x63746162
+.4byte 0x69662068
+.4byte 0x7720656C
+.4byte 0x656B726F
+.4byte 0x7D207372
+.4byte 0xA7325
+.4byte 0x2D207C20
+.4byte 0x63617274
+.4byte 0x69662065
+.4byte 0x7C20656C
+.4byte 0x74732D20
+.4byte 0x736B6361
+.4byte 0x72657020
+.4byte 0x20646F69
+.4byte 0x656C6966
+.4byte 0x2D207C20
+.4byte 0x6F6E6E61
+.4byte 0x65746174
+.4byte 0x6C696620
+.4byte 0x207C2065
+.4byte 0x676F6C2D
+.4byte 0x6C696620
+.4byte 0x65702065
+.4byte 0x646F6972
+.4byte 0x2D207C20
+.4byte 0x6C706572
+.4byte 0x66207961
+.4byte 0x20656C69
+.4byte 0x6E756F63
+.4byte 0x74
+.4byte 0x7B207325
+.4byte 0x20632D20
+.4byte 0x6F73207B
+.4byte 0x65637275
+.4byte 0x7C207D20
+.4byte 0x206F2D20
+.4byte 0x616E6962
+.4byte 0x7C207972
+.4byte 0x2D202820
+.4byte 0x207C2073
+.4byte 0x2920532D
+.4byte 0x73736120
+.4byte 0x6C626D65
+.4byte 0x207C2079
+.4byte 0x62206C2D
+.4byte 0x72616E69
+.4byte 0x207C2079
+.4byte 0x616E732D
+.4byte 0x6D692070
+.4byte 0x20656761
+.4byte 0x722D207C
+.4byte 0x6D757365
+.4byte 0x6D692065
+.4byte 0x656761
+.4byte 0x203A7325
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x74207325
+.4byte 0x696D7265
+.4byte 0x6974616E
+.4byte 0x2520676E
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x69622055
+.4byte 0x7972616E
+.4byte 0x20732520
+.4byte 0x68746977
+.4byte 0x69786520
+.4byte 0x6F632074
+.4byte 0x25206564
+.4byte 0xA646C
+.4byte 0x3A73250A
+.4byte 0x3C3C3C20
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0xA3C
+.4byte 0x3A73250A
+.4byte 0x3E3E3E20
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0xA0A3E
+.4byte 0x6E61202C
+.4byte 0x61622064
+.4byte 0x2D636973
+.4byte 0x636F6C62
+.4byte 0x7274206B
+.4byte 0x6C736E61
+.4byte 0x6F697461
+.4byte 0x6E
+.4byte 0x6E61202C
+.4byte 0x65642064
+.4byte 0x67677562
+.4byte 0x7265
+.4byte 0x6E61202C
+.4byte 0x65722064
+.4byte 0x79616C70
+.4byte 0x0
+.4byte 0x20746F6E
+.4byte 0x73756572
+.4byte 0x20676E69
+.4byte 0x6F6D656D
+.4byte 0x7972
+.4byte 0x73756572
+.4byte 0x20676E69
+.4byte 0x6F6D656D
+.4byte 0x7972
+.4byte 0x6367202C
+.4byte 0x20676E69
+.4byte 0x72657665
+.4byte 0x6C252079
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x202C73
+.4byte 0x656D202C
+.4byte 0x6E696772
+.4byte 0x64692067
+.4byte 0x69746E65
+.4byte 0x206C6163
+.4byte 0x65676170
+.4byte 0x76652073
+.4byte 0x20797265
+.4byte 0x20756C25
+.4byte 0x656D6974
+.4byte 0x6E692072
+.4byte 0x72726574
+.4byte 0x73747075
+.4byte 0x0
+.4byte 0x646E6120
+.4byte 0x756C2520
+.4byte 0x7320424D
+.4byte 0x20706177
+.4byte 0x63617073
+.4byte 0x65
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x746E6F63
+.4byte 0x73747865
+.4byte 0x68637320
+.4byte 0x6C756465
+.4byte 0x25206465
+.4byte 0x73
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x65207325
+.4byte 0x75636578
+.4byte 0x676E6974
+.4byte 0x756C2520
+.4byte 0x7469622D
+.4byte 0x53495220
+.4byte 0x20552D43
+.4byte 0x616E6962
+.4byte 0x25207972
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x424D756C
+.4byte 0x79687020
+.4byte 0x61636973
+.4byte 0x656D206C
+.4byte 0x79726F6D
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6772656D
+.4byte 0x20676E69
+.4byte 0x65676170
+.4byte 0x73692073
+.4byte 0x6C6E6F20
+.4byte 0x75732079
+.4byte 0x726F7070
+.4byte 0x20646574
+.4byte 0x6D206E6F
+.4byte 0x74737069
+.4byte 0x77207265
+.4byte 0x6F687469
+.4byte 0x73207475
+.4byte 0x70706177
+.4byte 0x2C676E69
+.4byte 0x63657220
+.4byte 0x6964726F
+.4byte 0x202C676E
+.4byte 0x68636163
+.4byte 0x202C7365
+.4byte 0x67616D69
+.4byte 0x202C7365
+.4byte 0x73676F6C
+.4byte 0x726F202C
+.4byte 0x70657220
+.4byte 0xA79616C
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x70617773
+.4byte 0x676E6970
+.4byte 0x20736920
+.4byte 0x796C6E6F
+.4byte 0x70757320
+.4byte 0x74726F70
+.4byte 0x6F206465
+.4byte 0x696D206E
+.4byte 0x65747370
+.4byte 0x69772072
+.4byte 0x756F6874
+.4byte 0x65722074
+.4byte 0x64726F63
+.4byte 0x2C676E69
+.4byte 0x63616320
+.4byte 0x2C736568
+.4byte 0x2C636720
+.4byte 0x616E7320
+.4byte 0x6F687370
+.4byte 0x202C7374
+.4byte 0x67616D69
+.4byte 0x202C7365
+.4byte 0x73676F6C
+.4byte 0x726F202C
+.4byte 0x70657220
+.4byte 0xA79616C
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x65686373
+.4byte 0x696C7564
+.4byte 0x6D20676E
+.4byte 0x69746C75
+.4byte 0x20656C70
+.4byte 0x746E6F63
+.4byte 0x73747865
+.4byte 0x20736920
+.4byte 0x75736E75
+.4byte 0x726F7070
+.4byte 0x20646574
+.4byte 0x6D206E6F
+.4byte 0x74736E69
+.4byte 0x202C7265
+.4byte 0x73626F6D
+.4byte 0x2C726574
+.4byte 0x646E6120
+.4byte 0x74697720
+.4byte 0x6D692068
+.4byte 0x73656761
+.4byte 0x6F6C202C
+.4byte 0x202C7367
+.4byte 0x6C706572
+.4byte 0x202C7961
+.4byte 0x6220726F
+.4byte 0x68637461
+.4byte 0xA636720
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x73707968
+.4byte 0x20726574
+.4byte 0x796C6E6F
+.4byte 0x6E757220
+.4byte 0x6E6F2073
+.4byte 0x70696D20
+.4byte 0x72657473
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x72206F74
+.4byte 0x202C6E75
+.4byte 0x75626564
+.4byte 0x6F202C67
+.4byte 0x6F682072
+.4byte 0xA7473
+.4byte 0x6C25202C
+.4byte 0x78652075
+.4byte 0x74756365
+.4byte 0x69206465
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x20726570
+.4byte 0x2C626F6A
+.4byte 0x756C2520
+.4byte 0x206E6920
+.4byte 0x61746F74
+.4byte 0x6E6F206C
+.4byte 0x65766120
+.4byte 0x65676172
+.4byte 0x746E7520
+.4byte 0x65206C69
+.4byte 0x746978
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x73626F6A
+.4byte 0x74697720
+.4byte 0x6C252068
+.4byte 0x61662075
+.4byte 0x72756C69
+.4byte 0x7365
+.4byte 0x74666120
+.4byte 0x25207265
+.4byte 0x6520756C
+.4byte 0x75636578
+.4byte 0x20646574
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x736E6F69
+.4byte 0x6C25202C
+.4byte 0x6E692075
+.4byte 0x746F7420
+.4byte 0x6C61
+.4byte 0x69786520
+.4byte 0x20646574
+.4byte 0x68746977
+.4byte 0x69786520
+.4byte 0x6F632074
+.4byte 0x25206564
+.4byte 0x646C
+.4byte 0x732520
+.4byte 0x203A7325
+.4byte 0x20626F6A
+.4byte 0x3A756C25
+.4byte 0x732520
+.4byte 0x203A7325
+.4byte 0x616E6962
+.4byte 0x25207972
+.4byte 0x666F2073
+.4byte 0x626F6A20
+.4byte 0x756C2520
+.4byte 0x73616820
+.4byte 0x64206120
+.4byte 0x65666669
+.4byte 0x746E6572
+.4byte 0x726F7720
+.4byte 0x69732064
+.4byte 0x7420657A
+.4byte 0x206E6168
+.4byte 0x20656874
+.4byte 0x616E6962
+.4byte 0x73656972
+.4byte 0x20666F20
+.4byte 0x6C726165
+.4byte 0x20726569
+.4byte 0x73626F6A
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x73626F6A
+.4byte 0x61657220
+.4byte 0x72662064
+.4byte 0x62206D6F
+.4byte 0x68637461
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0x206F7420
+.4byte 0x206E7572
+.4byte 0x20756C25
+.4byte 0x61207461
+.4byte 0x6D697420
+.4byte 0xA65
+.4byte 0x203A7325
+.4byte 0x20626F6A
+.4byte 0x20756C25
+.4byte 0x62206E69
+.4byte 0x68637461
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0x73616820
+.4byte 0x726F6D20
+.4byte 0x68742065
+.4byte 0x25206E61
+.4byte 0x6120756C
+.4byte 0x6D756772
+.4byte 0x73746E65
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x75677261
+.4byte 0x746E656D
+.4byte 0x2E732520
+.4byte 0x69202E2E
+.4byte 0x6162206E
+.4byte 0x20686374
+.4byte 0x656C6966
+.4byte 0x20732520
+.4byte 0x74207369
+.4byte 0x6C206F6F
+.4byte 0xA676E6F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x62206E65
+.4byte 0x68637461
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x25237325
+.4byte 0x756C
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74207325
+.4byte 0x77657268
+.4byte 0x636E7520
+.4byte 0x68677561
+.4byte 0x78652074
+.4byte 0x74706563
+.4byte 0x3A6E6F69
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0x6572202C
+.4byte 0x79616C70
+.4byte 0x2E676E69
+.4byte 0xA2E2E
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x75616620
+.4byte 0x6120746C
+.4byte 0x78302074
+.4byte 0x20586C25
+.4byte 0x2074756F
+.4byte 0x7020666F
+.4byte 0x69737968
+.4byte 0x206C6163
+.4byte 0x6F6D656D
+.4byte 0xA7972
+.4byte 0x203A7325
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x74737973
+.4byte 0x63206D65
+.4byte 0x206C6C61
+.4byte 0xA756C25
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x65786520
+.4byte 0x69747563
+.4byte 0x6C206E6F
+.4byte 0x7720676F
+.4byte 0x20687469
+.4byte 0x20756C25
+.4byte 0x74737973
+.4byte 0x63206D65
+.4byte 0x736C6C61
+.4byte 0x70657220
+.4byte 0x6579616C
+.4byte 0x72662064
+.4byte 0x25206D6F
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x63657865
+.4byte 0x6F697475
+.4byte 0x6E65206E
+.4byte 0x20646564
+.4byte 0x6F666562
+.4byte 0x72206572
+.4byte 0x68636165
+.4byte 0x20676E69
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x206E6F69
+.4byte 0xA756C25
+.4byte 0x0
+.4byte 0x70657228
+.4byte 0x6579616C
+.4byte 0x2D202964
+.4byte 0x203E
+.4byte 0x203A7325
+.4byte 0x6C706572
+.4byte 0x64207961
+.4byte 0x72657669
+.4byte 0x20646567
+.4byte 0x6D6F7266
+.4byte 0x65786520
+.4byte 0x69747563
+.4byte 0x6C206E6F
+.4byte 0x2520676F
+.4byte 0x74612073
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x756C2520
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C706572
+.4byte 0x64657961
+.4byte 0x756C2520
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x63202C73
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x74612073
+.4byte 0x20637020
+.4byte 0x6C257830
+.4byte 0xA58
+.4byte 0x203A7325
+.4byte 0x6C706572
+.4byte 0x6E697961
+.4byte 0x73252067
+.4byte 0x6F726620
+.4byte 0x6863206D
+.4byte 0x706B6365
+.4byte 0x746E696F
+.4byte 0x756C2520
+.4byte 0x20746120
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x206E6F69
+.4byte 0x20756C25
+.4byte 0x69206F74
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x25206E6F
+.4byte 0xA756C
+.4byte 0x203A7325
+.4byte 0x6C696166
+.4byte 0x74206465
+.4byte 0x6F6C206F
+.4byte 0x65206461
+.4byte 0x75636578
+.4byte 0x6E6F6974
+.4byte 0x676F6C20
+.4byte 0x6F726620
+.4byte 0x6E69206D
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x65206E65
+.4byte 0x75636578
+.4byte 0x6E6F6974
+.4byte 0x676F6C20
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x756C2520
+.4byte 0x65686320
+.4byte 0x6F706B63
+.4byte 0x73746E69
+.4byte 0x6B617420
+.4byte 0x65206E65
+.4byte 0x79726576
+.4byte 0x756C2520
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x72772073
+.4byte 0x65747469
+.4byte 0x6E69206E
+.4byte 0x25206F74
+.4byte 0x6F742073
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x65786520
+.4byte 0x69747563
+.4byte 0x6C206E6F
+.4byte 0x7720676F
+.4byte 0x20687469
+.4byte 0x20756C25
+.4byte 0x74737973
+.4byte 0x63206D65
+.4byte 0x736C6C61
+.4byte 0x69727720
+.4byte 0x6E657474
+.4byte 0x746E6920
+.4byte 0x7325206F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x65786520
+.4byte 0x69747563
+.4byte 0x6C206E6F
+.4byte 0x6620676F
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x63657865
+.4byte 0x6F697475
+.4byte 0x6F6C206E
+.4byte 0x69662067
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x706E73
+.4byte 0x756C252D
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C696166
+.4byte 0x74206465
+.4byte 0x6F6C206F
+.4byte 0x73206461
+.4byte 0x7370616E
+.4byte 0x20746F68
+.4byte 0x67616D69
+.4byte 0x72662065
+.4byte 0x69206D6F
+.4byte 0x7475706E
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x6D20756C
+.4byte 0x65707061
+.4byte 0x61702064
+.4byte 0x20736567
+.4byte 0x64616F6C
+.4byte 0x66206465
+.4byte 0x206D6F72
+.4byte 0x70616E73
+.4byte 0x746F6873
+.4byte 0x616D6920
+.4byte 0x25206567
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x73206E65
+.4byte 0x7370616E
+.4byte 0x20746F68
+.4byte 0x67616D69
+.4byte 0x69662065
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x6D20756C
+.4byte 0x65707061
+.4byte 0x61702064
+.4byte 0x20736567
+.4byte 0x6320666F
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x72772073
+.4byte 0x65747469
+.4byte 0x6E69206E
+.4byte 0x73206F74
+.4byte 0x7370616E
+.4byte 0x20746F68
+.4byte 0x67616D69
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x70616E73
+.4byte 0x746F6873
+.4byte 0x616D6920
+.4byte 0x66206567
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x65676170
+.4byte 0x61726620
+.4byte 0x2073656D
+.4byte 0x6F746E69
+.4byte 0x616E7320
+.4byte 0x6F687370
+.4byte 0x6D692074
+.4byte 0x20656761
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x616E7320
+.4byte 0x6F687370
+.4byte 0x6D692074
+.4byte 0x20656761
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203E7325
+.4byte 0x7325
+.4byte 0x73257325
+.4byte 0x73252E
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x72656D20
+.4byte 0x20646567
+.4byte 0x6D6F7266
+.4byte 0x61726620
+.4byte 0x3020656D
+.4byte 0x38302578
+.4byte 0x6920586C
+.4byte 0x206F746E
+.4byte 0x6D617266
+.4byte 0x78302065
+.4byte 0x6C383025
+.4byte 0x6E692058
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x61777320
+.4byte 0x64657070
+.4byte 0x74756F20
+.4byte 0x6F726620
+.4byte 0x7266206D
+.4byte 0x20656D61
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x63206E69
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x74756F20
+.4byte 0x69616620
+.4byte 0x2C64656C
+.4byte 0x74756F20
+.4byte 0x20666F20
+.4byte 0x73796870
+.4byte 0x6C616369
+.4byte 0x6D656D20
+.4byte 0x2079726F
+.4byte 0x20646E61
+.4byte 0x70617773
+.4byte 0x61707320
+.4byte 0xA6563
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x706F6320
+.4byte 0x20646569
+.4byte 0x77206E6F
+.4byte 0x65746972
+.4byte 0x6F726620
+.4byte 0x7266206D
+.4byte 0x20656D61
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x66206F74
+.4byte 0x656D6172
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x206E6920
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C6C6170
+.4byte 0x6F20636F
+.4byte 0x6F207475
+.4byte 0x68702066
+.4byte 0x63697379
+.4byte 0x6D206C61
+.4byte 0x726F6D65
+.4byte 0xA79
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x70616D20
+.4byte 0x20646570
+.4byte 0x66206F74
+.4byte 0x656D6172
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x206E6920
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x65726170
+.4byte 0x6320746E
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x72632073
+.4byte 0x65746165
+.4byte 0x68632064
+.4byte 0x20646C69
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x78652820
+.4byte 0x6E726574
+.4byte 0x296C61
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x7520756C
+.4byte 0x6563676E
+.4byte 0x616D2064
+.4byte 0x636F6C6C
+.4byte 0x73
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x6720756C
+.4byte 0x20646563
+.4byte 0x6C6C616D
+.4byte 0xA73636F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x6D20756C
+.4byte 0x6F6C6C61
+.4byte 0x28207363
+.4byte 0x20756C25
+.4byte 0x64656367
+.4byte 0x6C25202C
+.4byte 0x6E752075
+.4byte 0x64656367
+.4byte 0xA29
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x6C6F6320
+.4byte 0x7463656C
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x63672075
+.4byte 0x6E757220
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x65722029
+.4byte 0x64657375
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x73756572
+.4byte 0x6D206465
+.4byte 0x6F6C6C61
+.4byte 0xA7363
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x71657220
+.4byte 0x74736575
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x25282073
+.4byte 0x6720756C
+.4byte 0x2C646563
+.4byte 0x756C2520
+.4byte 0x75657220
+.4byte 0x29736573
+.4byte 0xA
+.4byte 0x5F636728
+.4byte 0x296B7262
+.4byte 0x203A
+.4byte 0x65726162
+.4byte 0x74656D20
+.4byte 0x6C61
+.4byte 0x646E6957
+.4byte 0x73776F
+.4byte 0x4F63616D
+.4byte 0x53
+.4byte 0x756E694C
+.4byte 0x78
+.4byte 0x666C6573
+.4byte 0x6569
+.4byte 0x6E617274
+.4byte 0x74616C73
+.4byte 0x736E6F69
+.4byte 0x20203A
+.4byte 0x203A7325
+.4byte 0x3A424C54
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x61202020
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0xA736573
+.4byte 0x0
+.4byte 0x6E65706F
+.4byte 0x203A7461
+.4byte 0x20202020
+.4byte 0x202020
+.4byte 0x74697277
+.4byte 0x20203A65
+.4byte 0x20202020
+.4byte 0x202020
+.4byte 0x64616572
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x202020
+.4byte 0x203A7325
+.4byte 0x63737973
+.4byte 0x206C6C61
+.4byte 0x3A4F2F49
+.4byte 0x63202020
+.4byte 0x736C6C61
+.4byte 0x7479622C
+.4byte 0x625B7365
+.4byte 0x73657479
+.4byte 0x6C61632F
+.4byte 0xA5D6C
+.4byte 0x726F7473
+.4byte 0x203A7365
+.4byte 0x20
+.4byte 0x64616F6C
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x706F6F6C
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x6C6C6163
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x746F7420
+.4byte 0x6D2C6C61
+.4byte 0x72287861
+.4byte 0x6F697461
+.4byte 0x40292525
+.4byte 0x72646461
+.4byte 0x2C737365
+.4byte 0x6D646E32
+.4byte 0x332C7861
+.4byte 0x616D6472
+.4byte 0xA78
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x746F7420
+.4byte 0x6D2C6C61
+.4byte 0x72287861
+.4byte 0x6F697461
+.4byte 0x40292525
+.4byte 0x72646461
+.4byte 0x28737365
+.4byte 0x656E696C
+.4byte 0x322C2923
+.4byte 0x616D646E
+.4byte 0x72332C78
+.4byte 0x78616D64
+.4byte 0xA
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20314C20
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x3A6E6F69
+.4byte 0x20
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20314C20
+.4byte 0x61746164
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x20
+.4byte 0x7865202C
+.4byte 0x64657469
+.4byte 0x74666120
+.4byte 0x25207265
+.4byte 0x6520756C
+.4byte 0x75636578
+.4byte 0x20646574
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x736E6F69
+.4byte 0x206E6920
+.4byte 0x61746F74
+.4byte 0x2528206C
+.4byte 0x7720756C
+.4byte 0x69746961
+.4byte 0x29676E
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x73696420
+.4byte 0x63746170
+.4byte 0x20736568
+.4byte 0x70207461
+.4byte 0x726F6972
+.4byte 0x20797469
+.4byte 0x756C25
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x73797320
+.4byte 0x6C6C6163
+.4byte 0x25202C73
+.4byte 0x7020756C
+.4byte 0x20656761
+.4byte 0x6C756166
+.4byte 0x202C7374
+.4byte 0x20756C25
+.4byte 0x656D6974
+.4byte 0x6E692072
+.4byte 0x72726574
+.4byte 0x73747075
+.4byte 0xA
+.4byte 0x6E6F202C
+.4byte 0x76652065
+.4byte 0x20797265
+.4byte 0x20756C25
+.4byte 0x63657865
+.4byte 0x64657475
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x73
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x20736E6F
+.4byte 0x646E6168
+.4byte 0x2064656C
+.4byte 0x207962
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x6C6C6120
+.4byte 0x7461636F
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x25282073
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0x6F20424D
+.4byte 0x6C252072
+.4byte 0x2E252E75
+.4byte 0x25756C32
+.4byte 0x63612025
+.4byte 0x6C617574
+.4byte 0x6120796C
+.4byte 0x73656363
+.4byte 0x29646573
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424B756C
+.4byte 0x61657020
+.4byte 0x7473206B
+.4byte 0x206B6361
+.4byte 0x657A6973
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x3A747865
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x67617020
+.4byte 0x6D207365
+.4byte 0x65707061
+.4byte 0x6F742064
+.4byte 0x72657A20
+.4byte 0x7266206F
+.4byte 0x2C656D61
+.4byte 0x756C2520
+.4byte 0x72656D20
+.4byte 0x20646567
+.4byte 0x25206E69
+.4byte 0x7320756C
+.4byte 0x736E6163
+.4byte 0x6C25202C
+.4byte 0x61702075
+.4byte 0x66206567
+.4byte 0x656D6172
+.4byte 0x61732073
+.4byte 0x20646576
+.4byte 0x756C2528
+.4byte 0x20746120
+.4byte 0x6B616570
+.4byte 0xA29
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x67617020
+.4byte 0x73207365
+.4byte 0x70706177
+.4byte 0x69206465
+.4byte 0x25202C6E
+.4byte 0x7320756C
+.4byte 0x70706177
+.4byte 0x6F206465
+.4byte 0x202C7475
+.4byte 0x20756C25
+.4byte 0x70736E69
+.4byte 0x65746365
+.4byte 0x79622064
+.4byte 0x6F6C6320
+.4byte 0x202C6B63
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20424D75
+.4byte 0x2520666F
+.4byte 0x424D756C
+.4byte 0x61777320
+.4byte 0x70732070
+.4byte 0x20656361
+.4byte 0x75206E69
+.4byte 0xA6573
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x646F6320
+.4byte 0x6E612065
+.4byte 0x61642064
+.4byte 0x70206174
+.4byte 0x73656761
+.4byte 0x61687320
+.4byte 0x20646572
+.4byte 0x63207962
+.4byte 0x65746E6F
+.4byte 0x20737478
+.4byte 0x74736E69
+.4byte 0x20646165
+.4byte 0x6C20666F
+.4byte 0x6564616F
+.4byte 0x25202C64
+.4byte 0x6320756C
+.4byte 0x6569706F
+.4byte 0x6E6F2064
+.4byte 0x69727720
+.4byte 0xA6574
+.4byte 0x61637320
+.4byte 0x6E696E6E
+.4byte 0x6C252067
+.4byte 0x6F632075
+.4byte 0x7865746E
+.4byte 0x7374
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x63732073
+.4byte 0x75646568
+.4byte 0x2064656C
+.4byte 0x77207325
+.4byte 0x20687469
+.4byte 0x20756C25
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x73656863
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x65686373
+.4byte 0x696C7564
+.4byte 0x6420676E
+.4byte 0x73696365
+.4byte 0x736E6F69
+.4byte 0x0
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20424D75
+.4byte 0x7070616D
+.4byte 0x6D206465
+.4byte 0x726F6D65
+.4byte 0x255B2079
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0x6F202525
+.4byte 0x6C252066
+.4byte 0x20424D75
+.4byte 0x73796870
+.4byte 0x6C616369
+.4byte 0x6D656D20
+.4byte 0x5D79726F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20
+.4byte 0x20756C25
+.4byte 0x63657865
+.4byte 0x64657475
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6E692073
+.4byte 0x746F7420
+.4byte 0x5B206C61
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20252575
+.4byte 0x73706F6E
+.4byte 0xA5D
+.4byte 0x203A7325
+.4byte 0x6D6D7573
+.4byte 0x3A797261
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x20736E6F
+.4byte 0x646E6168
+.4byte 0x2064656C
+.4byte 0x25207962
+.4byte 0x6920756C
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x68636165
+.4byte 0x6C255B20
+.4byte 0x2E252E75
+.4byte 0x25756C32
+.4byte 0x766F2025
+.4byte 0x65687265
+.4byte 0x202C6461
+.4byte 0x74636166
+.4byte 0x2520726F
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0xA5D
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x65786520
+.4byte 0x65747563
+.4byte 0x6E692064
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x5B20736E
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20252575
+.4byte 0x72616873
+.4byte 0x66202C65
+.4byte 0x6F746361
+.4byte 0x6C252072
+.4byte 0x2E252E75
+.4byte 0x5D756C32
+.4byte 0xA
+.4byte 0x706D6574
+.4byte 0x6F742073
+.4byte 0x3A6C6174
+.4byte 0x202020
+.4byte 0x73677261
+.4byte 0x746F7420
+.4byte 0x203A6C61
+.4byte 0x202020
+.4byte 0x63617473
+.4byte 0x6573206B
+.4byte 0x6E656D67
+.4byte 0x203A74
+.4byte 0x63617473
+.4byte 0x6F74206B
+.4byte 0x3A6C6174
+.4byte 0x202020
+.4byte 0x61746164
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0x20203A
+.4byte 0x70616568
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0x20203A
+.4byte 0x203A7325
+.4byte 0x2B555043
+.4byte 0x6F6D656D
+.4byte 0x203A7972
+.4byte 0x72202020
+.4byte 0x73646165
+.4byte 0x6972772B
+.4byte 0x2C736574
+.4byte 0x64616572
+.4byte 0x72772C73
+.4byte 0x73657469
+.4byte 0x6165725B
+.4byte 0x772F7364
+.4byte 0x65746972
+.4byte 0xA5D73
+.4byte 0x67657220
+.4byte 0x65747369
+.4byte 0x20203A72
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x73257325
+.4byte 0x2C756C25
+.4byte 0x2C756C25
+.4byte 0x5B756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0xA5D75
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6F207372
+.4byte 0x65702066
+.4byte 0x696C2D72
+.4byte 0x7020656E
+.4byte 0x69666F72
+.4byte 0x6F20656C
+.4byte 0x6C252066
+.4byte 0x6F732075
+.4byte 0x65637275
+.4byte 0x6C696620
+.4byte 0x77207365
+.4byte 0x74746972
+.4byte 0x69206E65
+.4byte 0x206F746E
+.4byte 0xA7325
+.4byte 0xA7D5D0A
+.4byte 0x0
+.4byte 0x6966227B
+.4byte 0x2273656C
+.4byte 0xA5B3A
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x72657020
+.4byte 0x6E696C2D
+.4byte 0x72702065
+.4byte 0x6C69666F
+.4byte 0x756F2065
+.4byte 0x74757074
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x61206F74
+.4byte 0x746F6E6E
+.4byte 0x2C657461
+.4byte 0x6C6E6F20
+.4byte 0x69622079
+.4byte 0x6972616E
+.4byte 0x63207365
+.4byte 0x69706D6F
+.4byte 0x2064656C
+.4byte 0x74206E69
+.4byte 0x20736968
+.4byte 0x206E7572
+.4byte 0x206E6163
+.4byte 0x61206562
+.4byte 0x746F6E6E
+.4byte 0x64657461
+.4byte 0xA
+.4byte 0xA2C
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6F207372
+.4byte 0x6C252066
+.4byte 0x6E612075
+.4byte 0x61746F6E
+.4byte 0x20646574
+.4byte 0x656E696C
+.4byte 0x666F2073
+.4byte 0x20732520
+.4byte 0x74697277
+.4byte 0x206E6574
+.4byte 0x6F746E69
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x756C6F43
+.4byte 0x3A736E6D
+.4byte 0x63657865
+.4byte 0x6F697475
+.4byte 0x6C3A736E
+.4byte 0x7364616F
+.4byte 0x6F74733A
+.4byte 0x3A736572
+.4byte 0x6D20314C
+.4byte 0x65737369
+.4byte 0x696C3A73
+.4byte 0x733A656E
+.4byte 0x6372756F
+.4byte 0x65
+.4byte 0x72756F53
+.4byte 0x3A6563
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x6E6E6120
+.4byte 0x7461746F
+.4byte 0x73206465
+.4byte 0x6372756F
+.4byte 0x69662065
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x672E7325
+.4byte 0x766F63
+.4byte 0x7D5D
+.4byte 0x616F6C22
+.4byte 0x3A227364
+.4byte 0x2C756C25
+.4byte 0x6F747322
+.4byte 0x22736572
+.4byte 0x756C253A
+.4byte 0x696D222C
+.4byte 0x73657373
+.4byte 0x6C253A22
+.4byte 0x7D75
+.4byte 0x6C227B0A
+.4byte 0x22656E69
+.4byte 0x756C253A
+.4byte 0x6E69222C
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x3A22736E
+.4byte 0x2C756C25
+.4byte 0x65786522
+.4byte 0x69747563
+.4byte 0x22736E6F
+.4byte 0x756C253A
+.4byte 0x2C
+.4byte 0x6F73227B
+.4byte 0x65637275
+.4byte 0x25223A22
+.4byte 0x222C2273
+.4byte 0x6F6E6E61
+.4byte 0x65746174
+.4byte 0x223A2264
+.4byte 0x2C227325
+.4byte 0x6E696C22
+.4byte 0x3A227365
+.4byte 0x5B
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20203A2D
+.4byte 0x20202020
+.4byte 0x3A2D2020
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20203A2D
+.4byte 0x20202020
+.4byte 0x3A2D2020
+.4byte 0x0
+.4byte 0x20202020
+.4byte 0x23232323
+.4byte 0x3A23
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x6F6E6E61
+.4byte 0x65746174
+.4byte 0x6F732064
+.4byte 0x65637275
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6F207372
+.4byte 0x61632066
+.4byte 0x73206C6C
+.4byte 0x6B636174
+.4byte 0x61732073
+.4byte 0x656C706D
+.4byte 0x76652064
+.4byte 0x20797265
+.4byte 0x20756C25
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x736E6F69
+.4byte 0x69727720
+.4byte 0x6E657474
+.4byte 0x746E6920
+.4byte 0x7325206F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x6C616320
+.4byte 0x7473206C
+.4byte 0x736B6361
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x756C2520
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x75
+.4byte 0x3028302C
+.4byte 0x2530302E
+.4byte 0x2925
+.4byte 0x756C252C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x78304029
+.4byte 0x586C25
+.4byte 0x203A7325
+.4byte 0x61207461
+.4byte 0x65726464
+.4byte 0x30207373
+.4byte 0x38302578
+.4byte 0x7520586C
+.4byte 0x6F6E6B6E
+.4byte 0x69206E77
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x30206E6F
+.4byte 0x586C2578
+.4byte 0x74697720
+.4byte 0x706F2068
+.4byte 0x65646F63
+.4byte 0x25783020
+.4byte 0x6420586C
+.4byte 0x63657465
+.4byte 0xA646574
+.4byte 0x0
+.4byte 0x3A73250A
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x74206E6F
+.4byte 0x67676972
+.4byte 0x64657265
+.4byte 0x20796220
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x206E6F69
+.4byte 0x62206E69
+.4byte 0x72616E69
+.4byte 0x2079
+.4byte 0x206E6920
+.4byte 0x73657270
+.4byte 0x65636E65
+.4byte 0x20666F20
+.4byte 0x73697865
+.4byte 0x676E6974
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x203A6E6F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74207325
+.4byte 0x776F7268
+.4byte 0x78652073
+.4byte 0x74706563
+.4byte 0x3A6E6F69
+.4byte 0x20
+.4byte 0x20
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x0
+.4byte 0x20444920
+.4byte 0x756C25
+.4byte 0x20746120
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x586C38
+.4byte 0x20746120
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x0
+.4byte 0x3D3D7325
+.4byte 0x28646C25
+.4byte 0x6C257830
+.4byte 0x2958
+.4byte 0x3D3D7325
+.4byte 0x6C256F30
+.4byte 0x6F
+.4byte 0x3D3D7325
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6F207372
+.4byte 0x73612066
+.4byte 0x626D6573
+.4byte 0x7720796C
+.4byte 0x20687469
+.4byte 0x20756C25
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x43534952
+.4byte 0x6920552D
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x20646E61
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x74616420
+.4byte 0x72772061
+.4byte 0x65747469
+.4byte 0x6E69206E
+.4byte 0x25206F74
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x73736120
+.4byte 0x6C626D65
+.4byte 0x756F2079
+.4byte 0x74757074
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x64206F74
+.4byte 0x73617369
+.4byte 0x626D6573
+.4byte 0x7420656C
+.4byte 0x756F206F
+.4byte 0x74757074
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x7962342E
+.4byte 0x206574
+.4byte 0x7962382E
+.4byte 0x206574
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x75642067
+.4byte 0x676E6972
+.4byte 0x676F6C20
+.4byte 0x676E6967
+.4byte 0x20736920
+.4byte 0x75736E75
+.4byte 0x726F7070
+.4byte 0xA646574
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x75642067
+.4byte 0x676E6972
+.4byte 0x6D797320
+.4byte 0x696C6F62
+.4byte 0x78652063
+.4byte 0x74756365
+.4byte 0x206E6F69
+.4byte 0x75207369
+.4byte 0x7075736E
+.4byte 0x74726F70
+.4byte 0xA6465
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x75642067
+.4byte 0x676E6972
+.4byte 0x63657220
+.4byte 0x6964726F
+.4byte 0x6920676E
+.4byte 0x6E752073
+.4byte 0x70707573
+.4byte 0x6574726F
+.4byte 0xA64
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x25207325
+.4byte 0x6C252C73
+.4byte 0x64
+.4byte 0x203E2D20
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x202D7C20
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x2578305B
+.4byte 0x5D586C
+.4byte 0x203E2D20
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x0
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x646C25
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x656D3D3D
+.4byte 0x78305B6D
+.4byte 0x5D586C25
+.4byte 0x0
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x766E6920
+.4byte 0x64696C61
+.4byte 0x0
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x6C6C6920
+.4byte 0x6765732D
+.4byte 0x746E656D
+.4byte 0x28206465
+.4byte 0x6D676573
+.4byte 0x61746E65
+.4byte 0x6E6F6974
+.4byte 0x75616620
+.4byte 0x29746C
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x6D6E7520
+.4byte 0x65707061
+.4byte 0x70282064
+.4byte 0x20656761
+.4byte 0x6C756166
+.4byte 0x2974
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x20646C25
+.4byte 0x202D7C
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x6C257830
+.4byte 0x2D7C2058
+.4byte 0x20
+.4byte 0x25207325
+.4byte 0x6C252C73
+.4byte 0x73252864
+.4byte 0x29
+.4byte 0x25207325
+.4byte 0x73252C73
+.4byte 0x73252C
+.4byte 0x25207325
+.4byte 0x73252C73
+.4byte 0x646C252C
+.4byte 0x0
+.4byte 0x706F6E
+.4byte 0x2D7C203A
+.4byte 0x20
+.4byte 0x25207325
+.4byte 0x78302C73
+.4byte 0x586C25
+.4byte 0x7830203A
+.4byte 0x6C383025
+.4byte 0x203A58
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x203A
+.4byte 0x203A7325
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x6C257E28
+.4byte 0x2975
+.4byte 0x203A7325
+.4byte 0x6E617274
+.4byte 0x74616C73
+.4byte 0x3A676E69
+.4byte 0x6176200A
+.4byte 0x3A726464
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x6170200A
+.4byte 0x203A6567
+.4byte 0x30257830
+.4byte 0xA586C34
+.4byte 0x61726620
+.4byte 0x203A656D
+.4byte 0x30257830
+.4byte 0xA586C38
+.4byte 0x64617020
+.4byte 0x203A7264
+.4byte 0x30257830
+.4byte 0xA586C38
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x6F6D656D
+.4byte 0x61207972
+.4byte 0x73656363
+.4byte 0x20736573
+.4byte 0x25206E69
+.4byte 0x7220756C
+.4byte 0x20736E75
+.4byte 0x63617274
+.4byte 0x69206465
+.4byte 0x206F746E
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x6F6D656D
+.4byte 0x61207972
+.4byte 0x73656363
+.4byte 0x72742073
+.4byte 0x20656361
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x6D656D20
+.4byte 0x2079726F
+.4byte 0x65636361
+.4byte 0x74207373
+.4byte 0x65636172
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x66657270
+.4byte 0x68637465
+.4byte 0x203A7365
+.4byte 0x70202020
+.4byte 0x65666572
+.4byte 0x65686374
+.4byte 0x73752C64
+.4byte 0x6C756665
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68636163
+.4byte 0x72772065
+.4byte 0x73657469
+.4byte 0x7720203A
+.4byte 0x65746972
+.4byte 0x7268742D
+.4byte 0x6867756F
+.4byte 0x72772C73
+.4byte 0x2D657469
+.4byte 0x6B636162
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x696C6F70
+.4byte 0x73656963
+.4byte 0x2020203A
+.4byte 0x25202020
+.4byte 0x65722073
+.4byte 0x63616C70
+.4byte 0x6E656D65
+.4byte 0x77202C74
+.4byte 0x65746972
+.4byte 0x2C73252D
+.4byte 0x65727020
+.4byte 0x63746566
+.4byte 0x73252068
+.4byte 0xA
+.4byte 0x7320334C
+.4byte 0x65726168
+.4byte 0x20203A64
+.4byte 0x202020
+.4byte 0x7520324C
+.4byte 0x6966696E
+.4byte 0x203A6465
+.4byte 0x202020
+.4byte 0x203A7325
+.4byte 0x202C324C
+.4byte 0x6320334C
+.4byte 0x65686361
+.4byte 0x61203A73
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0xA736573
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6E72656B
+.4byte 0x69206C65
+.4byte 0x6C61766E
+.4byte 0x74616469
+.4byte 0x736E6F69
+.4byte 0x6C25203A
+.4byte 0xA75
+.4byte 0x6F632820
+.4byte 0x65726568
+.4byte 0x2079636E
+.4byte 0x61766E69
+.4byte 0x6164696C
+.4byte 0x6E6F6974
+.4byte 0x25203A73
+.4byte 0x29756C
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x3A6E6F69
+.4byte 0x202020
+.4byte 0x68732820
+.4byte 0x64657261
+.4byte 0x74696820
+.4byte 0x25203A73
+.4byte 0x29756C
+.4byte 0x61746164
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x202020
+.4byte 0x203A7325
+.4byte 0x6320314C
+.4byte 0x65686361
+.4byte 0x20203A73
+.4byte 0x61202020
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0xA736573
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x6C252C75
+.4byte 0x6C252875
+.4byte 0x2E252E75
+.4byte 0x25756C32
+.4byte 0xA2925
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x6C252C75
+.4byte 0xA75
+.4byte 0x28756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x29252575
+.4byte 0x756C252C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x29
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x2C75
+.4byte 0x203A7325
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x696C6F70
+.4byte 0x25207963
+.4byte 0xA73
+.4byte 0x69727473
+.4byte 0x6564
+.4byte 0x7478656E
+.4byte 0x0
+.4byte 0x656E6F6E
+.4byte 0x0
+.4byte 0x6B636162
+.4byte 0x0
+.4byte 0x6F726874
+.4byte 0x686775
+.4byte 0x646E6172
+.4byte 0x6D6F
+.4byte 0x6F666966
+.4byte 0x0
+.4byte 0x75726C70
+.4byte 0x0
+.4byte 0x75726C
+.4byte 0x69777328
+.4byte 0x29686374
+.4byte 0x203A
+.4byte 0x206F7420
+.4byte 0x63657865
+.4byte 0x20657475
+.4byte 0x20756C25
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x736E6F69
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x72662067
+.4byte 0x63206D6F
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x6F742073
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x732520
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x6C252C75
+.4byte 0x6C255B75
+.4byte 0x2E252E75
+.4byte 0x5D756C32
+.4byte 0xA
+.4byte 0x6B726228
+.4byte 0x203A29
+.4byte 0x203A7325
+.4byte 0x72746572
+.4byte 0x69766569
+.4byte 0x6320676E
+.4byte 0x65727275
+.4byte 0x7020746E
+.4byte 0x72676F72
+.4byte 0x62206D61
+.4byte 0x6B616572
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x74746573
+.4byte 0x20676E69
+.4byte 0x676F7270
+.4byte 0x206D6172
+.4byte 0x61657262
+.4byte 0x6F74206B
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0xA
+.4byte 0x6C6C616D
+.4byte 0x636F
+.4byte 0x203A7325
+.4byte 0x6E65706F
+.4byte 0x66206465
+.4byte 0x20656C69
+.4byte 0x77207325
+.4byte 0x20687469
+.4byte 0x67616C66
+.4byte 0x78302073
+.4byte 0x20586C25
+.4byte 0x20646E61
+.4byte 0x65646F6D
+.4byte 0x256F3020
+.4byte 0x72206F6C
+.4byte 0x72757465
+.4byte 0x676E696E
+.4byte 0x6C696620
+.4byte 0x65642065
+.4byte 0x69726373
+.4byte 0x726F7470
+.4byte 0x756C2520
+.4byte 0xA
+.4byte 0x65706F28
+.4byte 0x2974616E
+.4byte 0x203A
+.4byte 0x6E65706F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x75746361
+.4byte 0x796C6C61
+.4byte 0x6F727720
+.4byte 0x25206574
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x746E6920
+.4byte 0x6966206F
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0xA756C
+.4byte 0x203A7325
+.4byte 0x69797274
+.4byte 0x7420676E
+.4byte 0x7277206F
+.4byte 0x20657469
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x72662073
+.4byte 0x62206D6F
+.4byte 0x65666675
+.4byte 0x74612072
+.4byte 0x72697620
+.4byte 0x6C617574
+.4byte 0x64646120
+.4byte 0x73736572
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x746E6920
+.4byte 0x6966206F
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0xA756C
+.4byte 0x69727728
+.4byte 0x3A296574
+.4byte 0x20
+.4byte 0x74697277
+.4byte 0x65
+.4byte 0x203E2D20
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x75746361
+.4byte 0x796C6C61
+.4byte 0x61657220
+.4byte 0x6C252064
+.4byte 0x79622075
+.4byte 0x20736574
+.4byte 0x6D6F7266
+.4byte 0x6C696620
+.4byte 0x69772065
+.4byte 0x64206874
+.4byte 0x72637365
+.4byte 0x6F747069
+.4byte 0x6C252072
+.4byte 0xA75
+.4byte 0x203A7325
+.4byte 0x69797274
+.4byte 0x7420676E
+.4byte 0x6572206F
+.4byte 0x25206461
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x6F726620
+.4byte 0x6966206D
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0x6920756C
+.4byte 0x206F746E
+.4byte 0x66667562
+.4byte 0x61207265
+.4byte 0x69762074
+.4byte 0x61757472
+.4byte 0x6461206C
+.4byte 0x73657264
+.4byte 0x78302073
+.4byte 0x6C383025
+.4byte 0xA58
+.4byte 0x202D7C20
+.4byte 0x0
+.4byte 0x61657228
+.4byte 0x203A2964
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x69727473
+.4byte 0x6920676E
+.4byte 0x6F742073
+.4byte 0x6F6C206F
+.4byte 0x6120676E
+.4byte 0x69762074
+.4byte 0x61757472
+.4byte 0x6461206C
+.4byte 0x73657264
+.4byte 0x78302073
+.4byte 0x6C383025
+.4byte 0xA58
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x69207369
+.4byte 0x6C61766E
+.4byte 0xA6469
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x69207369
+.4byte 0x6E61206E
+.4byte 0x766E6920
+.4byte 0x64696C61
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x75207369
+.4byte 0x70616D6E
+.4byte 0xA646570
+.4byte 0x0
+.4byte 0x64616572
+.4byte 0x0
+.4byte 0x202D7C20
+.4byte 0xA3E2D
+.4byte 0x69786528
+.4byte 0x203A2974
+.4byte 0x0
+.4byte 0x74697865
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C696166
+.4byte 0x74206465
+.4byte 0x6F6C206F
+.4byte 0x61206461
+.4byte 0x6420646E
+.4byte 0x646F6365
+.4byte 0x69622065
+.4byte 0x7972616E
+.4byte 0x6F726620
+.4byte 0x6E69206D
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x20646E61
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x74616420
+.4byte 0x6F6C2061
+.4byte 0x64656461
+.4byte 0x6F726620
+.4byte 0x7325206D
+.4byte 0xA
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x756C2520
+.4byte 0x7469622D
+.4byte 0x53495220
+.4byte 0x20562D43
+.4byte 0x65646F63
+.4byte 0x20
+.4byte 0x20756C25
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x43534952
+.4byte 0x6920552D
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x206874
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x2520756C
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x6E692055
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6120736E
+.4byte 0x2520646E
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x20666F20
+.4byte 0x61746164
+.4byte 0x69727720
+.4byte 0x6E657474
+.4byte 0x746E6920
+.4byte 0x7325206F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x61746164
+.4byte 0x746E6920
+.4byte 0x6962206F
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x65646F63
+.4byte 0x746E6920
+.4byte 0x6962206F
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x20464C45
+.4byte 0x64616568
+.4byte 0x6F207265
+.4byte 0x69622066
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x6E696220
+.4byte 0x20797261
+.4byte 0x7074756F
+.4byte 0x66207475
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x65206F74
+.4byte 0x2074696D
+.4byte 0x6F206F74
+.4byte 0x75707475
+.4byte 0x69662074
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x61746164
+.4byte 0x7A697320
+.4byte 0x78652065
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x65646F63
+.4byte 0x7A697320
+.4byte 0x78652065
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x203A7325
+.4byte 0x74737973
+.4byte 0x203A6D65
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x3A6C6F72
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x706D6F63
+.4byte 0x3A657261
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x706D6F63
+.4byte 0x3A657475
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x6F6D656D
+.4byte 0x203A7972
+.4byte 0x20
+.4byte 0x202C
+.4byte 0x203A7325
+.4byte 0x74696E69
+.4byte 0x2020203A
+.4byte 0x20
+.4byte 0x706F6E5B
+.4byte 0x5D252573
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6F74203A
+.4byte 0x286C6174
+.4byte 0x69746172
+.4byte 0x2925256F
+.4byte 0x0
+.4byte 0x756C255B
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x5D
+.4byte 0x203A7325
+.4byte 0x28756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x29252575
+.4byte 0x0
+.4byte 0x20646C25
+.4byte 0x65707865
+.4byte 0x64657463
+.4byte 0x74656220
+.4byte 0x6E656577
+.4byte 0x646C2520
+.4byte 0x646E6120
+.4byte 0x646C2520
+.4byte 0xA
+.4byte 0x6F636E65
+.4byte 0x676E6964
+.4byte 0x72726520
+.4byte 0x726F
+.4byte 0x6572203A
+.4byte 0x6E696461
+.4byte 0x72662067
+.4byte 0x75206D6F
+.4byte 0x696E696E
+.4byte 0x6C616974
+.4byte 0x64657A69
+.4byte 0x67657220
+.4byte 0x65747369
+.4byte 0x2072
+.4byte 0x6572203A
+.4byte 0x6E696461
+.4byte 0x6E752067
+.4byte 0x70617277
+.4byte 0x20646570
+.4byte 0x756C6176
+.4byte 0x72662065
+.4byte 0x72206D6F
+.4byte 0x73696765
+.4byte 0x20726574
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x71696E75
+.4byte 0x62206575
+.4byte 0x69206769
+.4byte 0x6765746E
+.4byte 0x3A737265
+.4byte 0x20202020
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x71696E75
+.4byte 0x73206575
+.4byte 0x6E697274
+.4byte 0x696C2067
+.4byte 0x61726574
+.4byte 0x203A736C
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x74616420
+.4byte 0x74203A61
+.4byte 0x6C61746F
+.4byte 0x74796228
+.4byte 0xA297365
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x65672073
+.4byte 0x6172656E
+.4byte 0x20646574
+.4byte 0x68746977
+.4byte 0x756C2520
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6E612073
+.4byte 0x6C252064
+.4byte 0x79622075
+.4byte 0x20736574
+.4byte 0x6420666F
+.4byte 0xA617461
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x626D7973
+.4byte 0x74206C6F
+.4byte 0x656C6261
+.4byte 0x6F6F6C20
+.4byte 0x7370756B
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x72657469
+.4byte 0x6F697461
+.4byte 0x6F20736E
+.4byte 0x7661206E
+.4byte 0x67617265
+.4byte 0xA65
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x63206F74
+.4byte 0x69706D6F
+.4byte 0x202C656C
+.4byte 0x796C6E6F
+.4byte 0x20732520
+.4byte 0x656E6567
+.4byte 0x65746172
+.4byte 0xA64
+.4byte 0x203A7325
+.4byte 0x6F636E65
+.4byte 0x65746E75
+.4byte 0x20646572
+.4byte 0x20756C25
+.4byte 0x746E7973
+.4byte 0x65207861
+.4byte 0x726F7272
+.4byte 0x68772073
+.4byte 0x20656C69
+.4byte 0x706D6F63
+.4byte 0x6E696C69
+.4byte 0x73252067
+.4byte 0x6F202D20
+.4byte 0x7474696D
+.4byte 0x20676E69
+.4byte 0x7074756F
+.4byte 0xA7475
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x69737361
+.4byte 0x656D6E67
+.4byte 0x2C73746E
+.4byte 0x756C2520
+.4byte 0x69687720
+.4byte 0x202C656C
+.4byte 0x20756C25
+.4byte 0x202C6669
+.4byte 0x20756C25
+.4byte 0x6C6C6163
+.4byte 0x25202C73
+.4byte 0x7220756C
+.4byte 0x72757465
+.4byte 0xA6E
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x6C25202C
+.4byte 0x72702075
+.4byte 0x6465636F
+.4byte 0x73657275
+.4byte 0x6C25202C
+.4byte 0x74732075
+.4byte 0x676E6972
+.4byte 0x74696C20
+.4byte 0x6C617265
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x68746977
+.4byte 0x756C2520
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x68632029
+.4byte 0x63617261
+.4byte 0x73726574
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x75746361
+.4byte 0x73206C61
+.4byte 0x6F626D79
+.4byte 0xA736C
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x72207372
+.4byte 0x20646165
+.4byte 0x25206E69
+.4byte 0x6C20756C
+.4byte 0x73656E69
+.4byte 0x646E6120
+.4byte 0x756C2520
+.4byte 0x6D6F6320
+.4byte 0x746E656D
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x69206E65
+.4byte 0x7475706E
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x666C6573
+.4byte 0x63206569
+.4byte 0x69706D6F
+.4byte 0x676E696C
+.4byte 0x20732520
+.4byte 0x25206F74
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x69772055
+.4byte 0x25206874
+.4byte 0x622D756C
+.4byte 0x73207469
+.4byte 0x63726174
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0xA
+.4byte 0x6C697562
+.4byte 0x736E6974
+.4byte 0x0
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x676F7270
+.4byte 0x206D6172
+.4byte 0x61657262
+.4byte 0x7865206B
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x72617627
+.4byte 0x646E655F
+.4byte 0x73752027
+.4byte 0x69206465
+.4byte 0x6F6E206E
+.4byte 0x61762D6E
+.4byte 0x64616972
+.4byte 0x70206369
+.4byte 0x65636F72
+.4byte 0x65727564
+.4byte 0x0
+.4byte 0x72617627
+.4byte 0x6174735F
+.4byte 0x20277472
+.4byte 0x64657375
+.4byte 0x206E6920
+.4byte 0x2D6E6F6E
+.4byte 0x69726176
+.4byte 0x63696461
+.4byte 0x6F727020
+.4byte 0x75646563
+.4byte 0x6572
+.4byte 0x66666964
+.4byte 0x6E657265
+.4byte 0x756E2074
+.4byte 0x7265626D
+.4byte 0x20666F20
+.4byte 0x75746361
+.4byte 0x61206C61
+.4byte 0x6620646E
+.4byte 0x616D726F
+.4byte 0x6170206C
+.4byte 0x656D6172
+.4byte 0x73726574
+.4byte 0x0
+.4byte 0x65776566
+.4byte 0x63612072
+.4byte 0x6C617574
+.4byte 0x61687420
+.4byte 0x6F66206E
+.4byte 0x6C616D72
+.4byte 0x72617020
+.4byte 0x74656D61
+.4byte 0x737265
+.4byte 0x5F726176
+.4byte 0x646E65
+.4byte 0x5F726176
+.4byte 0x677261
+.4byte 0x5F726176
+.4byte 0x72617473
+.4byte 0x74
+.4byte 0x65646572
+.4byte 0x696E6966
+.4byte 0x6E6F6974
+.4byte 0x20666F20
+.4byte 0x636F7270
+.4byte 0x72756465
+.4byte 0x73252065
+.4byte 0x6E676920
+.4byte 0x6465726F
+.4byte 0xA
+.4byte 0x206F6F74
+.4byte 0x796E616D
+.4byte 0x726F6620
+.4byte 0x206C616D
+.4byte 0x61726170
+.4byte 0x6574656D
+.4byte 0x7372
+.4byte 0x206F6F74
+.4byte 0x796E616D
+.4byte 0x636F6C20
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x0
+.4byte 0x63746566
+.4byte 0x61645F68
+.4byte 0x735F6174
+.4byte 0x656D6765
+.4byte 0x735F746E
+.4byte 0x657A69
+.4byte 0x63746566
+.4byte 0x6C675F68
+.4byte 0x6C61626F
+.4byte 0x696F705F
+.4byte 0x7265746E
+.4byte 0x0
+.4byte 0x63746566
+.4byte 0x74735F68
+.4byte 0x5F6B6361
+.4byte 0x6E696F70
+.4byte 0x726574
+.4byte 0x73707968
+.4byte 0x5F726574
+.4byte 0x74697773
+.4byte 0x6863
+.4byte 0x6C6C617A
+.4byte 0x636F
+.4byte 0x69727064
+.4byte 0x66746E
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x7270645F
+.4byte 0x66746E69
+.4byte 0x0
+.4byte 0x69727073
+.4byte 0x66746E
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x7270735F
+.4byte 0x66746E69
+.4byte 0x0
+.4byte 0x6E697270
+.4byte 0x6674
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x6972705F
+.4byte 0x66746E
+.4byte 0x6E697528
+.4byte 0x5F343674
+.4byte 0x2D202974
+.4byte 0x69752820
+.4byte 0x3436746E
+.4byte 0x292A745F
+.4byte 0x20736920
+.4byte 0x65646E75
+.4byte 0x656E6966
+.4byte 0x64
+.4byte 0x6E697528
+.4byte 0x5F343674
+.4byte 0x20292A74
+.4byte 0x7528202B
+.4byte 0x36746E69
+.4byte 0x2A745F34
+.4byte 0x73692029
+.4byte 0x646E7520
+.4byte 0x6E696665
+.4byte 0x6465
+.4byte 0x6E5F6F6E
+.4byte 0x656D61
+.4byte 0x65646572
+.4byte 0x696E6966
+.4byte 0x6E6F6974
+.4byte 0x20666F20
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x20656C62
+.4byte 0x69207325
+.4byte 0x726F6E67
+.4byte 0xA6465
+.4byte 0x65707974
+.4byte 0x73696D20
+.4byte 0x6374616D
+.4byte 0x202C68
+.4byte 0x6E726177
+.4byte 0x676E69
+.4byte 0x6E6B6E75
+.4byte 0x6E776F
+.4byte 0x65646E75
+.4byte 0x72616C63
+.4byte 0x6465
+.4byte 0x746E6975
+.4byte 0x745F3436
+.4byte 0x2A
+.4byte 0x65207325
+.4byte 0x63657078
+.4byte 0x20646574
+.4byte 0x20747562
+.4byte 0x66207325
+.4byte 0x646E756F
+.4byte 0xA
+.4byte 0x75207325
+.4byte 0x6365646E
+.4byte 0x6572616C
+.4byte 0xA64
+.4byte 0x78656E75
+.4byte 0x74636570
+.4byte 0x73206465
+.4byte 0x6F626D79
+.4byte 0x206C
+.4byte 0x656C6C69
+.4byte 0x206C6167
+.4byte 0x69676572
+.4byte 0x72657473
+.4byte 0x61656420
+.4byte 0x636F6C6C
+.4byte 0x6F697461
+.4byte 0x6E
+.4byte 0x656C6C69
+.4byte 0x206C6167
+.4byte 0x69676572
+.4byte 0x72657473
+.4byte 0x63636120
+.4byte 0x737365
+.4byte 0x2074756F
+.4byte 0x7220666F
+.4byte 0x73696765
+.4byte 0x73726574
+.4byte 0x0
+.4byte 0x636F7270
+.4byte 0x72756465
+.4byte 0x73252065
+.4byte 0x646E7520
+.4byte 0x6E696665
+.4byte 0xA6465
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x61637365
+.4byte 0x73206570
+.4byte 0x65757165
+.4byte 0x2065636E
+.4byte 0x6E756F66
+.4byte 0x64
+.4byte 0x6E756F66
+.4byte 0x6E752064
+.4byte 0x776F6E6B
+.4byte 0x6863206E
+.4byte 0x63617261
+.4byte 0x20726574
+.4byte 0x0
+.4byte 0x69727473
+.4byte 0x7420676E
+.4byte 0x6C206F6F
+.4byte 0x676E6F
+.4byte 0x63616572
+.4byte 0x20646568
+.4byte 0x20646E65
+.4byte 0x6620666F
+.4byte 0x20656C69
+.4byte 0x6B6F6F6C
+.4byte 0x20676E69
+.4byte 0x20726F66
+.4byte 0x68632061
+.4byte 0x63617261
+.4byte 0x20726574
+.4byte 0x6574696C
+.4byte 0x6C6172
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x74756F20
+.4byte 0x20666F20
+.4byte 0x67726174
+.4byte 0x62207465
+.4byte 0x646E756F
+.4byte 0x0
+.4byte 0x6E676973
+.4byte 0x69206465
+.4byte 0x6765746E
+.4byte 0x6F207265
+.4byte 0x6F207475
+.4byte 0x61742066
+.4byte 0x74656772
+.4byte 0x756F6220
+.4byte 0x646E
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x74756F20
+.4byte 0x20666F20
+.4byte 0x6E756F62
+.4byte 0x64
+.4byte 0x6E676973
+.4byte 0x69206465
+.4byte 0x6765746E
+.4byte 0x6F207265
+.4byte 0x6F207475
+.4byte 0x6F622066
+.4byte 0x646E75
+.4byte 0x6E656469
+.4byte 0x69666974
+.4byte 0x74207265
+.4byte 0x6C206F6F
+.4byte 0x676E6F
+.4byte 0x616E7572
+.4byte 0x20796177
+.4byte 0x746C756D
+.4byte 0x696C2D69
+.4byte 0x6320656E
+.4byte 0x656D6D6F
+.4byte 0x746E
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x65722074
+.4byte 0x63206461
+.4byte 0x61726168
+.4byte 0x72657463
+.4byte 0x6F726620
+.4byte 0x6E69206D
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x756F6620
+.4byte 0xA646E
+.4byte 0x70786520
+.4byte 0x65746365
+.4byte 0x75622064
+.4byte 0x2074
+.4byte 0xA7325
+.4byte 0x746E7973
+.4byte 0x65207861
+.4byte 0x726F7272
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x69207325
+.4byte 0x7325206E
+.4byte 0x206E6920
+.4byte 0x656E696C
+.4byte 0x756C2520
+.4byte 0x203A
+.4byte 0x20646E65
+.4byte 0x6620666F
+.4byte 0x656C69
+.4byte 0x203A7325
+.4byte 0x6C6C616D
+.4byte 0x6F20636F
+.4byte 0x6F207475
+.4byte 0x656D2066
+.4byte 0x79726F6D
+.4byte 0xA
+.4byte 0x6230
+.4byte 0x6F30
+.4byte 0x7830
+.4byte 0x22732522
+.4byte 0x0
+.4byte 0x27632527
+.4byte 0x0
+.4byte 0x72616327
+.4byte 0x67616972
+.4byte 0x65722065
+.4byte 0x6E727574
+.4byte 0x27
+.4byte 0x6E696C27
+.4byte 0x65662065
+.4byte 0x276465
+.4byte 0x62617427
+.4byte 0x74616C75
+.4byte 0x27726F
+.4byte 0x646E6527
+.4byte 0x20666F20
+.4byte 0x656C6966
+.4byte 0x27
+.4byte 0xA
+.4byte 0x4C4C554E
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6E692072
+.4byte 0x6F206F74
+.4byte 0x75707475
+.4byte 0x69662074
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x7325
+.4byte 0x203A7325
+.4byte 0x6E6E6163
+.4byte 0x6320746F
+.4byte 0x65766E6F
+.4byte 0x6F207472
+.4byte 0x6F2D7475
+.4byte 0x6F622D66
+.4byte 0x20646E75
+.4byte 0x626D756E
+.4byte 0x25207265
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x6E6E6163
+.4byte 0x6320746F
+.4byte 0x65766E6F
+.4byte 0x6E207472
+.4byte 0x642D6E6F
+.4byte 0x6D696365
+.4byte 0x6E206C61
+.4byte 0x65626D75
+.4byte 0x73252072
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C255E32
+.4byte 0x766F2075
+.4byte 0x6C667265
+.4byte 0xA776F
+.4byte 0x0
+.4byte 0x0
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x6F697270
+.4byte 0x79746972
+.4byte 0x0
+.4byte 0x7272
+.4byte 0x7478696D
+.4byte 0x7265
+.4byte 0x73626F6D
+.4byte 0x726574
+.4byte 0x736E696D
+.4byte 0x726574
+.4byte 0x73707968
+.4byte 0x726574
+.4byte 0x7370696D
+.4byte 0x726574
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x4
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x10000
+.4byte 0x6F646572
+.4byte 0x2
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x70616E73
+.4byte 0xB
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x0
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x20
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1000
+.4byte 0x400
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x400
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x8
+.4byte 0x20
+.4byte 0x1
+.4byte 0x3E8
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x2B
+.4byte 0x65746E69
+.4byte 0x20726567
+.4byte 0x7265766F
+.4byte 0x776F6C66
+.4byte 0x0
+.4byte 0x6E696E75
+.4byte 0x61697469
+.4byte 0x657A696C
+.4byte 0x65722064
+.4byte 0x74736967
+.4byte 0x7265
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x6E6F69
+.4byte 0x61766E69
+.4byte 0x2064696C
+.4byte 0x72646461
+.4byte 0x737365
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0x0
+.4byte 0x656D6974
+.4byte 0x6E692072
+.4byte 0x72726574
+.4byte 0x747075
+.4byte 0x63737973
+.4byte 0x6C6C61
+.4byte 0x6D676573
+.4byte 0x61746E65
+.4byte 0x6E6F6974
+.4byte 0x75616620
+.4byte 0x746C
+.4byte 0x65676170
+.4byte 0x75616620
+.4byte 0x746C
+.4byte 0x65206F6E
+.4byte 0x70656378
+.4byte 0x6E6F6974
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x186A0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x20
+.4byte 0x4
+.4byte 0x7
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x64
+.4byte 0x6C616365
+.4byte 0x6C
+.4byte 0x726C616A
+.4byte 0x0
+.4byte 0x6C616A
+.4byte 0x716562
+.4byte 0x75746C73
+.4byte 0x0
+.4byte 0x756D6572
+.4byte 0x0
+.4byte 0x75766964
+.4byte 0x0
+.4byte 0x6C756D
+.4byte 0x627573
+.4byte 0x646461
+.4byte 0x69646461
+.4byte 0x0
+.4byte 0x69756C
+.4byte 0x7773
+.4byte 0x776C
+.4byte 0x6473
+.4byte 0x646C
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x100
+.4byte 0x2
+.4byte 0x0
+.4byte 0x1
+.4byte 0x200
+.4byte 0x100000
+.4byte 0x1000
+.4byte 0x1000
+.4byte 0xFFFFFFFF
+.4byte 0x4
+.4byte 0x40000000
+.4byte 0x100000
+.4byte 0x400
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x10000
+.4byte 0x10
+.4byte 0x63617274
+.4byte 0x2
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x40
+.4byte 0x40
+.4byte 0x10
+.4byte 0x8
+.4byte 0x200000
+.4byte 0x40000
+.4byte 0x10
+.4byte 0x10
+.4byte 0x4
+.4byte 0x8
+.4byte 0x4000
+.4byte 0x8000
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x191
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0xFFFFFF9C
+.4byte 0xD6
+.4byte 0x38
+.4byte 0x40
+.4byte 0x3F
+.4byte 0x5D
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x38
+.4byte 0x40
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x10000
+.4byte 0x1
+.4byte 0xF3
+.4byte 0x2
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x1
+.4byte 0x2
+.4byte 0xCF
+.4byte 0x46
+.4byte 0x4C
+.4byte 0x45
+.4byte 0x7F
+.4byte 0x6
+.4byte 0x5
+.4byte 0x1
+.4byte 0x0
+.4byte 0x10000
+.4byte 0x10000
+.4byte 0x80000
+.4byte 0x100000
+.4byte 0x1
+.4byte 0x2
+.4byte 0x1000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x1
+.4byte 0x20
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x2
+.4byte 0x3
+.4byte 0x3
+.4byte 0x3
+.4byte 0x7
+.4byte 0x5
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x73
+.4byte 0x6F
+.4byte 0x67
+.4byte 0x63
+.4byte 0x37
+.4byte 0x33
+.4byte 0x23
+.4byte 0x13
+.4byte 0x3
+.4byte 0x3674
+.4byte 0x3574
+.4byte 0x3474
+.4byte 0x3374
+.4byte 0x313173
+.4byte 0x303173
+.4byte 0x3973
+.4byte 0x3873
+.4byte 0x3773
+.4byte 0x3673
+.4byte 0x3573
+.4byte 0x3473
+.4byte 0x3373
+.4byte 0x3273
+.4byte 0x3761
+.4byte 0x3661
+.4byte 0x3561
+.4byte 0x3461
+.4byte 0x3361
+.4byte 0x3261
+.4byte 0x3161
+.4byte 0x3061
+.4byte 0x3173
+.4byte 0x3073
+.4byte 0x3274
+.4byte 0x3174
+.4byte 0x3074
+.4byte 0x7074
+.4byte 0x7067
+.4byte 0x7073
+.4byte 0x6172
+.4byte 0x6F72657A
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1F
+.4byte 0x1E
+.4byte 0x1D
+.4byte 0x1C
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x7
+.4byte 0x20
+.4byte 0x6D75625F
+.4byte 0x70
+.4byte 0x6E69616D
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x400
+.4byte 0x2
+.4byte 0x1
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x736E6F63
+.4byte 0x74
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x0
+.4byte 0x72616863
+.4byte 0x0
+.4byte 0x746E69
+.4byte 0x2E2E2E
+.4byte 0x3D3E
+.4byte 0x3E
+.4byte 0x3D3C
+.4byte 0x3C
+.4byte 0x3D21
+.4byte 0x3D3D
+.4byte 0x3D
+.4byte 0x25
+.4byte 0x2F
+.4byte 0x2A
+.4byte 0x2D
+.4byte 0x2B
+.4byte 0x7D
+.4byte 0x7B
+.4byte 0x29
+.4byte 0x28
+.4byte 0x3B
+.4byte 0x2C
+.4byte 0x657A6973
+.4byte 0x666F
+.4byte 0x6C696877
+.4byte 0x65
+.4byte 0x75746572
+.4byte 0x6E72
+.4byte 0x64696F76
+.4byte 0x0
+.4byte 0x65736C65
+.4byte 0x0
+.4byte 0x6669
+.4byte 0x746E6975
+.4byte 0x745F3436
+.4byte 0x0
+.4byte 0x6E656469
+.4byte 0x69666974
+.4byte 0x7265
+.4byte 0x69727473
+.4byte 0x676E
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x72
+.4byte 0x65746E69
+.4byte 0x726567
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x80
+.4byte 0x14
+.4byte 0x40
+.4byte 0x0
+.4byte 0x21
+.4byte 0x20
+.4byte 0x1F
+.4byte 0x1E
+.4byte 0x1D
+.4byte 0x1C
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0xFFFFFFFF
+.4byte 0x2E
+.4byte 0x5C
+.4byte 0x3E
+.4byte 0x3C
+.4byte 0x21
+.4byte 0x3D
+.4byte 0x25
+.4byte 0x2F
+.4byte 0x2A
+.4byte 0x2D
+.4byte 0x2B
+.4byte 0x7D
+.4byte 0x7B
+.4byte 0x29
+.4byte 0x28
+.4byte 0x3B
+.4byte 0x2C
+.4byte 0x22
+.4byte 0x27
+.4byte 0x5F
+.4byte 0x20
+.4byte 0xD
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0xFFFFFFFF
+.4byte 0x666C6573
+.4byte 0x632E6569
+.4byte 0x6E752E73
+.4byte 0x61732D69
+.4byte 0x75627A6C
+.4byte 0x612E6772
+.4byte 0x74
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1ED
+.4byte 0x1A4
+.4byte 0x241
+.4byte 0x8301
+.4byte 0x601
+.4byte 0x241
+.4byte 0x8000
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x80
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x8
+.4byte 0x0
+.4byte 0x0
+.4byte 0x8
+.4byte 0x8
+.4byte 0x20
+.4byte 0x4
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x40
+.4byte 0x1
+.4byte 0x1
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
@@ -0,0 +1,65881 @@
+lui t0,0x53
+addi t0,t0,248
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+ld t0,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,sp,16
+sd t0,8(sp)
+jal ra,63230
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,0(sp)
+addi sp,sp,8
+addi a7,zero,93
+ecall
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+ld a3,0(sp)
+addi sp,sp,8
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-16(gp)
+beq t0,zero,2
+jal zero,121
+addi t0,zero,-344
+add t0,gp,t0
+sd t0,-16(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-48(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-56(gp)
+ld t0,-48(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10644
+addi t0,a0,0
+sd t0,-64(gp)
+ld t0,-64(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-64(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-64(gp)
+ld t2,-8(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sd t0,-72(gp)
+ld t0,-48(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7646
+addi t0,a0,0
+sd t0,-88(gp)
+ld t0,-88(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-80(gp)
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10579
+addi t0,a0,0
+sd t0,-160(gp)
+ld t0,-160(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-48(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8392
+addi t0,a0,0
+sd t0,-168(gp)
+addi t0,zero,80
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8386
+addi t0,a0,0
+sd t0,-176(gp)
+ld t0,-184(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8380
+addi t0,a0,0
+sd t0,-192(gp)
+addi t0,zero,255
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8374
+addi t0,a0,0
+sd t0,-200(gp)
+addi t0,zero,8
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10546
+addi t0,a0,0
+sd t0,-208(gp)
+ld t0,-208(gp)
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-280(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-832(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10510
+addi t0,a0,0
+sd t0,-840(gp)
+ld t0,-848(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8326
+addi t0,a0,0
+sd t0,-936(gp)
+ld t0,-840(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1128
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1136
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1144
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1152
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1160
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1168
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1176
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1184
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1192
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1200
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1208
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1216
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1224
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1232
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1240
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1248
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1256
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1264
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1272
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1288
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-832(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1296
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-352(gp)
+sd t0,-872(gp)
+ld t0,-560(gp)
+sd t0,-976(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-880(gp)
+addi t0,zero,1
+sd t0,-888(gp)
+jal ra,10561
+addi t0,zero,0
+sd t0,-896(gp)
+addi t0,zero,0
+sd t0,-904(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+addi t0,zero,0
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10183
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1392(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10071
+addi t0,a0,0
+sd t0,-1400(gp)
+addi t0,zero,0
+sd t0,-1408(gp)
+addi t0,zero,0
+sd t0,-1416(gp)
+addi t0,zero,0
+sd t0,-1424(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-1464(gp)
+addi t0,zero,0
+sd t0,-1472(gp)
+addi t0,zero,0
+sd t0,-1480(gp)
+addi t0,zero,0
+sd t0,-1488(gp)
+addi t0,zero,0
+sd t0,-1496(gp)
+addi t0,zero,0
+sd t0,-1504(gp)
+addi t0,zero,0
+sd t0,-1512(gp)
+addi t0,zero,0
+sd t0,-1520(gp)
+addi t0,zero,0
+sd t0,-920(gp)
+jal ra,10737
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,zero,-1528
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-1552
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7660
+addi t0,a0,0
+sd t0,-1536(gp)
+addi t0,zero,-1560
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7653
+addi t0,a0,0
+sd t0,-1544(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9759
+addi t0,a0,0
+sd t0,-1840(gp)
+ld t0,-1840(gp)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1848
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1856
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1864
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1872
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1880
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1888
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1896
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1904
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1912
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1920
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1928
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1944
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1968
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1840(gp)
+ld t1,-1832(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2000
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9475
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1136(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1128(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1208(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,3
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9187
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8747
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+addi t2,zero,8
+ld t3,-144(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sd t1,448(t0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,16(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+mul t1,t1,t2
+sd t1,432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,424(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,472(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,424(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,240
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,232
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,224
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,216
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8121
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,208
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,200
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,192
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,184
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,176
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,168
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,160
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,152
+add t1,gp,t1
+sd t1,0(t0)
+jal ra,-192
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,144
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,136
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,128
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,120
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8126
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,96(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8110
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,88(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7654
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7382
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-24(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-672
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-688
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-712
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-720
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-736
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-760
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-776
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,0(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-800
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-8(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-824
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-16(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-848
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-136(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sd t1,-168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-184(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7300
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7276
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7256
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+sd t1,-336(t0)
+jal zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7222
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7195
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7175
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-352(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7151
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-552(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7137
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-560(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-568(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-592(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-600(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-608(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-616(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-624(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-632(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-640(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-648(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-656(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2434
+jal ra,-350
+jal ra,-289
+jal ra,-131
+jal ra,-43
+jal ra,24313
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1008(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1000(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,992(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,984(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-856(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6794
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,33
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,34
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,35
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,36
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,37
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,38
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,39
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,40
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,41
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,42
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,33
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,34
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,35
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,36
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,37
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,38
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,39
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,40
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,41
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,42
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,41311
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1000(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1008(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1040(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1048(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1056(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1072(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4446
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,8
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3972
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1096(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,8(sp)
+jal ra,41711
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1104(t0)
+jal zero,-25
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1384(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,3
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3736
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1600(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3536
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1608(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1992
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1576(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1984
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1584(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1976
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1592(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1968
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1600(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1960
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1952(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3453
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1944(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1952
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1952(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFE
+addi t1,t1,1936
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1928(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,1920(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,54539
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1904(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,8
+addi t1,zero,8
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7353
+ld t0,-48(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-48(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-24(gp)
+addi t0,zero,0
+sd t0,-32(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7375
+jal ra,20072
+addi t0,a0,0
+beq t0,zero,71
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10905
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,653
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1872(t1)
+sd t1,1856(t0)
+jal zero,47
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-208(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-7405
+ld t0,-208(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1888(t1)
+sd t1,1856(t0)
+jal zero,23
+ld t0,-208(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1880(t1)
+sd t1,1856(t0)
+jal zero,7
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1872(t1)
+sd t1,1856(t0)
+jal zero,11
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1896(t1)
+sd t1,1856(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+addi t1,zero,1
+sd t1,1848(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-240(gp)
+sd t0,-256(gp)
+jal zero,16
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-248(gp)
+sd t0,-256(gp)
+jal zero,3
+ld t0,-232(gp)
+sd t0,-256(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,45
+ld t0,-24(gp)
+beq t0,zero,36
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,20
+sd t0,-856(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sd t1,1560(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,56
+sd t1,1448(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7542
+jal zero,60
+ld t0,-24(gp)
+beq t0,zero,24
+ld t0,-96(gp)
+sd t0,-112(gp)
+ld t0,-96(gp)
+sd t0,-120(gp)
+ld t0,-104(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,217
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-128(gp)
+ld t0,-104(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,207
+addi t0,a0,0
+sd t0,-136(gp)
+ld t0,-96(gp)
+sd t0,-144(gp)
+jal zero,11
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,10
+sd t0,-856(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sd t1,1560(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,32
+sd t1,1448(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1594
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,39270
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-896(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,1904(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sd t1,-888(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-64(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,21
+lui t0,0xFFFFE
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,2757
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7805
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,2
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-145
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-169
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-203
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-58
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,39
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-88(gp)
+add t0,t0,t1
+ld t1,24(s0)
+ld t2,-88(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,135
+ld t0,16(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,24(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,127
+jal zero,35
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-51
+addi t0,a0,0
+beq t0,zero,21
+ld t0,24(s0)
+addi t1,zero,1
+sub t1,zero,t1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,-88(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,99
+jal zero,7
+ld t0,-88(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,92
+jal zero,84
+ld t0,24(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,82
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-96
+addi t0,a0,0
+beq t0,zero,38
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-166
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,48
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-177
+addi t0,a0,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,37
+jal zero,29
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-141
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-199
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,14
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1512(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8214
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-464
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-482
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-517
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+ld t0,24(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-537
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-384
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-420
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-67
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-519
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-539
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2356
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-291
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-257
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-22
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-270
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-343
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-356
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-322
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-330
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-42
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-410
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,34
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-430
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-439
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-64
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-478
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-498
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,116
+ld t0,-24(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1776
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1681
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8881
+ld t0,-16(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,63
+ld t0,-16(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,-24(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1626
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8936
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1606
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8956
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-620
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-119
+ld t0,-32(s0)
+beq t0,zero,32
+ld t0,-16(s0)
+ld t1,-88(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,26
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1561
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9001
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-653
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,22
+ld t0,40(s0)
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1002
+addi t0,a0,0
+beq t0,zero,12
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-702
+jal zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-715
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-46
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-16(s0)
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,45
+sd t0,16(sp)
+jal ra,-740
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-756
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+jal zero,18
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-774
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-787
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-510
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1356
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1371
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,29
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi t1,zero,4
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1415
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-85
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,47
+jal zero,45
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,zero,4
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1444
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1469
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1497
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1521
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-203
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-66
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-231
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-70
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-241
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,1040
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-9514
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-1261
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-304(gp)
+beq t0,zero,14
+ld t0,-304(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-312(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-1176
+ld t0,-312(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-312(gp)
+jal zero,52
+ld t0,-160(gp)
+beq t0,zero,44
+ld t0,-160(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-89
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,-296(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFE
+addi t0,t0,1664
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-288(gp)
+sd t0,16(sp)
+jal ra,954
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9608
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9615
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17
+jal zero,29
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1312
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-25
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,871
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1632
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,849
+jal zero,49
+ld t0,16(s0)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,836
+jal zero,36
+ld t0,16(s0)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1600
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,823
+jal zero,23
+ld t0,16(s0)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,810
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,801
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1560
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,782
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-783
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-179
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-809
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-205
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1967
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-308
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(s0)
+jal zero,-12
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-857
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-253
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-884
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+ld t0,-360(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-366
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(s0)
+jal zero,-12
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-925
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-321
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1552
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,597
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-973
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-369
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,549
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-1021
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-417
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1536
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,501
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1731
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-466
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,303
+jal zero,298
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1753
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-564
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,281
+jal zero,276
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1775
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1789
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-365
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,245
+jal zero,76
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1813
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-363
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,221
+jal zero,52
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-273
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,195
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1863
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-251
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,169
+jal zero,164
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1887
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-227
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,145
+jal zero,140
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1911
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1925
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1762
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1955
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-483
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,75
+jal zero,70
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1981
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1995
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1832
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2011
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-463
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+ld t0,24(s0)
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,-304(gp)
+jal zero,3
+ld t0,-200(gp)
+sd t0,-304(gp)
+addi t0,zero,0
+sd t0,-312(gp)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2095
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2111
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2122
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+ld a0,0(t0)
+addi t0,t0,8
+sd t0,40(s0)
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,9
+addi t0,zero,37
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-947
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,15
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2157
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-962
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-87
+ld t0,-304(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-312(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2137
+ld t0,-312(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-312(gp)
+ld t0,24(s0)
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-304(gp)
+jal zero,16
+ld t0,-304(gp)
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-304(gp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-1053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,24
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,1
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-174
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-207
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-240
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-296(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-176(gp)
+sd t0,8(sp)
+jal ra,-117
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-176(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-10672
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-888(t0)
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4543
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10715
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,-160(gp)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-225
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1496(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10787
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-888(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sd t1,-888(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-87
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-888(t0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-147
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-187
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1848(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-73
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-888(t0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4730
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10903
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1488
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1200
+jal zero,10
+ld t0,-840(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1210
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1456
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-984(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-442
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-39
+lui t0,0xFFFFE
+addi t0,t0,1432
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-469
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-70
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1361
+lui t0,0xFFFFE
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-502
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1371
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-512
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-992(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-11086
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-160(gp)
+ld t0,0(t0)
+sd t0,-872(gp)
+ld t0,-880(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-880(gp)
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-352(gp)
+sd t0,-872(gp)
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1352
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-984(gp)
+sd t0,16(sp)
+jal ra,-572
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11134
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,-872(gp)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-59
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,156
+ld t0,-8(s0)
+beq t0,zero,23
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,16
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,140
+jal zero,6
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-167
+jal zero,131
+ld t0,-16(s0)
+beq t0,zero,58
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-181
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,-19
+ld t0,-16(s0)
+beq t0,zero,30
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal zero,19
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1320
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-288
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11298
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-226
+jal zero,72
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,17
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-245
+jal zero,53
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-253
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-896(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-896(gp)
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+jal ra,-270
+jal zero,24
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-896(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-896(gp)
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+jal ra,-288
+jal zero,6
+ld t0,-728(gp)
+sd t0,-976(gp)
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-156
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2931
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2887
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-302
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-928(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-840(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-2755
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,106
+jal zero,104
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal zero,96
+jal zero,94
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal zero,86
+jal zero,84
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-632(gp)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-640(gp)
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-648(gp)
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-808(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-816(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-832(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-560(gp)
+sd t0,-976(gp)
+addi t0,zero,0
+sd t0,-928(gp)
+addi t0,zero,0
+sd t0,-944(gp)
+addi t0,zero,0
+sd t0,-960(gp)
+addi t0,zero,0
+sd t0,-952(gp)
+jal ra,-424
+addi t0,a0,0
+ld t1,-352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,601
+ld t0,-976(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,592
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3187
+addi t0,a0,0
+beq t0,zero,56
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-269
+addi t0,a0,0
+beq t0,zero,33
+ld t0,-8(s0)
+ld t1,-848(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1296
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-663
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11673
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3298
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-609
+jal zero,-34
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3312
+ld t0,-936(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3096
+addi t0,a0,0
+sd t0,-928(gp)
+jal ra,-208
+addi t0,a0,0
+sd t0,-976(gp)
+jal zero,531
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3194
+addi t0,a0,0
+beq t0,zero,133
+ld t0,-872(gp)
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-641
+addi t0,zero,0
+sd t0,-960(gp)
+jal zero,120
+ld t0,-856(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3176
+addi t0,a0,0
+sd t0,-944(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3218
+addi t0,a0,0
+beq t0,zero,42
+ld t0,-8(s0)
+ld t1,-856(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,-968(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1232
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-752
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11762
+ld t0,-944(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3387
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-698
+jal zero,-46
+ld t0,-944(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3401
+ld t0,-944(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2979
+addi t0,a0,0
+sd t0,-960(gp)
+ld t0,-968(gp)
+beq t0,zero,18
+ld t0,-960(gp)
+ld t1,-136(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1192
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11808
+jal zero,32
+ld t0,-960(gp)
+ld t1,-128(gp)
+sltu t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,1152
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-815
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11825
+jal zero,15
+ld t0,-960(gp)
+ld t1,-136(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,9
+ld t0,-960(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+jal ra,-3564
+addi t0,a0,0
+sd t0,-960(gp)
+ld t0,-568(gp)
+sd t0,-976(gp)
+jal zero,393
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-773
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-858
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11868
+jal zero,3
+ld t0,-872(gp)
+sd t0,-960(gp)
+jal ra,-795
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-802
+jal zero,22
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-855
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11896
+jal zero,5
+ld t0,-408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-866
+ld t0,-576(gp)
+sd t0,-976(gp)
+jal zero,332
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+jal ra,-834
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3366
+addi t0,a0,0
+sd t0,-952(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-492
+addi t0,a0,0
+beq t0,zero,40
+ld t0,-8(s0)
+ld t1,-864(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-930
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11940
+ld t0,-872(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,299
+ld t0,-952(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3572
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-883
+jal zero,-41
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-891
+jal zero,11
+ld t0,-416(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-938
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11979
+ld t0,-952(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3604
+ld t0,-584(gp)
+sd t0,-976(gp)
+jal zero,246
+ld t0,-872(gp)
+ld t1,-424(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-920
+ld t0,-656(gp)
+sd t0,-976(gp)
+jal zero,236
+ld t0,-872(gp)
+ld t1,-432(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-930
+ld t0,-664(gp)
+sd t0,-976(gp)
+jal zero,226
+ld t0,-872(gp)
+ld t1,-440(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-940
+ld t0,-672(gp)
+sd t0,-976(gp)
+jal zero,216
+ld t0,-872(gp)
+ld t1,-448(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-950
+ld t0,-680(gp)
+sd t0,-976(gp)
+jal zero,206
+ld t0,-872(gp)
+ld t1,-456(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-960
+ld t0,-688(gp)
+sd t0,-976(gp)
+jal zero,196
+ld t0,-872(gp)
+ld t1,-464(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-970
+ld t0,-696(gp)
+sd t0,-976(gp)
+jal zero,186
+ld t0,-872(gp)
+ld t1,-472(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-980
+ld t0,-704(gp)
+sd t0,-976(gp)
+jal zero,176
+ld t0,-872(gp)
+ld t1,-480(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-990
+ld t0,-712(gp)
+sd t0,-976(gp)
+jal zero,166
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1000
+ld t0,-720(gp)
+sd t0,-976(gp)
+jal zero,156
+ld t0,-872(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1010
+ld t0,-736(gp)
+sd t0,-976(gp)
+jal zero,146
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1020
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1027
+ld t0,-752(gp)
+sd t0,-976(gp)
+jal zero,3
+ld t0,-744(gp)
+sd t0,-976(gp)
+jal zero,126
+ld t0,-872(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1040
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1047
+jal zero,5
+ld t0,-512(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1094
+ld t0,-760(gp)
+sd t0,-976(gp)
+jal zero,104
+ld t0,-872(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1062
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1069
+ld t0,-776(gp)
+sd t0,-976(gp)
+jal zero,3
+ld t0,-768(gp)
+sd t0,-976(gp)
+jal zero,84
+ld t0,-872(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1082
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1089
+ld t0,-792(gp)
+sd t0,-976(gp)
+jal zero,3
+ld t0,-784(gp)
+sd t0,-976(gp)
+jal zero,64
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1102
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1109
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1116
+jal zero,5
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1163
+jal zero,5
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1168
+ld t0,-800(gp)
+sd t0,-976(gp)
+jal zero,30
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-1237
+lui t0,0xFFFFE
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1665
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2534
+jal ra,-2551
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12235
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-1178
+ld t0,-872(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-376(gp)
+sd t0,-872(gp)
+jal zero,67
+ld t0,-872(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-368(gp)
+sd t0,-872(gp)
+jal zero,58
+ld t0,-872(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-360(gp)
+sd t0,-872(gp)
+jal zero,49
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-408(gp)
+sd t0,-872(gp)
+jal zero,40
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-416(gp)
+sd t0,-872(gp)
+jal zero,31
+ld t0,-872(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-504(gp)
+sd t0,-872(gp)
+jal zero,22
+ld t0,-872(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-544(gp)
+sd t0,-872(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1320
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12330
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+ld t1,0(t1)
+ld t2,16(s0)
+ld t2,0(t2)
+ld t3,16(s0)
+ld t3,0(t3)
+ld t4,16(s0)
+ld t4,0(t4)
+ld t5,16(s0)
+ld t5,0(t5)
+ld t6,-1392(gp)
+divu t5,t5,t6
+add t4,t4,t5
+ld t5,-1392(gp)
+divu t4,t4,t5
+add t3,t3,t4
+ld t4,-1392(gp)
+divu t3,t3,t4
+add t2,t2,t3
+ld t3,-1392(gp)
+divu t2,t2,t3
+add t1,t1,t2
+ld t2,-1392(gp)
+divu t1,t1,t2
+add t0,t0,t1
+ld t1,-1392(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-11854
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11677
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-11666
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-11655
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-11644
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,56(s0)
+sd t0,8(sp)
+jal ra,-11633
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,64(s0)
+sd t0,8(sp)
+jal ra,-11622
+ld t0,16(s0)
+ld t1,-1376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1608(gp)
+sd t0,8(sp)
+jal ra,-11617
+ld t0,-1400(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-105
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-11753
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,15
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1648(gp)
+sd t0,8(sp)
+jal ra,-11648
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1408(gp)
+sd t0,8(sp)
+jal ra,-11769
+ld t0,-8(s0)
+sd t0,-1408(gp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1416(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-1424(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1424(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11901
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11953
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3796
+addi t0,a0,0
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11980
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-222
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1304(gp)
+sd t0,16(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1304(gp)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12041
+addi t0,a0,0
+ld t1,-1328(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,43
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11996
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12010
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8900
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6913
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1392(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-1400(gp)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,32
+addi t0,zero,1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12158
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1772
+lui t0,0xFFFFE
+addi t0,t0,992
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12189
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2206
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12216
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-48
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-64
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+ld t1,-1576(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1432(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1432(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1804
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12814
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1432(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1616(gp)
+ld t1,-1432(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+ld t0,-1800(gp)
+ld t1,-1432(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1848
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12858
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+ld t0,-1432(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1640(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-64
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1892
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12902
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+ld t1,-1576(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-1432(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1808(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-108
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1936
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12946
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-1432(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,-1432(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,912
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1970
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12980
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,162
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-976(gp)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-976(gp)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-976(gp)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-976(gp)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-976(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,53
+jal zero,51
+ld t0,-976(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,43
+jal zero,41
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+ld t0,-976(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,26
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-277
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5696
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-976(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-976(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-976(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-976(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-285
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2551
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2587
+lui t0,0xFFFFE
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2983
+ld t0,-976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2597
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2993
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2593
+lui t0,0xFFFFE
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3021
+ld t0,-976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2635
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3031
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-976(gp)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1989
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13644
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2685
+lui t0,0xFFFFE
+addi t0,t0,872
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3115
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2716
+lui t0,0xFFFFE
+addi t0,t0,840
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-928(gp)
+sd t0,16(sp)
+jal ra,-3148
+addi sp,sp,16
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1056
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3174
+jal zero,45
+ld t0,16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3187
+jal zero,32
+ld t0,16(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1080
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3199
+jal zero,20
+ld t0,16(s0)
+ld t1,-1368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,808
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3212
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3219
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,792
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2815
+lui t0,0xFFFFE
+addi t0,t0,776
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3243
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-88
+lui t0,0xFFFFE
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3253
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+lui t0,0xFFFFE
+addi t0,t0,1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3263
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,147
+jal ra,-465
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-280
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13850
+jal zero,2
+jal ra,-2234
+jal zero,-18
+jal ra,-868
+addi t0,a0,0
+beq t0,zero,83
+jal ra,267
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+ld t0,-928(gp)
+sd t0,-16(s0)
+jal ra,-2250
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,54
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,106
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,276
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13110
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13252
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13240
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13322
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,8721
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1232(t0)
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-329
+jal zero,7
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2661
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-421
+jal zero,42
+ld t0,-976(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2327
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2334
+ld t0,-1352(gp)
+sd t0,-8(s0)
+jal zero,3
+ld t0,-1360(gp)
+sd t0,-8(s0)
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-928(gp)
+sd t0,-16(s0)
+jal ra,-2348
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2621
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-461
+jal zero,2
+jal ra,-421
+jal zero,-150
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1304(gp)
+sd t0,8(sp)
+jal ra,-1456
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1152(t0)
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-1660
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1464(gp)
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,792
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-3076
+lui t0,0xFFFFE
+addi t0,t0,728
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3506
+addi sp,sp,8
+jal zero,51
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,-1384(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-928(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1707
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2470
+jal zero,25
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-577
+ld t0,-1384(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,720
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1733
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1344(gp)
+sd t0,-8(s0)
+jal ra,-1146
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-2517
+jal ra,-1150
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2521
+jal zero,-4
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1352(gp)
+sd t0,-8(s0)
+jal ra,-2531
+jal zero,-9
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-639
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-976(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-2560
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-2567
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,48
+jal zero,12
+ld t0,16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1344(gp)
+sd t0,8(sp)
+jal ra,-421
+ld t0,-976(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-968(gp)
+jal ra,-2592
+jal ra,65
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-968(gp)
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-968(gp)
+ld t0,-8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,10
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-119
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-1368(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-481
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-1278
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-960(gp)
+sd t0,-8(s0)
+jal ra,-2669
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-734
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-898
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-754
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14324
+jal zero,2
+jal ra,-2708
+jal zero,-18
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,357
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,56
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-928(gp)
+sd t0,-8(s0)
+jal ra,-2733
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,334
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2945
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-773
+jal zero,28
+ld t0,-976(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1636
+jal zero,20
+ld t0,-976(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1768
+jal zero,12
+ld t0,-976(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,3129
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-801
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6465
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-6475
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6666
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6182
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7397
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6696
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,7487
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6217
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7362
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6226
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13856
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6307
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6873
+addi t0,a0,0
+beq t0,zero,25
+jal ra,-1746
+jal ra,-1716
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-138
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1725
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13869
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1735
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7368
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13923
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-1806
+jal ra,-1776
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13920
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7570
+jal zero,11
+jal ra,-1790
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-1794
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7559
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13997
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2039
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1005
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14661
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14033
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-211
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14067
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-1918
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14118
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,56
+ld t0,-720(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1127
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-928(gp)
+sd t0,16(s0)
+jal ra,-3144
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,29
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3158
+jal ra,115
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1187
+jal zero,14
+jal ra,-1227
+jal ra,-1997
+jal ra,-1967
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7093
+ld t0,-1352(gp)
+sd t0,-40(s0)
+jal ra,-1978
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-976(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-3191
+ld t0,-8(s0)
+beq t0,zero,15
+ld t0,-40(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1352(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+jal ra,-1042
+jal zero,3
+ld t0,-1344(gp)
+sd t0,-40(s0)
+jal ra,66
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-40(s0)
+ld t1,-48(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+jal ra,-1059
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7391
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1899
+ld t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1488(gp)
+jal zero,5
+ld t0,-744(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1345
+ld t0,-8(s0)
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1914
+jal zero,18
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14211
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1932
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,236
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1848
+addi t0,a0,0
+beq t0,zero,221
+ld t0,-976(gp)
+sd t0,-16(s0)
+jal ra,-3288
+jal ra,227
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1140
+ld t0,-1344(gp)
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2064
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2071
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7029
+jal ra,-2120
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6940
+jal ra,-2084
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2088
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2136
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7177
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2010
+jal zero,160
+ld t0,-16(s0)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-2106
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2155
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6987
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2032
+jal ra,-2166
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+jal ra,-2172
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7141
+jal zero,128
+ld t0,-16(s0)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2138
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2142
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2190
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7123
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2064
+jal zero,106
+ld t0,-16(s0)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2160
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7101
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2086
+jal zero,84
+ld t0,-16(s0)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2182
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2231
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2189
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7079
+jal ra,-2238
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6822
+jal ra,-2202
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6891
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2128
+jal zero,42
+ld t0,-16(s0)
+ld t1,-792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+jal ra,-2224
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2228
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2276
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7037
+jal ra,-2280
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6780
+jal ra,-2244
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2293
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6849
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2170
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,182
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2016
+addi t0,a0,0
+beq t0,zero,167
+ld t0,-976(gp)
+sd t0,-16(s0)
+jal ra,-3530
+jal ra,173
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+ld t0,-8(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-2350
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2760
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4179
+jal zero,16
+ld t0,-24(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2326
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2739
+ld t0,-1352(gp)
+sd t0,-8(s0)
+jal ra,-2335
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2339
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2387
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6716
+jal zero,96
+ld t0,-16(s0)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,-8(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+ld t0,-24(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-2410
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2700
+jal ra,-2372
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2376
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2424
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6721
+jal zero,34
+jal ra,-2384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2388
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2436
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6709
+jal ra,-2440
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-112(gp)
+sd t0,16(sp)
+jal ra,6620
+jal ra,-2404
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2408
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2456
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6773
+ld t0,-1344(gp)
+sd t0,-8(s0)
+jal zero,25
+ld t0,-24(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,640
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4290
+jal zero,12
+jal ra,-2431
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2435
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2483
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6662
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2357
+jal zero,-168
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,91
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2170
+addi t0,a0,0
+beq t0,zero,76
+ld t0,-976(gp)
+sd t0,-16(s0)
+jal ra,-3718
+jal ra,82
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1570
+ld t0,-16(s0)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2492
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2496
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2544
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6643
+jal zero,36
+ld t0,-16(s0)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2510
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2514
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2562
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6667
+jal zero,18
+ld t0,-16(s0)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2528
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2532
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2580
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6691
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2454
+jal zero,-77
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-1940
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-1870
+ld t0,-976(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15440
+jal zero,2
+jal ra,-3824
+jal zero,-18
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3834
+jal ra,-2467
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-1368(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1222
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,11
+jal ra,-571
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1873
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,221
+ld t0,-976(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-968(gp)
+jal ra,-3865
+addi t0,zero,0
+sd t0,-968(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-976(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sd t0,-32(s0)
+jal ra,-3879
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-976(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-3889
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1915
+jal ra,-1388
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1922
+jal ra,-2730
+ld t0,-16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-112(gp)
+sd t0,16(sp)
+jal ra,6354
+jal zero,10
+jal ra,-2716
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-120(gp)
+sd t0,16(sp)
+jal ra,6344
+ld t0,-1344(gp)
+sd t0,-16(s0)
+jal zero,83
+jal ra,-2272
+addi t0,a0,0
+beq t0,zero,5
+jal ra,419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,76
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-928(gp)
+sd t0,-40(s0)
+jal ra,-3945
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,32
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1731
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-2793
+ld t0,-16(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+jal ra,-2768
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1664(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6292
+jal zero,10
+jal ra,-2778
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6282
+jal zero,23
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3996
+jal ra,-723
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2025
+jal zero,8
+jal ra,-2065
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,193
+ld t0,-1344(gp)
+sd t0,-16(s0)
+ld t0,-32(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1352(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1862
+jal ra,-2823
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2827
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6526
+ld t0,-1344(gp)
+sd t0,-16(s0)
+ld t0,-24(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1344(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1887
+ld t0,-1344(gp)
+sd t0,-16(s0)
+jal ra,-2850
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+jal ra,-2856
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6289
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-7488
+addi t0,a0,0
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6169
+jal zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1322
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6152
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-944(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1312(gp)
+sd t0,8(sp)
+jal ra,-3206
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1152(t0)
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-944(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+ld t0,16(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3410
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sub t0,zero,t0
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+jal ra,6833
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1208(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1244
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-7609
+addi t0,a0,0
+beq t0,zero,10
+jal ra,-3044
+jal ra,-3014
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-141
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15195
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+jal ra,-3044
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15188
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3054
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6049
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-952(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1320(gp)
+sd t0,8(sp)
+jal ra,-3347
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-952(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7346
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-5228
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1152(t0)
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-952(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3571
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6721
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+ld t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1480(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2971
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-960(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+jal ra,-1706
+ld t0,-1344(gp)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+ld t0,-976(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-110
+jal ra,-4376
+ld t0,-1352(gp)
+addi a0,t0,0
+jal zero,11
+jal zero,9
+jal ra,-2441
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-183
+ld t0,-1344(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,-976(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,115
+jal ra,-4407
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+jal ra,-4414
+jal ra,-1141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-8(s0)
+jal ra,-3218
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6254
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3097
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+jal ra,-4439
+ld t0,-976(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4446
+jal ra,-2758
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1765
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2449
+jal zero,2
+jal ra,-1772
+ld t0,-976(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-4464
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-16(s0)
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,6246
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6352
+ld t0,-976(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4485
+jal ra,-2797
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1804
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2488
+jal zero,2
+jal ra,-1811
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,6382
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6321
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2616
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2621
+jal zero,5
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2626
+ld t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1504(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-976(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,63
+jal ra,-4553
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-4560
+jal ra,-1287
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-16(s0)
+jal ra,-3364
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6108
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3243
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-4585
+ld t0,-976(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4592
+jal ra,-2904
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1911
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2595
+jal zero,2
+jal ra,-1918
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2710
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2715
+jal zero,5
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2720
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,6092
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6193
+ld t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1496(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,616
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7549
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7683
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,576
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7569
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,568
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7703
+addi t0,a0,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,536
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7589
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,528
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7723
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,520
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7623
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,60
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,504
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7637
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,480
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7655
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,456
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7669
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,432
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7683
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5448
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1592(gp)
+sd t0,16(sp)
+jal ra,5791
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5431
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1648(gp)
+sd t0,16(sp)
+jal ra,5774
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5415
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+ld t0,16(s0)
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8263
+addi t0,a0,0
+beq t0,zero,11
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5393
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,400
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5498
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16508
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1648(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5358
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5640
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,5342
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5624
+ld t0,-144(gp)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8341
+addi t0,a0,0
+beq t0,zero,12
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,5314
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,368
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5577
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16587
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-1408(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-976(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,104
+jal ra,-4993
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,96
+jal ra,-3631
+addi t0,a0,0
+beq t0,zero,88
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2499
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2641
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-144(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-15846
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3309
+addi t0,a0,0
+beq t0,zero,50
+jal ra,-5035
+ld t0,-976(gp)
+ld t1,-800(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5042
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,38
+jal ra,-3678
+addi t0,a0,0
+beq t0,zero,31
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2546
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2688
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-144(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-15895
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3184
+jal zero,-54
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3109
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3194
+jal zero,2
+jal ra,-5094
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3201
+ld t0,-8(s0)
+beq t0,zero,4
+ld t0,-16(s0)
+sub t0,zero,t0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1328(gp)
+sd t0,8(sp)
+jal ra,-4187
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-16(s0)
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-4380
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16139
+addi t0,a0,0
+ld t1,-1368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-16011
+ld t0,-976(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16161
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16170
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3022
+jal ra,-5185
+jal zero,216
+ld t0,-976(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,209
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4174
+addi t0,a0,0
+beq t0,zero,78
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-16090
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16200
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16209
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3061
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-16081
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16187
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16196
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,5678
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-16076
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+jal ra,-8153
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-984(gp)
+sd t1,1200(t0)
+ld t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1472(gp)
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-557
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9242
+addi t0,a0,0
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,792
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-5934
+lui t0,0xFFFFE
+addi t0,t0,328
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-6364
+addi sp,sp,8
+jal ra,-5303
+addi t0,zero,0
+sd t0,-32(s0)
+jal ra,-3938
+addi t0,a0,0
+beq t0,zero,20
+ld t0,-32(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-32(s0)
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2810
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,-2953
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3348
+jal zero,-21
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-522
+ld t0,-24(s0)
+sd t0,-1440(gp)
+addi t0,zero,0
+sd t0,-1448(gp)
+ld t0,24(s0)
+sd t0,-1456(gp)
+jal ra,-3649
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2656
+jal zero,-4
+addi t0,zero,0
+sd t0,-1456(gp)
+ld t0,24(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4913
+ld t0,-1448(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,5563
+addi t0,zero,0
+sd t0,-1448(gp)
+ld t0,-8(s0)
+beq t0,zero,11
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sub t0,zero,t0
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-482
+jal zero,9
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-491
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5357
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3421
+jal zero,2
+jal ra,-3461
+addi t0,zero,0
+sd t0,-1440(gp)
+addi t0,zero,0
+sd t0,-1408(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1432(gp)
+sd t0,-8(s0)
+ld t0,-1432(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,4838
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4236
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,5180
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4110
+jal zero,-26
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-4295
+jal ra,-4265
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5085
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,4787
+jal zero,-22
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16548
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,312
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8398
+addi t0,a0,0
+beq t0,zero,3
+jal ra,483
+jal zero,24
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8410
+addi t0,a0,0
+beq t0,zero,3
+jal ra,588
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,296
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8422
+addi t0,a0,0
+beq t0,zero,2
+jal ra,681
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16532
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3534
+ld t0,-1368(gp)
+sd t0,-8(s0)
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-4826
+ld t0,-1592(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5128
+jal zero,89
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16589
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16557
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-16435
+ld t0,-1592(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5097
+jal zero,58
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16582
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4328
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2341
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,-1592(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16605
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,5066
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-16484
+jal zero,15
+ld t0,-1592(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16628
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,5039
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+jal ra,-5698
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1336(gp)
+sd t0,8(sp)
+jal ra,-4775
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+addi t0,a0,0
+addi a0,t0,0
+jal zero,180
+jal ra,-307
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4302
+addi t0,a0,0
+beq t0,zero,67
+jal ra,-2451
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-24(s0)
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4533
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4541
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4875
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4415
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-976(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5759
+jal ra,-2486
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-4566
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4850
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4440
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-27
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sd t0,8(sp)
+jal ra,5175
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,82
+jal ra,-5799
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1328(gp)
+sd t0,8(sp)
+jal ra,-4876
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-264
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16799
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9407
+addi t0,a0,0
+beq t0,zero,32
+ld t0,-40(s0)
+sub t0,zero,t0
+sd t0,-40(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t0,t1
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,4415
+jal zero,11
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6480
+jal zero,12
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,200
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6492
+jal zero,7
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3985
+ld t0,-1344(gp)
+sd t0,-48(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-432
+ld t0,-1512(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1512(gp)
+ld t0,-48(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3935
+ld t0,-976(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-2645
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1456(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1456(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-3770
+ld t0,-1456(gp)
+ld t1,-1360(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4739
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4324
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4615
+jal zero,20
+ld t0,-1456(gp)
+ld t1,-1360(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-1456(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1360(gp)
+sd t0,8(sp)
+jal ra,-3800
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4300
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1448(gp)
+sd t0,8(sp)
+jal ra,4744
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t0,t1
+sd t0,-1448(gp)
+ld t0,-1520(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1520(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-1440(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16979
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9585
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9975
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,152
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6638
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5070
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+jal ra,-6042
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-6049
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1440(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17031
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-144(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1865
+jal ra,-4866
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1648(gp)
+sd t0,8(sp)
+jal ra,-4872
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4231
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17038
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-4885
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4531
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4759
+jal zero,6
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4067
+jal ra,-6100
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4207
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5167
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+jal ra,-6139
+ld t0,-976(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-6146
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17104
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4982
+jal ra,-4952
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1648(gp)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,4398
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4964
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4389
+jal ra,-4970
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4974
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,4089
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-4985
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4431
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4859
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4301
+jal zero,6
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4172
+jal ra,-6205
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4312
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1440(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17198
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9804
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10194
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6857
+ld t0,-976(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-6250
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4276
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4361
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5099
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,3990
+jal ra,-5079
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3981
+jal ra,-5088
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5094
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4177
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5103
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4042
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4977
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5032
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3939
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5046
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4052
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,21
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,3857
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-9
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+ld t1,-144(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,3824
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-7332
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1176(t0)
+jal ra,-5344
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3830
+jal zero,189
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10296
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10307
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2269
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,72
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7092
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18102
+ld t0,-1608(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-5286
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3777
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5162
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3765
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,16(sp)
+jal ra,3755
+jal ra,4274
+ld t0,-1664(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-257
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,16(sp)
+jal ra,3738
+jal ra,4257
+ld t0,-1544(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1304(gp)
+sd t0,8(sp)
+jal ra,-5610
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17480
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17506
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1664(gp)
+sd t0,16(sp)
+jal ra,4064
+jal ra,-5387
+jal ra,-5357
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3993
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3694
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-5380
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4036
+jal ra,-5384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3674
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-5400
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4016
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5274
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1328(gp)
+sd t0,8(sp)
+jal ra,-5686
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17599
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1078
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3632
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1664(gp)
+sd t0,16(sp)
+jal ra,3975
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1176(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,72(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1176(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-224(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-18279
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-10035
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-32(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,56
+add t0,gp,t0
+sd t0,-984(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-984(gp)
+sd t1,1200(t0)
+jal ra,-16941
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7434
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7448
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7468
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+ld t1,-144(gp)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7486
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1136(t0)
+jal ra,-17572
+jal ra,-16963
+jal ra,-444
+jal ra,6848
+jal ra,6965
+jal ra,7714
+jal ra,8134
+jal ra,8531
+jal ra,9126
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,8
+jal ra,27560
+jal ra,27609
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-32(s0)
+jal ra,27654
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,312
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9831
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1336(gp)
+sd t0,24(sp)
+ld t0,-1360(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6069
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9853
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1336(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6091
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9875
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1336(gp)
+sd t0,24(sp)
+ld t0,-1360(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6113
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6129
+ld t0,-8(s0)
+beq t0,zero,272
+jal ra,43294
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,261
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,43313
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10183
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,242
+jal ra,43327
+addi t0,a0,0
+sd t0,-984(gp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8004
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-96
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-984(gp)
+sd t0,16(sp)
+ld t0,-152(gp)
+sd t0,24(sp)
+ld t0,-48(gp)
+sd t0,32(sp)
+jal ra,-8021
+addi sp,sp,32
+ld t0,-984(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-292
+addi t0,a0,0
+sd t0,-992(gp)
+ld t0,-992(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10544
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-136
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-984(gp)
+sd t0,16(sp)
+jal ra,-8048
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18610
+jal ra,-18104
+jal ra,-17754
+jal ra,-17375
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+sd t0,8(sp)
+jal ra,-17289
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-984(gp)
+sd t0,8(sp)
+jal ra,-17282
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-17273
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1128(t0)
+jal ra,-4818
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-17269
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8105
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-280
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-888(gp)
+sd t0,24(sp)
+ld t0,-904(gp)
+sd t0,32(sp)
+jal ra,-8122
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,-344
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld t0,-880(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9267
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-880(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9249
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-912(gp)
+sd t0,40(sp)
+jal ra,-8159
+addi sp,sp,40
+lui t0,0xFFFFE
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-1464(gp)
+sd t0,16(sp)
+ld t0,-1472(gp)
+sd t0,24(sp)
+ld t0,-1480(gp)
+sd t0,32(sp)
+jal ra,-8176
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,-472
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-1488(gp)
+sd t0,16(sp)
+ld t0,-1496(gp)
+sd t0,24(sp)
+ld t0,-1504(gp)
+sd t0,32(sp)
+ld t0,-1512(gp)
+sd t0,40(sp)
+ld t0,-1520(gp)
+sd t0,48(sp)
+jal ra,-8197
+addi sp,sp,48
+ld t0,-920(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-544
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+ld t0,-984(gp)
+sd t0,24(sp)
+jal ra,-8217
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18779
+jal zero,-272
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-592
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-984(gp)
+sd t0,16(sp)
+jal ra,-8243
+addi sp,sp,16
+jal ra,3961
+jal ra,-813
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,5
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,27315
+ld t0,-1416(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8268
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-656
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-1416(gp)
+sd t0,16(sp)
+ld t0,-1424(gp)
+ld t1,-1416(gp)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-8285
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-744
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8296
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-816
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,32(sp)
+jal ra,-8327
+addi sp,sp,32
+jal ra,2085
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8339
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-856
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-8350
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8371
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-936
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,24(sp)
+jal ra,-8390
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8411
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1840(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8454
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+ld t1,-1648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,16(s0)
+ld t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1664(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,16(s0)
+ld t1,-1720(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1624(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,16(s0)
+ld t1,-1640(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+ld t0,16(s0)
+ld t1,-1808(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-72(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-552(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,24(s0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-128(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+jal ra,17925
+lui t0,0xFFFFE
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8670
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-236
+jal ra,-9556
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,19015
+jal zero,21
+jal ra,17904
+lui t0,0xFFFFE
+addi t0,t0,-1064
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8691
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-257
+jal ra,-9577
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,18994
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-114
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+jal ra,-10985
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-72(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-560(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(gp)
+ld t1,-152(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+sd t0,8(sp)
+jal ra,-80
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11156
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11722
+addi t0,a0,0
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,-1080
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-8414
+lui t0,0xFFFFE
+addi t0,t0,-1120
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11634
+addi t0,a0,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11643
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(sp)
+jal ra,-8863
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19425
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11537
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11545
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11553
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11561
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11569
+addi t0,a0,0
+ld t1,56(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11545
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11567
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,15
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11589
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,3
+sd t0,16(sp)
+jal ra,-11611
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11633
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11655
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-146
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-138
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-130
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-344
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11393
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11821
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11829
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11837
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11845
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-11821
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11505
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-282
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-274
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-507
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11556
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11938
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11948
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12004
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12012
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12020
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12028
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12036
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-12014
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-12024
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12080
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11718
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-514
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-506
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-498
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-721
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-11770
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12152
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12162
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12172
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12182
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12238
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12246
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12254
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12262
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12270
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12278
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12286
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12264
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12274
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12284
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12294
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12350
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12358
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12366
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12374
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-12010
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-806
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-790
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-156
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-1013
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12062
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12444
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12454
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12464
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12474
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12530
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12538
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12546
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12554
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12562
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12540
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12550
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12560
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12570
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12626
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12634
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12642
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12650
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12286
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1028
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-136
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-1268
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12317
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12745
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12753
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-12729
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12413
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1584(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1154
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-200(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-216(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-224(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-264(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-280(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1144
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,16227
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-150
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11475
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11456
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-10364
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,-1160
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11519
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11499
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-10407
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10428
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-1208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10439
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10450
+jal ra,-11332
+lui t0,0xFFFFE
+addi t0,t0,-1240
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10461
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-192(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+sd t0,16(sp)
+jal ra,-105
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10482
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+sd t0,16(sp)
+jal ra,-125
+jal ra,-11378
+lui t0,0xFFFFE
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10507
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+sd t0,16(sp)
+jal ra,-151
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10528
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+sd t0,16(sp)
+jal ra,-171
+jal ra,-11424
+lui t0,0xFFFFE
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10553
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,16(sp)
+jal ra,-197
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10574
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+sd t0,16(sp)
+jal ra,-217
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10594
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,16(sp)
+jal ra,-237
+jal ra,-11490
+lui t0,0xFFFFE
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10619
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+sd t0,16(sp)
+jal ra,-263
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10640
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+sd t0,16(sp)
+jal ra,-283
+jal ra,-11536
+lui t0,0xFFFFE
+addi t0,t0,-1296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10665
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+sd t0,16(sp)
+jal ra,-309
+jal ra,-11562
+lui t0,0xFFFFE
+addi t0,t0,-1312
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10691
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+sd t0,16(sp)
+jal ra,-335
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10712
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,16(sp)
+jal ra,-355
+lui t0,0xFFFFE
+addi t0,t0,-1248
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10732
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-288(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,16(sp)
+jal ra,-375
+jal ra,-11628
+lui t0,0xFFFFE
+addi t0,t0,-1328
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-10757
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+jal ra,-440
+jal ra,-11650
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,-13390
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,-13412
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,53
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,50
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,t0,0
+jal zero,28
+jal zero,15
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,109
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+jal zero,104
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-96(gp)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13598
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13191
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,40
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13634
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-96(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-181
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,10
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-218
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1360
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10616
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21626
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-189
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-284
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-308
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-1392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10706
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21716
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-279
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-888(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,1176(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1920(t0)
+sd t0,16(sp)
+ld t0,-1584(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,32(sp)
+jal ra,-2122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-35
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+sd t0,16(sp)
+jal ra,-1245
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1912(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,32(sp)
+jal ra,-2207
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-178
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2519
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-220
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2561
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1888(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2603
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-304
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1880(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2645
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-346
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1872(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2687
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-388
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1864(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,40(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-430
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1856(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2499
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-470
+jal zero,21
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1840(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2520
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-491
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1848(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,32(sp)
+jal ra,-2398
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-531
+jal zero,21
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1832(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,32(sp)
+jal ra,-2419
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-552
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+sd t0,32(sp)
+jal ra,-2243
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-590
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1936(t0)
+sd t0,16(sp)
+jal ra,-1983
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-622
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1816(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1944(t0)
+sd t0,32(sp)
+jal ra,-2689
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-660
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1248(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+sd t0,16(sp)
+ld t0,-1584(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1928(t0)
+sd t0,32(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-700
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1240(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-879
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2966
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2950
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2934
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2896
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2417
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-895
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-935
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2954
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2938
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-937
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2085
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-68
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1013
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3074
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3058
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3042
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3026
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2923
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1025
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-956
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22116
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14124
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-12006
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-1341
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22058
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22142
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-99
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1216(t1)
+ld t2,-24(s0)
+add t1,t1,t2
+sd t1,1216(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1648(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sub t0,t0,t1
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1121
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1100
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+ld t1,-8(s0)
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1136(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1648(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1152(t3)
+sub t2,t2,t3
+ld t3,-8(s0)
+add t2,t2,t3
+ld t3,-144(gp)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-63
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+sltu t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+jal zero,-25
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t2,zero,1
+sub t1,t1,t2
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12006
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1448(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sd t1,1488(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+sd t1,1440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1600(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1592(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15100
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15128
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1589
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1552(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15154
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15168
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1536(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15182
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1643
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1528(t0)
+sd t0,24(sp)
+jal ra,-1655
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1520(t0)
+sd t0,24(sp)
+jal ra,-1667
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15232
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1693
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+sd t0,24(sp)
+jal ra,-1705
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,132
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,24(sp)
+jal ra,-1727
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+sd t0,24(sp)
+jal ra,-1739
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+sd t0,24(sp)
+jal ra,-1751
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15316
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15330
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1791
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15356
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15370
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15384
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1845
+jal zero,127
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,24(sp)
+jal ra,-1858
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,28
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+sd t0,24(sp)
+jal ra,-1870
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+sd t0,24(sp)
+jal ra,-1882
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,36
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,24(sp)
+jal ra,-1894
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15459
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1920
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15485
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1946
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15511
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1972
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1616(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sd t1,1376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1360(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-12799
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1160(t1)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1160(t1)
+sd t1,1376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sd t1,1360(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,11
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+ld t2,24(s0)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15685
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-2146
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2160
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2174
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2188
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,32
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,24(sp)
+jal ra,-2202
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,40
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+sd t0,24(sp)
+jal ra,-2216
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+sd t0,24(sp)
+jal ra,-2230
+jal zero,113
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,24(sp)
+jal ra,-2245
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,4
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2259
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2273
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,12
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2287
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,24(sp)
+jal ra,-2301
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,20
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+sd t0,24(sp)
+jal ra,-2315
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+sd t0,24(sp)
+jal ra,-2329
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,28
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+sd t0,24(sp)
+jal ra,-2343
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2438
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15870
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15886
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15902
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15918
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2512
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15942
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,1
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,115
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2582
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16012
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2606
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16036
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2634
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1488(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2650
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16080
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1440(t0)
+addi t0,zero,0
+sd t0,-40(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,-40(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,129
+jal zero,124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16136
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2730
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16160
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2758
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1488(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2774
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16204
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1440(t0)
+addi t0,zero,0
+sd t0,-40(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,-40(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,135
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2844
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2854
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2864
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2877
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2902
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16332
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2926
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16356
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2950
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1360(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,133
+jal zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,118
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2988
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2998
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3008
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3021
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3046
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3062
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3090
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1400(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-256(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-24472
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-16228
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1432
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-13992
+addi sp,sp,16
+jal zero,216
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-272(gp)
+sd t0,8(sp)
+jal ra,-75
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16520
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1480
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14026
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24588
+jal ra,-1628
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+sd t0,16(sp)
+jal ra,-24588
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1544
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14067
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24629
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-13944
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1810
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-24646
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1600
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14123
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24685
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,16(sp)
+jal ra,-24684
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14163
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24725
+lui t0,0xFFFFE
+addi t0,t0,-1752
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1688(t0)
+ld t1,-24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-14208
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6497
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16749
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-136
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14255
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24817
+jal ra,-23420
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1672(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14113
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+sd t0,8(sp)
+jal ra,-2009
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1632(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1632(t0)
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-24860
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,358
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1077
+addi t0,a0,0
+beq t0,zero,352
+jal ra,-17386
+jal ra,-22357
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi t1,zero,8
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-24890
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+addi t2,zero,8
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,324
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-976
+addi t0,a0,0
+beq t0,zero,318
+addi t0,zero,0
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+addi t0,zero,0
+sd t0,-72(s0)
+ld t0,-72(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1440(t1)
+sltu t0,t0,t1
+beq t0,zero,109
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-64(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+sd t0,16(sp)
+jal ra,-24940
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-64(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-763
+addi t0,a0,0
+beq t0,zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,-40(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1384(t1)
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+sd t1,1176(t0)
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,-48(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,-56(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1384(t1)
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+sd t1,1152(t0)
+ld t0,-64(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1448(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+ld t0,-72(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-72(s0)
+jal zero,-113
+ld t0,-40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,184
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,176
+ld t0,-56(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,172
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-48(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,164
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-32(s0)
+add t1,t1,t2
+sd t1,1192(t0)
+jal ra,-2136
+addi t0,a0,0
+sd t0,-80(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,139
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-25097
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-16835
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,113
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-48(s0)
+add t1,t1,t2
+sd t1,1168(t0)
+ld t0,-48(s0)
+ld t1,-56(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,87
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-25149
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-16887
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1776
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-80(s0)
+sd t0,16(sp)
+jal ra,-14630
+addi sp,sp,16
+ld t0,-40(gp)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1816
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+ld t0,-152(gp)
+sd t0,16(sp)
+jal ra,-14647
+addi sp,sp,16
+jal zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1856
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+ld t0,-152(gp)
+sd t0,16(sp)
+jal ra,-14659
+addi sp,sp,16
+lui t0,0xFFFFE
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14672
+addi sp,sp,16
+jal zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1960
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+jal ra,-14688
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25250
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16667
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1360(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-12907
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3115
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3413
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+sd t0,16(sp)
+jal ra,-3423
+jal ra,-2904
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1984
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14778
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12443
+lui t0,0xFFFFE
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14788
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20815
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-17041
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-19791
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2000
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16785
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-13025
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3233
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3531
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3249
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3547
+ld t0,-1680(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3265
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3563
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,16(sp)
+jal ra,-3573
+jal ra,-3054
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3100
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-184(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,24(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,40(s0)
+sltu t0,t0,t1
+beq t0,zero,237
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,6899
+addi t0,a0,0
+beq t0,zero,212
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,20322
+addi t0,a0,0
+beq t0,zero,187
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6846
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,27005
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20983
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,6902
+addi t0,a0,0
+beq t0,zero,148
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,20342
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,40(s0)
+ld t1,-16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+sub t0,t0,t1
+ld t1,-144(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+ld t1,-144(gp)
+divu t0,t0,t1
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,40(s0)
+ld t1,-16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+sub t0,t0,t1
+ld t1,-144(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+ld t1,-144(gp)
+divu t0,t0,t1
+sd t0,-24(s0)
+ld t0,48(s0)
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,26306
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21037
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,6872
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,89
+ld t0,48(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,4640
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-4247
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,6187
+jal zero,17
+ld t0,32(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6158
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-4192
+ld t0,-8(s0)
+beq t0,zero,31
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+ld t1,-144(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,-40(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-17313
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,95
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-40(s0)
+jal zero,-27
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-24(s0)
+jal zero,-91
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-2048
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15146
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,58
+jal zero,17
+lui t0,0xFFFFD
+addi t0,t0,1992
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15163
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal zero,17
+lui t0,0xFFFFD
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15180
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,24
+jal zero,-241
+ld t0,-8(s0)
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,1896
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15199
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,1880
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15229
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12056
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15238
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11983
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15247
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12038
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15257
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12028
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21288
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21299
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21310
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,1768
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+jal ra,-15314
+addi sp,sp,32
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15181
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15197
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15179
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-3075
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1040(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21390
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-25935
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21415
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-17686
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1024(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1024(t0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-17931
+addi t0,a0,0
+beq t0,zero,93
+ld t0,-24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-18065
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-559
+addi t0,a0,0
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+ld t2,-24(s0)
+add t1,t1,t2
+sd t1,1016(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21518
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-17742
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21564
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20762
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,1704
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15547
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15558
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11727
+jal ra,-16444
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1688
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17535
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-13775
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3983
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4281
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3999
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4297
+ld t0,-1680(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4015
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4313
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(sp)
+jal ra,-4323
+jal ra,-3804
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3850
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,1672
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15686
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11599
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15695
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11526
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15704
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11581
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15714
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11571
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21745
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21756
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21767
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-15771
+addi sp,sp,32
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15652
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15634
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-3530
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1040(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1008(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1008(t0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-930
+addi t0,a0,0
+beq t0,zero,43
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21880
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-16941
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-18113
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1000(t1)
+ld t2,-24(s0)
+add t1,t1,t2
+sd t1,1000(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21922
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-18146
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21968
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-21166
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+beq t0,zero,33
+lui t0,0xFFFFD
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21973
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-18244
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15968
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15979
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11306
+jal ra,-16865
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17956
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-14196
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4404
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4702
+ld t0,-1680(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4420
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4718
+ld t0,-1688(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4436
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4734
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1048(t0)
+sd t0,16(sp)
+jal ra,-4744
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,16(sp)
+jal ra,-4754
+jal ra,-4235
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4281
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-1197
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,48
+lui t0,0xFFFFD
+addi t0,t0,1480
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16143
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11078
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16152
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11069
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16161
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11060
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16170
+ld t0,-1688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11083
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16180
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11105
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22211
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22222
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22233
+addi t0,a0,0
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,992(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,992(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-192(gp)
+sd t0,16(sp)
+jal ra,-131
+addi t0,a0,0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,984(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-192(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18234
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+addi t2,zero,1
+add t1,t1,t2
+sd t1,984(t0)
+ld t0,-16(s0)
+ld t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-256(gp)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22292
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-192(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-26817
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22316
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-18540
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22362
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-21560
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1104(t0)
+beq t0,zero,37
+lui t0,0xFFFFD
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-192(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22373
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-18644
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-16366
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16377
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10908
+jal ra,-17263
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1384
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18355
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-14595
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,520
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18379
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-14619
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1152(t0)
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1544(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-14646
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26385
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26373
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26455
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4412
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1232(t0)
+jal ra,-14266
+jal ra,-14236
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4886
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5184
+jal ra,-14253
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-9196
+jal ra,-14291
+jal ra,-14261
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26405
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26430
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4919
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14281
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-14239
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-5181
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,16(sp)
+jal ra,-5229
+jal ra,-4710
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14302
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4831
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4843
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14282
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4856
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5276
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4876
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26497
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26523
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1664(gp)
+sd t0,16(sp)
+jal ra,-4953
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14376
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5313
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14252
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4843
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22488
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,5172
+addi t0,a0,0
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,18547
+addi t0,a0,0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1344
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16708
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21744
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1296
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-16734
+addi sp,sp,16
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22778
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22580
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-109
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16786
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10435
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16796
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10425
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22830
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1664(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22846
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22502
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-21738
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22873
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22906
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-22104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16881
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10340
+jal ra,-17767
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27425
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27431
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFD
+addi t0,t0,1256
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+sd t0,32(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-18146
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-18126
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-16978
+addi sp,sp,48
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,504
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18950
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,2
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-15190
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5398
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5696
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5414
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5712
+ld t0,-1720(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+sd t0,16(sp)
+jal ra,-5722
+jal ra,-5203
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1712(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5731
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5257
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22826
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22829
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1096(t1)
+sd t1,0(t0)
+ld t0,-1712(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8337
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+beq t0,zero,43
+lui t0,0xFFFFD
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22849
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22855
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-17158
+addi sp,sp,24
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFD
+addi t0,t0,1176
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-17174
+addi sp,sp,8
+jal ra,-18057
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1096(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-168(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,30
+lui t0,0xFFFFD
+addi t0,t0,1160
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17205
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10016
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17214
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10071
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17224
+ld t0,-1712(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10061
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8522
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8526
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,21539
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,21391
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,22137
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-198
+jal ra,12772
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17287
+ld t0,-1712(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9934
+jal ra,-18173
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,22100
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-235
+jal ra,12853
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,21479
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17198
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1152
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1144
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1136
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1128
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17268
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,784(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1120
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1112
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17312
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1104
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1096
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFD
+addi t1,t1,1088
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,32(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-19381
+addi t0,a0,0
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,23
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+lui t0,0xFFFFD
+addi t0,t0,1064
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-17577
+addi sp,sp,16
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26221
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26210
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26182
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26120
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26109
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26098
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26087
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-66
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-96
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,632(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,624(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26698
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26667
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17554
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-26420
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+jal ra,-26142
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26611
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26719
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17599
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25973
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17428
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26311
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-26481
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-26470
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-26459
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26380
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26369
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-137
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26430
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26283
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26272
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-269
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26902
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+sd t0,32(sp)
+jal ra,-99
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26931
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,32(sp)
+jal ra,-128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26966
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+sd t0,32(sp)
+jal ra,-163
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+sd t0,8(sp)
+jal ra,-26508
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+sd t0,8(sp)
+jal ra,-26518
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27021
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,848(t0)
+sd t0,32(sp)
+jal ra,-218
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+sd t0,8(sp)
+jal ra,-26563
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27031
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27000
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27062
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26882
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,-16(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26313
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26272
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26227
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26216
+ld t0,-24(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-46
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26708
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-109
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-127
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-139
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27175
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27163
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-37
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27218
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27242
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27252
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-47
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27352
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-127
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27338
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27289
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-26992
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,616(t1)
+lui t2,0x196
+addi t2,t2,1549
+mul t1,t1,t2
+lui t2,0x3C6EF
+addi t2,t2,863
+add t1,t1,t2
+sd t1,616(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+lui t1,0x10
+addi t1,t1,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,24(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,41
+ld t0,32(s0)
+ld t1,-16(s0)
+ld t2,-24(s0)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,2
+ld t1,-8(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,18
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi t0,zero,2
+ld t1,-8(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sd t0,-24(s0)
+jal zero,-43
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,24(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,28
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+beq t0,zero,12
+addi t0,zero,2
+ld t1,-8(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,5
+addi t0,zero,2
+ld t1,-8(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,2
+divu t0,t0,t1
+sd t0,-24(s0)
+jal zero,-30
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27550
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,24(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26970
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,107
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27595
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-117
+addi t0,a0,0
+addi a0,t0,0
+jal zero,79
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-227
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27620
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,54
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27637
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,34
+ld t0,24(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27004
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27016
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-44
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27100
+addi t0,a0,0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27091
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27733
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,24(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,14
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27763
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-609
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-593
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27800
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27843
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27667
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-32(s0)
+ld t0,0(t0)
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-153
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-134
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27862
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,117
+ld t0,-24(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-48(s0)
+ld t0,40(s0)
+beq t0,zero,105
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27845
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27539
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27226
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27811
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27511
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27192
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27696
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27410
+ld t0,-48(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27078
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27952
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-540
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-48(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-618
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27188
+ld t0,-32(s0)
+ld t1,-40(s0)
+sd t1,0(t0)
+ld t0,-48(s0)
+addi a0,t0,0
+jal zero,53
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-455
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-48(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28017
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-605
+ld t0,-32(s0)
+ld t1,-40(s0)
+sd t1,0(t0)
+ld t0,-48(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27289
+ld t0,-48(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28032
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27431
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-817
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-27
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27410
+addi t0,a0,0
+beq t0,zero,31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27933
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27643
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27450
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,153
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27306
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,139
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27530
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-129
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1004
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27428
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+sd t0,8(sp)
+jal ra,-27385
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-950
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27380
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-854
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27424
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27362
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-27483
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-476
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27662
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28212
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27908
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-176
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28168
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28177
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-102
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,32(s0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-27536
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28213
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27921
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-104
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28403
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,53
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1191
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28201
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1212
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27929
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28206
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-27931
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2289
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2282
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+ld t3,-144(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,32(s0)
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-762
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27948
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-450
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-27705
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28360
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-28072
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1416
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1290
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-891
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28619
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27895
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27854
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27809
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,624(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-110
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-130
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,624(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28714
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28113
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1499
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,1455
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28736
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-568
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28181
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1536
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28777
+addi t0,a0,0
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,11475
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-458
+ld t0,-32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28824
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-656
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28269
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1624
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-202
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-578
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28881
+addi t0,a0,0
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,11371
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-562
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-202
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-226
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+jal ra,-164
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-478
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,632(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-20124
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-21261
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-21241
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21279
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21259
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-20167
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,992
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28994
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28981
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-20203
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,960
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28991
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28978
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29003
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28991
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-21374
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29019
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29007
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-21362
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-20270
+addi sp,sp,48
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-20291
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-20302
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29242
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29232
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,896
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-224
+lui t0,0xFFFFD
+addi t0,t0,872
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29212
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-20339
+addi sp,sp,8
+jal ra,-21222
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29280
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29270
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,856
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-262
+lui t0,0xFFFFD
+addi t0,t0,872
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29250
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-20377
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+sd t0,8(sp)
+jal ra,-20392
+addi sp,sp,8
+jal ra,-21275
+lui t0,0xFFFFD
+addi t0,t0,792
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,16(sp)
+jal ra,-20408
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFD
+addi t0,t0,744
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-20425
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29365
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29355
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,728
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-347
+jal ra,-21330
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29394
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29384
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,712
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-376
+jal ra,-21359
+lui t0,0xFFFFD
+addi t0,t0,648
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,32(sp)
+jal ra,-20521
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,600
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-20532
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,896
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-368
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,728
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-384
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi t1,zero,2
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,712
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-400
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lui t0,0xFFFFD
+addi t0,t0,560
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-20594
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,896
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-395
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,856
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-405
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-6710
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,592(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23159
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+sd t0,16(sp)
+jal ra,-20665
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31227
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20510
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sd t1,576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20362
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,568(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20376
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,560(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20390
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,552(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,544(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,536(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,528(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,600(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+sd t0,16(sp)
+jal ra,-31336
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,448
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+sd t0,16(sp)
+jal ra,-20815
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31377
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,528(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+add t1,t1,t2
+sd t1,528(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,576(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+addi t3,zero,8
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-23560
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-159
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,16(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sd t0,16(s0)
+jal zero,-18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-126
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,552(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-88(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,9
+addi t0,zero,0
+ld t1,-8(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,2
+mul t0,t0,t1
+ld t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,536(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,544(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,560(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-158
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-206
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+jal ra,-424
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,600(t0)
+lui t0,0xFFFFD
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,536(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,528(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+sd t0,40(sp)
+jal ra,-21230
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,608(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,448(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24222
+addi t0,a0,0
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,70
+jal zero,68
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-99
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,606
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,279
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+ld t0,-16(s0)
+ld t0,0(t0)
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,392(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,392(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,384(t0)
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-166
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,28
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-24(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-125
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sltu t0,t0,t1
+beq t0,zero,51
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-258
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-314
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+mul t0,t0,t1
+sd t0,24(s0)
+jal zero,23
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-285
+addi t0,a0,0
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,13
+jal zero,5
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24534
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,55
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-386
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,18171
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-410
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-407
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,416(t2)
+remu t1,t1,t2
+addi t2,zero,2
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21589
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-21503
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,400(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-96
+addi t0,a0,0
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-375
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-102
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-517
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,472(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,472(t2)
+divu t1,t1,t2
+mul t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,288
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-21970
+addi sp,sp,40
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-755
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-106
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2332
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-775
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-150
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,48(s0)
+beq t0,zero,15
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2378
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-822
+jal zero,12
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-845
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,32(s0)
+ld t0,24(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,40(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,40(s0)
+jal zero,-78
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1081
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-249
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2138
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-191
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1133
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-301
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-2168
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-220
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1182
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-350
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2263
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-292
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-176(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,280
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-22285
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22224
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+beq t0,zero,66
+ld t0,-176(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,264
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-22327
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22266
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,125
+jal zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22367
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22305
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,103
+jal zero,101
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+beq t0,zero,44
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22359
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-153
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22385
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+beq t0,zero,47
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-22406
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-198
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,232
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+sd t0,16(sp)
+jal ra,-22434
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-192
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,216
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4023
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14134
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-24794
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-22533
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22472
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,208
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22594
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4625
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22616
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4603
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4424
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-25322
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-192(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13929
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,104(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,112(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-455
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,200
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22796
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22734
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,52
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,184
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3713
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14444
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14452
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,40(sp)
+jal ra,-22845
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22784
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22907
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4376
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22919
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4364
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22941
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4342
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,8(sp)
+jal ra,-14362
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-200(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-200(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-200(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14246
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-737
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,168
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3478
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14679
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14687
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14695
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-23084
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23023
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23145
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4138
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4127
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23168
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4115
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14481
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14487
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14482
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14601
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14607
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-216(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14602
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14721
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14727
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-224(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14722
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14855
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14861
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-232(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14856
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,4028
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15000
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15006
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-240(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15001
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,3883
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15131
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15137
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-248(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15137
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1628
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,152
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2587
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15570
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15582
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-23971
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23910
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24048
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3171
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24059
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2211
+addi t0,a0,0
+beq t0,zero,91
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3270
+addi t0,a0,0
+beq t0,zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2194
+addi t0,a0,0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15584
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,128
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2124
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24109
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,104
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2144
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24129
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3153
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,72
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24145
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,24
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24155
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,0
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24165
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2329
+addi t0,a0,0
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3152
+addi t0,a0,0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2312
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24207
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3076
+lui t0,0xFFFFD
+addi t0,t0,-16
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-24221
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2400
+addi t0,a0,0
+beq t0,zero,30
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3081
+addi t0,a0,0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2383
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2784
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15593
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2470
+addi t0,a0,0
+beq t0,zero,156
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3011
+addi t0,a0,0
+beq t0,zero,141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2453
+addi t0,a0,0
+beq t0,zero,118
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2226
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-256(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-15684
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2650
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,3227
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3218
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3209
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2173
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,152
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2042
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16115
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16127
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24516
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24455
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24593
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2626
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24604
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2679
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24616
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2768
+addi t0,a0,0
+beq t0,zero,85
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2793
+addi t0,a0,0
+beq t0,zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2751
+addi t0,a0,0
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16141
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,-40
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2681
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24666
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,-56
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2701
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24686
+addi sp,sp,16
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,72
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24696
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,24
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24706
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,0
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-24716
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2880
+addi t0,a0,0
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2681
+addi t0,a0,0
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2755
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-24756
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2526
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2941
+addi t0,a0,0
+beq t0,zero,25
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2620
+addi t0,a0,0
+beq t0,zero,19
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2694
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2835
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2248
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16129
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-3006
+addi t0,a0,0
+beq t0,zero,178
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2555
+addi t0,a0,0
+beq t0,zero,163
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2629
+addi t0,a0,0
+beq t0,zero,144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16276
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2908
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2740
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2772
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-3902
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3208
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,2669
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2660
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2651
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,112(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-3095
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2782
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,184
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1433
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16724
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16732
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,8(sp)
+jal ra,-27653
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-25133
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25072
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-88
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-25133
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25228
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2055
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25239
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2044
+lui t0,0xFFFFD
+addi t0,t0,-104
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-25255
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-120
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-25276
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1778
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16597
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16603
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3054
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-136
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1161
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16996
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,8(sp)
+jal ra,-27917
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-25397
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25336
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-88
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-25397
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,208
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25492
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1720
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25510
+lui t0,0xFFFFD
+addi t0,t0,-152
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-25520
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-270
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25544
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1675
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-304(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,5202
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-28176
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-320(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1712(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16958
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3439
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,152
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,776
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17381
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,8(sp)
+jal ra,-28302
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17401
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-25790
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25729
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25851
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1368
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25863
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1349
+addi t0,zero,-1112
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25881
+lui t0,0xFFFFD
+addi t0,t0,-152
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-25891
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17199
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1712(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-28555
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-28585
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5008
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,4832
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17240
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1248(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3721
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,494
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-26044
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25983
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,959
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1720(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17415
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,104(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,112(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-27050
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,137
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-208
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-26202
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36764
+jal zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-272
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-26224
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36786
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1776(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,-328
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-26246
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36808
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal ra,-9075
+jal zero,51
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17560
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17578
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17582
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17594
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17515
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,1382
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,104(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,112(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,112(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,280
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1176(t2)
+sub t1,t1,t2
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-26351
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,16(sp)
+jal ra,-26382
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-26401
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+beq t0,zero,5
+jal ra,-58
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-32(gp)
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-336
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-26442
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-344
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-26459
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15437
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-26487
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3823
+addi t0,a0,0
+addi a0,t0,0
+jal zero,201
+jal zero,199
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2664
+addi t0,a0,0
+addi a0,t0,0
+jal zero,186
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2134
+addi t0,a0,0
+addi a0,t0,0
+jal zero,171
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3585
+addi t0,a0,0
+addi a0,t0,0
+jal zero,156
+jal zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3600
+addi t0,a0,0
+addi a0,t0,0
+jal zero,141
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3615
+addi t0,a0,0
+addi a0,t0,0
+jal zero,126
+jal zero,124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3630
+addi t0,a0,0
+addi a0,t0,0
+jal zero,111
+jal zero,109
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3645
+addi t0,a0,0
+addi a0,t0,0
+jal zero,96
+jal zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3660
+addi t0,a0,0
+addi a0,t0,0
+jal zero,81
+jal zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1631
+addi t0,a0,0
+addi a0,t0,0
+jal zero,66
+jal zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1374
+addi t0,a0,0
+addi a0,t0,0
+jal zero,51
+jal zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1003
+addi t0,a0,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4265
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-751
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,24488
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,-392
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,16(sp)
+jal ra,-26853
+addi sp,sp,16
+jal zero,208
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-12940
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-29389
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-440
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,16(sp)
+jal ra,-26895
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37457
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,-288(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+sd t0,-296(gp)
+jal ra,-37273
+jal ra,-33982
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-40(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-80(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15917
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+jal ra,1030
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-360
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1648
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-26897
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,-56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-515
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1648
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-26943
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,-128(t0)
+jal zero,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-80(t0)
+addi t0,zero,0
+sd t0,-288(gp)
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,-552
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,48(sp)
+jal ra,-27061
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,112(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,112(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,104(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,112(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-64(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,104(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,96(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,104(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,112(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,-128(t0)
+jal ra,673
+jal ra,797
+jal ra,2111
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-72(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+jal ra,655
+jal ra,779
+jal ra,2140
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,104(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-72(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-64(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-568
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18819
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-27250
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-584
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18851
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-27282
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18792
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+jal zero,32
+lui t0,0xFFFFD
+addi t0,t0,-600
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18894
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-27334
+addi sp,sp,24
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7740
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-616(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-616(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7775
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-632(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-632(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7797
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-648(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-648(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7660
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-624(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-624(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7695
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-640(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-640(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7717
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-656(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-656(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5626
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5706
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,13517
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-27565
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-624
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27582
+addi sp,sp,8
+jal zero,109
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27600
+addi sp,sp,8
+jal zero,91
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-656
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27618
+addi sp,sp,8
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27636
+addi sp,sp,8
+jal zero,55
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-672
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27654
+addi sp,sp,8
+jal zero,37
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-27672
+addi sp,sp,8
+jal zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-8(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27688
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19254
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33503
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33516
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFD
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33441
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27744
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-205
+lui t0,0xFFFFD
+addi t0,t0,-760
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27757
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33558
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33548
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal ra,-28657
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38337
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-32802
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-32793
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33521
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27824
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-285
+lui t0,0xFFFFD
+addi t0,t0,-816
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-27841
+addi sp,sp,8
+jal ra,-1254
+jal ra,-28725
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,8(sp)
+jal ra,-6010
+addi t0,a0,0
+beq t0,zero,85
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,7160
+addi t0,a0,0
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+ld t1,-144(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-5670
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17131
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-5697
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17136
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+jal zero,32
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-251
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16717
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18949
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-18774
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1912(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sd t1,-144(t0)
+jal zero,367
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-18802
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1856(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sd t1,-144(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sd t1,-144(t0)
+jal zero,320
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-18635
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1848(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sd t1,-144(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sd t1,-144(t0)
+jal zero,273
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,144
+jal ra,-19068
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1904(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sd t1,-144(t0)
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sd t1,-144(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sd t1,-144(t0)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sd t1,-144(t0)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sd t1,-144(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sd t1,-144(t0)
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-18543
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sd t1,-144(t0)
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-18295
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sd t1,-144(t0)
+jal zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-19095
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sd t1,-144(t0)
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-18215
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sd t1,-144(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-19141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sd t1,-144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-715
+jal zero,32
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,32(sp)
+jal ra,-28438
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39000
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33931
+addi t0,a0,0
+ld t1,24(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34378
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,80(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34418
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34413
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-184(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,80(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34046
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+ld t0,32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,6447
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-146
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-36214
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,19
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+jal zero,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-188
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-36158
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34561
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,45
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-218
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36415
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,20
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36427
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,920
+addi t0,a0,0
+beq t0,zero,2
+jal zero,8
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-36213
+jal zero,-55
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-224
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,162
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36470
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,3
+jal ra,-890
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-7689
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36503
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36500
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36493
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36486
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36479
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36472
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+jal zero,62
+jal ra,-979
+jal ra,-855
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31732
+addi t0,a0,0
+beq t0,zero,49
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+sd t0,8(sp)
+jal ra,-36457
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-136(t0)
+sd t0,8(sp)
+jal ra,-36452
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,8(sp)
+jal ra,-36443
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+sd t0,8(sp)
+jal ra,-36434
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,8(sp)
+jal ra,-36425
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+sd t0,8(sp)
+jal ra,-36416
+jal zero,3
+jal ra,-1038
+jal ra,-914
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,3
+jal ra,189
+jal zero,2
+jal ra,425
+jal zero,180
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5975
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4648
+jal zero,144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4124
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5784
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5676
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5568
+jal zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5460
+jal zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5327
+jal zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5194
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3739
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3492
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3162
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6421
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2968
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+beq t0,zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2315
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6486
+jal ra,-6162
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4899
+jal ra,-4836
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4371
+jal ra,-4313
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6525
+jal ra,-5974
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6538
+jal ra,-5867
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6551
+jal ra,-5760
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6564
+jal ra,-5653
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6577
+jal ra,-5521
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6590
+jal ra,-5389
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3948
+jal ra,-3935
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6616
+jal ra,-3689
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6629
+jal ra,-3360
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6642
+jal ra,-6620
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3188
+jal ra,-3168
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4247
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,15
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3006
+jal zero,2
+jal ra,-6584
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2753
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6456
+jal ra,-6401
+jal ra,-6424
+jal zero,187
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5345
+jal ra,-5076
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5199
+jal zero,170
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4817
+jal ra,-4557
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4665
+jal zero,153
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6266
+jal ra,-6222
+jal ra,-6472
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6280
+jal ra,-6116
+jal ra,-6486
+jal zero,125
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6294
+jal ra,-6010
+jal ra,-6500
+jal zero,111
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6308
+jal ra,-5904
+jal ra,-6514
+jal zero,97
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6322
+jal ra,-5773
+jal ra,-6528
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6336
+jal ra,-5642
+jal ra,-6542
+jal zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4267
+jal ra,-4189
+jal ra,-4225
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4017
+jal ra,-3944
+jal ra,-3974
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3672
+jal ra,-3616
+jal ra,-3988
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6943
+jal ra,-6877
+jal ra,-6923
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3425
+jal zero,2
+jal ra,-30424
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35379
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1902
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-168(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,42
+jal zero,40
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1187
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37323
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,23
+jal zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37350
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37378
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37504
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37501
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-136(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37494
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37487
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37480
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37473
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-8776
+jal ra,-947
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+beq t0,zero,4
+ld t0,-16(s0)
+sd t0,-8(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(s0)
+jal zero,-110
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+ld t2,-16(s0)
+sub t1,t1,t2
+sd t1,-168(t0)
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-347
+jal zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+ld t2,-16(s0)
+sub t1,t1,t2
+sd t1,-168(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32836
+addi t0,a0,0
+beq t0,zero,97
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-283
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-228
+jal zero,70
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1485
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+jal ra,-1277
+jal ra,-1090
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+sd t0,-32(s0)
+jal ra,-442
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,38
+ld t0,-32(s0)
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-37531
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-416
+addi t0,a0,0
+beq t0,zero,9
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-37548
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,-103
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-176(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35535
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-184(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35975
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29739
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-184(t0)
+sd t0,8(sp)
+jal ra,-34836
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-1423
+jal ra,-1236
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+beq t0,zero,4
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-29
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+beq t0,zero,3
+jal ra,-257
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33085
+addi t0,a0,0
+beq t0,zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-72(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-86
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-97
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+ld t2,-8(s0)
+sub t1,t1,t2
+sd t1,-168(t0)
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-702
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+ld t2,-8(s0)
+sub t1,t1,t2
+sd t1,-168(t0)
+jal ra,-1553
+jal ra,-1366
+jal ra,-714
+jal zero,-80
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-176(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,-72(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,67
+ld t0,16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19303
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21290
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-32(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+sd t0,-8(s0)
+jal zero,8
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-75
+ld t0,-8(s0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-72(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-124
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,-920
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-31564
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-31544
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-30454
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,280
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-30481
+addi sp,sp,8
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,-936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30492
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-30521
+addi sp,sp,24
+ld t0,24(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,-72(gp)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-156
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-161
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-166
+jal ra,-31434
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-38061
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-37916
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-37909
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-37881
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-37870
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-37859
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-37848
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38072
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-37931
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-37954
+jal zero,13
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+sd t0,8(sp)
+jal ra,-37946
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-384(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36359
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36707
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-109
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30352
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-408(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1392(gp)
+sltu t0,t0,t1
+beq t0,zero,84
+ld t0,-1400(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40686
+addi t0,a0,0
+ld t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40639
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28673
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40664
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40775
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40798
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-70
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-86
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-20622
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38193
+addi t0,a0,0
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-376(t2)
+divu t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-376(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-38093
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-400(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38328
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38282
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-392(t0)
+jal zero,84
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38341
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-32
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36659
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1184(t2)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-411
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38244
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38474
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38392
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-206
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38498
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-392(t0)
+jal zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38507
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-39
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38528
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38537
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,-1120
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-31015
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38509
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38530
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-31048
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,29
+jal zero,27
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38538
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-31075
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38534
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,36
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-138
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-960
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38564
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-31139
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38675
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-66
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38669
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-70
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-17335
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-33784
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1016
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,16(sp)
+jal ra,-31290
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41852
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,-288(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+sd t0,-296(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-155
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-288(gp)
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1104
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,32(sp)
+jal ra,-31337
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-360(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,31
+ld t0,16(s0)
+ld t1,24(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1184(t2)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1184(t3)
+sub t2,t2,t3
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,72(t3)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-76
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+sd t0,16(sp)
+jal ra,-41999
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1152
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+sd t0,16(sp)
+jal ra,-31478
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42040
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-496(t2)
+add t1,t1,t2
+sd t1,-464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-496(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-488(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-496(t2)
+addi t3,zero,8
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-34223
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-496(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-159
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-33826
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-33837
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-127
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-25
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,9
+sd t0,32(sp)
+jal ra,-33202
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-60
+addi t0,zero,58
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-163
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,101
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+sltu t0,t0,t1
+beq t0,zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-77
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-95
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,5
+sd t0,32(sp)
+jal ra,-33315
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-173
+addi t0,zero,58
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-276
+jal zero,27
+lui t0,0xFFFFD
+addi t0,t0,-1216
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-184
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,5
+sd t0,32(sp)
+jal ra,-33342
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-200
+addi t0,zero,58
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-303
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-504(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41086
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41080
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1144(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-504(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31534
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-512(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31550
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-520(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31566
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-528(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31582
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-536(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31598
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-544(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41225
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41219
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,223
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-520(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t1,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-344(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-528(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-328(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-536(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-336(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,72
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21094
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23081
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-528(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-328(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-536(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-336(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-544(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-352(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-237
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1264
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+sd t0,24(sp)
+jal ra,-32172
+addi sp,sp,16
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+addi t0,zero,1
+sd t0,-24(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+sltu t0,t0,t1
+beq t0,zero,122
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,106
+ld t0,-24(s0)
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-24(s0)
+jal zero,18
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,-1112
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-32213
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1320
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,32(sp)
+jal ra,-32251
+addi sp,sp,24
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1360
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,32(sp)
+jal ra,-32295
+addi sp,sp,24
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-126
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1368
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-32319
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41686
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-600
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34408
+addi t0,a0,0
+addi t1,zero,5
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34434
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-448(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1376
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-32411
+addi sp,sp,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24715
+addi t0,a0,0
+sd t0,-992(gp)
+ld t0,-992(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-34967
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-136
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-32471
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43033
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-18563
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35012
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1424
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+sd t0,16(sp)
+jal ra,-32518
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43080
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32359
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-464(t0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-867
+lui t0,0xFFFFD
+addi t0,t0,-1432
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-943
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-947
+ld t0,-376(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1050
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-885
+lui t0,0xFFFFD
+addi t0,t0,-1488
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-961
+ld t0,-376(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1064
+addi t0,zero,0
+sd t0,-48(s0)
+addi t0,zero,1
+sd t0,-56(s0)
+ld t0,-992(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+sd t0,16(sp)
+jal ra,-43134
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-35101
+addi t0,a0,0
+beq t0,zero,70
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,51
+ld t0,-56(s0)
+beq t0,zero,11
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-935
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-16(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-35233
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1131
+ld t0,-40(s0)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,-56(s0)
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-53
+ld t0,-992(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+sd t0,16(sp)
+jal ra,-43210
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-76
+ld t0,-56(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-376(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1167
+jal ra,-1234
+lui t0,0xFFFFD
+addi t0,t0,-1560
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+sd t0,16(sp)
+ld t0,-48(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+sd t0,40(sp)
+jal ra,-32695
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1568
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-32655
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-524
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-472(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-472(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42069
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-385
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-32816
+addi sp,sp,8
+jal zero,151
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-18903
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35352
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,16(sp)
+jal ra,-32858
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43420
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,-288(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,-296(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32711
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-488(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1720
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-32839
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-152
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1728
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-32868
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-480(t0)
+addi t0,zero,0
+sd t0,-288(gp)
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,-1808
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,32(sp)
+jal ra,-32967
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-424(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,48
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-34202
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-34182
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-33034
+addi sp,sp,64
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24630
+addi t0,a0,0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1856
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-97
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFD
+addi t0,t0,-1920
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-33096
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1936
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+sd t0,24(sp)
+jal ra,-136
+ld t0,-1608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-77
+lui t0,0xFFFFD
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-616(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-624(t0)
+sd t0,24(sp)
+jal ra,-157
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24684
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-568(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-552(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-568(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-576(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-560(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-576(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-568(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+sd t0,24(sp)
+jal ra,-225
+lui t0,0xFFFFD
+addi t0,t0,-1984
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+sd t0,24(sp)
+jal ra,-242
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24697
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-584(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-552(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-592(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-560(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-592(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-2000
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-584(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+sd t0,24(sp)
+jal ra,-310
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24736
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-600(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-552(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-600(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-608(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-560(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-608(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-293
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1528
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-600(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-608(t0)
+sd t0,24(sp)
+jal ra,-378
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,115
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39119
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,97
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39130
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39400
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39121
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39652
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11435
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38313
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39596
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11451
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38244
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39666
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11467
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38328
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39664
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11483
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38327
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39662
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11499
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38326
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39564
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-118
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFC
+addi t0,t0,2000
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39197
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-23323
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39207
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34652
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-23336
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39220
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34637
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-23349
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39233
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34734
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-23362
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39246
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34719
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-33571
+addi sp,sp,48
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39327
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39283
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39257
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39248
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39239
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39719
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-65
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+lui t0,0xFFFFC
+addi t0,t0,1896
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39346
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-34850
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39361
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34806
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39373
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34790
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39382
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-34886
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,48(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39396
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-34872
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-33724
+addi sp,sp,56
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-33747
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,1880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-33758
+addi sp,sp,8
+jal ra,-23564
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,42
+lui t0,0xFFFFC
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+jal ra,-23574
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-23577
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-23513
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34903
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-23587
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-23523
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34885
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-33793
+addi sp,sp,24
+lui t0,0xFFFFC
+addi t0,t0,1808
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-33804
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+jal ra,6006
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-34998
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,5995
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-34981
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,5979
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34964
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,5968
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34947
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+divu t0,t0,t1
+sd t0,40(sp)
+jal ra,-33863
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,57
+lui t0,0xFFFFC
+addi t0,t0,1640
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1976(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2032(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2024(t0)
+sd t0,40(sp)
+jal ra,-33903
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1976(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2040(t0)
+sd t0,8(sp)
+jal ra,-33924
+addi sp,sp,8
+jal ra,-34807
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1176(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,1520
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1176(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1184(t0)
+sd t0,24(sp)
+jal ra,-33950
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,56
+lui t0,0xFFFFC
+addi t0,t0,1400
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1256(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1264(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1272(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1248(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35167
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1248(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35151
+addi t0,a0,0
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+divu t0,t0,t1
+sd t0,56(sp)
+jal ra,-34011
+addi sp,sp,56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1360(t1)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lui t0,0xFFFFC
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1360(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1368(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+sd t0,48(sp)
+jal ra,-34052
+addi sp,sp,48
+jal ra,-691
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,590
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34073
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,1264
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39787
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-34090
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39776
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,205
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-605
+lui t0,0xFFFFC
+addi t0,t0,1216
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39702
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-35303
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39716
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-35289
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-34141
+addi sp,sp,24
+lui t0,0xFFFFC
+addi t0,t0,1112
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39969
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39995
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35352
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39993
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40019
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35348
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39865
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39776
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35396
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39790
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-35382
+addi t0,a0,0
+sd t0,48(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40051
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40077
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-34115
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39829
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35388
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40085
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40111
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-34149
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39863
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35394
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-34302
+addi sp,sp,64
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39950
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39938
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39929
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,160
+lui t0,0xFFFFC
+addi t0,t0,1072
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39987
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39975
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39966
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-34367
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40110
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34390
+addi sp,sp,8
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40139
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40105
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34408
+addi sp,sp,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40094
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+lui t0,0xFFFFC
+addi t0,t0,1032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40107
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40076
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40064
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40055
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-35635
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-34459
+addi sp,sp,8
+jal ra,-35342
+lui t0,0xFFFFC
+addi t0,t0,960
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40117
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40104
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40091
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-34489
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,70
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39820
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,62
+lui t0,0xFFFFC
+addi t0,t0,912
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39837
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39862
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-34526
+addi sp,sp,24
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39832
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,30
+lui t0,0xFFFFC
+addi t0,t0,848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39845
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39851
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40238
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-34563
+addi sp,sp,16
+jal ra,-35446
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,77
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40026
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40014
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40005
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39996
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,39
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40064
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40052
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFC
+addi t0,t0,816
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-14524
+jal ra,-35507
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40045
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40033
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFC
+addi t0,t0,784
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-14543
+jal ra,-35526
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40725
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-593
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34666
+addi sp,sp,8
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2893
+jal ra,-24476
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,123
+jal ra,-24263
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34687
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFC
+addi t0,t0,720
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34705
+addi sp,sp,8
+jal zero,12
+lui t0,0xFFFFC
+addi t0,t0,664
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34717
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,648
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-304(t0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-4231
+lui t0,0xFFFFC
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-312(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-4247
+lui t0,0xFFFFC
+addi t0,t0,616
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,24(sp)
+jal ra,-4265
+lui t0,0xFFFFC
+addi t0,t0,600
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,24(sp)
+jal ra,-4283
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34796
+addi sp,sp,8
+jal ra,-1717
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1008(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,992(t1)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,65
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34822
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34833
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,536
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+sd t0,16(sp)
+jal ra,-17910
+lui t0,0xFFFFC
+addi t0,t0,520
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+sd t0,16(sp)
+jal ra,-17924
+lui t0,0xFFFFC
+addi t0,t0,504
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+sd t0,16(sp)
+jal ra,-17938
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,38
+lui t0,0xFFFFE
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34896
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,456
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-34907
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+sd t0,8(sp)
+lui t0,0xFFFFC
+addi t0,t0,440
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-14821
+jal ra,-35804
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,2
+jal ra,-14651
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,432
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34955
+jal zero,75
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,424
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34972
+jal zero,58
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34989
+jal zero,41
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35006
+jal zero,24
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35023
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35030
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40956
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40970
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40962
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40975
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40989
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40981
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41184
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1600(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41038
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41033
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41062
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41285
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1600(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-202
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-157
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+ld t1,24(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,472(t2)
+remu t1,t1,t2
+sub t0,t0,t1
+ld t1,-144(gp)
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-265
+addi t0,a0,0
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41235
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41223
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-233
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,30
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41207
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,-144(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+ld t1,-144(gp)
+divu t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,480
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37389
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-33629
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-1600(gp)
+sd t0,16(sp)
+jal ra,-24089
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-23653
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,456
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37439
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-33679
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-1608(gp)
+sd t0,16(sp)
+jal ra,-24139
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-23703
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,432
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37489
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,48(sp)
+jal ra,-33729
+jal ra,-24275
+jal ra,-24276
+jal ra,-24277
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-23748
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1176(t0)
+ld t0,-1664(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,8(sp)
+jal ra,-30446
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1176(t2)
+ld t3,16(s0)
+sub t2,t2,t3
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,72(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1176(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41649
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41454
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,140
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,11
+lui t0,0xFFFFC
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35655
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8434
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41480
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35681
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8460
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41712
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,1261
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35716
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8495
+jal ra,-36602
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,193
+addi t0,a0,0
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,5602
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41741
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,177
+addi t0,a0,0
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41566
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-13749
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41424
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-40660
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41816
+addi t0,a0,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,72(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-41016
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19042
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-912(t0)
+sd t0,8(sp)
+jal ra,820
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35675
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-70
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-40404
+addi t0,a0,0
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41899
+addi t0,a0,0
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41782
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-134
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-952(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41812
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41800
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-174
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-960(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41814
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-204
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-968(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41825
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-234
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-976(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41589
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-264
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-984(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41600
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-294
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-992(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41611
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-324
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-888(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41622
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-354
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40678
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40678
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sd t1,-944(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35945
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-960(t1)
+sd t1,-968(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-414
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-976(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-41013
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-441
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-984(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-41023
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-468
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-992(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-41033
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-495
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-872(t1)
+sd t1,-888(t0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-872(t0)
+sd t0,8(sp)
+jal ra,-41047
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-210
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-40694
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+addi t2,zero,2
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-912(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-575
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,8
+sd t1,-920(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-144(gp)
+sd t1,-920(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-244
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-190
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-169
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-148
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-373
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40895
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40948
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40959
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-40890
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-454
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-40900
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-283
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,14
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40987
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-69
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-720
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42530
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14645
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42542
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14562
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-771
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42580
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14695
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,4745
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42598
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-14596
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41096
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41086
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-85
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-18
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-871
+addi t0,a0,0
+beq t0,zero,25
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36432
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-968(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-968(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42510
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20041
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-328
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-146
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41237
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,10
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1000(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1000(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1040(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-1040(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-89
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1024(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1064(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-1064(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,112
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-194
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1043
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-855
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41301
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-684
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-41300
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-41289
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-928(t0)
+sd t0,8(sp)
+jal ra,-41280
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1008(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1008(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1016(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1048(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-1048(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1056(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-912(t2)
+add t1,t1,t2
+sd t1,-1056(t0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1040(t1)
+ld t2,24(s0)
+sub t1,t1,t2
+sd t1,-1040(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-890
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-896(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,555
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-734
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-916
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-747
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-920(t0)
+sd t0,8(sp)
+jal ra,-36870
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1079
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,96
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1064
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1048
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1285
+addi t0,a0,0
+beq t0,zero,18
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-912(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41582
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,24(s0)
+ld t1,-16(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41581
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41630
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-67
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-654
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1390
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40085
+addi t0,a0,0
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-15343
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40097
+addi t0,a0,0
+beq t0,zero,2
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-182
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,59
+jal zero,23
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41665
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+sd t0,8(sp)
+jal ra,-41615
+jal zero,2
+jal zero,36
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41725
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41715
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-120
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-16
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-164
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-20
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1314
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,35
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1492
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-76
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1476
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1452
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-92
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41893
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1201
+jal zero,11
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41904
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41835
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1373
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41849
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1205
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1072(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41906
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-1072(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1463
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41989
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41942
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-135
+jal zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-928(t0)
+sd t0,8(sp)
+jal ra,-41901
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-24(s0)
+sd t0,-16(s0)
+jal zero,-44
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-219
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-91
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1032(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1032(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38766
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38750
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1000(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1008(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1024(t0)
+sd t0,48(sp)
+jal ra,-37614
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,224
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38813
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38797
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+sd t0,8(sp)
+jal ra,-38781
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+sd t0,8(sp)
+jal ra,-38765
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1024(t0)
+sd t0,48(sp)
+jal ra,-37677
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38876
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38860
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+sd t0,32(sp)
+jal ra,-37716
+addi sp,sp,32
+lui t0,0xFFFFC
+addi t0,t0,80
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1056(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38919
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1056(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38907
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1056(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-38895
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1056(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-38883
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1008(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1016(t1)
+add t0,t0,t1
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1008(t0)
+sd t0,56(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1016(t0)
+sd t0,64(sp)
+jal ra,-37807
+addi sp,sp,64
+lui t0,0xFFFFC
+addi t0,t0,8
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-39006
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-38990
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+sd t0,8(sp)
+jal ra,-38974
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1048(t0)
+sd t0,8(sp)
+jal ra,-38958
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1008(t0)
+sd t0,48(sp)
+jal ra,-37870
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,-64
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-39069
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-39053
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+sd t0,8(sp)
+jal ra,-39037
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+sd t0,8(sp)
+jal ra,-39021
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1016(t0)
+sd t0,48(sp)
+jal ra,-37933
+addi sp,sp,48
+ld t0,16(s0)
+beq t0,zero,7
+lui t0,0xFFFFC
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37942
+jal ra,-38824
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1112(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-44597
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1112(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1112(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44056
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1112(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,8(sp)
+jal ra,-43255
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43248
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-43263
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1104(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1112(t0)
+sd t0,8(sp)
+jal ra,-43303
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1112(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44134
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44143
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44135
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43327
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44142
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44151
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44173
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43363
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43356
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44187
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1945
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37785
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43364
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41050
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37807
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43369
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37826
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43388
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43377
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44187
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43370
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16396
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43365
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44171
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43358
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,136
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44245
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44702
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16269
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43368
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44265
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44704
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16289
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43371
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44285
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44706
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16309
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43374
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44305
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44708
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16329
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43377
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44325
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44710
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16349
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43380
+ld t0,-184(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40344
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44351
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44610
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16375
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-22260
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-43295
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,8(sp)
+jal ra,-43389
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43378
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1416(t0)
+sd t0,8(sp)
+jal ra,-43369
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-43358
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-43347
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43319
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43308
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43297
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43286
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43275
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43264
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43253
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43157
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43146
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43135
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43124
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43266
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43255
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43244
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-864(t0)
+sd t0,8(sp)
+jal ra,-43235
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43224
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43145
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43134
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43123
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43112
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43101
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43090
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-601
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-429
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1080(t0)
+beq t0,zero,26
+lui t0,0xFFFFC
+addi t0,t0,-128
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44277
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44285
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-38588
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44356
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44347
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44717
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-68
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-140
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,89
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47647
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44174
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43433
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47650
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44177
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43438
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47691
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44180
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43443
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47694
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44183
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43448
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,8(sp)
+jal ra,-44045
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44554
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,131
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44565
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44835
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44556
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45408
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16867
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44593
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-856(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3532
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44609
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3518
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45468
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44936
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-16891
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44929
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-1568(gp)
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-16875
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45284
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45290
+addi t0,a0,0
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-16895
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45088
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45094
+addi t0,a0,0
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-16915
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-28761
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44645
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43880
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-277
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+jal ra,-8170
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,8(sp)
+jal ra,-43628
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45026
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1600(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44606
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-43856
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45099
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-17478
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-17322
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44932
+addi t0,a0,0
+ld t1,-144(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17306
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45126
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-106
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44329
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45123
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-100
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44328
+jal zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45121
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-139
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44328
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45118
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-133
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44327
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,2234
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-184
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44929
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-39232
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,40(s0)
+sd t0,-24(s0)
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,148
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-17952
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18010
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+mul t0,t0,t1
+sd t0,-24(s0)
+jal zero,32
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-17407
+addi t0,a0,0
+beq t0,zero,10
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-17391
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,15
+ld t0,40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+ld t2,-8(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,472(t3)
+remu t2,t2,t3
+sub t1,t1,t2
+addi t2,zero,8
+divu t1,t1,t2
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,74
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18087
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,36
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17524
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17934
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45355
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-17946
+addi t0,a0,0
+ld t1,-32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-284
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,7
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+sd t0,40(s0)
+jal zero,-150
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45154
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,225
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45165
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45435
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45156
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46029
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17470
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44688
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46024
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17483
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45499
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-1568(gp)
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-17445
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45854
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45860
+addi t0,a0,0
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-17465
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46054
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17531
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46048
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17543
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46042
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17555
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-40(s0)
+sd t0,24(sp)
+ld t0,-48(s0)
+sd t0,32(sp)
+jal ra,-311
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45293
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-856(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,2832
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46100
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-48(s0)
+sd t0,16(sp)
+jal ra,-17573
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46076
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17607
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46070
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17619
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-40(s0)
+sd t0,24(sp)
+ld t0,-48(s0)
+sd t0,32(sp)
+jal ra,-375
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46094
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-17621
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45782
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45788
+addi t0,a0,0
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-17609
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45697
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45690
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45683
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17954
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,640(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-29501
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45385
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-44620
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1017
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45102
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9090
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44379
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45126
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-392(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1128(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1120(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,424(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1120(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1128(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1136(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1152(t1)
+ld t1,0(t1)
+sd t1,-1152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1136(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+sub t1,t1,t2
+sd t1,-1136(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+sd t0,8(sp)
+jal ra,-39606
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,142
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1128(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+jal ra,-134
+addi t0,a0,0
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,472(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,-1128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1128(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39556
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1128(t2)
+add t1,t1,t2
+sd t1,-1120(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+sd t0,8(sp)
+jal ra,-39800
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+sub t1,t1,t2
+sd t1,-1128(t0)
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,7
+jal ra,1739
+jal ra,-128
+addi t0,a0,0
+addi a0,t0,0
+jal zero,55
+jal zero,18
+lui t0,0xFFFFC
+addi t0,t0,-224
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-39983
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1504(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50545
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1144(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+add t1,t1,t2
+sd t1,-1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1128(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+sub t1,t1,t2
+sd t1,-1128(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+sd t0,8(sp)
+jal ra,-39746
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1152(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1136(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+add t1,t1,t2
+sd t1,-1136(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46075
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,160
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,757
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2076
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45830
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43007
+addi t0,a0,0
+beq t0,zero,36
+ld t0,-24(s0)
+beq t0,zero,33
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-8(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-8(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2340
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-29
+jal zero,74
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sltu t0,t0,t1
+beq t0,zero,66
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18894
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,39
+ld t0,-24(s0)
+beq t0,zero,33
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-16(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-16(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2277
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-40(s0)
+jal zero,-29
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-181
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-70
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18498
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-45438
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46258
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-18373
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43160
+addi t0,a0,0
+beq t0,zero,30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18455
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,1704
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18471
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-451
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1209
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46303
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-18301
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-11749
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18512
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44490
+addi t0,a0,0
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44596
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18533
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,472(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,472(t2)
+divu t1,t1,t2
+mul t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19138
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44648
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,128
+jal zero,45
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44644
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,113
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44640
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1160(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,98
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44636
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,83
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-151
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29390
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,49
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-36
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-190
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29405
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,10
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-36
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-171
+addi t0,a0,0
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44834
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-20
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44842
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18779
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44781
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44771
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44792
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-1560
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1176(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1176(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-57
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44801
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-44672
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-45230
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+jal ra,-44978
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-44803
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-44794
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+sd t0,8(sp)
+jal ra,-44785
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,8(sp)
+jal ra,-44776
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46564
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+jal ra,-44777
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44919
+addi t0,a0,0
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40580
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18942
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44944
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,-16(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46791
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-32(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19384
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-39
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-44828
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-44817
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+sd t0,8(sp)
+jal ra,-44940
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1160(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-45387
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46132
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,179
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45112
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19049
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45051
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-32(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,153
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46901
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-32(s0)
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-19280
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-45471
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45060
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-44931
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45069
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45112
+addi t0,a0,0
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45126
+addi t0,a0,0
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-948
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1160(t0)
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45279
+addi t0,a0,0
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45288
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-15
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45298
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45153
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47064
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19655
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,118
+jal zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1439
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,105
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46378
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,90
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45360
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19297
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,73
+jal zero,24
+ld t0,24(s0)
+ld t1,-16(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45308
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,49
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45306
+addi t0,a0,0
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47181
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19772
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47216
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19807
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1380
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1376(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1376(t0)
+jal zero,40
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-24
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1422
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1184(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1184(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47287
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-19664
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47299
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19512
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+beq t0,zero,24
+lui t0,0xFFFFC
+addi t0,t0,-312
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47024
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-41327
+addi sp,sp,40
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19528
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-305
+addi t0,a0,0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19540
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-158
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1224(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1224(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45375
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1224(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41237
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1224(t0)
+sd t0,8(sp)
+jal ra,-45325
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1224(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-81
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-45336
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-45325
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-45314
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-45375
+jal zero,21
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45476
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45388
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-45396
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1240(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45462
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,59
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45509
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47548
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45506
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19851
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,-8(s0)
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45530
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1240(t2)
+mul t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45606
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45597
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45584
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1272(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19815
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-6618
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1208(t0)
+jal zero,31
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-143
+addi t0,a0,0
+beq t0,zero,22
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-45519
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47681
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-19894
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1208(t0)
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,10
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-87
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-56
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1200(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+jal ra,-135
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFC
+addi t0,t0,-376
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-41754
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1504(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52316
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45734
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45721
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47781
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-20372
+addi t0,a0,0
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1232(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1232(t0)
+sd t0,-40(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-40(s0)
+ld t1,0(t1)
+sd t1,-1232(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41636
+addi t0,a0,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-56(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-40(s0)
+ld t1,-56(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+ld t2,-56(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-56(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-56(s0)
+jal zero,-24
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47845
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-20222
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47857
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-20070
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45849
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1208(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45871
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45783
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1240(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1216(t0)
+ld t1,-24(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1192(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+jal ra,-45745
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45816
+ld t0,-48(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+add t1,t1,t2
+sd t1,-1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1264(t0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1915
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-440
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-32(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47669
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-41972
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,162
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1216(t0)
+ld t1,24(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1192(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,136
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45991
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,117
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45982
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,107
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46035
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46047
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45959
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45982
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-656
+jal ra,-2236
+addi t0,a0,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-48(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-40(s0)
+ld t1,-48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+ld t2,-48(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+jal zero,-24
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1232(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-32(s0)
+sd t1,-1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+sub t1,t1,t2
+sd t1,-1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1256(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+jal ra,-3055
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+ld t0,-24(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46134
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-139
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,215
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1240(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,70
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46185
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46176
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,-16(s0)
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1208(t0)
+jal zero,23
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46215
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46127
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1240(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1240(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-838
+jal zero,3
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-40(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-40(s0)
+jal zero,-72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1216(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1216(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1192(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,111
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-24(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46265
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,75
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46299
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46311
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46223
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46246
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1232(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-32(s0)
+sd t1,-1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1248(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+sub t1,t1,t2
+sd t1,-1248(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-939
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-24(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+jal zero,7
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46357
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,9
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46366
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-97
+ld t0,-24(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-121
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20590
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,32(s0)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20603
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20599
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1103
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1376(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1384(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1376(t1)
+sd t1,-1384(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1376(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1376(t0)
+jal zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,186
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2484
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1288(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46340
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46368
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46418
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1328(t0)
+jal zero,4
+jal ra,-46446
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1288(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-46396
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-46389
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-46378
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46437
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-46393
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-179
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,111
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46476
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-46432
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1376(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1376(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46493
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,77
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1288(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46563
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,30
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46575
+addi t0,a0,0
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46584
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-15
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46594
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46544
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+sd t0,8(sp)
+jal ra,-46552
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1328(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-8(s0)
+addi t1,zero,31
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-23
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,24(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,10
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-30
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1344(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1296(t2)
+remu t1,t1,t2
+addi t2,zero,2
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,15
+ld t0,-8(s0)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+sd t0,8(sp)
+jal ra,-135
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+ld t1,40(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1296(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,81
+jal zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-179
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,67
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-472
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49072
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-21449
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49084
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21297
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3057
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1360(t0)
+jal ra,-649
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+beq t0,zero,24
+lui t0,0xFFFFC
+addi t0,t0,-520
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48822
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-43125
+addi sp,sp,40
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+ld t1,32(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,99
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49152
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21743
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,77
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-2123
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-347
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-262
+addi t0,a0,0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+jal ra,-209
+jal zero,40
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-679
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-386
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1296(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-24(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-103
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49005
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal zero,85
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49355
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-43018
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,49
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49311
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49304
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49291
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-195
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49282
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49269
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-211
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49424
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-52
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1368(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49360
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49385
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-21861
+addi t0,a0,0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,76
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1128(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1136(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1120(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,424(t2)
+mul t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,424(t2)
+mul t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1120(t2)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+divu t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+sd t0,16(sp)
+jal ra,-4371
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1352(t0)
+jal ra,-1016
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-31
+jal zero,18
+jal ra,-3717
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-3644
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4402
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,424(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,472(t3)
+divu t2,t2,t3
+add t1,t1,t2
+sd t1,424(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,8(sp)
+jal ra,-48760
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21718
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-48721
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49531
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-48714
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-48671
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-48662
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+sd t0,8(sp)
+jal ra,-48653
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,8(sp)
+jal ra,-48644
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+sd t0,8(sp)
+jal ra,-43458
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-48647
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49441
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-48640
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1168(t0)
+beq t0,zero,16
+jal ra,-3073
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-3045
+jal zero,71
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49554
+addi t0,a0,0
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32564
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-3410
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-28
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49547
+addi t0,a0,0
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32571
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-3441
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1168(t0)
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3016
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45702
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-43584
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,32(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-32932
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-3508
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-26
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43617
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-103
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-30
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3590
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3602
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-3627
+jal zero,-25
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-3640
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49913
+addi t0,a0,0
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49924
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45910
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45917
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45929
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45956
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45942
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-24(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-46196
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,46
+sd t0,-24(s0)
+jal zero,-32
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+sd t0,-32(s0)
+jal zero,30
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46012
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-46236
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-46202
+jal zero,-22
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-528
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+sd t0,32(sp)
+jal ra,-44012
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46052
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46078
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-46295
+addi t0,a0,0
+addi t1,zero,62
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,62
+sd t0,16(sp)
+jal ra,-46272
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,12
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-46285
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,-40
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46129
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46140
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46167
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-536
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-44142
+addi sp,sp,16
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-681
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-49138
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49915
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7143
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,7026
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7039
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-459
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1072(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-30369
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-46814
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,-584
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-44318
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54880
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50335
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-22782
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50357
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-22806
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,-24
+ld t0,-32(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44198
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50382
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-22829
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-24(s0)
+ld t1,-48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-40(s0)
+sd t1,0(t0)
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50411
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-22860
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,-31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44254
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1656(t1)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-144(gp)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50502
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50384
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50380
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50376
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50372
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50368
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50364
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55115
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,106
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50613
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55139
+addi t0,a0,0
+ld t1,-1568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,84
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55157
+addi t0,a0,0
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-48(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,57
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50640
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-23236
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+sd t0,16(sp)
+jal ra,-55196
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-44673
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55235
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+jal zero,-59
+ld t0,-32(s0)
+addi a0,t0,0
+jal zero,21
+lui t0,0xFFFFC
+addi t0,t0,-696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-44700
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55262
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1664(t0)
+sd t0,8(sp)
+jal ra,-443
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFC
+addi t0,t0,-784
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+ld t1,-1568(gp)
+add t0,t0,t1
+ld t1,-8(s0)
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50461
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1664(t0)
+sd t0,40(sp)
+jal ra,-44768
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1664(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1672(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37061
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-47313
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-832
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+sd t0,16(sp)
+jal ra,-44819
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55381
+jal ra,-53984
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44667
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-32565
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1680(t0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55418
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,279
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,268
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,255
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,240
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44763
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-32659
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1688(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44785
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-32681
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1696(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44811
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+sd t0,8(sp)
+jal ra,-44851
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1704(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-32723
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+sd t0,8(sp)
+ld t0,-1568(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55570
+addi t0,a0,0
+ld t1,-1568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,129
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55590
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1704(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-55612
+addi t0,a0,0
+ld t1,-16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,85
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,4
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,5
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,6
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,7
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,1152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1672(t1)
+sd t1,1200(t0)
+lui t0,0xFFFFC
+addi t0,t0,-904
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1648(t0)
+ld t1,-1568(gp)
+add t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+ld t1,-16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+sd t0,32(sp)
+jal ra,-45153
+addi sp,sp,32
+jal zero,22
+lui t0,0xFFFFC
+addi t0,t0,-960
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+sd t0,16(sp)
+jal ra,-45169
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55731
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-50434
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51234
+addi t0,a0,0
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1688(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23430
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50433
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51243
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50426
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-50383
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-50374
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+sd t0,8(sp)
+jal ra,-50365
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+sd t0,8(sp)
+jal ra,-50356
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-50352
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-50348
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,10
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1704(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+addi t3,zero,8
+divu t2,t2,t3
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-6275
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23532
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10177
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50947
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-50195
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-70
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1680(t2)
+addi t3,zero,10
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,464(t3)
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-1120(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-1296
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50354
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,21
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47449
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-968
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-45422
+addi sp,sp,8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFC
+addi t0,t0,-976
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-1551
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1800(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1808(t0)
+sd t0,16(sp)
+jal ra,-56037
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1808(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+sd t0,16(sp)
+jal ra,-45516
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56078
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1824(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1808(t2)
+add t1,t1,t2
+sd t1,-1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1808(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1808(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1808(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1808(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1800(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1808(t2)
+addi t3,zero,8
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1808(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-48261
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1808(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-159
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,16(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sd t0,16(s0)
+jal zero,-18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-126
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-31765
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1768(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-48214
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+sd t0,16(sp)
+jal ra,-45720
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56282
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1712(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45563
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1720(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-144(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1712(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-56305
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+sd t0,16(sp)
+jal ra,-45786
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56348
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45631
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1800(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sd t1,-1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1832(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1848(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-1776(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-35656
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51653
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1840(t0)
+sd t0,8(sp)
+jal ra,-449
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1601
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-252
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-256
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1840(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1848(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1648(t2)
+ld t3,-1568(gp)
+add t2,t2,t3
+ld t3,-16(s0)
+add t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t2,-16(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,464(t3)
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-1848(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1840(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1784(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35749
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1784(t2)
+add t1,t1,t2
+sd t1,-1792(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-72(gp)
+sd t1,-1792(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-334
+jal ra,-35781
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-339
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-343
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52012
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-356
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52033
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-48304
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-48541
+addi t0,a0,0
+beq t0,zero,37
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-48663
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-521
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-33
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1832(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1832(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-612
+lui t0,0xFFFFC
+addi t0,t0,-1144
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1824(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1832(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+sd t0,32(sp)
+jal ra,-46111
+addi sp,sp,32
+lui t0,0xFFFFC
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1848(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1840(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1784(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-707
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1840(t0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-721
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-46158
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1776(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1760(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1816(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1800(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1728(t0)
+sd t0,16(sp)
+jal ra,-56757
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1816(t0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1808(t0)
+sd t0,8(sp)
+jal ra,-48732
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1808(t0)
+addi t0,zero,0
+addi a0,t0,0
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1800(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1816(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1816(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-48863
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1816(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1816(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1824(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1824(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+jal ra,-126
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,128
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-48969
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,7
+add t0,t0,t1
+sd t0,-24(s0)
+jal ra,-155
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-29
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-48991
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38633
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1768(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-48889
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-46393
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56955
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1712(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46236
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1768(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1712(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-56975
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+ld t0,-8(s0)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46292
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1800(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1816(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+addi t2,zero,8
+mul t1,t1,t2
+sd t1,-1824(t0)
+jal zero,20
+lui t0,0xFFFFC
+addi t0,t0,-1336
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-46497
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-57059
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-228
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1736(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,191
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-242
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-251
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1864(t0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,165
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-268
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1872(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,146
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1872(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-48862
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-49099
+addi t0,a0,0
+beq t0,zero,126
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-46457
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1032(t1)
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-46473
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46455
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+sd t0,8(sp)
+jal ra,-34351
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1040(t0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,72
+ld t0,-24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-492
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1040(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-521
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-49355
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-74
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-1896(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-392
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1912(t0)
+jal ra,-244
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1736(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1856(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1896(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1864(t1)
+sd t1,-1904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1856(t1)
+sd t1,-1912(t0)
+jal ra,-284
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1904(t0)
+sd t0,8(sp)
+jal ra,-1374
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2032
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-476
+jal ra,-320
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1736(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1864(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1904(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1736(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1736(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-359
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-39
+lui t0,0xFFFFC
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1904(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1912(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+sd t0,40(sp)
+jal ra,-46899
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-48(t1)
+sd t1,-1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-56(t1)
+sd t1,-1928(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-64(t1)
+sd t1,-1936(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1832(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-1888(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36760
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1896(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,76
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,60
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,48
+lui t0,0xFFFFC
+addi t0,t0,-1472
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52721
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53069
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-47030
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1920(t1)
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1928(t1)
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1936(t1)
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-72(gp)
+sd t1,-1896(t0)
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,-1536
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36891
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-47093
+addi sp,sp,24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+sd t0,8(sp)
+jal ra,-52080
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-609
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-620
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-11
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1752(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,216
+jal zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1856(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1912(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36964
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-109
+addi t0,a0,0
+addi a0,t0,0
+jal zero,188
+jal zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1864(t0)
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-124
+addi t0,a0,0
+addi a0,t0,0
+jal zero,173
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1832(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1832(t0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10898
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11600
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30476
+jal zero,112
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32472
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,124
+jal zero,94
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1872(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-49540
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-49777
+addi t0,a0,0
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53299
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-32371
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53319
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1872(t1)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53354
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52552
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,-1552
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47329
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20044
+jal ra,-48215
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53361
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1872(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-290
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFC
+addi t0,t0,-1608
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1896(t0)
+sd t0,16(sp)
+jal ra,-47395
+addi sp,sp,16
+lui t0,0xFFFFC
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1824(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1832(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+sd t0,32(sp)
+jal ra,-47418
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1888(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1880(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,8(sp)
+jal ra,-52458
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53096
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52334
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53485
+addi t0,a0,0
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1664(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3245
+addi t0,a0,0
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2771
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1888(t0)
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-382
+addi t0,a0,0
+addi a0,t0,0
+jal zero,132
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11198
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11900
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30776
+jal zero,79
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32321
+jal zero,66
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1072(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31877
+jal zero,53
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31433
+jal zero,40
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32811
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,-1712
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-47587
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+sd t0,8(sp)
+jal ra,-52574
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1776(t0)
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1646
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,8(sp)
+jal ra,-52662
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53281
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52521
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53442
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-5694
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi a0,t0,0
+jal zero,141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+jal ra,-7928
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-5988
+jal ra,-7936
+addi t0,a0,0
+beq t0,zero,97
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-6660
+addi t0,a0,0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-6509
+jal zero,76
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1352(t0)
+jal ra,-5295
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7911
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-8676
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25933
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12578
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53348
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52596
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,-1760
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-47806
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1504(t0)
+sd t0,8(sp)
+jal ra,-52793
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,8(sp)
+jal ra,-52852
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-47854
+addi sp,sp,8
+jal ra,-20737
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1416(t0)
+sd t0,8(sp)
+jal ra,-52842
+jal zero,20
+lui t0,0xFFFFC
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-47875
+addi sp,sp,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1512(t0)
+sd t0,8(sp)
+jal ra,-52862
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,8(sp)
+jal ra,-52920
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53520
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52762
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-2008(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1312(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1304(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+jal ra,-4700
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53769
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1776(t0)
+beq t0,zero,14
+jal ra,-37785
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1792(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2147
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-572
+addi t0,a0,0
+addi a0,t0,0
+jal zero,92
+jal zero,90
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-384
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-209
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-157
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+jal zero,42
+lui t0,0xFFFFC
+addi t0,t0,-1872
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53770
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-48073
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53857
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-20538
+jal ra,-48966
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1552(t0)
+sd t0,8(sp)
+jal ra,-53071
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-52737
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1992(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2000(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-52758
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-2000(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53527
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1992(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2000(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-2024(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-2024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1976(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53593
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-2040(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-2040(t0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53593
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53600
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,-24(s0)
+sd t0,-8(s0)
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53634
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-41
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53649
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-52915
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-2000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,-2000(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+sd t0,8(sp)
+jal ra,-52935
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1992(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53656
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-52928
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-2032(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-2032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1992(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2000(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2008(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1416(t1)
+sd t1,-2016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2040(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-46
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-311
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1984(t1)
+sltu t0,t0,t1
+beq t0,zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9889
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4252
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54143
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50433
+addi t0,a0,0
+addi t1,zero,21
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50459
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-1880
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54166
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-48438
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-53405
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1968(t1)
+remu t0,t0,t1
+sd t0,8(sp)
+jal ra,-53092
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12159
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-394
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-85
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-313
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1992(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2008(t0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2008(t0)
+jal ra,-397
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-442
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-356
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-424
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-2008(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-38383
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-53152
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2016(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1416(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54357
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-2016(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8553
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,464
+lui t0,0xFFFFE
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52185
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,2024(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8590
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1992(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54040
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,2040(t0)
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,2008(t0)
+jal zero,5
+lui t0,0xFFFFE
+add t0,gp,t0
+addi t1,zero,1
+sd t1,2008(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,-984(gp)
+ld t0,-984(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41009
+addi t0,a0,0
+sd t0,-992(gp)
+ld t0,-992(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-51261
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFC
+addi t0,t0,-1920
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-984(gp)
+sd t0,16(sp)
+jal ra,-48765
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-59327
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2048(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48608
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFE
+add t0,gp,t0
+addi t1,zero,0
+sd t1,2032(t0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFE
+add t0,gp,t0
+addi t1,zero,0
+sd t1,2016(t0)
+jal ra,-48271
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,246
+addi t0,zero,0
+sd t0,-32(s0)
+jal ra,-48215
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,131
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-376(gp)
+sd t0,-872(gp)
+jal zero,121
+jal ra,-48197
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-48298
+jal zero,116
+ld t0,-184(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50831
+addi t0,a0,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+jal ra,-48210
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-376(gp)
+sd t0,-872(gp)
+jal zero,42
+ld t0,-48(s0)
+ld t1,-184(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-40(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-51029
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+jal ra,-48340
+jal zero,24
+lui t0,0xFFFFC
+addi t0,t0,-1976
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,24(sp)
+jal ra,-48879
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-59441
+jal zero,-57
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-2048(t1)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-8(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-40(s0)
+sd t1,0(t0)
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,32
+lui t0,0xFFFFC
+addi t0,t0,-2040
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2016(t0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2048(t0)
+sd t0,32(sp)
+jal ra,-48929
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-59491
+jal zero,-136
+ld t0,-32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,96
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2016(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,2016(t0)
+jal ra,-52528
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-52421
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2016(t0)
+sd t0,8(sp)
+jal ra,-52416
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-52405
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48809
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-52400
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-52389
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-48(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52501
+addi t0,a0,0
+ld t1,-48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+ld t2,-48(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+jal zero,-24
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,2032(t0)
+jal zero,7
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-52497
+ld t0,-16(s0)
+sd t0,-24(s0)
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-48520
+jal zero,-249
+lui t0,0xFFFFB
+addi t0,t0,1992
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2016(t0)
+sd t0,16(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+sd t0,24(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2008(t0)
+sd t0,32(sp)
+jal ra,-49065
+addi sp,sp,32
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2016(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFE
+add t0,gp,t0
+addi t1,zero,0
+sd t1,2040(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52595
+addi t0,a0,0
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34883
+ld t0,-144(gp)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2000(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lui t0,0xFFFFB
+addi t0,t0,1904
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52662
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-49126
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-59688
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10597
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5633
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-5029
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51152
+addi t0,a0,0
+addi t1,zero,21
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51178
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-54102
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54879
+addi t0,a0,0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-1880
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52731
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-49162
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52701
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54907
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52738
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52725
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-5457
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-52632
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1131
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2040(t1)
+sd t1,1200(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-889
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t1,-144(gp)
+sd t1,2000(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2032(t1)
+sd t1,2024(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2008(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-202
+lui t0,0xFFFFE
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2024(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52851
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,2024(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-37
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1114
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2032(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,150
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52825
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFB
+addi t0,t0,1888
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52897
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55064
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-49367
+addi sp,sp,24
+addi t0,zero,1
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52897
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFB
+addi t0,t0,1880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52892
+addi t0,a0,0
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-49399
+addi sp,sp,8
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-40(s0)
+jal zero,-34
+lui t0,0xFFFFB
+addi t0,t0,1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55171
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-51703
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-49425
+addi sp,sp,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54731
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFB
+addi t0,t0,1800
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55124
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54750
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-49452
+addi sp,sp,16
+jal ra,-50335
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55215
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1416(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54777
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53039
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-153
+lui t0,0xFFFFB
+addi t0,t0,1768
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2016(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+jal ra,-49504
+addi sp,sp,24
+ld t0,-32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,21
+lui t0,0xFFFFB
+addi t0,t0,1696
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-39319
+addi t0,a0,0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2016(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+ld t0,-32(s0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2016(t1)
+divu t0,t0,t1
+sd t0,16(sp)
+jal ra,-49528
+addi sp,sp,16
+jal ra,-50411
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1888(t0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2613
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-32267
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55310
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55321
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+jal zero,49
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1629
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1040
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2016(t0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-8(s0)
+jal zero,15
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1108
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-970
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-92
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,1
+beq t0,zero,48
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,8(sp)
+jal ra,-60167
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1703
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1114
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2016(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,7
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1178
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-48
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-72(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-8(s0)
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sd t0,-8(s0)
+jal zero,24
+ld t0,-8(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,-8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+ld t1,24(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,7
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,116
+ld t0,24(s0)
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-32482
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-60295
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55534
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55545
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-16(s0)
+jal zero,74
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1853
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1264
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-2016(t0)
+addi a0,t0,0
+jal zero,47
+ld t0,24(s0)
+beq t0,zero,4
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,33
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1339
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,24(s0)
+beq t0,zero,17
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-112(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,9
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,-116
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,122
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-32614
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55657
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1392(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55668
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+jal zero,91
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55736
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55732
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8915
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFC
+addi t0,t0,-1872
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55678
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-49981
+addi sp,sp,16
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55781
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55769
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-22450
+jal ra,-50878
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1552(t0)
+addi a0,t0,0
+jal zero,28
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2041
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1408(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55775
+addi t0,a0,0
+addi a0,t0,0
+jal zero,9
+ld t0,-16(s0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+sd t0,-8(s0)
+jal zero,-122
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6678
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-152
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-170
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,2016(t1)
+sd t1,-1984(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFB
+addi t0,t0,1656
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50118
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,1119
+jal zero,112
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1856(t0)
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFB
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50152
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,1085
+jal zero,78
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+sd t0,16(s0)
+jal zero,57
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-57971
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+sd t0,16(s0)
+jal zero,35
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-32347
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+sd t0,16(s0)
+jal zero,17
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-104(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,102
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+jal zero,65
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+jal zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+jal zero,16
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1984(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFB
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50337
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,900
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,115
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1664(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFB
+addi t0,t0,1384
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50475
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,762
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,101
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFB
+addi t0,t0,1272
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50585
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,652
+jal ra,-57662
+jal ra,-57275
+jal ra,-54284
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1192(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50252
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1216(t0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,661
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52370
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-58725
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10808
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1280(t0)
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10826
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1288(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50329
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50345
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50363
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1344(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1489
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1096(t0)
+jal zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-12212
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1096(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5590
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6593
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2383
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1096(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-40(t0)
+lui t0,0xFFFFB
+addi t0,t0,1192
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-50833
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,23
+lui t0,0xFFFFB
+addi t0,t0,1160
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1960(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1976(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-50861
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,16
+lui t0,0xFFFFB
+addi t0,t0,1136
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+jal ra,-50882
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFB
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+sd t0,8(sp)
+jal ra,-50899
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14573
+lui t0,0xFFFFB
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-896(t0)
+sd t0,8(sp)
+jal ra,-50920
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+beq t0,zero,8
+lui t0,0xFFFFB
+addi t0,t0,1032
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50931
+jal zero,7
+lui t0,0xFFFFB
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50938
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,8
+lui t0,0xFFFFB
+addi t0,t0,992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50952
+jal zero,7
+lui t0,0xFFFFB
+addi t0,t0,976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50959
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+beq t0,zero,7
+lui t0,0xFFFFB
+addi t0,t0,944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50970
+lui t0,0xFFFFB
+addi t0,t0,856
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-50980
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-30368
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+jal ra,-20319
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1760(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5350
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-4214
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1510
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1576(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1417
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,56
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1045
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,39
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1040
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,22
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1408
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFB
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-51132
+addi sp,sp,8
+lui t0,0xFFFFB
+addi t0,t0,696
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+sd t0,8(sp)
+jal ra,-53448
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-51170
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+beq t0,zero,2
+jal ra,-30019
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-19939
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-18402
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1776(t0)
+beq t0,zero,2
+jal ra,-5113
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1888(t0)
+beq t0,zero,2
+jal ra,-3832
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-1889
+jal ra,-17479
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-40(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-48(t0)
+lui t0,0xFFFFB
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-51237
+addi sp,sp,8
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1928(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1920(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1920(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1912(t0)
+jal ra,-79
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1928(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,1928(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+lui t1,0xFFFFE
+add t1,gp,t1
+ld t1,1920(t1)
+addi t2,zero,1
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,1920(t0)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1920(t0)
+ld t1,16(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1424(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1432(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1440(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFB
+addi t0,t0,512
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-51441
+addi sp,sp,8
+lui t0,0xFFFFB
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51448
+lui t0,0xFFFFB
+addi t0,t0,384
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-51456
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-219
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1424(t0)
+addi a0,t0,0
+jal zero,1016
+jal zero,1014
+lui t0,0xFFFFB
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-51490
+addi sp,sp,8
+lui t0,0xFFFFB
+addi t0,t0,248
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-16(gp)
+sd t0,16(sp)
+jal ra,-51503
+addi sp,sp,16
+lui t0,0xFFFFB
+addi t0,t0,184
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+ld t0,-56(gp)
+sd t0,24(sp)
+jal ra,-51518
+addi sp,sp,24
+jal ra,-16585
+jal ra,-52402
+lui t0,0xFFFFB
+addi t0,t0,296
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-51531
+addi sp,sp,8
+jal ra,-61883
+jal ra,-61155
+jal ra,-61132
+jal ra,-58764
+jal ra,-59504
+jal ra,-289
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,936
+jal ra,-232
+jal ra,956
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,176
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53380
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-43793
+jal zero,903
+jal ra,-310
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,925
+jal zero,890
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,168
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53407
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-273
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37631
+jal zero,872
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,160
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53425
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24792
+jal zero,855
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,152
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53442
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24809
+jal zero,838
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,144
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53459
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-325
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37424
+jal zero,820
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,136
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53477
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-347
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1664(t0)
+jal zero,798
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,128
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53499
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-365
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6900
+jal zero,780
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,120
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53517
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-387
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,608(t0)
+jal zero,758
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,112
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53539
+addi t0,a0,0
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-409
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53470
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-376(t0)
+jal ra,-492
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,743
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-446
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-360(t0)
+jal zero,699
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,96
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53598
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-468
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-424(t0)
+jal zero,677
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,88
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53620
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-490
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1760(t0)
+jal ra,-557
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,678
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-511
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53572
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1784(t0)
+jal zero,630
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,80
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53667
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-537
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1880(t0)
+jal ra,-604
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,631
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1880(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-559
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53620
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-5150
+jal zero,583
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,72
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53714
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFE
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-584
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,2040(t0)
+jal ra,-651
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,584
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,2040(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-606
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53667
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3211
+jal zero,536
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54825
+addi t0,a0,0
+beq t0,zero,525
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,64
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53767
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1873
+addi t0,a0,0
+addi a0,t0,0
+jal zero,543
+jal zero,502
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,56
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53789
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1616(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1895
+addi t0,a0,0
+addi a0,t0,0
+jal zero,521
+jal zero,480
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,48
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53811
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1624(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1917
+addi t0,a0,0
+addi a0,t0,0
+jal zero,499
+jal zero,458
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,40
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53833
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1939
+addi t0,a0,0
+addi a0,t0,0
+jal zero,477
+jal zero,436
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,32
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53855
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1961
+addi t0,a0,0
+addi a0,t0,0
+jal zero,455
+jal zero,414
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,24
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53877
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1592(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1983
+addi t0,a0,0
+addi a0,t0,0
+jal zero,433
+jal zero,392
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,16
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53899
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1632(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2005
+addi t0,a0,0
+addi a0,t0,0
+jal zero,411
+jal zero,370
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,8
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53921
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1640(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2027
+addi t0,a0,0
+addi a0,t0,0
+jal zero,389
+jal zero,348
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,0
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53943
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+sd t1,952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1632(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,363
+jal zero,322
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-8
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53969
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,3
+sd t1,952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1632(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2079
+addi t0,a0,0
+addi a0,t0,0
+jal zero,337
+jal zero,296
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-24
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-53995
+addi t0,a0,0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-865
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-34657
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,288
+jal zero,247
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-32
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54044
+addi t0,a0,0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-914
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-34706
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,239
+jal zero,198
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-48
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54093
+addi t0,a0,0
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-963
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-34755
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,190
+jal zero,149
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-64
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54142
+addi t0,a0,0
+beq t0,zero,76
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1012
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1960(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1952(t0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-34804
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1976(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1976(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1952(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,141
+jal zero,13
+jal ra,-1107
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1061
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1984(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1984(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-1984(t0)
+jal zero,62
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-72
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54229
+addi t0,a0,0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1099
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54160
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+mul t1,t1,t2
+sd t1,-1200(t0)
+jal zero,32
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-80
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54259
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1129
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54190
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1304(t0)
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,41
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1440(t0)
+addi a0,t0,0
+jal zero,35
+jal ra,-1212
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFB
+addi t0,t0,-168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-52475
+addi sp,sp,8
+jal zero,-939
+lui t0,0xFFFFB
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,8(sp)
+jal ra,-52487
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1416(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-176
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54340
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-32(gp)
+jal ra,-55581
+jal ra,-60552
+jal ra,-61678
+jal ra,-1211
+jal zero,92
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-184
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54359
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,1
+sd t0,-32(gp)
+jal ra,-55600
+jal ra,-60571
+jal ra,-61697
+jal ra,-1230
+jal zero,73
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-192
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54378
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-872(t1)
+sd t1,-880(t0)
+jal ra,-1250
+jal zero,53
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-200
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54398
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-872(t1)
+sd t1,-880(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sd t1,-904(t0)
+jal ra,-1276
+jal zero,27
+lui t0,0xFFFFE
+add t0,gp,t0
+ld t0,1912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-208
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-54424
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sd t1,-904(t0)
+jal ra,-1296
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sd t1,-880(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1251
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1207
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1440(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1424(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1416(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-55928
+jal ra,-63181
+jal ra,-55903
+jal ra,-55748
+jal ra,-56069
+jal ra,-35336
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1229
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFB
+addi t0,t0,-248
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-82
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x34366D2D
+.8byte 0x32336D2D
+.8byte 0x2A2A2A2A203A7325
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0xA2A2A2A2A
+.8byte 0x70756465642D
+.8byte 0x706177732D
+.8byte 0x6C7564656863732D
+.8byte 0x65
+.8byte 0x637465666572702D
+.8byte 0x68
+.8byte 0x65746972772D
+.8byte 0x6563616C7065722D
+.8byte 0x0
+.8byte 0x334C2D
+.8byte 0x324C2D
+.8byte 0x74696A2D
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x68637461622D
+.8byte 0x79616C7065722D
+.8byte 0x676F6C2D
+.8byte 0x7461746F6E6E612D
+.8byte 0x65
+.8byte 0x736B636174732D
+.8byte 0x65636172742D
+.8byte 0x656D757365722D
+.8byte 0x70616E732D
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6F2D
+.8byte 0x632D
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x3D3D3D3D203A7325
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0xA3D3D3D3D
+.8byte 0x637461622D207C20
+.8byte 0x7720656C69662068
+.8byte 0x7D207372656B726F
+.8byte 0xA7325
+.8byte 0x636172742D207C20
+.8byte 0x7C20656C69662065
+.8byte 0x736B636174732D20
+.8byte 0x20646F6972657020
+.8byte 0x2D207C20656C6966
+.8byte 0x657461746F6E6E61
+.8byte 0x207C20656C696620
+.8byte 0x6C696620676F6C2D
+.8byte 0x646F697265702065
+.8byte 0x6C7065722D207C20
+.8byte 0x20656C6966207961
+.8byte 0x746E756F63
+.8byte 0x20632D207B207325
+.8byte 0x656372756F73207B
+.8byte 0x206F2D207C207D20
+.8byte 0x7C207972616E6962
+.8byte 0x207C20732D202820
+.8byte 0x737361202920532D
+.8byte 0x207C20796C626D65
+.8byte 0x72616E6962206C2D
+.8byte 0x616E732D207C2079
+.8byte 0x206567616D692070
+.8byte 0x6D757365722D207C
+.8byte 0x6567616D692065
+.8byte 0x23232323203A7325
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0xA23232323
+.8byte 0x2D756C25203A7325
+.8byte 0x7420732520746962
+.8byte 0x6974616E696D7265
+.8byte 0x622D756C2520676E
+.8byte 0x2D43534952207469
+.8byte 0x7972616E69622055
+.8byte 0x6874697720732520
+.8byte 0x6F63207469786520
+.8byte 0xA646C25206564
+.8byte 0x3C3C3C203A73250A
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C3C
+.8byte 0x3E3E3E203A73250A
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA0A3E3E3E3E3E
+.8byte 0x616220646E61202C
+.8byte 0x636F6C622D636973
+.8byte 0x6C736E617274206B
+.8byte 0x6E6F697461
+.8byte 0x656420646E61202C
+.8byte 0x726567677562
+.8byte 0x657220646E61202C
+.8byte 0x79616C70
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x6E696772656D202C
+.8byte 0x69746E6564692067
+.8byte 0x65676170206C6163
+.8byte 0x2079726576652073
+.8byte 0x656D697420756C25
+.8byte 0x727265746E692072
+.8byte 0x73747075
+.8byte 0x756C2520646E6120
+.8byte 0x207061777320424D
+.8byte 0x6563617073
+.8byte 0x20756C25206E6920
+.8byte 0x73747865746E6F63
+.8byte 0x6C75646568637320
+.8byte 0x7325206465
+.8byte 0x2D756C25203A7325
+.8byte 0x6520732520746962
+.8byte 0x676E697475636578
+.8byte 0x7469622D756C2520
+.8byte 0x20552D4353495220
+.8byte 0x25207972616E6962
+.8byte 0x2520687469772073
+.8byte 0x79687020424D756C
+.8byte 0x656D206C61636973
+.8byte 0x79726F6D
+.8byte 0x6772656D203A7325
+.8byte 0x6567617020676E69
+.8byte 0x6C6E6F2073692073
+.8byte 0x726F707075732079
+.8byte 0x6D206E6F20646574
+.8byte 0x7720726574737069
+.8byte 0x732074756F687469
+.8byte 0x2C676E6970706177
+.8byte 0x6964726F63657220
+.8byte 0x68636163202C676E
+.8byte 0x67616D69202C7365
+.8byte 0x73676F6C202C7365
+.8byte 0x70657220726F202C
+.8byte 0xA79616C
+.8byte 0x70617773203A7325
+.8byte 0x20736920676E6970
+.8byte 0x70757320796C6E6F
+.8byte 0x6F20646574726F70
+.8byte 0x65747370696D206E
+.8byte 0x756F687469772072
+.8byte 0x64726F6365722074
+.8byte 0x636163202C676E69
+.8byte 0x2C6367202C736568
+.8byte 0x6F687370616E7320
+.8byte 0x67616D69202C7374
+.8byte 0x73676F6C202C7365
+.8byte 0x70657220726F202C
+.8byte 0xA79616C
+.8byte 0x65686373203A7325
+.8byte 0x6D20676E696C7564
+.8byte 0x20656C7069746C75
+.8byte 0x73747865746E6F63
+.8byte 0x75736E7520736920
+.8byte 0x20646574726F7070
+.8byte 0x74736E696D206E6F
+.8byte 0x73626F6D202C7265
+.8byte 0x646E61202C726574
+.8byte 0x6D69206874697720
+.8byte 0x6F6C202C73656761
+.8byte 0x6C706572202C7367
+.8byte 0x6220726F202C7961
+.8byte 0xA63672068637461
+.8byte 0x0
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x786520756C25202C
+.8byte 0x6920646574756365
+.8byte 0x697463757274736E
+.8byte 0x2072657020736E6F
+.8byte 0x756C25202C626F6A
+.8byte 0x61746F74206E6920
+.8byte 0x657661206E6F206C
+.8byte 0x746E752065676172
+.8byte 0x74697865206C69
+.8byte 0x20756C25203A7325
+.8byte 0x7469772073626F6A
+.8byte 0x616620756C252068
+.8byte 0x736572756C69
+.8byte 0x2520726574666120
+.8byte 0x756365786520756C
+.8byte 0x74736E6920646574
+.8byte 0x736E6F6974637572
+.8byte 0x6E6920756C25202C
+.8byte 0x6C61746F7420
+.8byte 0x2064657469786520
+.8byte 0x6978652068746977
+.8byte 0x252065646F632074
+.8byte 0x646C
+.8byte 0x732520
+.8byte 0x20626F6A203A7325
+.8byte 0x7325203A756C25
+.8byte 0x616E6962203A7325
+.8byte 0x666F207325207972
+.8byte 0x756C2520626F6A20
+.8byte 0x6420612073616820
+.8byte 0x746E657265666669
+.8byte 0x69732064726F7720
+.8byte 0x206E61687420657A
+.8byte 0x616E696220656874
+.8byte 0x20666F2073656972
+.8byte 0x207265696C726165
+.8byte 0xA73626F6A
+.8byte 0x20756C25203A7325
+.8byte 0x6165722073626F6A
+.8byte 0x62206D6F72662064
+.8byte 0x6C69662068637461
+.8byte 0x206F742073252065
+.8byte 0x20756C25206E7572
+.8byte 0x6D69742061207461
+.8byte 0xA65
+.8byte 0x20626F6A203A7325
+.8byte 0x62206E6920756C25
+.8byte 0x6C69662068637461
+.8byte 0x7361682073252065
+.8byte 0x68742065726F6D20
+.8byte 0x6120756C25206E61
+.8byte 0x73746E656D756772
+.8byte 0xA
+.8byte 0x75677261203A7325
+.8byte 0x2E732520746E656D
+.8byte 0x6162206E69202E2E
+.8byte 0x656C696620686374
+.8byte 0x7420736920732520
+.8byte 0xA676E6F6C206F6F
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x6863746162206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x756C25237325
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x65676170203A7325
+.8byte 0x6120746C75616620
+.8byte 0x20586C2578302074
+.8byte 0x7020666F2074756F
+.8byte 0x206C616369737968
+.8byte 0xA79726F6D656D
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x20756C25203A7325
+.8byte 0x666F207365747962
+.8byte 0x6974756365786520
+.8byte 0x7720676F6C206E6F
+.8byte 0x20756C2520687469
+.8byte 0x63206D6574737973
+.8byte 0x70657220736C6C61
+.8byte 0x726620646579616C
+.8byte 0xA7325206D6F
+.8byte 0x63657865203A7325
+.8byte 0x6E65206E6F697475
+.8byte 0x6F66656220646564
+.8byte 0x6863616572206572
+.8byte 0x74736E6920676E69
+.8byte 0x206E6F6974637572
+.8byte 0xA756C25
+.8byte 0x6579616C70657228
+.8byte 0x203E2D202964
+.8byte 0x6C706572203A7325
+.8byte 0x7265766964207961
+.8byte 0x6D6F726620646567
+.8byte 0x6974756365786520
+.8byte 0x2520676F6C206E6F
+.8byte 0x736E692074612073
+.8byte 0x6E6F697463757274
+.8byte 0xA756C2520
+.8byte 0x6C706572203A7325
+.8byte 0x756C252064657961
+.8byte 0x63757274736E6920
+.8byte 0x63202C736E6F6974
+.8byte 0x2520747865746E6F
+.8byte 0x2063702074612073
+.8byte 0xA586C257830
+.8byte 0x6C706572203A7325
+.8byte 0x732520676E697961
+.8byte 0x6863206D6F726620
+.8byte 0x746E696F706B6365
+.8byte 0x20746120756C2520
+.8byte 0x7463757274736E69
+.8byte 0x20756C25206E6F69
+.8byte 0x7274736E69206F74
+.8byte 0x25206E6F69746375
+.8byte 0xA756C
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x7563657865206461
+.8byte 0x676F6C206E6F6974
+.8byte 0x6E69206D6F726620
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7563657865206E65
+.8byte 0x676F6C206E6F6974
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x20756C25203A7325
+.8byte 0x666F207365747962
+.8byte 0x65686320756C2520
+.8byte 0x73746E696F706B63
+.8byte 0x65206E656B617420
+.8byte 0x756C252079726576
+.8byte 0x63757274736E6920
+.8byte 0x727720736E6F6974
+.8byte 0x6E69206E65747469
+.8byte 0x6F74207325206F74
+.8byte 0xA732520
+.8byte 0x20756C25203A7325
+.8byte 0x666F207365747962
+.8byte 0x6974756365786520
+.8byte 0x7720676F6C206E6F
+.8byte 0x20756C2520687469
+.8byte 0x63206D6574737973
+.8byte 0x69727720736C6C61
+.8byte 0x746E69206E657474
+.8byte 0xA7325206F
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6578652065746165
+.8byte 0x6C206E6F69747563
+.8byte 0x20656C696620676F
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6365786520657469
+.8byte 0x6F6C206E6F697475
+.8byte 0x2520656C69662067
+.8byte 0xA73
+.8byte 0x706E73
+.8byte 0x756C252D
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x7370616E73206461
+.8byte 0x67616D6920746F68
+.8byte 0x69206D6F72662065
+.8byte 0x6C6966207475706E
+.8byte 0xA73252065
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6D20756C25206874
+.8byte 0x6170206465707061
+.8byte 0x64616F6C20736567
+.8byte 0x206D6F7266206465
+.8byte 0x746F687370616E73
+.8byte 0x25206567616D6920
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7370616E73206E65
+.8byte 0x67616D6920746F68
+.8byte 0x2520656C69662065
+.8byte 0xA73
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x6D20756C25206874
+.8byte 0x6170206465707061
+.8byte 0x6320666F20736567
+.8byte 0x2520747865746E6F
+.8byte 0x6574746972772073
+.8byte 0x73206F746E69206E
+.8byte 0x20746F687370616E
+.8byte 0x7325206567616D69
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x70616E7320657469
+.8byte 0x616D6920746F6873
+.8byte 0x20656C6966206567
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6567617020657469
+.8byte 0x2073656D61726620
+.8byte 0x616E73206F746E69
+.8byte 0x6D6920746F687370
+.8byte 0x656C696620656761
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x616E732065746165
+.8byte 0x6D6920746F687370
+.8byte 0x656C696620656761
+.8byte 0xA732520
+.8byte 0x7325203E7325
+.8byte 0x73252E73257325
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064656772656D20
+.8byte 0x617266206D6F7266
+.8byte 0x383025783020656D
+.8byte 0x206F746E6920586C
+.8byte 0x783020656D617266
+.8byte 0x6E6920586C383025
+.8byte 0x747865746E6F6320
+.8byte 0xA732520
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x6465707061777320
+.8byte 0x6F72662074756F20
+.8byte 0x20656D617266206D
+.8byte 0x20586C3830257830
+.8byte 0x65746E6F63206E69
+.8byte 0xA7325207478
+.8byte 0x65676170203A7325
+.8byte 0x6961662074756F20
+.8byte 0x74756F202C64656C
+.8byte 0x7379687020666F20
+.8byte 0x6D656D206C616369
+.8byte 0x20646E612079726F
+.8byte 0x6170732070617773
+.8byte 0xA6563
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x20646569706F6320
+.8byte 0x6574697277206E6F
+.8byte 0x7266206D6F726620
+.8byte 0x3025783020656D61
+.8byte 0x66206F7420586C38
+.8byte 0x25783020656D6172
+.8byte 0x206E6920586C3830
+.8byte 0x20747865746E6F63
+.8byte 0xA7325
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0xA732520747865
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x7263207325207478
+.8byte 0x6863206465746165
+.8byte 0x746E6F6320646C69
+.8byte 0xA732520747865
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x74616C736E617274
+.8byte 0x20203A736E6F69
+.8byte 0x3A424C54203A7325
+.8byte 0x2020202020202020
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x203A74616E65706F
+.8byte 0x20202020202020
+.8byte 0x20203A6574697277
+.8byte 0x20202020202020
+.8byte 0x2020203A64616572
+.8byte 0x20202020202020
+.8byte 0x63737973203A7325
+.8byte 0x3A4F2F49206C6C61
+.8byte 0x736C6C6163202020
+.8byte 0x625B73657479622C
+.8byte 0x6C61632F73657479
+.8byte 0xA5D6C
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x2020202020202020
+.8byte 0x74736E6920314C20
+.8byte 0x3A6E6F6974637572
+.8byte 0x20
+.8byte 0x2020202020202020
+.8byte 0x6174616420314C20
+.8byte 0x202020202020203A
+.8byte 0x20
+.8byte 0x646574697865202C
+.8byte 0x2520726574666120
+.8byte 0x756365786520756C
+.8byte 0x74736E6920646574
+.8byte 0x736E6F6974637572
+.8byte 0x61746F74206E6920
+.8byte 0x7720756C2528206C
+.8byte 0x29676E69746961
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6374617073696420
+.8byte 0x7020746120736568
+.8byte 0x20797469726F6972
+.8byte 0x756C25
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6C6C616373797320
+.8byte 0x7020756C25202C73
+.8byte 0x6C75616620656761
+.8byte 0x20756C25202C7374
+.8byte 0x6E692072656D6974
+.8byte 0x7374707572726574
+.8byte 0xA
+.8byte 0x766520656E6F202C
+.8byte 0x20756C2520797265
+.8byte 0x6465747563657865
+.8byte 0x63757274736E6920
+.8byte 0x736E6F6974
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x2079622064656C
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x252E756C25282073
+.8byte 0x6F20424D756C322E
+.8byte 0x2E252E756C252072
+.8byte 0x6361202525756C32
+.8byte 0x6120796C6C617574
+.8byte 0x2964657373656363
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424B756C322E252E
+.8byte 0x7473206B61657020
+.8byte 0x657A6973206B6361
+.8byte 0xA
+.8byte 0x746E6F63203A7325
+.8byte 0xA7325203A747865
+.8byte 0x0
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6D20736567617020
+.8byte 0x6F74206465707061
+.8byte 0x7266206F72657A20
+.8byte 0x756C25202C656D61
+.8byte 0x2064656772656D20
+.8byte 0x7320756C25206E69
+.8byte 0x6C25202C736E6163
+.8byte 0x6620656761702075
+.8byte 0x61732073656D6172
+.8byte 0x756C252820646576
+.8byte 0x6B61657020746120
+.8byte 0xA29
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x7320736567617020
+.8byte 0x6920646570706177
+.8byte 0x7320756C25202C6E
+.8byte 0x6F20646570706177
+.8byte 0x20756C25202C7475
+.8byte 0x6574636570736E69
+.8byte 0x6F6C632079622064
+.8byte 0x2E756C25202C6B63
+.8byte 0x20424D756C322E25
+.8byte 0x424D756C2520666F
+.8byte 0x7073207061777320
+.8byte 0x75206E6920656361
+.8byte 0xA6573
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6E612065646F6320
+.8byte 0x7020617461642064
+.8byte 0x6168732073656761
+.8byte 0x6320796220646572
+.8byte 0x2073747865746E6F
+.8byte 0x2064616574736E69
+.8byte 0x6564616F6C20666F
+.8byte 0x6320756C25202C64
+.8byte 0x6E6F20646569706F
+.8byte 0xA657469727720
+.8byte 0x6E696E6E61637320
+.8byte 0x6F6320756C252067
+.8byte 0x73747865746E
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x747865746E6F6320
+.8byte 0x7564656863732073
+.8byte 0x772073252064656C
+.8byte 0x20756C2520687469
+.8byte 0x20747865746E6F63
+.8byte 0x7365686374697773
+.8byte 0x20756C25206E6920
+.8byte 0x696C756465686373
+.8byte 0x736963656420676E
+.8byte 0x736E6F69
+.8byte 0x6C322E252E756C25
+.8byte 0x7070616D20424D75
+.8byte 0x726F6D656D206465
+.8byte 0x252E756C255B2079
+.8byte 0x6F202525756C322E
+.8byte 0x20424D756C252066
+.8byte 0x6C61636973796870
+.8byte 0x5D79726F6D656D20
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x2020202020
+.8byte 0x6365786520756C25
+.8byte 0x736E692064657475
+.8byte 0x6E6F697463757274
+.8byte 0x746F74206E692073
+.8byte 0x2E756C255B206C61
+.8byte 0x202525756C322E25
+.8byte 0xA5D73706F6E
+.8byte 0x6D6D7573203A7325
+.8byte 0x203A797261
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x252079622064656C
+.8byte 0x7274736E6920756C
+.8byte 0x20736E6F69746375
+.8byte 0x6C255B2068636165
+.8byte 0x25756C322E252E75
+.8byte 0x65687265766F2025
+.8byte 0x74636166202C6461
+.8byte 0x252E756C2520726F
+.8byte 0xA5D756C322E
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x7261687320252575
+.8byte 0x6F74636166202C65
+.8byte 0x2E252E756C252072
+.8byte 0xA5D756C32
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x657020666F207372
+.8byte 0x7020656E696C2D72
+.8byte 0x6F20656C69666F72
+.8byte 0x6F7320756C252066
+.8byte 0x6C69662065637275
+.8byte 0x7474697277207365
+.8byte 0x206F746E69206E65
+.8byte 0xA7325
+.8byte 0xA7D5D0A
+.8byte 0x2273656C6966227B
+.8byte 0xA5B3A
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7265702065746165
+.8byte 0x727020656E696C2D
+.8byte 0x756F20656C69666F
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x61206F7420676E69
+.8byte 0x2C657461746F6E6E
+.8byte 0x696220796C6E6F20
+.8byte 0x632073656972616E
+.8byte 0x2064656C69706D6F
+.8byte 0x2073696874206E69
+.8byte 0x206E6163206E7572
+.8byte 0x746F6E6E61206562
+.8byte 0xA64657461
+.8byte 0xA2C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x6C2520666F207372
+.8byte 0x61746F6E6E612075
+.8byte 0x656E696C20646574
+.8byte 0x20732520666F2073
+.8byte 0x206E657474697277
+.8byte 0xA7325206F746E69
+.8byte 0x0
+.8byte 0x3A736E6D756C6F43
+.8byte 0x6F69747563657865
+.8byte 0x7364616F6C3A736E
+.8byte 0x3A7365726F74733A
+.8byte 0x657373696D20314C
+.8byte 0x733A656E696C3A73
+.8byte 0x656372756F
+.8byte 0x3A656372756F53
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E6E612065746165
+.8byte 0x732064657461746F
+.8byte 0x696620656372756F
+.8byte 0xA732520656C
+.8byte 0x766F63672E7325
+.8byte 0x7D5D
+.8byte 0x3A227364616F6C22
+.8byte 0x6F7473222C756C25
+.8byte 0x756C253A22736572
+.8byte 0x73657373696D222C
+.8byte 0x7D756C253A22
+.8byte 0x22656E696C227B0A
+.8byte 0x6E69222C756C253A
+.8byte 0x6F69746375727473
+.8byte 0x2C756C253A22736E
+.8byte 0x6974756365786522
+.8byte 0x756C253A22736E6F
+.8byte 0x2C
+.8byte 0x656372756F73227B
+.8byte 0x222C227325223A22
+.8byte 0x657461746F6E6E61
+.8byte 0x2C227325223A2264
+.8byte 0x3A2273656E696C22
+.8byte 0x5B
+.8byte 0x2020202020202020
+.8byte 0x2020202020203A2D
+.8byte 0x202020203A2D2020
+.8byte 0x20203A2D20202020
+.8byte 0x3A2D202020202020
+.8byte 0x0
+.8byte 0x2323232320202020
+.8byte 0x3A23
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6F6E6E6120657469
+.8byte 0x6F73206465746174
+.8byte 0x6C69662065637275
+.8byte 0xA73252065
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x616320666F207372
+.8byte 0x6B63617473206C6C
+.8byte 0x656C706D61732073
+.8byte 0x2079726576652064
+.8byte 0x74736E6920756C25
+.8byte 0x736E6F6974637572
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6C61632065746165
+.8byte 0x736B63617473206C
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA756C2520
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x2925
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x637865203A73250A
+.8byte 0x74206E6F69747065
+.8byte 0x6465726567676972
+.8byte 0x74736E6920796220
+.8byte 0x206E6F6974637572
+.8byte 0x72616E6962206E69
+.8byte 0x2079
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x78652073776F7268
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x20
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x207469622D756C25
+.8byte 0x6920552D43534952
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x2065747962342E
+.8byte 0x2065747962382E
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x676F6C20676E6972
+.8byte 0x20736920676E6967
+.8byte 0x726F707075736E75
+.8byte 0xA646574
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x5D586C2578305B
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x6C2578305B6D656D
+.8byte 0x646C253D3D5D58
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x58
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x736920586C257830
+.8byte 0x64696C61766E6920
+.8byte 0x0
+.8byte 0x736920586C257830
+.8byte 0x6765732D6C6C6920
+.8byte 0x28206465746E656D
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x29746C
+.8byte 0x736920586C257830
+.8byte 0x657070616D6E7520
+.8byte 0x2065676170282064
+.8byte 0x29746C756166
+.8byte 0x6C2578305B6D656D
+.8byte 0x20646C253D3D5D58
+.8byte 0x202D7C
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x202D7C2058
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x6E617274203A7325
+.8byte 0x3A676E6974616C73
+.8byte 0x3A7264646176200A
+.8byte 0x586C383025783020
+.8byte 0x203A65676170200A
+.8byte 0xA586C3430257830
+.8byte 0x203A656D61726620
+.8byte 0xA586C3830257830
+.8byte 0x203A726464617020
+.8byte 0xA586C3830257830
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x612079726F6D656D
+.8byte 0x2073657373656363
+.8byte 0x7220756C25206E69
+.8byte 0x6361727420736E75
+.8byte 0x206F746E69206465
+.8byte 0x6574796220756C25
+.8byte 0xA732520666F2073
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6F6D656D20657469
+.8byte 0x7365636361207972
+.8byte 0x2065636172742073
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6D656D2065746165
+.8byte 0x656363612079726F
+.8byte 0x6563617274207373
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x66657270203A7325
+.8byte 0x203A736568637465
+.8byte 0x6566657270202020
+.8byte 0x73752C6465686374
+.8byte 0xA6C756665
+.8byte 0x68636163203A7325
+.8byte 0x7365746972772065
+.8byte 0x657469727720203A
+.8byte 0x6867756F7268742D
+.8byte 0x2D65746972772C73
+.8byte 0xA736B636162
+.8byte 0x696C6F70203A7325
+.8byte 0x2020203A73656963
+.8byte 0x6572207325202020
+.8byte 0x6E656D6563616C70
+.8byte 0x6574697277202C74
+.8byte 0x657270202C73252D
+.8byte 0x7325206863746566
+.8byte 0xA
+.8byte 0x657261687320334C
+.8byte 0x20202020203A64
+.8byte 0x6966696E7520324C
+.8byte 0x202020203A6465
+.8byte 0x202C324C203A7325
+.8byte 0x656863616320334C
+.8byte 0x7365636361203A73
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x6E72656B203A7325
+.8byte 0x6C61766E69206C65
+.8byte 0x736E6F6974616469
+.8byte 0xA756C25203A
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x6465726168732820
+.8byte 0x25203A7374696820
+.8byte 0x29756C
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x6C257325203A7325
+.8byte 0x6C2528756C252C75
+.8byte 0x25756C322E252E75
+.8byte 0xA2925
+.8byte 0x6C257325203A7325
+.8byte 0xA756C252C75
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x6E6B6E75203A7325
+.8byte 0x696C6F70206E776F
+.8byte 0xA7325207963
+.8byte 0x656469727473
+.8byte 0x7478656E
+.8byte 0x656E6F6E
+.8byte 0x6B636162
+.8byte 0x6867756F726874
+.8byte 0x6D6F646E6172
+.8byte 0x6F666966
+.8byte 0x75726C70
+.8byte 0x75726C
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x726620676E696863
+.8byte 0x65746E6F63206D6F
+.8byte 0x6F74207325207478
+.8byte 0x747865746E6F6320
+.8byte 0x732520
+.8byte 0x6C257325203A7325
+.8byte 0x6C255B756C252C75
+.8byte 0x5D756C322E252E75
+.8byte 0xA
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C616D
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x69727473203A7325
+.8byte 0x6F7420736920676E
+.8byte 0x6120676E6F6C206F
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0xA64696C61766E
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x7520736920586C38
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x6420646E61206461
+.8byte 0x69622065646F6365
+.8byte 0x6F7266207972616E
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x20756C2520646E61
+.8byte 0x666F207365747962
+.8byte 0x6F6C206174616420
+.8byte 0x6F72662064656461
+.8byte 0xA7325206D
+.8byte 0x6574796220756C25
+.8byte 0x756C2520666F2073
+.8byte 0x534952207469622D
+.8byte 0x65646F6320562D43
+.8byte 0x20
+.8byte 0x2D756C2520756C25
+.8byte 0x4353495220746962
+.8byte 0x7274736E6920552D
+.8byte 0x20736E6F69746375
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x206874
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x2520756C25206874
+.8byte 0x52207469622D756C
+.8byte 0x6E6920552D435349
+.8byte 0x6F69746375727473
+.8byte 0x2520646E6120736E
+.8byte 0x736574796220756C
+.8byte 0x6174616420666F20
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x5D252573706F6E5B
+.8byte 0x0
+.8byte 0x666F7270203A7325
+.8byte 0x736E69203A656C69
+.8byte 0x6E6F697463757274
+.8byte 0x286C61746F74203A
+.8byte 0x2925256F69746172
+.8byte 0x0
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x6E6964616572203A
+.8byte 0x706172776E752067
+.8byte 0x756C617620646570
+.8byte 0x72206D6F72662065
+.8byte 0x2072657473696765
+.8byte 0x0
+.8byte 0x71696E75203A7325
+.8byte 0x6920676962206575
+.8byte 0x3A7372656765746E
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x71696E75203A7325
+.8byte 0x6E69727473206575
+.8byte 0x61726574696C2067
+.8byte 0x28756C25203A736C
+.8byte 0xA29756C25
+.8byte 0x626F6C67203A7325
+.8byte 0x6169726176206C61
+.8byte 0x2020203A73656C62
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x666F7270203A7325
+.8byte 0x746164203A656C69
+.8byte 0x6C61746F74203A61
+.8byte 0xA29736574796228
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x6E6120736E6F6974
+.8byte 0x796220756C252064
+.8byte 0x6420666F20736574
+.8byte 0xA617461
+.8byte 0x76767676203A7325
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0xA76767676
+.8byte 0x20756C25203A7325
+.8byte 0x74206C6F626D7973
+.8byte 0x6F6F6C20656C6261
+.8byte 0x206E69207370756B
+.8byte 0x7265746920756C25
+.8byte 0x6F20736E6F697461
+.8byte 0x676172657661206E
+.8byte 0xA65
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x20732520796C6E6F
+.8byte 0x65746172656E6567
+.8byte 0xA64
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x656D6E6769737361
+.8byte 0x756C25202C73746E
+.8byte 0x202C656C69687720
+.8byte 0x202C666920756C25
+.8byte 0x6C6C616320756C25
+.8byte 0x7220756C25202C73
+.8byte 0xA6E72757465
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x622D756C25206F74
+.8byte 0x2D43534952207469
+.8byte 0x2520687469772055
+.8byte 0x73207469622D756C
+.8byte 0xA63726174
+.8byte 0x2B2B2B2B203A7325
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0xA2B2B2B2B
+.8byte 0x736E69746C697562
+.8byte 0x0
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x61762D6E6F6E206E
+.8byte 0x7020636964616972
+.8byte 0x6572756465636F72
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x2D6E6F6E206E6920
+.8byte 0x6369646169726176
+.8byte 0x756465636F727020
+.8byte 0x6572
+.8byte 0x6E65726566666964
+.8byte 0x7265626D756E2074
+.8byte 0x7574636120666F20
+.8byte 0x6620646E61206C61
+.8byte 0x6170206C616D726F
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6361207265776566
+.8byte 0x616874206C617574
+.8byte 0x6C616D726F66206E
+.8byte 0x74656D6172617020
+.8byte 0x737265
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x796E616D206F6F74
+.8byte 0x206C616D726F6620
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x796E616D206F6F74
+.8byte 0x76206C61636F6C20
+.8byte 0x73656C6261697261
+.8byte 0x0
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x636F6C6C617A
+.8byte 0x66746E69727064
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270645F
+.8byte 0x0
+.8byte 0x66746E69727073
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270735F
+.8byte 0x0
+.8byte 0x66746E697270
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E6972705F
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x656D616E5F6F6E
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x6365707865207325
+.8byte 0x2074756220646574
+.8byte 0x646E756F66207325
+.8byte 0xA
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x6220746567726174
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x617420666F207475
+.8byte 0x756F622074656772
+.8byte 0x646E
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x646E756F62
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x22732522
+.8byte 0x27632527
+.8byte 0x6761697272616327
+.8byte 0x6E72757465722065
+.8byte 0x27
+.8byte 0x656620656E696C27
+.8byte 0x276465
+.8byte 0x74616C7562617427
+.8byte 0x27726F
+.8byte 0x20666F20646E6527
+.8byte 0x27656C6966
+.8byte 0xA
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x7325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x6C255E32203A7325
+.8byte 0x6C667265766F2075
+.8byte 0xA776F
+.8byte 0x0
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x797469726F697270
+.8byte 0x0
+.8byte 0x7272
+.8byte 0x72657478696D
+.8byte 0x72657473626F6D
+.8byte 0x726574736E696D
+.8byte 0x72657473707968
+.8byte 0x7265747370696D
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x4
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x10000
+.8byte 0x6F646572
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x70616E73
+.8byte 0xB
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x8
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x2B
+.8byte 0x2072656765746E69
+.8byte 0x776F6C667265766F
+.8byte 0x0
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x186A0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x4
+.8byte 0x7
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x100
+.8byte 0x2
+.8byte 0x0
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x1000
+.8byte 0xFFFFFFFF
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x10000
+.8byte 0x10
+.8byte 0x63617274
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x40
+.8byte 0x40
+.8byte 0x10
+.8byte 0x8
+.8byte 0x200000
+.8byte 0x40000
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x191
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x6
+.8byte 0x5
+.8byte 0x1
+.8byte 0x0
+.8byte 0x10000
+.8byte 0x10000
+.8byte 0x80000
+.8byte 0x100000
+.8byte 0x1
+.8byte 0x2
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x0
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x7
+.8byte 0x20
+.8byte 0x706D75625F
+.8byte 0x6E69616D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x666F657A6973
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x0
+.8byte 0x21
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x8
+.8byte 0x8
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x40
+.8byte 0x1
+.8byte 0x1
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
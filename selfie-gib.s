@@ -0,0 +1,45667 @@
+lui t0,0x3E
+addi t0,t0,1896
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+ld t0,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,sp,16
+sd t0,8(sp)
+jal ra,43835
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,0(sp)
+addi sp,sp,8
+addi a7,zero,93
+ecall
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+ld a3,0(sp)
+addi sp,sp,8
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-16(gp)
+beq t0,zero,2
+jal zero,121
+addi t0,zero,-344
+add t0,gp,t0
+sd t0,-16(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-48(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-56(gp)
+ld t0,-48(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8298
+addi t0,a0,0
+sd t0,-64(gp)
+ld t0,-64(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-64(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-64(gp)
+ld t2,-8(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sd t0,-72(gp)
+ld t0,-48(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5300
+addi t0,a0,0
+sd t0,-88(gp)
+ld t0,-88(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-80(gp)
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8233
+addi t0,a0,0
+sd t0,-160(gp)
+ld t0,-160(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-48(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6046
+addi t0,a0,0
+sd t0,-168(gp)
+addi t0,zero,80
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6040
+addi t0,a0,0
+sd t0,-176(gp)
+ld t0,-184(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6034
+addi t0,a0,0
+sd t0,-192(gp)
+addi t0,zero,255
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6028
+addi t0,a0,0
+sd t0,-200(gp)
+addi t0,zero,8
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8200
+addi t0,a0,0
+sd t0,-208(gp)
+ld t0,-208(gp)
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-280(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-832(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8164
+addi t0,a0,0
+sd t0,-840(gp)
+ld t0,-840(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1128
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1136
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1144
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1152
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1160
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1168
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1176
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1184
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1192
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1200
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1208
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1216
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1224
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1232
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1240
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1248
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1256
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1264
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1280
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-840(gp)
+ld t1,-832(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1288
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-352(gp)
+sd t0,-872(gp)
+ld t0,-560(gp)
+sd t0,-968(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-880(gp)
+addi t0,zero,1
+sd t0,-888(gp)
+jal ra,8213
+addi t0,zero,0
+sd t0,-896(gp)
+addi t0,zero,0
+sd t0,-904(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+addi t0,zero,0
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7843
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1384(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7723
+addi t0,a0,0
+sd t0,-1392(gp)
+addi t0,zero,0
+sd t0,-1400(gp)
+addi t0,zero,0
+sd t0,-1408(gp)
+addi t0,zero,0
+sd t0,-1416(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-1456(gp)
+addi t0,zero,0
+sd t0,-1464(gp)
+addi t0,zero,0
+sd t0,-1472(gp)
+addi t0,zero,0
+sd t0,-1480(gp)
+addi t0,zero,0
+sd t0,-1488(gp)
+addi t0,zero,0
+sd t0,-1496(gp)
+addi t0,zero,0
+sd t0,-1504(gp)
+addi t0,zero,0
+sd t0,-1512(gp)
+addi t0,zero,0
+sd t0,-920(gp)
+jal ra,8389
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,zero,-1520
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-1544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5320
+addi t0,a0,0
+sd t0,-1528(gp)
+addi t0,zero,-1552
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5313
+addi t0,a0,0
+sd t0,-1536(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1560(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7419
+addi t0,a0,0
+sd t0,-1832(gp)
+ld t0,-1832(gp)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1840
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1848
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1856
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1864
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1872
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1880
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1888
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1896
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1904
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1912
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1920
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1928
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1944
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1968
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1832(gp)
+ld t1,-1824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2008
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1152(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1224(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7012
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,1
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6924
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+addi t2,zero,8
+ld t3,-144(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,888(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sd t1,872(t0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,16(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,928(t2)
+mul t1,t1,t2
+sd t1,856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,848(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,896(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,848(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,704
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,696
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,688
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,680
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6450
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,672
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,664
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,656
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,648
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,640
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,632
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,624
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,616
+add t1,gp,t1
+sd t1,0(t0)
+jal ra,-192
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,608
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,600
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,592
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,584
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6447
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,560(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6431
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,552(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6015
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,520(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,8
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-8
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-32
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-40
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-56
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-80
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-96
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-120
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-144
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,448(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-168
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sd t1,304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,184(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5925
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5901
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,152(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5881
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5861
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,136(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1560(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5837
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,128(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1560(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5823
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,120(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,112(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,104(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,96(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,88(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,80(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,72(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,40(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,32(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,24(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-1565
+jal ra,-289
+jal ra,-228
+jal ra,-131
+jal ra,-43
+jal ra,22464
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,5520
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,33245
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-392(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,34243
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-424(t0)
+jal zero,-25
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-672(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3488
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-680(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-640(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-712
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-720
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-728
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-736
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-672(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-744
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,38147
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-776(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,8
+addi t1,zero,8
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5011
+ld t0,-48(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-48(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-24(gp)
+addi t0,zero,0
+sd t0,-32(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5033
+jal ra,19840
+addi t0,a0,0
+beq t0,zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10893
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,649
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-808(t1)
+sd t1,-824(t0)
+jal zero,47
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-208(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-5063
+ld t0,-208(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-792(t1)
+sd t1,-824(t0)
+jal zero,23
+ld t0,-208(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1584(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-800(t1)
+sd t1,-824(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-808(t1)
+sd t1,-824(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-784(t1)
+sd t1,-824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-240(gp)
+sd t0,-256(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-248(gp)
+sd t0,-256(gp)
+jal zero,3
+ld t0,-232(gp)
+sd t0,-256(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,45
+ld t0,-24(gp)
+beq t0,zero,36
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,20
+sd t0,-856(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sd t1,1576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1496(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,56
+sd t1,1464(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5196
+jal zero,60
+ld t0,-24(gp)
+beq t0,zero,24
+ld t0,-96(gp)
+sd t0,-112(gp)
+ld t0,-96(gp)
+sd t0,-120(gp)
+ld t0,-104(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,217
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-128(gp)
+ld t0,-104(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,207
+addi t0,a0,0
+sd t0,-136(gp)
+ld t0,-96(gp)
+sd t0,-144(gp)
+jal zero,11
+addi t0,zero,8
+sd t0,-112(gp)
+addi t0,zero,8
+sd t0,-120(gp)
+ld t0,-72(gp)
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+addi t0,zero,8
+sd t0,-144(gp)
+ld t0,-144(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-152(gp)
+addi t0,zero,10
+sd t0,-856(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sd t1,1576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1496(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,32
+sd t1,1464(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-680
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,32124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-776(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+sd t1,-208(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-56
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-81
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-64(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,21
+lui t0,0xFFFFF
+addi t0,t0,-848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,2757
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5459
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,2
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-145
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-169
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-203
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-58
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,39
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-88(gp)
+add t0,t0,t1
+ld t1,24(s0)
+ld t2,-88(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,135
+ld t0,16(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,24(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,127
+jal zero,35
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-51
+addi t0,a0,0
+beq t0,zero,21
+ld t0,24(s0)
+addi t1,zero,1
+sub t1,zero,t1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,-88(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,99
+jal zero,7
+ld t0,-88(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,92
+jal zero,84
+ld t0,24(s0)
+ld t1,-88(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,82
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-96
+addi t0,a0,0
+beq t0,zero,38
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-166
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,48
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-177
+addi t0,a0,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,37
+jal zero,29
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-141
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-199
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,14
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-584(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5868
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-464
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-482
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-517
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+ld t0,24(s0)
+ld t1,-48(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-537
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-384
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-420
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-67
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-519
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-539
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2348
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-291
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-257
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-22
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-270
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-343
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-356
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-322
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-330
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-42
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-410
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,34
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-430
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-439
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-64
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-478
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-498
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,116
+ld t0,-24(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1681
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6535
+ld t0,-16(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,63
+ld t0,-16(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,-24(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1626
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6590
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1606
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6610
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-620
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-119
+ld t0,-32(s0)
+beq t0,zero,32
+ld t0,-16(s0)
+ld t1,-88(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,26
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-944
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1561
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6655
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-653
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,22
+ld t0,40(s0)
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1002
+addi t0,a0,0
+beq t0,zero,12
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-702
+jal zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-715
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-46
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-16(s0)
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,45
+sd t0,16(sp)
+jal ra,-740
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-756
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+jal zero,18
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-774
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-787
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-510
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1356
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1371
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,29
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi t1,zero,4
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1415
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-85
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,47
+jal zero,45
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,zero,4
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1444
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1469
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1497
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1521
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-203
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-66
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-231
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-70
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-241
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-784(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,1040
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-7168
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-1261
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-304(gp)
+beq t0,zero,14
+ld t0,-304(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-312(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-1176
+ld t0,-312(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-312(gp)
+jal zero,52
+ld t0,-160(gp)
+beq t0,zero,44
+ld t0,-160(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-89
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,-296(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1008
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-288(gp)
+sd t0,16(sp)
+jal ra,954
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7262
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7269
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17
+jal zero,29
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1312
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-25
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,871
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1040
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,849
+jal zero,49
+ld t0,16(s0)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1056
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,836
+jal zero,36
+ld t0,16(s0)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,823
+jal zero,23
+ld t0,16(s0)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,810
+jal zero,10
+lui t0,0xFFFFF
+addi t0,t0,-1104
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,801
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,782
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-783
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-179
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-809
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-205
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1967
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-308
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(s0)
+jal zero,-12
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-857
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-253
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-884
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+ld t0,-360(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-366
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(s0)
+jal zero,-12
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-925
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-321
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1120
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,597
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-973
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-369
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1128
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,549
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-1021
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-417
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1136
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,501
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1731
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-466
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,303
+jal zero,298
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1753
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-564
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,281
+jal zero,276
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1775
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1789
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-365
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,245
+jal zero,76
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1813
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-363
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,221
+jal zero,52
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-273
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,195
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1863
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-251
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,169
+jal zero,164
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1887
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-227
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,145
+jal zero,140
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1911
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1925
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1762
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1955
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-483
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,75
+jal zero,70
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1981
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1995
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1832
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2011
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-463
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+ld t0,24(s0)
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,-304(gp)
+jal zero,3
+ld t0,-200(gp)
+sd t0,-304(gp)
+addi t0,zero,0
+sd t0,-312(gp)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2095
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2111
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2122
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+ld a0,0(t0)
+addi t0,t0,8
+sd t0,40(s0)
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,9
+addi t0,zero,37
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-947
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,15
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2157
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-962
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-87
+ld t0,-304(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-312(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2137
+ld t0,-312(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-312(gp)
+ld t0,24(s0)
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-304(gp)
+jal zero,16
+ld t0,-304(gp)
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-304(gp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-1053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,24
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,1
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-174
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-207
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-240
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-296(gp)
+ld t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-176(gp)
+sd t0,8(sp)
+jal ra,-117
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-176(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-8326
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3629
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8369
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,-160(gp)
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-225
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-568(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8441
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+sd t1,-208(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-87
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-208(t0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-147
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-187
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-65
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3808
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8549
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1184
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1192
+jal zero,10
+ld t0,-840(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1202
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1216
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-976(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-434
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-39
+lui t0,0xFFFFF
+addi t0,t0,-1240
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-461
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-70
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1353
+lui t0,0xFFFFF
+addi t0,t0,-1256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-494
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1363
+lui t0,0xFFFFF
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-504
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-984(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-8732
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-160(gp)
+ld t0,0(t0)
+sd t0,-872(gp)
+ld t0,-880(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-880(gp)
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-352(gp)
+sd t0,-872(gp)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1320
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-976(gp)
+sd t0,16(sp)
+jal ra,-564
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8780
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,-872(gp)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-59
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,156
+ld t0,-8(s0)
+beq t0,zero,23
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,16
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,140
+jal zero,6
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-167
+jal zero,131
+ld t0,-16(s0)
+beq t0,zero,58
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-181
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,-19
+ld t0,-16(s0)
+beq t0,zero,30
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal zero,19
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1352
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-288
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8944
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-226
+jal zero,72
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,17
+ld t0,-872(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-245
+jal zero,53
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-253
+ld t0,-872(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-896(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-896(gp)
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+jal ra,-270
+jal zero,24
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-896(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-896(gp)
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+jal ra,-288
+jal zero,6
+ld t0,-728(gp)
+sd t0,-968(gp)
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+ld t0,-872(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-156
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2923
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2879
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-302
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-928(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-840(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-2747
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,106
+jal zero,104
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal zero,96
+jal zero,94
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal zero,86
+jal zero,84
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-632(gp)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-640(gp)
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-648(gp)
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-808(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-816(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-832(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-560(gp)
+sd t0,-968(gp)
+addi t0,zero,0
+sd t0,-928(gp)
+addi t0,zero,0
+sd t0,-936(gp)
+addi t0,zero,0
+sd t0,-952(gp)
+addi t0,zero,0
+sd t0,-944(gp)
+jal ra,-424
+addi t0,a0,0
+ld t1,-352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,601
+ld t0,-968(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,592
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3179
+addi t0,a0,0
+beq t0,zero,56
+ld t0,-848(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3097
+addi t0,a0,0
+sd t0,-928(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-275
+addi t0,a0,0
+beq t0,zero,33
+ld t0,-8(s0)
+ld t1,-848(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1376
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9325
+ld t0,-928(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3296
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-615
+jal zero,-34
+ld t0,-928(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3310
+jal ra,-208
+addi t0,a0,0
+sd t0,-968(gp)
+jal zero,531
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3186
+addi t0,a0,0
+beq t0,zero,133
+ld t0,-872(gp)
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-641
+addi t0,zero,0
+sd t0,-952(gp)
+jal zero,120
+ld t0,-856(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3168
+addi t0,a0,0
+sd t0,-936(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3210
+addi t0,a0,0
+beq t0,zero,42
+ld t0,-8(s0)
+ld t1,-856(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,-960(gp)
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1440
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-752
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9408
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3379
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-698
+jal zero,-46
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3393
+ld t0,-936(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2971
+addi t0,a0,0
+sd t0,-952(gp)
+ld t0,-960(gp)
+beq t0,zero,18
+ld t0,-952(gp)
+ld t1,-136(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1480
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9454
+jal zero,32
+ld t0,-952(gp)
+ld t1,-128(gp)
+sltu t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-815
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9471
+jal zero,15
+ld t0,-952(gp)
+ld t1,-136(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,9
+ld t0,-952(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+jal ra,-3556
+addi t0,a0,0
+sd t0,-952(gp)
+ld t0,-568(gp)
+sd t0,-968(gp)
+jal zero,393
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-773
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-858
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9514
+jal zero,3
+ld t0,-872(gp)
+sd t0,-952(gp)
+jal ra,-795
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-802
+jal zero,22
+ld t0,-872(gp)
+ld t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-855
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9542
+jal zero,5
+ld t0,-408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-866
+ld t0,-576(gp)
+sd t0,-968(gp)
+jal zero,332
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+jal ra,-834
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3358
+addi t0,a0,0
+sd t0,-944(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-492
+addi t0,a0,0
+beq t0,zero,40
+ld t0,-8(s0)
+ld t1,-864(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1592
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-930
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9586
+ld t0,-872(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,299
+ld t0,-944(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+jal ra,-3564
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-883
+jal zero,-41
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-891
+jal zero,11
+ld t0,-416(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-938
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9625
+ld t0,-944(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3596
+ld t0,-584(gp)
+sd t0,-968(gp)
+jal zero,246
+ld t0,-872(gp)
+ld t1,-424(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-920
+ld t0,-656(gp)
+sd t0,-968(gp)
+jal zero,236
+ld t0,-872(gp)
+ld t1,-432(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-930
+ld t0,-664(gp)
+sd t0,-968(gp)
+jal zero,226
+ld t0,-872(gp)
+ld t1,-440(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-940
+ld t0,-672(gp)
+sd t0,-968(gp)
+jal zero,216
+ld t0,-872(gp)
+ld t1,-448(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-950
+ld t0,-680(gp)
+sd t0,-968(gp)
+jal zero,206
+ld t0,-872(gp)
+ld t1,-456(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-960
+ld t0,-688(gp)
+sd t0,-968(gp)
+jal zero,196
+ld t0,-872(gp)
+ld t1,-464(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-970
+ld t0,-696(gp)
+sd t0,-968(gp)
+jal zero,186
+ld t0,-872(gp)
+ld t1,-472(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-980
+ld t0,-704(gp)
+sd t0,-968(gp)
+jal zero,176
+ld t0,-872(gp)
+ld t1,-480(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-990
+ld t0,-712(gp)
+sd t0,-968(gp)
+jal zero,166
+ld t0,-872(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1000
+ld t0,-720(gp)
+sd t0,-968(gp)
+jal zero,156
+ld t0,-872(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1010
+ld t0,-736(gp)
+sd t0,-968(gp)
+jal zero,146
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1020
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1027
+ld t0,-752(gp)
+sd t0,-968(gp)
+jal zero,3
+ld t0,-744(gp)
+sd t0,-968(gp)
+jal zero,126
+ld t0,-872(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1040
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1047
+jal zero,5
+ld t0,-512(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1094
+ld t0,-760(gp)
+sd t0,-968(gp)
+jal zero,104
+ld t0,-872(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1062
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1069
+ld t0,-776(gp)
+sd t0,-968(gp)
+jal zero,3
+ld t0,-768(gp)
+sd t0,-968(gp)
+jal zero,84
+ld t0,-872(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1082
+ld t0,-872(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1089
+ld t0,-792(gp)
+sd t0,-968(gp)
+jal zero,3
+ld t0,-784(gp)
+sd t0,-968(gp)
+jal zero,64
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1102
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1109
+ld t0,-872(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1116
+jal zero,5
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1163
+jal zero,5
+ld t0,-552(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1168
+ld t0,-800(gp)
+sd t0,-968(gp)
+jal zero,30
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-1237
+lui t0,0xFFFFF
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1657
+ld t0,-872(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2526
+jal ra,-2543
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9881
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-1178
+ld t0,-872(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-376(gp)
+sd t0,-872(gp)
+jal zero,67
+ld t0,-872(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-368(gp)
+sd t0,-872(gp)
+jal zero,58
+ld t0,-872(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-360(gp)
+sd t0,-872(gp)
+jal zero,49
+ld t0,-872(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-408(gp)
+sd t0,-872(gp)
+jal zero,40
+ld t0,-872(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-416(gp)
+sd t0,-872(gp)
+jal zero,31
+ld t0,-872(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-504(gp)
+sd t0,-872(gp)
+jal zero,22
+ld t0,-872(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-544(gp)
+sd t0,-872(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1320
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9976
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+ld t1,0(t1)
+ld t2,16(s0)
+ld t2,0(t2)
+ld t3,16(s0)
+ld t3,0(t3)
+ld t4,16(s0)
+ld t4,0(t4)
+ld t5,16(s0)
+ld t5,0(t5)
+ld t6,-1384(gp)
+divu t5,t5,t6
+add t4,t4,t5
+ld t5,-1384(gp)
+divu t4,t4,t5
+add t3,t3,t4
+ld t4,-1384(gp)
+divu t3,t3,t4
+add t2,t2,t3
+ld t3,-1384(gp)
+divu t2,t2,t3
+add t1,t1,t2
+ld t2,-1384(gp)
+divu t1,t1,t2
+add t0,t0,t1
+ld t1,-1384(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-9506
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-9329
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-9318
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-9307
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-9296
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,56(s0)
+sd t0,8(sp)
+jal ra,-9285
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,64(s0)
+sd t0,8(sp)
+jal ra,-9274
+ld t0,16(s0)
+ld t1,-1368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1600(gp)
+sd t0,8(sp)
+jal ra,-9269
+ld t0,-1392(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-105
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-9405
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,15
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1640(gp)
+sd t0,8(sp)
+jal ra,-9300
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1400(gp)
+sd t0,8(sp)
+jal ra,-9421
+ld t0,-8(s0)
+sd t0,-1400(gp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1408(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1408(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-1416(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1416(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9553
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9605
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3788
+addi t0,a0,0
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9632
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1392(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-222
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1296(gp)
+sd t0,16(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1296(gp)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9693
+addi t0,a0,0
+ld t1,-1320(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,43
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9648
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9662
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8863
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6876
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1384(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-1392(gp)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,32
+addi t0,zero,1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9810
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1772
+lui t0,0xFFFFF
+addi t0,t0,-1680
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9841
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2198
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9868
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-48
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-64
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1424(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1424(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1804
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10460
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1424(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1608(gp)
+ld t1,-1424(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+ld t0,-1792(gp)
+ld t1,-1424(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1728
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1848
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10504
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+ld t0,-1424(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1632(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-64
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1728
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1892
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10548
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+ld t1,-1568(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-1424(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1800(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-108
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1936
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10592
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-1424(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,-1424(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1760
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1970
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10626
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,162
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-968(gp)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-968(gp)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-968(gp)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-968(gp)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-968(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,53
+jal zero,51
+ld t0,-968(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,43
+jal zero,41
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+ld t0,-968(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,26
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-277
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5688
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-968(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-968(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-968(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-968(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-285
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2551
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2587
+lui t0,0xFFFFF
+addi t0,t0,-1256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2975
+ld t0,-968(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2597
+lui t0,0xFFFFF
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2985
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2593
+lui t0,0xFFFFF
+addi t0,t0,-1784
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3013
+ld t0,-968(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2635
+lui t0,0xFFFFF
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3023
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-968(gp)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1989
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11290
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2685
+lui t0,0xFFFFF
+addi t0,t0,-1800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3107
+addi sp,sp,8
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1232
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2716
+lui t0,0xFFFFF
+addi t0,t0,-1832
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-928(gp)
+sd t0,16(sp)
+jal ra,-3140
+addi sp,sp,16
+ld t0,-920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-920(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1048
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3166
+jal zero,45
+ld t0,16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3179
+jal zero,32
+ld t0,16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1072
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3191
+jal zero,20
+ld t0,16(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1864
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3204
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3211
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-2815
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3235
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-88
+lui t0,0xFFFFF
+addi t0,t0,-1256
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3245
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+lui t0,0xFFFFF
+addi t0,t0,-1264
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3255
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,147
+jal ra,-465
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-280
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11496
+jal zero,2
+jal ra,-2234
+jal zero,-18
+jal ra,-868
+addi t0,a0,0
+beq t0,zero,83
+jal ra,267
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+ld t0,-928(gp)
+sd t0,-16(s0)
+jal ra,-2250
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,54
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,106
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,276
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10762
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10904
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10892
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10974
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,8684
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1248(t0)
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-329
+jal zero,7
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2661
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-421
+jal zero,42
+ld t0,-968(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2327
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2334
+ld t0,-1344(gp)
+sd t0,-8(s0)
+jal zero,3
+ld t0,-1352(gp)
+sd t0,-8(s0)
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-928(gp)
+sd t0,-16(s0)
+jal ra,-2348
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2621
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-461
+jal zero,2
+jal ra,-421
+jal zero,-150
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1296(gp)
+sd t0,8(sp)
+jal ra,-1456
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1168(t0)
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1296(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-1660
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1456(gp)
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-3076
+lui t0,0xFFFFF
+addi t0,t0,-1944
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3498
+addi sp,sp,8
+jal zero,51
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-928(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1296(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1707
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2470
+jal zero,25
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-577
+ld t0,-1376(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1952
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1296(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1733
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1336(gp)
+sd t0,-8(s0)
+jal ra,-1146
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-2517
+jal ra,-1150
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2521
+jal zero,-4
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1344(gp)
+sd t0,-8(s0)
+jal ra,-2531
+jal zero,-9
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-639
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-968(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-2560
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-2567
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,48
+jal zero,12
+ld t0,16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1336(gp)
+sd t0,8(sp)
+jal ra,-421
+ld t0,-968(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-960(gp)
+jal ra,-2592
+jal ra,65
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-960(gp)
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-960(gp)
+ld t0,-8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,10
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-119
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-481
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-1278
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-952(gp)
+sd t0,-8(s0)
+jal ra,-2669
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-734
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-898
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-754
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11970
+jal zero,2
+jal ra,-2708
+jal zero,-18
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,357
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,56
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-928(gp)
+sd t0,-8(s0)
+jal ra,-2733
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,334
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2945
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-773
+jal zero,28
+ld t0,-968(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1636
+jal zero,20
+ld t0,-968(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1768
+jal zero,12
+ld t0,-968(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,3129
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-801
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6457
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-6467
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6658
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6174
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7360
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6688
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,7450
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6209
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7325
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6218
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11508
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6299
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6865
+addi t0,a0,0
+beq t0,zero,25
+jal ra,-1746
+jal ra,-1716
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-138
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1725
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11521
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1735
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7331
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11575
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-1806
+jal ra,-1776
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11572
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7533
+jal zero,11
+jal ra,-1790
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-1794
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7522
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11649
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2039
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1005
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12307
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11685
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-211
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11719
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-1918
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11770
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,56
+ld t0,-720(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1127
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-928(gp)
+sd t0,16(s0)
+jal ra,-3144
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,29
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3158
+jal ra,115
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1187
+jal zero,14
+jal ra,-1227
+jal ra,-1997
+jal ra,-1967
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7056
+ld t0,-1344(gp)
+sd t0,-40(s0)
+jal ra,-1978
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-968(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-3191
+ld t0,-8(s0)
+beq t0,zero,15
+ld t0,-40(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1344(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+jal ra,-1042
+jal zero,3
+ld t0,-1336(gp)
+sd t0,-40(s0)
+jal ra,66
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-40(s0)
+ld t1,-48(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+jal ra,-1059
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7354
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1899
+ld t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1480(gp)
+jal zero,5
+ld t0,-744(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1345
+ld t0,-8(s0)
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1914
+jal zero,18
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11863
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1932
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,236
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1848
+addi t0,a0,0
+beq t0,zero,221
+ld t0,-968(gp)
+sd t0,-16(s0)
+jal ra,-3288
+jal ra,227
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1140
+ld t0,-1336(gp)
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2064
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2071
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6992
+jal ra,-2120
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6903
+jal ra,-2084
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2088
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2136
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7140
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2010
+jal zero,160
+ld t0,-16(s0)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-2106
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2155
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6950
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2032
+jal ra,-2166
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+jal ra,-2172
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7104
+jal zero,128
+ld t0,-16(s0)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2138
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2142
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2190
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7086
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2064
+jal zero,106
+ld t0,-16(s0)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2160
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7064
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2086
+jal zero,84
+ld t0,-16(s0)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2182
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2231
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2189
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7042
+jal ra,-2238
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6785
+jal ra,-2202
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6854
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2128
+jal zero,42
+ld t0,-16(s0)
+ld t1,-792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+jal ra,-2224
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2228
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2276
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7000
+jal ra,-2280
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6743
+jal ra,-2244
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2293
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6812
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2170
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,182
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2016
+addi t0,a0,0
+beq t0,zero,167
+ld t0,-968(gp)
+sd t0,-16(s0)
+jal ra,-3530
+jal ra,173
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+ld t0,-8(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-2350
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2760
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4179
+jal zero,16
+ld t0,-24(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2326
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2739
+ld t0,-1344(gp)
+sd t0,-8(s0)
+jal ra,-2335
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2339
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2387
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6679
+jal zero,96
+ld t0,-16(s0)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,-8(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+ld t0,-24(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-2410
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-112(gp)
+sd t0,8(sp)
+jal ra,2700
+jal ra,-2372
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2376
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2424
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6684
+jal zero,34
+jal ra,-2384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2388
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2436
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6672
+jal ra,-2440
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,-112(gp)
+sd t0,16(sp)
+jal ra,6583
+jal ra,-2404
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2408
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2456
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6736
+ld t0,-1336(gp)
+sd t0,-8(s0)
+jal zero,25
+ld t0,-24(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4290
+jal zero,12
+jal ra,-2431
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2435
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2483
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6625
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2357
+jal zero,-168
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,91
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2170
+addi t0,a0,0
+beq t0,zero,76
+ld t0,-968(gp)
+sd t0,-16(s0)
+jal ra,-3718
+jal ra,82
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1570
+ld t0,-16(s0)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2492
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2496
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2544
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6606
+jal zero,36
+ld t0,-16(s0)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2510
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2514
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2562
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6630
+jal zero,18
+ld t0,-16(s0)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2528
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2532
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2580
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6654
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2454
+jal zero,-77
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-1940
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-1870
+ld t0,-968(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13086
+jal zero,2
+jal ra,-3824
+jal zero,-18
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3834
+jal ra,-2467
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-1360(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1222
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,11
+jal ra,-571
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1873
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,221
+ld t0,-968(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-960(gp)
+jal ra,-3865
+addi t0,zero,0
+sd t0,-960(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-968(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sd t0,-32(s0)
+jal ra,-3879
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-968(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-3889
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1915
+jal ra,-1388
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1922
+jal ra,-2730
+ld t0,-16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,-112(gp)
+sd t0,16(sp)
+jal ra,6317
+jal zero,10
+jal ra,-2716
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,-120(gp)
+sd t0,16(sp)
+jal ra,6307
+ld t0,-1336(gp)
+sd t0,-16(s0)
+jal zero,83
+jal ra,-2272
+addi t0,a0,0
+beq t0,zero,5
+jal ra,419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,76
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-928(gp)
+sd t0,-40(s0)
+jal ra,-3945
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,32
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1731
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-2793
+ld t0,-16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+jal ra,-2768
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1656(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6255
+jal zero,10
+jal ra,-2778
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6245
+jal zero,23
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3996
+jal ra,-723
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2025
+jal zero,8
+jal ra,-2065
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,193
+ld t0,-1336(gp)
+sd t0,-16(s0)
+ld t0,-32(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1344(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1862
+jal ra,-2823
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2827
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6489
+ld t0,-1336(gp)
+sd t0,-16(s0)
+ld t0,-24(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1336(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1887
+ld t0,-1336(gp)
+sd t0,-16(s0)
+jal ra,-2850
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+jal ra,-2856
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6252
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-7480
+addi t0,a0,0
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6132
+jal zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1322
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6115
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-936(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1304(gp)
+sd t0,8(sp)
+jal ra,-3206
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1168(t0)
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-936(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+ld t0,16(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3410
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sub t0,zero,t0
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+jal ra,6796
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1224(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1244
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-7601
+addi t0,a0,0
+beq t0,zero,10
+jal ra,-3044
+jal ra,-3014
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-141
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12847
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+jal ra,-3044
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12840
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3054
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6012
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-944(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1312(gp)
+sd t0,8(sp)
+jal ra,-3347
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-944(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7338
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-5220
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1168(t0)
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-944(gp)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3571
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6684
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+ld t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1472(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2971
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-952(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+jal ra,-1706
+ld t0,-1336(gp)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+ld t0,-968(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-110
+jal ra,-4376
+ld t0,-1344(gp)
+addi a0,t0,0
+jal zero,11
+jal zero,9
+jal ra,-2441
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-183
+ld t0,-1336(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,-968(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,115
+jal ra,-4407
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+jal ra,-4414
+jal ra,-1141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-8(s0)
+jal ra,-3218
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6217
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3097
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+jal ra,-4439
+ld t0,-968(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4446
+jal ra,-2758
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1765
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2449
+jal zero,2
+jal ra,-1772
+ld t0,-968(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-4464
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-16(s0)
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,6209
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6315
+ld t0,-968(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4485
+jal ra,-2797
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1804
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2488
+jal zero,2
+jal ra,-1811
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,6345
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6284
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2616
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2621
+jal zero,5
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2626
+ld t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1496(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-968(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,63
+jal ra,-4553
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-4560
+jal ra,-1287
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-16(s0)
+jal ra,-3364
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6071
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3243
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-4585
+ld t0,-968(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4592
+jal ra,-2904
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1911
+jal zero,-4
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2595
+jal zero,2
+jal ra,-1918
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2710
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2715
+jal zero,5
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2720
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,6055
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6156
+ld t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1488(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,2040
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7541
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,2032
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7675
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,2000
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7561
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7695
+addi t0,a0,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1960
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7581
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7715
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7615
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,60
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1928
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7629
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1904
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7647
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1880
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7661
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1856
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7675
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5411
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+jal ra,5754
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5394
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1640(gp)
+sd t0,16(sp)
+jal ra,5737
+ld t0,-1640(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5378
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+ld t0,16(s0)
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8255
+addi t0,a0,0
+beq t0,zero,11
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5356
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5498
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14154
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1640(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5321
+ld t0,-1640(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5603
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,5305
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5587
+ld t0,-144(gp)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8333
+addi t0,a0,0
+beq t0,zero,12
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,5277
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1792
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5577
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14233
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-1400(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-968(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,104
+jal ra,-4993
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,96
+jal ra,-3631
+addi t0,a0,0
+beq t0,zero,88
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2499
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2641
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-144(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13498
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3309
+addi t0,a0,0
+beq t0,zero,50
+jal ra,-5035
+ld t0,-968(gp)
+ld t1,-800(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5042
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,38
+jal ra,-3678
+addi t0,a0,0
+beq t0,zero,31
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2546
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2688
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-144(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13547
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3184
+jal zero,-54
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3109
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3194
+jal zero,2
+jal ra,-5094
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3201
+ld t0,-8(s0)
+beq t0,zero,4
+ld t0,-16(s0)
+sub t0,zero,t0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1320(gp)
+sd t0,8(sp)
+jal ra,-4187
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-16(s0)
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-4380
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13791
+addi t0,a0,0
+ld t1,-1360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13663
+ld t0,-968(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13813
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13822
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3022
+jal ra,-5185
+jal zero,216
+ld t0,-968(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,209
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4174
+addi t0,a0,0
+beq t0,zero,78
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-13742
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13852
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13861
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3061
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13733
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13839
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13848
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,5641
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,-13728
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+jal ra,-8145
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-976(gp)
+sd t1,1216(t0)
+ld t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1464(gp)
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-557
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9234
+addi t0,a0,0
+beq t0,zero,18
+lui t0,0xFFFFF
+addi t0,t0,-1880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-5934
+lui t0,0xFFFFE
+addi t0,t0,1752
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-6356
+addi sp,sp,8
+jal ra,-5303
+addi t0,zero,0
+sd t0,-32(s0)
+jal ra,-3938
+addi t0,a0,0
+beq t0,zero,20
+ld t0,-32(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-32(s0)
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2810
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,-2953
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3348
+jal zero,-21
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-522
+ld t0,-24(s0)
+sd t0,-1432(gp)
+addi t0,zero,0
+sd t0,-1440(gp)
+ld t0,24(s0)
+sd t0,-1448(gp)
+jal ra,-3649
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2656
+jal zero,-4
+addi t0,zero,0
+sd t0,-1448(gp)
+ld t0,24(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4876
+ld t0,-1440(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,5526
+addi t0,zero,0
+sd t0,-1440(gp)
+ld t0,-8(s0)
+beq t0,zero,11
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sub t0,zero,t0
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-482
+jal zero,9
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-491
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5320
+ld t0,-696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3421
+jal zero,2
+jal ra,-3461
+addi t0,zero,0
+sd t0,-1432(gp)
+addi t0,zero,0
+sd t0,-1400(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1424(gp)
+sd t0,-8(s0)
+ld t0,-1424(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,4801
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4236
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,5143
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4110
+jal zero,-26
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-4295
+jal ra,-4265
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5048
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,4750
+jal zero,-22
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14200
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1736
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8390
+addi t0,a0,0
+beq t0,zero,3
+jal ra,483
+jal zero,24
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1728
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8402
+addi t0,a0,0
+beq t0,zero,3
+jal ra,588
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8414
+addi t0,a0,0
+beq t0,zero,2
+jal ra,681
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14184
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3534
+ld t0,-1360(gp)
+sd t0,-8(s0)
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-888(gp)
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-4826
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5091
+jal zero,89
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14241
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14209
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,-14087
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5060
+jal zero,58
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14234
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4291
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2304
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14257
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,5029
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-14136
+jal zero,15
+ld t0,-1584(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14280
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,5002
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+jal ra,-5698
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1328(gp)
+sd t0,8(sp)
+jal ra,-4775
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+addi t0,a0,0
+addi a0,t0,0
+jal zero,180
+jal ra,-307
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4302
+addi t0,a0,0
+beq t0,zero,67
+jal ra,-2451
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-24(s0)
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4496
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4541
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4838
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4415
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-968(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5759
+jal ra,-2486
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-4566
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4813
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4440
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-27
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sd t0,8(sp)
+jal ra,5138
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,82
+jal ra,-5799
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1320(gp)
+sd t0,8(sp)
+jal ra,-4876
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-264
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14451
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9399
+addi t0,a0,0
+beq t0,zero,32
+ld t0,-40(s0)
+sub t0,zero,t0
+sd t0,-40(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t0,t1
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,4378
+jal zero,11
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6480
+jal zero,12
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6492
+jal zero,7
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3985
+ld t0,-1336(gp)
+sd t0,-48(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-432
+ld t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1504(gp)
+ld t0,-48(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3935
+ld t0,-968(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-2645
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1448(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1448(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-3770
+ld t0,-1448(gp)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4739
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4287
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4615
+jal zero,20
+ld t0,-1448(gp)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-1448(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1352(gp)
+sd t0,8(sp)
+jal ra,-3800
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4263
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1440(gp)
+sd t0,8(sp)
+jal ra,4707
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+sub t0,t0,t1
+sd t0,-1440(gp)
+ld t0,-1512(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1512(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-1432(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14631
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9577
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9967
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6638
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5070
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+jal ra,-6042
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-6049
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1432(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14683
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-144(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1865
+jal ra,-4866
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1640(gp)
+sd t0,8(sp)
+jal ra,-4872
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4194
+ld t0,-1640(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14690
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-4885
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4494
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4759
+jal zero,6
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4067
+jal ra,-6100
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4207
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5167
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+jal ra,-6139
+ld t0,-968(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-6146
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14756
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4982
+jal ra,-4952
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1640(gp)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,4361
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4964
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4352
+jal ra,-4970
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4974
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,4052
+ld t0,-1640(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-4985
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4394
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4859
+jal zero,5
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4301
+jal zero,6
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4172
+jal ra,-6205
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4312
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1432(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14850
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9796
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10186
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,1528
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6857
+ld t0,-968(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-6250
+ld t0,-680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4276
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4361
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5099
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,3953
+jal ra,-5079
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3944
+jal ra,-5088
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5094
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4140
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5103
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4005
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4977
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5032
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3902
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5046
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4015
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,21
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,3820
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-9
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+ld t1,-144(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,3787
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-7324
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1192(t0)
+jal ra,-5344
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3793
+jal zero,189
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10288
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10299
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2269
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7092
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15748
+ld t0,-1600(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-5286
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3740
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5162
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3728
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,16(sp)
+jal ra,3718
+jal ra,4237
+ld t0,-1656(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-257
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,16(sp)
+jal ra,3701
+jal ra,4220
+ld t0,-1536(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1296(gp)
+sd t0,8(sp)
+jal ra,-5610
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15132
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15158
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1656(gp)
+sd t0,16(sp)
+jal ra,4027
+jal ra,-5387
+jal ra,-5357
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3956
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3657
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-5380
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3999
+jal ra,-5384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,2
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3637
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-5400
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3979
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5274
+ld t0,-1528(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1320(gp)
+sd t0,8(sp)
+jal ra,-5686
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15251
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1078
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3595
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1656(gp)
+sd t0,16(sp)
+jal ra,3938
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1192(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,536(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1192(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-224(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-15925
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-10027
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,1480
+add t0,gp,t0
+sd t0,-976(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-976(gp)
+sd t1,1216(t0)
+jal ra,-14754
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7434
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7448
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7468
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+ld t1,-144(gp)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7486
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1152(t0)
+jal ra,-15224
+jal ra,-14780
+jal ra,-444
+jal ra,6789
+jal ra,6906
+jal ra,7540
+jal ra,7944
+jal ra,8311
+jal ra,8859
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+beq t0,zero,8
+jal ra,20434
+jal ra,20483
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-24(s0)
+jal ra,20528
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9823
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6069
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1728
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9845
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6091
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9867
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1328(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6113
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6129
+ld t0,-8(s0)
+beq t0,zero,235
+jal ra,26914
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,224
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,26933
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10175
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,205
+jal ra,26947
+addi t0,a0,0
+sd t0,-976(gp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-7996
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,1328
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-976(gp)
+sd t0,16(sp)
+ld t0,-152(gp)
+sd t0,24(sp)
+ld t0,-48(gp)
+sd t0,32(sp)
+jal ra,-8013
+addi sp,sp,32
+ld t0,-976(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-292
+addi t0,a0,0
+sd t0,-984(gp)
+ld t0,-984(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10536
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-976(gp)
+sd t0,16(sp)
+jal ra,-8040
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16256
+jal ra,-15756
+jal ra,-15406
+jal ra,-4789
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-8060
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-888(gp)
+sd t0,24(sp)
+ld t0,-904(gp)
+sd t0,32(sp)
+jal ra,-8077
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld t0,-880(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9222
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-880(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+ld t1,-896(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9204
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-912(gp)
+sd t0,40(sp)
+jal ra,-8114
+addi sp,sp,40
+lui t0,0xFFFFE
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-1456(gp)
+sd t0,16(sp)
+ld t0,-1464(gp)
+sd t0,24(sp)
+ld t0,-1472(gp)
+sd t0,32(sp)
+jal ra,-8131
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,952
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-1480(gp)
+sd t0,16(sp)
+ld t0,-1488(gp)
+sd t0,24(sp)
+ld t0,-1496(gp)
+sd t0,32(sp)
+ld t0,-1504(gp)
+sd t0,40(sp)
+ld t0,-1512(gp)
+sd t0,48(sp)
+jal ra,-8152
+addi sp,sp,48
+ld t0,-920(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,880
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+ld t0,-976(gp)
+sd t0,24(sp)
+jal ra,-8172
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-560(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16388
+jal zero,-235
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-976(gp)
+sd t0,16(sp)
+jal ra,-8198
+addi sp,sp,16
+jal ra,3961
+jal ra,-776
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+beq t0,zero,5
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,20226
+ld t0,-1408(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-8223
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-1408(gp)
+sd t0,16(sp)
+ld t0,-1416(gp)
+ld t1,-1408(gp)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-8240
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,680
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-8251
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,32(sp)
+jal ra,-8282
+addi sp,sp,32
+jal ra,2085
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-8294
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,568
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-8305
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,528
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8326
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,488
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+sd t0,24(sp)
+jal ra,-8345
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,448
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+ld t1,-144(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8366
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1832(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8409
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+ld t1,-1640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,16(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1656(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,16(s0)
+ld t1,-1712(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1616(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,16(s0)
+ld t1,-1632(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+ld t0,16(s0)
+ld t1,-1800(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-72(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,128(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,24(s0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-128(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+jal ra,14547
+lui t0,0xFFFFE
+addi t0,t0,400
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8625
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-236
+jal ra,-9511
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,15592
+jal zero,21
+jal ra,14526
+lui t0,0xFFFFE
+addi t0,t0,360
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8646
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-257
+jal ra,-9532
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,456(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,15571
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-114
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+jal ra,-10940
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-72(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,120(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(gp)
+ld t1,-152(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+sd t0,8(sp)
+jal ra,-80
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11111
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11677
+addi t0,a0,0
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,344
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-888(gp)
+sd t0,8(sp)
+jal ra,-8377
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11589
+addi t0,a0,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11598
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(sp)
+jal ra,-8818
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17034
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11492
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11500
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11508
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11516
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11524
+addi t0,a0,0
+ld t1,56(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11500
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11522
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,15
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11544
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,3
+sd t0,16(sp)
+jal ra,-11566
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11588
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11610
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-146
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-138
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-130
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-344
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11348
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11776
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11784
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11792
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11800
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-11776
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11460
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-282
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-274
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-507
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11511
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11893
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11903
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11959
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11967
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11975
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11983
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11991
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11969
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11979
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12035
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11673
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-514
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-506
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-498
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-721
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-11725
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12107
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12117
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12127
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12137
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12193
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12201
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12209
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12217
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12225
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12233
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12241
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12219
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12229
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12239
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12249
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12305
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12313
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12321
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12329
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-11965
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-806
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-790
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-156
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-1013
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12017
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12399
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12409
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12419
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12429
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12485
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12493
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12501
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12509
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12517
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12495
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12505
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12515
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12525
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12581
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12589
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12597
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12605
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12241
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1028
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-136
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-1268
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12272
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12700
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12708
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-12684
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12368
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1576(gp)
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1154
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,240(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,232(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,224(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,216(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,208(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,200(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,184(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,280
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12849
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-150
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11430
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11411
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-10319
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,264
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11474
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11454
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-10362
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10383
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,216
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10394
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,200
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10405
+jal ra,-11287
+lui t0,0xFFFFE
+addi t0,t0,184
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10416
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,840(t0)
+sd t0,16(sp)
+jal ra,-105
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10437
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,832(t0)
+sd t0,16(sp)
+jal ra,-125
+jal ra,-11333
+lui t0,0xFFFFE
+addi t0,t0,160
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10462
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,216(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,776(t0)
+sd t0,16(sp)
+jal ra,-151
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10483
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,208(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+sd t0,16(sp)
+jal ra,-171
+jal ra,-11379
+lui t0,0xFFFFE
+addi t0,t0,144
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10508
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,16(sp)
+jal ra,-197
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10529
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+sd t0,16(sp)
+jal ra,-217
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10549
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,16(sp)
+jal ra,-237
+jal ra,-11445
+lui t0,0xFFFFE
+addi t0,t0,144
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10574
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+sd t0,16(sp)
+jal ra,-263
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10595
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+sd t0,16(sp)
+jal ra,-283
+jal ra,-11491
+lui t0,0xFFFFE
+addi t0,t0,128
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10620
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,224(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+sd t0,16(sp)
+jal ra,-309
+jal ra,-11517
+lui t0,0xFFFFE
+addi t0,t0,112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10646
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,200(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,760(t0)
+sd t0,16(sp)
+jal ra,-335
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10667
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,192(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+sd t0,16(sp)
+jal ra,-355
+lui t0,0xFFFFE
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10687
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,184(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+sd t0,16(sp)
+jal ra,-375
+jal ra,-11583
+lui t0,0xFFFFE
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-10712
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+sd t0,8(sp)
+jal ra,-440
+jal ra,-11605
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,-13345
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,-13367
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,53
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,50
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,t0,0
+jal zero,28
+jal zero,15
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,109
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+jal zero,104
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-96(gp)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13553
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13146
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,40
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,-13589
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-96(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-181
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,10
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-218
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10579
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19235
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-189
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-284
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-308
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,32
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10669
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19325
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-279
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-888(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,1192(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1928(t0)
+sd t0,16(sp)
+ld t0,-1576(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-35
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,16(sp)
+jal ra,-1245
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1920(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2207
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-178
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1912(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2519
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-220
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2561
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2603
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-304
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1888(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2645
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-346
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1880(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2687
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-388
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1872(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,40(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-430
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1864(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2000(t0)
+sd t0,32(sp)
+jal ra,-2499
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-470
+jal zero,21
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1848(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2000(t0)
+sd t0,32(sp)
+jal ra,-2520
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-491
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1856(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,32(sp)
+jal ra,-2398
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-531
+jal zero,21
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1840(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,32(sp)
+jal ra,-2419
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-552
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1832(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+sd t0,32(sp)
+jal ra,-2243
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-590
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1944(t0)
+sd t0,16(sp)
+jal ra,-1983
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-622
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+sd t0,32(sp)
+jal ra,-2689
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-660
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1816(t0)
+sd t0,16(sp)
+ld t0,-1576(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1936(t0)
+sd t0,32(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-700
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-879
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2966
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2950
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2934
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2896
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2417
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-895
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-935
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2954
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2938
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-937
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2085
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-68
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1013
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3074
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3058
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3042
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3026
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2923
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1025
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-956
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19731
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14079
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-11961
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-1341
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19673
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19757
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-99
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1232(t1)
+ld t2,-24(s0)
+add t1,t1,t2
+sd t1,1232(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1656(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sub t0,t0,t1
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1121
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1100
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+ld t1,-8(s0)
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1152(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1656(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1168(t3)
+sub t2,t2,t3
+ld t3,-8(s0)
+add t2,t2,t3
+ld t3,-144(gp)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-63
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+sltu t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+jal zero,-25
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t2,zero,1
+sub t1,t1,t2
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11969
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1464(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sd t1,1504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+sd t1,1456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1608(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15055
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1600(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15069
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1592(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15083
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1589
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1568(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15109
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15123
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1552(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15137
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1643
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+sd t0,24(sp)
+jal ra,-1655
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1536(t0)
+sd t0,24(sp)
+jal ra,-1667
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1520(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15187
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1693
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+sd t0,24(sp)
+jal ra,-1705
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,132
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+sd t0,24(sp)
+jal ra,-1727
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+sd t0,24(sp)
+jal ra,-1739
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,24(sp)
+jal ra,-1751
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15271
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15285
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1791
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15311
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15325
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15339
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1845
+jal zero,127
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+sd t0,24(sp)
+jal ra,-1858
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,28
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+sd t0,24(sp)
+jal ra,-1870
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,24(sp)
+jal ra,-1882
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,36
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+sd t0,24(sp)
+jal ra,-1894
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15414
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1920
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15440
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1946
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15466
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1972
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sd t1,1376(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-12754
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sd t1,1376(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,11
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+ld t2,24(s0)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15640
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-2146
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,24(sp)
+jal ra,-2160
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+sd t0,24(sp)
+jal ra,-2174
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2188
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,32
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2202
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,40
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2216
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,24(sp)
+jal ra,-2230
+jal zero,113
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+sd t0,24(sp)
+jal ra,-2245
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,4
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,24(sp)
+jal ra,-2259
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+sd t0,24(sp)
+jal ra,-2273
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,12
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2287
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2301
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,20
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2315
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+sd t0,24(sp)
+jal ra,-2329
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,28
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+sd t0,24(sp)
+jal ra,-2343
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2438
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15825
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15841
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15857
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15873
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2512
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15897
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,1
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,115
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2582
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-15967
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2606
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-15991
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2634
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2650
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16035
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1456(t0)
+addi t0,zero,0
+sd t0,-40(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,-40(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,129
+jal zero,124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16091
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2730
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16115
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2758
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2774
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16159
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1456(t0)
+addi t0,zero,0
+sd t0,-40(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,-40(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,135
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2844
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2854
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2864
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2877
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2902
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16287
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2926
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16311
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2950
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1376(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,133
+jal zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,118
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2988
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2998
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3008
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3021
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3046
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3062
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3090
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1416(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-256(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-22081
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-16183
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-8
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-13947
+addi sp,sp,16
+jal zero,216
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-272(gp)
+sd t0,8(sp)
+jal ra,-75
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16475
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-56
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-13981
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22197
+jal ra,-1628
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+sd t0,16(sp)
+jal ra,-22197
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-120
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14022
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22238
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-13899
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1810
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-22255
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-176
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14078
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22294
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,16(sp)
+jal ra,-22293
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-232
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14118
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22334
+lui t0,0xFFFFE
+addi t0,t0,-328
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1696(t0)
+ld t1,-24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,48(sp)
+jal ra,-14163
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6460
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16704
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14210
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22426
+jal ra,-21196
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14052
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+sd t0,8(sp)
+jal ra,-1993
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-22447
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,358
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1055
+addi t0,a0,0
+beq t0,zero,352
+jal ra,-17319
+jal ra,-20619
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi t1,zero,8
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-22477
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+addi t2,zero,8
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,324
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-954
+addi t0,a0,0
+beq t0,zero,318
+addi t0,zero,0
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+addi t0,zero,0
+sd t0,-72(s0)
+ld t0,-72(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1456(t1)
+sltu t0,t0,t1
+beq t0,zero,109
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-64(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+sd t0,16(sp)
+jal ra,-22527
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-64(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-741
+addi t0,a0,0
+beq t0,zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,-40(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1376(t1)
+sd t1,1192(t0)
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,-48(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,-56(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1400(t1)
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1376(t1)
+sd t1,1168(t0)
+ld t0,-64(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+ld t0,-72(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-72(s0)
+jal zero,-113
+ld t0,-40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,184
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,176
+ld t0,-56(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,172
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-48(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,164
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-32(s0)
+add t1,t1,t2
+sd t1,1208(t0)
+jal ra,-2114
+addi t0,a0,0
+sd t0,-80(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,139
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-22684
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-16768
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,113
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-48(s0)
+add t1,t1,t2
+sd t1,1184(t0)
+ld t0,-48(s0)
+ld t1,-56(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,87
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-22736
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-16820
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFE
+addi t0,t0,-352
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-80(s0)
+sd t0,16(sp)
+jal ra,-14563
+addi sp,sp,16
+ld t0,-40(gp)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-392
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+ld t0,-152(gp)
+sd t0,16(sp)
+jal ra,-14580
+addi sp,sp,16
+jal zero,12
+lui t0,0xFFFFE
+addi t0,t0,-432
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+ld t0,-152(gp)
+sd t0,16(sp)
+jal ra,-14592
+addi sp,sp,16
+lui t0,0xFFFFE
+addi t0,t0,-472
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14605
+addi sp,sp,16
+jal zero,22
+lui t0,0xFFFFE
+addi t0,t0,-536
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+jal ra,-14621
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22837
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16600
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1352(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-12848
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3093
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3391
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+sd t0,16(sp)
+jal ra,-3401
+jal ra,-2882
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-560
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14711
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9087
+lui t0,0xFFFFE
+addi t0,t0,-568
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14721
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19474
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-16974
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18640
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16718
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-12966
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3211
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3509
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3227
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3525
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3243
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-3541
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1104(t0)
+sd t0,16(sp)
+jal ra,-3551
+jal ra,-3032
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3078
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-184(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,24(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,40(s0)
+sltu t0,t0,t1
+beq t0,zero,164
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,3766
+addi t0,a0,0
+beq t0,zero,139
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,13344
+addi t0,a0,0
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19632
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,3779
+addi t0,a0,0
+beq t0,zero,49
+ld t0,48(s0)
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19646
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-4157
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3872
+jal zero,23
+ld t0,32(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19678
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,3828
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-4108
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-624
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-14970
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,94
+ld t0,-8(s0)
+beq t0,zero,31
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-144(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-17201
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,67
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-27
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-680
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15023
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15040
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,24
+jal zero,-168
+ld t0,-8(s0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-776
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15059
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-792
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15089
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8773
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15098
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8700
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15107
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8755
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15117
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8745
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19874
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19885
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19896
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-904
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+jal ra,-15174
+addi sp,sp,32
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15041
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15057
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1056(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15039
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-2980
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15094
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-14961
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19990
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-23463
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20015
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-17560
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-17797
+addi t0,a0,0
+beq t0,zero,45
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-449
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18203
+addi t0,a0,0
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20062
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-17560
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20108
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19496
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,-968
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15365
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15376
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8486
+jal ra,-16262
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-984
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17353
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-13601
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3846
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4144
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3862
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4160
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3878
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4176
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+sd t0,16(sp)
+jal ra,-4186
+jal ra,-3667
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3713
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-1000
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15504
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8358
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15513
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8285
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15522
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8340
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15532
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8330
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20289
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20300
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20311
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1104
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-15589
+addi sp,sp,32
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15470
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1056(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15452
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,8(sp)
+jal ra,-3393
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-807
+addi t0,a0,0
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20416
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-16751
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-17923
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20450
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-17948
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20496
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19884
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+beq t0,zero,33
+lui t0,0xFFFFE
+addi t0,t0,-1168
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20501
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-18046
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15770
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15781
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8081
+jal ra,-16667
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1176
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17758
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-14006
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4251
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4549
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4267
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4565
+ld t0,-1680(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4283
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-4581
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(sp)
+jal ra,-4591
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+sd t0,16(sp)
+jal ra,-4601
+jal ra,-4082
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4128
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-1066
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,48
+lui t0,0xFFFFE
+addi t0,t0,-1192
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15945
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7853
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15954
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7844
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15963
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7835
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15972
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7858
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15982
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7880
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20739
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20750
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20761
+addi t0,a0,0
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-192(gp)
+sd t0,16(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,33
+ld t0,-16(s0)
+ld t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-256(gp)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20790
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-192(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-24243
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20814
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-18312
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20860
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20248
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+beq t0,zero,37
+lui t0,0xFFFFE
+addi t0,t0,-1280
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-192(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20871
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-18416
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-16138
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16149
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7713
+jal ra,-17035
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1288
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18127
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-14375
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18151
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-14399
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,1168(t0)
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1536(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-1296(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-14426
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23817
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23805
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23887
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4229
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1248(t0)
+jal ra,-14046
+jal ra,-14016
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4703
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5001
+jal ra,-14033
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-8976
+jal ra,-14071
+jal ra,-14041
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23837
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23862
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4736
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14061
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-14019
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4998
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,16(sp)
+jal ra,-5046
+jal ra,-4527
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14082
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4648
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4660
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14062
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4673
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5093
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4693
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23929
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23955
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1656(gp)
+sd t0,16(sp)
+jal ra,-4770
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14156
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5130
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14032
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4660
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20986
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,2200
+addi t0,a0,0
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,11730
+addi t0,a0,0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-1328
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16480
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20432
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-1376
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-16506
+addi sp,sp,16
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21276
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21078
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-109
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1384
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16558
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7240
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16568
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7230
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21328
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1656(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21344
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21000
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20426
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21371
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21404
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20792
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16653
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7145
+jal ra,-17539
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24851
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24857
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1928
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18675
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,2
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-14923
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5168
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5466
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5184
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-5482
+ld t0,-1712(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1048(t0)
+sd t0,16(sp)
+jal ra,-5492
+jal ra,-4973
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1704(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5501
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5027
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21277
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21280
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-416(t1)
+sd t1,0(t0)
+ld t0,-1704(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8107
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,-1432
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21300
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21306
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-16883
+addi sp,sp,24
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1464
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-16899
+addi sp,sp,8
+jal ra,-17782
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,30
+lui t0,0xFFFFE
+addi t0,t0,-1480
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16930
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6868
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16939
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6923
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16949
+ld t0,-1704(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6913
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8292
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8296
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,14496
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,14450
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,15037
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-198
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17011
+ld t0,-1704(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6787
+jal ra,-17897
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,15001
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-234
+jal ra,8962
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,14437
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23723
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23712
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23948
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23917
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16979
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-23860
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,30
+jal ra,-23752
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23959
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17014
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-23649
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-23899
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-23888
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-23877
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-155
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24100
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1016(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+sd t0,24(sp)
+jal ra,-67
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24127
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,968(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+sd t0,24(sp)
+jal ra,-94
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24125
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24094
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24156
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23837
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23796
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-27
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23967
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-90
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24220
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24208
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-37
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24263
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24287
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24297
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-47
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24397
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-127
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24383
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24334
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-24227
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-221
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-95
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24464
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,74
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24193
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24200
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-40(s0)
+sd t0,-32(s0)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24264
+addi t0,a0,0
+beq t0,zero,38
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24255
+addi t0,a0,0
+ld t1,-8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,40(s0)
+beq t0,zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24481
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-24365
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-130
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-24181
+ld t0,-40(s0)
+addi a0,t0,0
+jal zero,16
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-84
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24242
+ld t0,-32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24549
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24308
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-289
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,489
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-27
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,40(s0)
+beq t0,zero,53
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24579
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-24465
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-90
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-437
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-24342
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-267
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-24318
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-24371
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-275
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24478
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-105
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24729
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24488
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-469
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,324
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-123
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24552
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-502
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-174
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24603
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-553
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-161
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-146
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+jal ra,-122
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+beq t0,zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-297
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24695
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24654
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,952(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1496
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-18249
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-1536
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-19386
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-19366
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19404
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-19384
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-18292
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,872(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,872(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21281
+addi t0,a0,0
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,70
+jal zero,68
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-99
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,347
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-109
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,7
+jal zero,5
+ld t0,-8(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-47
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21443
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,55
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-236
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,13914
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-260
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-257
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,904(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-194
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-102
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-258
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,896(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,888(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,896(t2)
+divu t1,t1,t2
+mul t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-18770
+addi sp,sp,40
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-496
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-105
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-507
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-134
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-713
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-174
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-731
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-93
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-211
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-814
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-153
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-176(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1632
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-18946
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18885
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+beq t0,zero,66
+ld t0,-176(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-18988
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18927
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,125
+jal zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-19028
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18966
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,103
+jal zero,101
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+beq t0,zero,44
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1664
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-19020
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-153
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-19046
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+beq t0,zero,47
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1664
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-19067
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-198
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1680
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+sd t0,16(sp)
+jal ra,-19095
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-192
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1696
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3939
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10840
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-21455
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-19194
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19133
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19255
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4541
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19277
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4519
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4340
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-21983
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,280(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10635
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,552(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,568(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,576(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-455
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1712
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-19457
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19395
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,52
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1728
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3629
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11150
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11158
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,40(sp)
+jal ra,-19506
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19445
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19568
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4292
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19580
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4280
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19602
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4258
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,8(sp)
+jal ra,-11068
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,272(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10952
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-737
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1744
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3394
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11385
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11393
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11401
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-19745
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19684
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19806
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4054
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19817
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4043
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19829
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4031
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11187
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11193
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,264(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11188
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11307
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11313
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,256(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11308
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11427
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11433
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,248(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11428
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11561
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11567
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,240(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11562
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,3899
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11706
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11712
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,232(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11707
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,3754
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11837
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11843
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,224(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11843
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1628
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1760
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2503
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12276
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12288
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-20632
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20571
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20709
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3087
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20720
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2072
+addi t0,a0,0
+beq t0,zero,91
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3186
+addi t0,a0,0
+beq t0,zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2055
+addi t0,a0,0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12290
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1784
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1985
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-20770
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1808
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2005
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-20790
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3069
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-20806
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-20816
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-20826
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2190
+addi t0,a0,0
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3068
+addi t0,a0,0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2173
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20868
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2992
+lui t0,0xFFFFE
+addi t0,t0,-1928
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-20882
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2261
+addi t0,a0,0
+beq t0,zero,30
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2997
+addi t0,a0,0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2244
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2700
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12299
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2331
+addi t0,a0,0
+beq t0,zero,156
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2927
+addi t0,a0,0
+beq t0,zero,141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2314
+addi t0,a0,0
+beq t0,zero,118
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2190
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,216(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-12390
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,144(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2511
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,3098
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3089
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3080
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2173
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1760
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1958
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12821
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12833
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-21177
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21116
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21254
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2542
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21265
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2595
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21277
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2629
+addi t0,a0,0
+beq t0,zero,85
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2709
+addi t0,a0,0
+beq t0,zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2612
+addi t0,a0,0
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12847
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2542
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-21327
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2562
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-21347
+addi sp,sp,16
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-21357
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-21367
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-21377
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2741
+addi t0,a0,0
+beq t0,zero,32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2597
+addi t0,a0,0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2724
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-21421
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2438
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2806
+addi t0,a0,0
+beq t0,zero,29
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2532
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2789
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2704
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2156
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12843
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-2875
+addi t0,a0,0
+beq t0,zero,169
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2463
+addi t0,a0,0
+beq t0,zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2858
+addi t0,a0,0
+beq t0,zero,131
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-12994
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2781
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2728
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,208(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2760
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,136(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3068
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,2541
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2532
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2523
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2955
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2781
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1728
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1350
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13429
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13437
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,536(t0)
+sd t0,8(sp)
+jal ra,-24313
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-21793
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21732
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2000
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-21793
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21888
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1972
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21899
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1961
+lui t0,0xFFFFE
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-21915
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-21936
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1695
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13302
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13308
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1736(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,200(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3053
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2048
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1078
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13701
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,536(t0)
+sd t0,8(sp)
+jal ra,-24577
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-22057
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21996
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2000
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-22057
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1704
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22152
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1637
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22170
+lui t0,0xFFFFD
+addi t0,t0,2032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-22180
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-270
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22204
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1592
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,176(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,168(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-24812
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,160(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,160(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,152(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1720(t2)
+add t1,t1,t2
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,192(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13639
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3414
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1760
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,717
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14062
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,536(t0)
+sd t0,8(sp)
+jal ra,-24938
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14082
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-22426
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22365
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22487
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1309
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22499
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1290
+addi t0,zero,-1104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22517
+lui t0,0xFFFFD
+addi t0,t0,2032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-22527
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13880
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1720(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-25191
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-25221
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,184(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,344(t0)
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13884
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3659
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-176(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,472
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-22643
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-22582
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,937
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1712(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14059
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,552(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,568(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,576(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-23649
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,115
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1048(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,1976
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-22801
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-608(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31017
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,1912
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-22823
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-608(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31039
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal ra,-5927
+jal zero,51
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14182
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1112(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14200
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14204
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1680(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14216
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14137
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,496(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,1337
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,552(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,568(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,576(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1632
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1192(t2)
+sub t1,t1,t2
+ld t2,-144(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-22928
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1664
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,16(sp)
+jal ra,-22959
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1656
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22978
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+beq t0,zero,5
+jal ra,-58
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-32(gp)
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1904
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23019
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1896
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23036
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1664
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12059
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-23064
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3739
+addi t0,a0,0
+addi a0,t0,0
+jal zero,201
+jal zero,199
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2580
+addi t0,a0,0
+addi a0,t0,0
+jal zero,186
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2050
+addi t0,a0,0
+addi a0,t0,0
+jal zero,171
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3501
+addi t0,a0,0
+addi a0,t0,0
+jal zero,156
+jal zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3516
+addi t0,a0,0
+addi a0,t0,0
+jal zero,141
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3531
+addi t0,a0,0
+addi a0,t0,0
+jal zero,126
+jal zero,124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3546
+addi t0,a0,0
+addi a0,t0,0
+jal zero,111
+jal zero,109
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3561
+addi t0,a0,0
+addi a0,t0,0
+jal zero,96
+jal zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3576
+addi t0,a0,0
+addi a0,t0,0
+jal zero,81
+jal zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1548
+addi t0,a0,0
+addi a0,t0,0
+jal zero,66
+jal zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1291
+addi t0,a0,0
+addi a0,t0,0
+jal zero,51
+jal zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-944
+addi t0,a0,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4181
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-729
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11523
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,1848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+sd t0,16(sp)
+jal ra,-23430
+addi sp,sp,16
+jal zero,208
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-9562
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25966
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1800
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+sd t0,16(sp)
+jal ra,-23472
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31688
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+sd t0,-288(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+sd t0,-296(gp)
+jal ra,-31504
+jal ra,-29192
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,384(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12539
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,336(t0)
+jal ra,985
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-360
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1024
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23474
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,-56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-515
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-296(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1024
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23520
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+ld t2,-144(gp)
+add t1,t1,t2
+sd t1,344(t0)
+jal zero,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,384(t0)
+addi t0,zero,0
+sd t0,-288(gp)
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,1688
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+sd t0,48(sp)
+jal ra,-23638
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,576(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,568(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,576(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,400(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,568(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,560(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,568(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,576(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,344(t0)
+jal ra,628
+jal ra,752
+jal ra,1923
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,392(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+jal ra,610
+jal ra,734
+jal ra,1952
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,568(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,400(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1672
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15441
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-23827
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1656
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15473
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-23859
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15414
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+jal zero,32
+lui t0,0xFFFFD
+addi t0,t0,1640
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15516
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-23911
+addi sp,sp,24
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4118
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,64(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4153
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,48(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4175
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,32(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4038
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,56(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,56(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4073
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,40(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,4095
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,24(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-24097
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24114
+addi sp,sp,8
+jal zero,109
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1592
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24132
+addi sp,sp,8
+jal zero,91
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1584
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24150
+addi sp,sp,8
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1592
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24168
+addi sp,sp,8
+jal zero,55
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24186
+addi sp,sp,8
+jal zero,37
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1592
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-24204
+addi sp,sp,8
+jal zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1560
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24220
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15831
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28761
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,520(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28774
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFD
+addi t0,t0,1520
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28699
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24276
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-205
+lui t0,0xFFFFD
+addi t0,t0,1480
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24289
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28816
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28806
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal ra,-25189
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-616(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32523
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-28250
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28241
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,432(t0)
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,1520
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28779
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24356
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-285
+lui t0,0xFFFFD
+addi t0,t0,1424
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-24373
+addi sp,sp,8
+jal ra,-1209
+jal ra,-25257
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,536(t0)
+sd t0,8(sp)
+jal ra,-5742
+addi t0,a0,0
+beq t0,zero,85
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,3583
+addi t0,a0,0
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+ld t1,-144(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-5529
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13708
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,336(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-5556
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13713
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,336(t0)
+jal zero,32
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-251
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13294
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,336(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15526
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-15351
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sd t1,328(t0)
+jal zero,367
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-15379
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sd t1,328(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1848(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sd t1,328(t0)
+jal zero,320
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-15212
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1856(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sd t1,328(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sd t1,328(t0)
+jal zero,273
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,144
+jal ra,-15645
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1912(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sd t1,328(t0)
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sd t1,328(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+sd t1,328(t0)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+sd t1,328(t0)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sd t1,328(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+sd t1,328(t0)
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-15120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sd t1,328(t0)
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-14872
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sd t1,328(t0)
+jal zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-15672
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sd t1,328(t0)
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-14792
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+sd t1,328(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-15718
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sd t1,328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,464(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-715
+jal zero,32
+ld t0,-216(gp)
+sd t0,-296(gp)
+lui t0,0xFFFFD
+addi t0,t0,1344
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+sd t0,32(sp)
+jal ra,-24970
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-592(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33186
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29189
+addi t0,a0,0
+ld t1,24(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29636
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,544(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29233
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,38
+ld t0,32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,2941
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-75
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-31023
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+jal zero,-36
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29734
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29729
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,173
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,163
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,544(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31217
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,2
+jal ra,-776
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31235
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31232
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31225
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31218
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31211
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31204
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+jal zero,62
+jal ra,-850
+jal ra,-726
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28135
+addi t0,a0,0
+beq t0,zero,49
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+sd t0,8(sp)
+jal ra,-31208
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+sd t0,8(sp)
+jal ra,-31203
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,8(sp)
+jal ra,-31194
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,8(sp)
+jal ra,-31185
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+sd t0,8(sp)
+jal ra,-31176
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+sd t0,8(sp)
+jal ra,-31167
+jal zero,3
+jal ra,-909
+jal ra,-785
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+beq t0,zero,3
+jal ra,176
+jal zero,2
+jal ra,412
+jal zero,168
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5712
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4385
+jal zero,144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3853
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5521
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5413
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5305
+jal zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5197
+jal zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5064
+jal zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4931
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3477
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3230
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2924
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6158
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-2767
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6214
+jal ra,-5890
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4627
+jal ra,-4564
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4095
+jal ra,-4033
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6253
+jal ra,-5702
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6266
+jal ra,-5595
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6279
+jal ra,-5488
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6292
+jal ra,-5381
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6305
+jal ra,-5249
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6318
+jal ra,-5117
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-3677
+jal ra,-3664
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6344
+jal ra,-3418
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6357
+jal ra,-3113
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6370
+jal ra,-6348
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2978
+jal ra,-2958
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3976
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,15
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-2818
+jal zero,2
+jal ra,-6312
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2565
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6184
+jal ra,-6129
+jal ra,-6152
+jal zero,187
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5073
+jal ra,-4804
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4927
+jal zero,170
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4545
+jal ra,-4277
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4393
+jal zero,153
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5994
+jal ra,-5950
+jal ra,-6200
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6008
+jal ra,-5844
+jal ra,-6214
+jal zero,125
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6022
+jal ra,-5738
+jal ra,-6228
+jal zero,111
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6036
+jal ra,-5632
+jal ra,-6242
+jal zero,97
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6050
+jal ra,-5501
+jal ra,-6256
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6064
+jal ra,-5370
+jal ra,-6270
+jal zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3996
+jal ra,-3918
+jal ra,-3954
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,752(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3746
+jal ra,-3673
+jal ra,-3703
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,744(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3425
+jal ra,-3369
+jal ra,-3717
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6671
+jal ra,-6605
+jal ra,-6651
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3215
+jal zero,2
+jal ra,-26813
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30494
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,520(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-1759
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30212
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30652
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25698
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,8(sp)
+jal ra,-29703
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28970
+addi t0,a0,0
+beq t0,zero,5
+jal ra,-994
+jal ra,-779
+jal ra,-141
+jal zero,-11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,296(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,-72(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-32(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+sd t0,-8(s0)
+jal zero,8
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-41
+ld t0,-8(s0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-72(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,1320
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-27343
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-27323
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-26233
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-1632
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-26260
+addi sp,sp,8
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,1304
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26271
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1288
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-26300
+addi sp,sp,24
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,-72(gp)
+sd t0,16(sp)
+jal ra,-152
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-155
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-158
+jal ra,-27207
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,48
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,1256
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-27556
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-27536
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-26388
+addi sp,sp,64
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18029
+addi t0,a0,0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1240
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,128(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,120(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-97
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFD
+addi t0,t0,1176
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-26450
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,1160
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+sd t0,24(sp)
+jal ra,-136
+ld t0,-1600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-77
+lui t0,0xFFFFD
+addi t0,t0,1144
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,56(t0)
+sd t0,24(sp)
+jal ra,-157
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18083
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,112(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,128(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,112(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,104(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,120(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,104(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1128
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,112(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,104(t0)
+sd t0,24(sp)
+jal ra,-225
+lui t0,0xFFFFD
+addi t0,t0,1112
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+sd t0,24(sp)
+jal ra,-242
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18096
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,96(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,128(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,96(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,120(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,88(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+sd t0,24(sp)
+jal ra,-310
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18135
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,128(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,80(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,120(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,72(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-293
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,1080
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1520
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+sd t0,24(sp)
+jal ra,-378
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,115
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31199
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,97
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31210
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31480
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31201
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31732
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-7989
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-30583
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31676
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8005
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-30514
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31746
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8021
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-30598
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31744
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8037
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-30597
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31742
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8053
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-30596
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31644
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-118
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFD
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31277
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-16722
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31287
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28006
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-16735
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31300
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27991
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-16748
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31313
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28088
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-16761
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31326
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28073
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-26925
+addi sp,sp,48
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31407
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31363
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31337
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31328
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31319
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31799
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-65
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+lui t0,0xFFFFD
+addi t0,t0,896
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31426
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-28204
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31441
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28160
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31453
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28144
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31462
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-28240
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,48(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31476
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-28226
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-27078
+addi sp,sp,56
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27101
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,880
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27112
+addi sp,sp,8
+jal ra,-16963
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,42
+lui t0,0xFFFFD
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+jal ra,-16973
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16976
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-16912
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28257
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-16986
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-16922
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28239
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-27147
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,808
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27158
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,736
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+jal ra,5308
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28352
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,5297
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28335
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,5281
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28318
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,5270
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28301
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+divu t0,t0,t1
+sd t0,40(sp)
+jal ra,-27217
+addi sp,sp,40
+jal ra,-502
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,435
+lui t0,0xFFFFE
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27238
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,712
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31678
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27255
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31667
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,205
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-416
+lui t0,0xFFFFD
+addi t0,t0,664
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31593
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+sd t0,8(sp)
+jal ra,-28468
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31607
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+sd t0,8(sp)
+jal ra,-28454
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-27306
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,560
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31860
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31886
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28517
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31884
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31910
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28513
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31756
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31667
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28561
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31681
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-28547
+addi t0,a0,0
+sd t0,48(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31942
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31968
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-27280
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31720
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28553
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31976
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32002
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-27314
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31754
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-28559
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-27467
+addi sp,sp,64
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31841
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31829
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31820
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,160
+lui t0,0xFFFFD
+addi t0,t0,520
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31878
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31866
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31857
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-27532
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32001
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27555
+addi sp,sp,8
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32030
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31996
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27573
+addi sp,sp,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31985
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+lui t0,0xFFFFD
+addi t0,t0,480
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31998
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31967
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31955
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31946
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-28800
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-27624
+addi sp,sp,8
+jal ra,-28507
+lui t0,0xFFFFD
+addi t0,t0,408
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32008
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31995
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31982
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-27654
+addi sp,sp,32
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32461
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-438
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27676
+addi sp,sp,8
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2731
+jal ra,-17531
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,111
+jal ra,-17318
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27697
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,344
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27715
+addi sp,sp,8
+jal zero,12
+lui t0,0xFFFFD
+addi t0,t0,288
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27727
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,272
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,176(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,168(t0)
+sd t0,16(sp)
+jal ra,-1460
+lui t0,0xFFFFD
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,160(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,152(t0)
+sd t0,16(sp)
+jal ra,-1474
+lui t0,0xFFFFD
+addi t0,t0,240
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,144(t0)
+sd t0,16(sp)
+jal ra,-1488
+lui t0,0xFFFFD
+addi t0,t0,224
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,136(t0)
+sd t0,16(sp)
+jal ra,-1502
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27794
+addi sp,sp,8
+jal ra,-1361
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,84
+lui t0,0xFFFFE
+addi t0,t0,1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27810
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,176
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-27821
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34586
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34576
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,160
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-9618
+jal ra,-28726
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34609
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34599
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,144
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-9641
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+sd t0,8(sp)
+jal ra,-27881
+addi sp,sp,8
+jal ra,-28764
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,104
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27910
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27927
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,88
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27944
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,80
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27961
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27978
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1872
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27985
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32637
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32651
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32643
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32656
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32670
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32662
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32865
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1592(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,904(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32719
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32714
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32743
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32966
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1592(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-202
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-157
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1904
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30255
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-26503
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,-1592(gp)
+sd t0,16(sp)
+jal ra,-17000
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-16564
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1880
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30305
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-26553
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+ld t0,-1600(gp)
+sd t0,16(sp)
+jal ra,-17050
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-16614
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1856
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30355
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,48(sp)
+jal ra,-26603
+jal ra,-17186
+jal ra,-17187
+jal ra,-17188
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-16659
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1192(t0)
+ld t0,-1656(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,8(sp)
+jal ra,-23320
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1192(t2)
+ld t3,16(s0)
+sub t2,t2,t3
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,536(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1192(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33241
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33046
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,48
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28521
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4723
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33072
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28547
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4749
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33304
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,1243
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28582
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4784
+jal ra,-29468
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33321
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,177
+addi t0,a0,0
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33146
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-9803
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33004
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-32430
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33396
+addi t0,a0,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,536(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-32786
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12124
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+sd t0,8(sp)
+jal ra,814
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28529
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-70
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-32344
+addi t0,a0,0
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33479
+addi t0,a0,0
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33362
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-134
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-272(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33392
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33380
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-174
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33394
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-204
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-288(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33405
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-234
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33169
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-264
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-304(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33180
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-294
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-312(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33191
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-324
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33202
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-354
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32618
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32618
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sd t1,-264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28799
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-280(t1)
+sd t1,-288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-414
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-296(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-32783
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-441
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-304(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-32793
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-468
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-312(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-32803
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-495
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+sd t1,-208(t0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-192(t0)
+sd t0,8(sp)
+jal ra,-32817
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-210
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-32634
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+addi t2,zero,2
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-232(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-575
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,8
+sd t1,-240(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-144(gp)
+sd t1,-240(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-244
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-190
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-169
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-148
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-373
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32835
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32888
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32899
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-32830
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-454
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-32840
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-283
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,14
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32927
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-69
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-720
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34110
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-10699
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34122
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-10616
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-771
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34160
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-10749
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34172
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-10644
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33030
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33020
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-79
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-18
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-865
+addi t0,a0,0
+beq t0,zero,25
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29280
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-288(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34084
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13117
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-322
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-146
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33171
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,10
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-360(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-360(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-89
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-384(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,112
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-194
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1037
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-849
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-33235
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-678
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-33234
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-33223
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+sd t0,8(sp)
+jal ra,-33214
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-368(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-232(t2)
+add t1,t1,t2
+sd t1,-376(t0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-360(t1)
+ld t2,24(s0)
+sub t1,t1,t2
+sd t1,-360(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-884
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-216(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,555
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-728
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-910
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-741
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+sd t0,8(sp)
+jal ra,-29718
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1073
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,96
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1058
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1042
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1279
+addi t0,a0,0
+beq t0,zero,18
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-232(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33516
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,24(s0)
+ld t1,-16(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33515
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33564
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-67
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-648
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1384
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32933
+addi t0,a0,0
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-11391
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32945
+addi t0,a0,0
+beq t0,zero,2
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-182
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,59
+jal zero,23
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33599
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+sd t0,8(sp)
+jal ra,-33549
+jal zero,2
+jal zero,36
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33659
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33649
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-120
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-16
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-164
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-240(t1)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-20
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1308
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,35
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1486
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,920(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-76
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1470
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1446
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-92
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33827
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1195
+jal zero,11
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33838
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-33769
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1367
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-33783
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1199
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-392(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33840
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-392(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1457
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33923
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33876
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-135
+jal zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+sd t0,8(sp)
+jal ra,-33835
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-24(s0)
+sd t0,-16(s0)
+jal zero,-44
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-219
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-91
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-352(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31614
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31598
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+sd t0,48(sp)
+jal ra,-30462
+addi sp,sp,48
+lui t0,0xFFFFD
+addi t0,t0,-104
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31661
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31645
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+sd t0,8(sp)
+jal ra,-31629
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+sd t0,8(sp)
+jal ra,-31613
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+sd t0,48(sp)
+jal ra,-30525
+addi sp,sp,48
+lui t0,0xFFFFD
+addi t0,t0,-160
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31724
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31708
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+sd t0,32(sp)
+jal ra,-30564
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,-248
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31767
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31755
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-31743
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-31731
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+add t0,t0,t1
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+sd t0,56(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+sd t0,64(sp)
+jal ra,-30655
+addi sp,sp,64
+lui t0,0xFFFFD
+addi t0,t0,-320
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31854
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31838
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+sd t0,8(sp)
+jal ra,-31822
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+sd t0,8(sp)
+jal ra,-31806
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+sd t0,48(sp)
+jal ra,-30718
+addi sp,sp,48
+lui t0,0xFFFFD
+addi t0,t0,-392
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31917
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,8(sp)
+jal ra,-31901
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,8(sp)
+jal ra,-31885
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,8(sp)
+jal ra,-31869
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+sd t0,48(sp)
+jal ra,-30781
+addi sp,sp,48
+ld t0,16(s0)
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30790
+jal ra,-31672
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-36171
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35630
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-432(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,8(sp)
+jal ra,-35019
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35012
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-35027
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-424(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,8(sp)
+jal ra,-35067
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-432(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35708
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35717
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35709
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35091
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35716
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35725
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35747
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35127
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35120
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35761
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-89
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1560(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30637
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33894
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30659
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35129
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,872(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30678
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35148
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35137
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35757
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35130
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12440
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35125
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35741
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35118
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,136
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35815
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36272
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12313
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35128
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35835
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36274
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12333
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35131
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35855
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36276
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12353
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35134
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35875
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36278
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12373
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35137
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35895
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36280
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12393
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35140
+ld t0,-184(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33188
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35921
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36180
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12419
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-15302
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-35055
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+sd t0,8(sp)
+jal ra,-35149
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35138
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+sd t0,8(sp)
+jal ra,-35129
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-35118
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-35107
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35079
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35068
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35057
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35046
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35035
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35024
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35013
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-35002
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-34991
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-34980
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-184(t0)
+sd t0,8(sp)
+jal ra,-34971
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-34960
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-537
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-369
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+beq t0,zero,26
+lui t0,0xFFFFD
+addi t0,t0,-456
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35787
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35795
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-31372
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35866
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35857
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36227
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-68
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-140
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,8(sp)
+jal ra,-35643
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35962
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,207
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35973
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36243
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35964
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36834
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36302
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12731
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36292
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36840
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12773
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-12772
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-25
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36680
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36136
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12793
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36678
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36133
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12809
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36676
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36130
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12825
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36674
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36127
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12841
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36528
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35934
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12857
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36526
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35931
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12873
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36524
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35928
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12889
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36522
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35925
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-12905
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-21564
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36129
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-35554
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,920(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36490
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1592(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36070
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-35510
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36563
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-13307
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36390
+addi t0,a0,0
+ld t1,-144(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13238
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36584
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-100
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35977
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36581
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-94
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35976
+jal zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36579
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-133
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35976
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36576
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-127
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35975
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-512
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36375
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-31952
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,57
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-13603
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-13298
+addi t0,a0,0
+beq t0,zero,34
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-13211
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13389
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13540
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-196
+ld t0,40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+jal zero,-59
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36505
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,319
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36516
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36786
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36507
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37380
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13295
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36229
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36835
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37383
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13316
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-24(s0)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,27
+ld t0,-32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-13339
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-29
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37230
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13361
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36091
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37228
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13377
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36090
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37226
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13393
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36089
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37224
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13409
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36088
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37471
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13422
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37465
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13434
+addi t0,a0,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37459
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13446
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-56(s0)
+sd t0,24(sp)
+ld t0,-64(s0)
+sd t0,32(sp)
+jal ra,-282
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37501
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-64(s0)
+sd t0,16(sp)
+jal ra,-13448
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37477
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13482
+addi t0,a0,0
+sd t0,-56(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37471
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13494
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-56(s0)
+sd t0,24(sp)
+ld t0,-64(s0)
+sd t0,32(sp)
+jal ra,-330
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37495
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-56(s0)
+sd t0,16(sp)
+jal ra,-13496
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37186
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13533
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36025
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37184
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13549
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36024
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37182
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13565
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36023
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37180
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-13581
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36022
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37142
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37135
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37128
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,312(t0)
+jal ra,-15032
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-22256
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36821
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-36246
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,856(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,848(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-448(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+jal ra,-80
+addi t0,a0,0
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,896(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,-448(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32177
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-440(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-448(t2)
+add t1,t1,t2
+sd t1,-440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,8(sp)
+jal ra,-32413
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-448(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+sub t1,t1,t2
+sd t1,-448(t0)
+jal zero,18
+lui t0,0xFFFFD
+addi t0,t0,-552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-32584
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40800
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-456(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+add t1,t1,t2
+sd t1,-456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-448(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+sub t1,t1,t2
+sd t1,-448(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,8(sp)
+jal ra,-20384
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(s0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37388
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-13977
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35564
+addi t0,a0,0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14059
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-187
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-859
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37417
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-13889
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-144(gp)
+sd t0,16(sp)
+jal ra,-7676
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37429
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37454
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-14223
+addi t0,a0,0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+jal ra,-311
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-253
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-925
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,848(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,888(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,896(t3)
+divu t2,t2,t3
+add t1,t1,t2
+sd t1,848(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+sd t0,8(sp)
+jal ra,-36937
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14179
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36898
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37518
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36891
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-36848
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+jal ra,-36839
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-36830
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+sd t0,8(sp)
+jal ra,-36821
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+sd t0,8(sp)
+jal ra,-32719
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36824
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37428
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36817
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1192(t1)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37522
+addi t0,a0,0
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21851
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-248
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-28
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1168(t1)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37515
+addi t0,a0,0
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21858
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-279
+ld t0,-8(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-28
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34936
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-32818
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,32(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-22211
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-338
+ld t0,-16(s0)
+ld t1,-144(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-26
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,920(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32851
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-103
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-30
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-420
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-432
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-457
+jal zero,-25
+ld t0,-8(s0)
+ld t1,-144(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-470
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37873
+addi t0,a0,0
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37884
+addi t0,a0,0
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35144
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35151
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35163
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35190
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35176
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-24(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-35430
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,46
+sd t0,-24(s0)
+jal zero,-32
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+sd t0,-32(s0)
+jal zero,30
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35246
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-35470
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-35436
+jal zero,-22
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-560
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+sd t0,32(sp)
+jal ra,-33246
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35286
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35312
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-35529
+addi t0,a0,0
+addi t1,zero,62
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,62
+sd t0,16(sp)
+jal ra,-35506
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,12
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-35519
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,-40
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35363
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35374
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35401
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-568
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-33376
+addi sp,sp,16
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-654
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-37288
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37875
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1521
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,1404
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,1417
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-459
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+sd t0,8(sp)
+jal ra,-37410
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37858
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-37286
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38247
+addi t0,a0,0
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1080(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4350
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5040
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17010
+jal zero,84
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1104(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18467
+jal zero,71
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1096(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18065
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17637
+jal zero,45
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1112(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18884
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal zero,34
+jal zero,27
+lui t0,0xFFFFD
+addi t0,t0,-600
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-33598
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-600(t0)
+sd t0,8(sp)
+jal ra,-37501
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+sd t0,8(sp)
+jal ra,-37566
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37995
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-37425
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38156
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1230
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1172
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1844
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15039
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-5529
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37980
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,896(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-37418
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lui t0,0xFFFFD
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-33712
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-576(t0)
+sd t0,8(sp)
+jal ra,-37615
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+sd t0,8(sp)
+jal ra,-37674
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-33760
+addi sp,sp,8
+jal ra,-10066
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+sd t0,8(sp)
+jal ra,-37664
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,-712
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-33781
+addi sp,sp,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-584(t0)
+sd t0,8(sp)
+jal ra,-37684
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+sd t0,8(sp)
+jal ra,-37742
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38152
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-37584
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38368
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-392
+addi t0,a0,0
+addi a0,t0,0
+jal zero,92
+jal zero,90
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-252
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-107
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+jal zero,42
+lui t0,0xFFFFD
+addi t0,t0,-760
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38352
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-33929
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38439
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-9862
+jal ra,-34822
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-624(t0)
+sd t0,8(sp)
+jal ra,-37843
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,58
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-16956
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38449
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38460
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+sd t0,-8(s0)
+jal zero,27
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-169
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38502
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,7
+ld t0,-16(s0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-8(s0)
+jal zero,-58
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,1
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,8(sp)
+jal ra,-42212
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-221
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38554
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,3
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-34
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-72(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-8(s0)
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sd t0,-8(s0)
+jal zero,24
+ld t0,-8(s0)
+ld t1,-72(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,-8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+ld t1,24(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,7
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,91
+ld t0,24(s0)
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-17135
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-42326
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38637
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38648
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+sd t0,-16(s0)
+jal zero,49
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-357
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38690
+addi t0,a0,0
+addi a0,t0,0
+jal zero,32
+jal zero,29
+ld t0,-24(s0)
+sd t0,16(s0)
+ld t0,24(s0)
+beq t0,zero,17
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,9
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,-91
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,107
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-17242
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38735
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38746
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+sd t0,-8(s0)
+jal zero,76
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38814
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,-760
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38740
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-34317
+addi sp,sp,16
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38843
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38831
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10254
+jal ra,-35214
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-624(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,20
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-505
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38838
+addi t0,a0,0
+addi a0,t0,0
+jal zero,9
+ld t0,-16(s0)
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,-8(s0)
+jal zero,-107
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1672
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-137
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-155
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFD
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-34436
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi a0,t0,0
+jal zero,413
+jal zero,95
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-784(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,-840
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-34470
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi a0,t0,0
+jal zero,379
+jal zero,61
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+sd t0,16(s0)
+jal zero,40
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-40618
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+sd t0,16(s0)
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-17292
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,1032(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+sd t0,16(s0)
+jal ra,-40241
+jal ra,-39915
+jal ra,-37914
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,349
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36294
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40978
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-3236
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1153
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,424(t0)
+lui t0,0xFFFFD
+addi t0,t0,-920
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,928(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-34613
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-200(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5433
+lui t0,0xFFFFD
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+sd t0,8(sp)
+jal ra,-34634
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34645
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34652
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1008
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34666
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34673
+lui t0,0xFFFFD
+addi t0,t0,-1112
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-34683
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-736
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-677
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,56
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-656(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-359
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,39
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-664(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-354
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,22
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-672(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-682
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,-1200
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-34783
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1272
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-680(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-152(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-632(t0)
+sd t0,8(sp)
+jal ra,-37099
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-34821
+addi sp,sp,48
+jal ra,-7737
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,416(t0)
+lui t0,0xFFFFD
+addi t0,t0,-1360
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-34849
+addi sp,sp,8
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-752(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-760(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-760(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-768(t0)
+jal ra,-79
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-752(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+addi t2,zero,1
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-760(t0)
+ld t1,16(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-1432
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-35055
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-206
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+addi a0,t0,0
+jal zero,368
+jal zero,366
+lui t0,0xFFFFD
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-35089
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1568
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-16(gp)
+sd t0,16(sp)
+jal ra,-35102
+addi sp,sp,16
+lui t0,0xFFFFD
+addi t0,t0,-1632
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+ld t0,-48(gp)
+sd t0,16(sp)
+ld t0,-56(gp)
+sd t0,24(sp)
+jal ra,-35117
+addi sp,sp,24
+jal ra,-7229
+jal ra,-36001
+lui t0,0xFFFFD
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-35130
+addi sp,sp,8
+jal ra,-43136
+jal ra,-42414
+jal ra,-42391
+jal ra,-40996
+jal ra,-41432
+jal ra,-276
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,288
+jal ra,-219
+jal ra,308
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1640
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-36979
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-27400
+jal zero,255
+jal ra,-297
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi a0,t0,0
+jal zero,277
+jal zero,242
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1648
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37006
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-260
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21275
+jal zero,224
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1656
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37024
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11814
+jal zero,207
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1664
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37041
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11831
+jal zero,190
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1672
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37058
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-312
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21068
+jal zero,172
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38140
+addi t0,a0,0
+beq t0,zero,161
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1680
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37082
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-640(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-851
+addi t0,a0,0
+addi a0,t0,0
+jal zero,179
+jal zero,138
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1688
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37104
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-688(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-873
+addi t0,a0,0
+addi a0,t0,0
+jal zero,157
+jal zero,116
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1696
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37126
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-895
+addi t0,a0,0
+addi a0,t0,0
+jal zero,135
+jal zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1704
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37148
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-648(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-917
+addi t0,a0,0
+addi a0,t0,0
+jal zero,113
+jal zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1712
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37170
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-656(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-939
+addi t0,a0,0
+addi a0,t0,0
+jal zero,91
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1720
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37192
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-664(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-961
+addi t0,a0,0
+addi a0,t0,0
+jal zero,69
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1728
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37214
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-983
+addi t0,a0,0
+addi a0,t0,0
+jal zero,47
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi a0,t0,0
+jal zero,41
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+addi a0,t0,0
+jal zero,35
+jal ra,-551
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1816
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-35426
+addi sp,sp,8
+jal zero,-291
+lui t0,0xFFFFD
+addi t0,t0,-1360
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+sd t0,8(sp)
+jal ra,-35438
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1824
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37291
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-32(gp)
+jal ra,-38532
+jal ra,-41832
+jal ra,-42450
+jal ra,-550
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1832
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37310
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,1
+sd t0,-32(gp)
+jal ra,-38551
+jal ra,-41851
+jal ra,-42469
+jal ra,-569
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1840
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37329
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+sd t1,-200(t0)
+jal ra,-589
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1848
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37349
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+sd t1,-200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+sd t1,-224(t0)
+jal ra,-615
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1856
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-37375
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+sd t1,-224(t0)
+jal ra,-635
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+sd t1,-200(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-590
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-546
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38875
+jal ra,-43786
+jal ra,-38850
+jal ra,-38699
+jal ra,-38972
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-580
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1896
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x34366D2D
+.8byte 0x32336D2D
+.8byte 0x2A2A2A2A203A7325
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0xA2A2A2A2A
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6F2D
+.8byte 0x632D
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x3D3D3D3D203A7325
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0xA3D3D3D3D
+.8byte 0x20632D207B207325
+.8byte 0x656372756F73207B
+.8byte 0x206F2D207C207D20
+.8byte 0x7C207972616E6962
+.8byte 0x207C20732D202820
+.8byte 0x737361202920532D
+.8byte 0x207C20796C626D65
+.8byte 0x72616E6962206C2D
+.8byte 0xA73257D2079
+.8byte 0x23232323203A7325
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0xA23232323
+.8byte 0x2D756C25203A7325
+.8byte 0x7420732520746962
+.8byte 0x6974616E696D7265
+.8byte 0x622D756C2520676E
+.8byte 0x2D43534952207469
+.8byte 0x7972616E69622055
+.8byte 0x6874697720732520
+.8byte 0x6F63207469786520
+.8byte 0xA646C25206564
+.8byte 0x3C3C3C203A73250A
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C3C
+.8byte 0x3E3E3E203A73250A
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA0A3E3E3E3E3E
+.8byte 0x656420646E61202C
+.8byte 0x726567677562
+.8byte 0x657220646E61202C
+.8byte 0x79616C70
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x2D756C25203A7325
+.8byte 0x6520732520746962
+.8byte 0x676E697475636578
+.8byte 0x7469622D756C2520
+.8byte 0x20552D4353495220
+.8byte 0x25207972616E6962
+.8byte 0x2520687469772073
+.8byte 0x79687020424D756C
+.8byte 0x656D206C61636973
+.8byte 0x79726F6D
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x65676170203A7325
+.8byte 0x6120746C75616620
+.8byte 0x20586C2578302074
+.8byte 0x7020666F2074756F
+.8byte 0x206C616369737968
+.8byte 0xA79726F6D656D
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x7325203E7325
+.8byte 0x73252E73257325
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0xA732520747865
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x7263207325207478
+.8byte 0x6863206465746165
+.8byte 0x746E6F6320646C69
+.8byte 0xA732520747865
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6C6C616373797320
+.8byte 0x7020756C25202C73
+.8byte 0x6C75616620656761
+.8byte 0x20756C25202C7374
+.8byte 0x6E692072656D6974
+.8byte 0x7374707572726574
+.8byte 0xA
+.8byte 0x766520656E6F202C
+.8byte 0x20756C2520797265
+.8byte 0x6465747563657865
+.8byte 0x63757274736E6920
+.8byte 0x736E6F6974
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x2079622064656C
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x252E756C25282073
+.8byte 0x6F20424D756C322E
+.8byte 0x2E252E756C252072
+.8byte 0x6361202525756C32
+.8byte 0x6120796C6C617574
+.8byte 0x2964657373656363
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424B756C322E252E
+.8byte 0x7473206B61657020
+.8byte 0x657A6973206B6361
+.8byte 0xA
+.8byte 0x746E6F63203A7325
+.8byte 0xA7325203A747865
+.8byte 0x0
+.8byte 0x6C322E252E756C25
+.8byte 0x7070616D20424D75
+.8byte 0x726F6D656D206465
+.8byte 0x252E756C255B2079
+.8byte 0x6F202525756C322E
+.8byte 0x20424D756C252066
+.8byte 0x6C61636973796870
+.8byte 0x5D79726F6D656D20
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x2020202020
+.8byte 0x6365786520756C25
+.8byte 0x736E692064657475
+.8byte 0x6E6F697463757274
+.8byte 0x746F74206E692073
+.8byte 0x2E756C255B206C61
+.8byte 0x202525756C322E25
+.8byte 0xA5D73706F6E
+.8byte 0x6D6D7573203A7325
+.8byte 0x203A797261
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x252079622064656C
+.8byte 0x7274736E6920756C
+.8byte 0x20736E6F69746375
+.8byte 0x6C255B2068636165
+.8byte 0x25756C322E252E75
+.8byte 0x65687265766F2025
+.8byte 0x74636166202C6461
+.8byte 0x252E756C2520726F
+.8byte 0xA5D756C322E
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x7261687320252575
+.8byte 0x6F74636166202C65
+.8byte 0x2E252E756C252072
+.8byte 0xA5D756C32
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x2925
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x637865203A73250A
+.8byte 0x74206E6F69747065
+.8byte 0x6465726567676972
+.8byte 0x74736E6920796220
+.8byte 0x206E6F6974637572
+.8byte 0x72616E6962206E69
+.8byte 0x2079
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x78652073776F7268
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x20
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x207469622D756C25
+.8byte 0x6920552D43534952
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x2065747962342E
+.8byte 0x2065747962382E
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x5D586C2578305B
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x6C2578305B6D656D
+.8byte 0x646C253D3D5D58
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x58
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x736920586C257830
+.8byte 0x64696C61766E6920
+.8byte 0x0
+.8byte 0x736920586C257830
+.8byte 0x6765732D6C6C6920
+.8byte 0x28206465746E656D
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x29746C
+.8byte 0x736920586C257830
+.8byte 0x657070616D6E7520
+.8byte 0x2065676170282064
+.8byte 0x29746C756166
+.8byte 0x6C2578305B6D656D
+.8byte 0x20646C253D3D5D58
+.8byte 0x202D7C
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x202D7C2058
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x6E617274203A7325
+.8byte 0x3A676E6974616C73
+.8byte 0x3A7264646176200A
+.8byte 0x586C383025783020
+.8byte 0x203A65676170200A
+.8byte 0xA586C3430257830
+.8byte 0x203A656D61726620
+.8byte 0xA586C3830257830
+.8byte 0x203A726464617020
+.8byte 0xA586C3830257830
+.8byte 0x0
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x726620676E696863
+.8byte 0x65746E6F63206D6F
+.8byte 0x6F74207325207478
+.8byte 0x747865746E6F6320
+.8byte 0x732520
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C616D
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x69727473203A7325
+.8byte 0x6F7420736920676E
+.8byte 0x6120676E6F6C206F
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0xA64696C61766E
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x7520736920586C38
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x6420646E61206461
+.8byte 0x69622065646F6365
+.8byte 0x6F7266207972616E
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x20756C2520646E61
+.8byte 0x666F207365747962
+.8byte 0x6F6C206174616420
+.8byte 0x6F72662064656461
+.8byte 0xA7325206D
+.8byte 0x6574796220756C25
+.8byte 0x756C2520666F2073
+.8byte 0x534952207469622D
+.8byte 0x65646F6320562D43
+.8byte 0x20
+.8byte 0x2D756C2520756C25
+.8byte 0x4353495220746962
+.8byte 0x7274736E6920552D
+.8byte 0x20736E6F69746375
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x206874
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x2520756C25206874
+.8byte 0x52207469622D756C
+.8byte 0x6E6920552D435349
+.8byte 0x6F69746375727473
+.8byte 0x2520646E6120736E
+.8byte 0x736574796220756C
+.8byte 0x6174616420666F20
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x5D252573706F6E5B
+.8byte 0x0
+.8byte 0x666F7270203A7325
+.8byte 0x736E69203A656C69
+.8byte 0x6E6F697463757274
+.8byte 0x286C61746F74203A
+.8byte 0x2925256F69746172
+.8byte 0x0
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x6E6964616572203A
+.8byte 0x706172776E752067
+.8byte 0x756C617620646570
+.8byte 0x72206D6F72662065
+.8byte 0x2072657473696765
+.8byte 0x0
+.8byte 0x71696E75203A7325
+.8byte 0x6920676962206575
+.8byte 0x3A7372656765746E
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x71696E75203A7325
+.8byte 0x6E69727473206575
+.8byte 0x61726574696C2067
+.8byte 0x28756C25203A736C
+.8byte 0xA29756C25
+.8byte 0x626F6C67203A7325
+.8byte 0x6169726176206C61
+.8byte 0x2020203A73656C62
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x666F7270203A7325
+.8byte 0x746164203A656C69
+.8byte 0x6C61746F74203A61
+.8byte 0xA29736574796228
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x6E6120736E6F6974
+.8byte 0x796220756C252064
+.8byte 0x6420666F20736574
+.8byte 0xA617461
+.8byte 0x76767676203A7325
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0xA76767676
+.8byte 0x20756C25203A7325
+.8byte 0x74206C6F626D7973
+.8byte 0x6F6F6C20656C6261
+.8byte 0x206E69207370756B
+.8byte 0x7265746920756C25
+.8byte 0x6F20736E6F697461
+.8byte 0x676172657661206E
+.8byte 0xA65
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x20732520796C6E6F
+.8byte 0x65746172656E6567
+.8byte 0xA64
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x656D6E6769737361
+.8byte 0x756C25202C73746E
+.8byte 0x202C656C69687720
+.8byte 0x202C666920756C25
+.8byte 0x6C6C616320756C25
+.8byte 0x7220756C25202C73
+.8byte 0xA6E72757465
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x622D756C25206F74
+.8byte 0x2D43534952207469
+.8byte 0x2520687469772055
+.8byte 0x73207469622D756C
+.8byte 0xA63726174
+.8byte 0x2B2B2B2B203A7325
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0xA2B2B2B2B
+.8byte 0x736E69746C697562
+.8byte 0x0
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x61762D6E6F6E206E
+.8byte 0x7020636964616972
+.8byte 0x6572756465636F72
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x2D6E6F6E206E6920
+.8byte 0x6369646169726176
+.8byte 0x756465636F727020
+.8byte 0x6572
+.8byte 0x6E65726566666964
+.8byte 0x7265626D756E2074
+.8byte 0x7574636120666F20
+.8byte 0x6620646E61206C61
+.8byte 0x6170206C616D726F
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6361207265776566
+.8byte 0x616874206C617574
+.8byte 0x6C616D726F66206E
+.8byte 0x74656D6172617020
+.8byte 0x737265
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x796E616D206F6F74
+.8byte 0x206C616D726F6620
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x796E616D206F6F74
+.8byte 0x76206C61636F6C20
+.8byte 0x73656C6261697261
+.8byte 0x0
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x636F6C6C617A
+.8byte 0x66746E69727064
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270645F
+.8byte 0x0
+.8byte 0x66746E69727073
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270735F
+.8byte 0x0
+.8byte 0x66746E697270
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E6972705F
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x656D616E5F6F6E
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x6365707865207325
+.8byte 0x2074756220646574
+.8byte 0x646E756F66207325
+.8byte 0xA
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x6220746567726174
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x617420666F207475
+.8byte 0x756F622074656772
+.8byte 0x646E
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x646E756F62
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x22732522
+.8byte 0x27632527
+.8byte 0x6761697272616327
+.8byte 0x6E72757465722065
+.8byte 0x27
+.8byte 0x656620656E696C27
+.8byte 0x276465
+.8byte 0x74616C7562617427
+.8byte 0x27726F
+.8byte 0x20666F20646E6527
+.8byte 0x27656C6966
+.8byte 0xA
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x7325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x6C255E32203A7325
+.8byte 0x6C667265766F2075
+.8byte 0xA776F
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x72657478696D
+.8byte 0x72657473626F6D
+.8byte 0x726574736E696D
+.8byte 0x72657473707968
+.8byte 0x7265747370696D
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x8
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x21
+.8byte 0x2072656765746E69
+.8byte 0x776F6C667265766F
+.8byte 0x0
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x186A0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x4
+.8byte 0x6
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x2
+.8byte 0x0
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x1000
+.8byte 0xFFFFFFFF
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x191
+.8byte 0x0
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x6
+.8byte 0x5
+.8byte 0x1
+.8byte 0x10000
+.8byte 0x10000
+.8byte 0x80000
+.8byte 0x100000
+.8byte 0x1
+.8byte 0x2
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x0
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x7
+.8byte 0x20
+.8byte 0x706D75625F
+.8byte 0x6E69616D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x666F657A6973
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x0
+.8byte 0x21
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x8
+.8byte 0x8
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x40
+.8byte 0x1
+.8byte 0x1
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
@@ -494,6 +494,7 @@ uint64_t number_of_scanned_symbols    = 0;
 uint64_t number_of_syntax_errors = 0; // the number of encountered syntax errors
 
 char* identifier = (char*) 0; // stores scanned identifier as string
+char* identifier_buffer = (char*) 0; // buffer for scanning identifiers of any length
 char* integer    = (char*) 0; // stores scanned integer as string
 char* string     = (char*) 0; // stores scanned string
 
@@ -511,6 +512,9 @@ uint64_t source_fd   = 0; // file descriptor of open source file
 void init_scanner () {
   SYMBOLS = smalloc((SYM_CONST + 1) * sizeof(uint64_t*));
 
+  // accommodate identifier and null for termination
+  identifier_buffer = string_alloc(MAX_IDENTIFIER_LENGTH);
+
   *(SYMBOLS + SYM_INTEGER)      = (uint64_t) "integer";
   *(SYMBOLS + SYM_CHARACTER)    = (uint64_t) "character";
   *(SYMBOLS + SYM_STRING)       = (uint64_t) "string";
@@ -1129,6 +1133,8 @@ uint64_t MAX_DATA_SIZE = 65536;  // 64KB
 
 uint64_t PK_CODE_START = 65536; // start of code segment at 0x10000 (according to RISC-V pk)
 
+uint64_t* ELF_file_buffer = (uint64_t*) 0; // memory for loading binaries, reused since each load replaces the previous binary
+
 uint64_t PT_LOAD = 1; // loadable segment
 uint64_t PF_RX   = 5; // readable and executable segment
 uint64_t PF_RW   = 6; // readable and writable segment
@@ -1223,6 +1229,30 @@ uint64_t  data_size   = 0;             // size of data binary in bytes
 uint64_t* code_line_number = (uint64_t*) 0; // code line number per emitted instruction
 uint64_t* data_line_number = (uint64_t*) 0; // data line number per emitted data word
 
+uint64_t* source_files = (uint64_t*) 0; // code range of each compiled source file, last one first
+
+// source file entry:
+// +---+------------+
+// | 0 | next       | pointer to source file compiled before
+// | 1 | name       | name of source file
+// | 2 | code start | offset of first instruction compiled from source file
+// | 3 | code end   | offset right after last instruction compiled from source file
+// +---+------------+
+
+uint64_t* allocate_source_file() {
+  return smalloc(2 * sizeof(uint64_t*) + 2 * sizeof(uint64_t));
+}
+
+uint64_t* get_next_source_file(uint64_t* file)  { return (uint64_t*) *file; }
+char*     get_source_name(uint64_t* file)       { return (char*)     *(file + 1); }
+uint64_t  get_source_code_start(uint64_t* file) { return             *(file + 2); }
+uint64_t  get_source_code_end(uint64_t* file)   { return             *(file + 3); }
+
+void set_next_source_file(uint64_t* file, uint64_t* next)  { *file       = (uint64_t) next; }
+void set_source_name(uint64_t* file, char* name)           { *(file + 1) = (uint64_t) name; }
+void set_source_code_start(uint64_t* file, uint64_t start) { *(file + 2) = start; }
+void set_source_code_end(uint64_t* file, uint64_t end)     { *(file + 3) = end; }
+
 // ------------------------- INITIALIZATION ------------------------
 
 void reset_binary() {
@@ -1236,6 +1266,8 @@ void reset_binary() {
 
   code_line_number = (uint64_t*) 0;
   data_line_number = (uint64_t*) 0;
+
+  source_files = (uint64_t*) 0;
 }
 
 void reset_binary_counters() {
@@ -1284,6 +1316,8 @@ void     implement_brk(uint64_t* context);
 
 uint64_t is_boot_level_zero();
 
+void print_syscall_io_profile(char* syscall_name, uint64_t calls, uint64_t bytes);
+
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 uint64_t debug_read  = 0;
@@ -1308,6 +1342,15 @@ uint64_t DIRFD_AT_FDCWD = -100;
 uint64_t* IO_buffer      = (uint64_t*) 0;
 uint64_t  IO_buffer_size = 0;
 
+// syscall I/O counters
+
+uint64_t sc_read_calls   = 0;
+uint64_t sc_read_bytes   = 0; // bytes moved from host into guest memory
+uint64_t sc_write_calls  = 0;
+uint64_t sc_write_bytes  = 0; // bytes moved from guest memory to host
+uint64_t sc_openat_calls = 0;
+uint64_t sc_openat_bytes = 0; // bytes of file names moved from guest memory to host
+
 // -----------------------------------------------------------------
 // ------------------------ HYPSTER SYSCALL ------------------------
 // -----------------------------------------------------------------
@@ -1337,63 +1380,115 @@ uint64_t debug_switch = 0;
 // -----------------------------------------------------------------
 
 // cache
-// +---+------------------+
-// | 0 | cache memory     | pointer to actual cache consisting of pointers to cache blocks
-// | 1 | cache size       | cache size in bytes
-// | 2 | associativity    | cache associativity
-// | 3 | cache-block size | cache-block size in bytes
-// | 4 | cache hits       | counter for cache hits
-// | 5 | cache misses     | counter for cache misses
-// | 6 | cache timer      | counter for LRU replacement strategy
-// +---+------------------+
+// +----+-------------------+
+// |  0 | cache memory      | pointer to actual cache consisting of pointers to cache blocks
+// |  1 | cache size        | cache size in bytes
+// |  2 | associativity     | cache associativity
+// |  3 | cache-block size  | cache-block size in bytes
+// |  4 | cache hits        | counter for cache hits
+// |  5 | cache misses      | counter for cache misses
+// |  6 | cache timer       | counter for LRU and FIFO replacement strategies
+// |  7 | shared hits       | counter for cache hits on blocks filled by another context
+// |  8 | cache level       | 1 for L1 caches, 2 for L2 cache, 3 for L3 cache
+// |  9 | next level        | pointer to next-level cache (null if next level is memory)
+// | 10 | set states        | pointer to replacement state of each set
+// | 11 | write-throughs    | counter for stores written through to next level
+// | 12 | write-backs       | counter for dirty blocks written back to next level
+// | 13 | prefetches        | counter for prefetched cache blocks
+// | 14 | useful prefetches | counter for prefetched cache blocks accessed before eviction
+// | 15 | last miss         | virtual address of last cache miss (stride prefetcher)
+// | 16 | last stride       | distance between last two cache misses (stride prefetcher)
+// +----+-------------------+
 
 uint64_t* allocate_cache() {
-  return smalloc(1 * sizeof(uint64_t*) + 6 * sizeof(uint64_t));
-}
-
-uint64_t* get_cache_memory(uint64_t* cache)     { return (uint64_t*) *cache; }
-uint64_t  get_cache_size(uint64_t* cache)       { return             *(cache + 1); }
-uint64_t  get_associativity(uint64_t* cache)    { return             *(cache + 2); }
-uint64_t  get_cache_block_size(uint64_t* cache) { return             *(cache + 3); }
-uint64_t  get_cache_hits(uint64_t* cache)       { return             *(cache + 4); }
-uint64_t  get_cache_misses(uint64_t* cache)     { return             *(cache + 5); }
-uint64_t  get_cache_timer(uint64_t* cache)      { return             *(cache + 6); }
-
-void set_cache_memory(uint64_t* cache, uint64_t* cache_memory)        { *cache       = (uint64_t) cache_memory; }
-void set_cache_size(uint64_t* cache, uint64_t cache_size)             { *(cache + 1) = cache_size; }
-void set_associativity(uint64_t* cache, uint64_t associativity)       { *(cache + 2) = associativity; }
-void set_cache_block_size(uint64_t* cache, uint64_t cache_block_size) { *(cache + 3) = cache_block_size; }
-void set_cache_hits(uint64_t* cache, uint64_t cache_hits)             { *(cache + 4) = cache_hits; }
-void set_cache_misses(uint64_t* cache, uint64_t cache_misses)         { *(cache + 5) = cache_misses; }
-void set_cache_timer(uint64_t* cache, uint64_t cache_timer)           { *(cache + 6) = cache_timer; }
+  return smalloc(3 * sizeof(uint64_t*) + 14 * sizeof(uint64_t));
+}
+
+uint64_t* get_cache_memory(uint64_t* cache)      { return (uint64_t*) *cache; }
+uint64_t  get_cache_size(uint64_t* cache)        { return             *(cache + 1); }
+uint64_t  get_associativity(uint64_t* cache)     { return             *(cache + 2); }
+uint64_t  get_cache_block_size(uint64_t* cache)  { return             *(cache + 3); }
+uint64_t  get_cache_hits(uint64_t* cache)        { return             *(cache + 4); }
+uint64_t  get_cache_misses(uint64_t* cache)      { return             *(cache + 5); }
+uint64_t  get_cache_timer(uint64_t* cache)       { return             *(cache + 6); }
+uint64_t  get_shared_hits(uint64_t* cache)       { return             *(cache + 7); }
+uint64_t  get_cache_level(uint64_t* cache)       { return             *(cache + 8); }
+uint64_t* get_next_level(uint64_t* cache)        { return (uint64_t*) *(cache + 9); }
+uint64_t* get_set_states(uint64_t* cache)        { return (uint64_t*) *(cache + 10); }
+uint64_t  get_write_throughs(uint64_t* cache)    { return             *(cache + 11); }
+uint64_t  get_write_backs(uint64_t* cache)       { return             *(cache + 12); }
+uint64_t  get_prefetches(uint64_t* cache)        { return             *(cache + 13); }
+uint64_t  get_useful_prefetches(uint64_t* cache) { return             *(cache + 14); }
+uint64_t  get_last_miss(uint64_t* cache)         { return             *(cache + 15); }
+uint64_t  get_last_stride(uint64_t* cache)       { return             *(cache + 16); }
+
+void set_cache_memory(uint64_t* cache, uint64_t* cache_memory)        { *cache        = (uint64_t) cache_memory; }
+void set_cache_size(uint64_t* cache, uint64_t cache_size)             { *(cache + 1)  = cache_size; }
+void set_associativity(uint64_t* cache, uint64_t associativity)       { *(cache + 2)  = associativity; }
+void set_cache_block_size(uint64_t* cache, uint64_t cache_block_size) { *(cache + 3)  = cache_block_size; }
+void set_cache_hits(uint64_t* cache, uint64_t cache_hits)             { *(cache + 4)  = cache_hits; }
+void set_cache_misses(uint64_t* cache, uint64_t cache_misses)         { *(cache + 5)  = cache_misses; }
+void set_cache_timer(uint64_t* cache, uint64_t cache_timer)           { *(cache + 6)  = cache_timer; }
+void set_shared_hits(uint64_t* cache, uint64_t shared_hits)           { *(cache + 7)  = shared_hits; }
+void set_cache_level(uint64_t* cache, uint64_t level)                 { *(cache + 8)  = level; }
+void set_next_level(uint64_t* cache, uint64_t* next_level)            { *(cache + 9)  = (uint64_t) next_level; }
+void set_set_states(uint64_t* cache, uint64_t* set_states)            { *(cache + 10) = (uint64_t) set_states; }
+void set_write_throughs(uint64_t* cache, uint64_t write_throughs)     { *(cache + 11) = write_throughs; }
+void set_write_backs(uint64_t* cache, uint64_t write_backs)           { *(cache + 12) = write_backs; }
+void set_prefetches(uint64_t* cache, uint64_t prefetches)             { *(cache + 13) = prefetches; }
+void set_useful_prefetches(uint64_t* cache, uint64_t prefetches)      { *(cache + 14) = prefetches; }
+void set_last_miss(uint64_t* cache, uint64_t vaddr)                   { *(cache + 15) = vaddr; }
+void set_last_stride(uint64_t* cache, uint64_t stride)                { *(cache + 16) = stride; }
 
 // cache block
 // +---+------------+
 // | 0 | valid flag | valid block or not
 // | 1 | tag        | unique identifier within a set
-// | 2 | memory     | pointer to cache-block memory
+// | 2 | memory     | pointer to cache-block memory (null in L2 and L3 caches)
 // | 3 | timestamp  | timestamp for replacement strategy
+// | 4 | asid       | identifier of context that filled the block
+// | 5 | address    | physical address of block
+// | 6 | dirty flag | block modified but not yet written back or not
+// | 7 | prefetched | block prefetched but not yet accessed or not
 // +---+------------+
 
 uint64_t* allocate_cache_block() {
-  return zmalloc(1 * sizeof(uint64_t*) + 3 * sizeof(uint64_t));
+  return zmalloc(1 * sizeof(uint64_t*) + 7 * sizeof(uint64_t));
 }
 
-uint64_t  get_valid_flag(uint64_t* cache_block)   { return             *cache_block; }
-uint64_t  get_tag(uint64_t* cache_block)          { return             *(cache_block + 1); }
-uint64_t* get_block_memory(uint64_t* cache_block) { return (uint64_t*) *(cache_block + 2); }
-uint64_t  get_timestamp(uint64_t* cache_block)    { return             *(cache_block + 3); }
+uint64_t  get_valid_flag(uint64_t* cache_block)      { return             *cache_block; }
+uint64_t  get_tag(uint64_t* cache_block)             { return             *(cache_block + 1); }
+uint64_t* get_block_memory(uint64_t* cache_block)    { return (uint64_t*) *(cache_block + 2); }
+uint64_t  get_timestamp(uint64_t* cache_block)       { return             *(cache_block + 3); }
+uint64_t  get_asid(uint64_t* cache_block)            { return             *(cache_block + 4); }
+uint64_t  get_block_address(uint64_t* cache_block)   { return             *(cache_block + 5); }
+uint64_t  get_dirty_flag(uint64_t* cache_block)      { return             *(cache_block + 6); }
+uint64_t  get_prefetched_flag(uint64_t* cache_block) { return             *(cache_block + 7); }
+
+void set_valid_flag(uint64_t* cache_block, uint64_t valid)           { *cache_block       = valid; }
+void set_tag(uint64_t* cache_block, uint64_t tag)                    { *(cache_block + 1) = tag; }
+void set_block_memory(uint64_t* cache_block, uint64_t* memory)       { *(cache_block + 2) = (uint64_t) memory; }
+void set_timestamp(uint64_t* cache_block, uint64_t timestamp)        { *(cache_block + 3) = timestamp; }
+void set_asid(uint64_t* cache_block, uint64_t asid)                  { *(cache_block + 4) = asid; }
+void set_block_address(uint64_t* cache_block, uint64_t paddr)        { *(cache_block + 5) = paddr; }
+void set_dirty_flag(uint64_t* cache_block, uint64_t dirty)           { *(cache_block + 6) = dirty; }
+void set_prefetched_flag(uint64_t* cache_block, uint64_t prefetched) { *(cache_block + 7) = prefetched; }
+
+// set state
+// +---+-----------+
+// | 0 | MRU way   | most recently used way, looked up first
+// | 1 | PLRU tree | associativity - 1 nodes of the tree-PLRU binary tree
+// +---+-----------+
+
+void init_caches();
 
-void set_valid_flag(uint64_t* cache_block, uint64_t valid)     { *cache_block       = valid; }
-void set_tag(uint64_t* cache_block, uint64_t tag)              { *(cache_block + 1) = tag; }
-void set_block_memory(uint64_t* cache_block, uint64_t* memory) { *(cache_block + 2) = (uint64_t) memory; }
-void set_timestamp(uint64_t* cache_block, uint64_t timestamp)  { *(cache_block + 3) = timestamp; }
+uint64_t select_policy(char* name, uint64_t* policies, uint64_t number_of_policies);
 
 void reset_cache_counters(uint64_t* cache);
 void reset_all_cache_counters();
 
 void init_cache_memory(uint64_t* cache);
-void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size);
+void init_cache(uint64_t* cache, uint64_t level, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size);
 void init_all_caches();
 
 void flush_cache(uint64_t* cache);
@@ -1408,12 +1503,29 @@ uint64_t cache_byte_offset(uint64_t* cache, uint64_t address);
 
 uint64_t* cache_set(uint64_t* cache, uint64_t vaddr);
 
-uint64_t  get_new_timestamp(uint64_t* cache);
+uint64_t get_new_timestamp(uint64_t* cache);
+uint64_t cache_random();
+
+void     update_plru_tree(uint64_t* state, uint64_t associativity, uint64_t way);
+uint64_t plru_victim(uint64_t* state, uint64_t associativity);
+uint64_t find_victim(uint64_t* cache, uint64_t* set, uint64_t* state);
+
+uint64_t  is_cache_hit(uint64_t* cache_block, uint64_t tag);
+uint64_t  find_way(uint64_t* cache, uint64_t* set, uint64_t tag);
 uint64_t* cache_lookup(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access);
 
 void      fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
-uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr, uint64_t is_access);
-uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access);
+uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
+uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
+
+void access_next_level(uint64_t* cache, uint64_t paddr, uint64_t is_store);
+void access_cache(uint64_t* cache, uint64_t paddr, uint64_t is_store);
+void write_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
+
+void prefetch_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
+
+uint64_t invalidate_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
+void     invalidate_cached_word(uint64_t vaddr, uint64_t paddr);
 
 void     flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
 uint64_t load_from_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
@@ -1424,12 +1536,27 @@ uint64_t load_data_from_cache(uint64_t vaddr, uint64_t paddr);
 void     store_data_in_cache(uint64_t vaddr, uint64_t paddr, uint64_t data);
 
 void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name);
+void print_cache_writes(uint64_t* cache, char* cache_name);
+void print_cache_prefetches(uint64_t* cache, char* cache_name);
+void print_all_cache_profiles();
+
+void start_trace();
+void flush_trace_buffer();
+void trace_byte(uint64_t b);
+void trace_number(uint64_t n);
+void trace_run(uint64_t cache);
+void trace_access(uint64_t cache, uint64_t vaddr);
+void stop_trace();
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 // indicates whether the machine has a cache or not
 uint64_t L1_CACHE_ENABLED = 0;
 
+// number of cache levels: split L1 instruction and data caches,
+// optionally followed by a unified L2 cache and a shared L3 cache
+uint64_t CACHE_LEVELS = 1;
+
 // machine-enforced coherency for self-modifying code (selfie also
 // works if this is turned off since there is no code modification
 // during runtime and stores in the code segment are illegal)
@@ -1466,13 +1593,104 @@ uint64_t L1_ICACHE_ASSOCIATIVITY = 4;
 uint64_t L1_DCACHE_BLOCK_SIZE = 16; // in bytes
 uint64_t L1_ICACHE_BLOCK_SIZE = 16; // in bytes
 
-// pointers to VIPT n-way set-associative write-through L1-caches
+// L2 and L3 caches are physically indexed and only keep tags
+// assert: L2_CACHE_BLOCK_SIZE >= L1_xCACHE_BLOCK_SIZE
+// assert: L3_CACHE_BLOCK_SIZE >= L2_CACHE_BLOCK_SIZE
+uint64_t L2_CACHE_SIZE = 262144;  // 256 KB unified cache
+uint64_t L3_CACHE_SIZE = 2097152; // 2 MB shared cache
+
+uint64_t L2_CACHE_ASSOCIATIVITY = 8;
+uint64_t L3_CACHE_ASSOCIATIVITY = 16;
+
+uint64_t L2_CACHE_BLOCK_SIZE = 64; // in bytes
+uint64_t L3_CACHE_BLOCK_SIZE = 64; // in bytes
+
+// replacement policies
+uint64_t REPLACE_LRU    = 0; // true least-recently used
+uint64_t REPLACE_PLRU   = 1; // tree-based pseudo least-recently used
+uint64_t REPLACE_FIFO   = 2; // first in, first out
+uint64_t REPLACE_RANDOM = 3; // pseudo-random
+
+uint64_t* REPLACEMENT_POLICIES; // named replacement policies
+
+// write policies (memory is always kept up to date since the
+// kernel accesses memory directly, write-back only affects
+// how writes to the next level are accounted for)
+uint64_t WRITE_THROUGH = 0;
+uint64_t WRITE_BACK    = 1;
+
+uint64_t* WRITE_POLICIES; // named write policies
+
+// prefetchers (L1 caches only, never across page boundaries)
+uint64_t PREFETCH_NONE      = 0;
+uint64_t PREFETCH_NEXT_LINE = 1; // block following missed block
+uint64_t PREFETCH_STRIDE    = 2; // block at same distance as last two misses
+
+uint64_t* PREFETCHERS; // named prefetchers
+
+uint64_t CACHE_REPLACEMENT  = 0; // REPLACE_LRU
+uint64_t CACHE_WRITE_POLICY = 0; // WRITE_THROUGH
+uint64_t CACHE_PREFETCHER   = 0; // PREFETCH_NONE
+
+// pointers to VIPT n-way set-associative L1-caches
 uint64_t* L1_ICACHE;
 uint64_t* L1_DCACHE;
 
+// pointers to PIPT n-way set-associative L2 and L3 caches
+uint64_t* L2_CACHE;
+uint64_t* L3_CACHE;
+
+// memory access trace header
+// +---+------------+
+// | 0 | magic      | TRACEMAGIC identifying memory access traces
+// | 1 | block size | TRACEBLOCKSIZE of traced virtual addresses
+// +---+------------+
+// followed by runs of accesses to the same block by the same cache,
+// each encoded as two variable-length numbers (7 bits per byte, least
+// significant bits first, highest bit set if more bytes follow):
+// 1. block distance to previous run of same cache in zigzag encoding,
+//    times 2 plus TRACE_INSTRUCTION or TRACE_DATA
+// 2. number of accesses in run minus 1
+// (runs of instruction and data cache are only ordered per cache)
+
+uint64_t TRACEHEADERENTRIES = 2;
+
+uint64_t TRACEMAGIC = 1667330676; // "trac" in little-endian ASCII
+
+uint64_t TRACEBLOCKSIZE  = 16;    // in bytes, smallest simulated cache-block size
+uint64_t TRACEBUFFERSIZE = 65536; // in bytes
+
+uint64_t TRACE_INSTRUCTION = 0;
+uint64_t TRACE_DATA        = 1;
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
+// address-space identifier of the context currently using the caches
+// (cache blocks are physically tagged and thus remain valid across
+// context switches, the ASID only attributes blocks to contexts)
+uint64_t L1_asid = 0;
+
 uint64_t L1_icache_coherency_invalidations = 0;
+uint64_t L1_kernel_invalidations           = 0;
+
+uint64_t cache_random_state = 0; // state of pseudo-random replacement
+
+char* trace_name = (char*) 0; // trace file for memory accesses
+
+uint64_t tracing  = 0; // flag for tracing memory accesses
+uint64_t trace_fd = 0;
+
+uint64_t* trace_buffer       = (uint64_t*) 0; // buffer of TRACEBUFFERSIZE bytes
+uint64_t  trace_buffer_bytes = 0;             // number of bytes in buffer
+
+// per cache: block and number of accesses of current run, block of previous run
+uint64_t* trace_blocks   = (uint64_t*) 0;
+uint64_t* trace_counts   = (uint64_t*) 0;
+uint64_t* trace_previous = (uint64_t*) 0;
+
+uint64_t trace_accesses = 0;
+uint64_t trace_runs     = 0;
+uint64_t trace_bytes    = 0;
 
 // -----------------------------------------------------------------
 // ---------------------------- MEMORY -----------------------------
@@ -1488,8 +1706,13 @@ uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page
 
 uint64_t get_page_frame(uint64_t* table, uint64_t page);
 uint64_t is_page_mapped(uint64_t* table, uint64_t page);
+uint64_t next_mapped_page(uint64_t* table, uint64_t page);
 void     set_page_frame(uint64_t* table, uint64_t page, uint64_t frame);
 
+uint64_t* tlb_entry(uint64_t page);
+void      flush_tlb(uint64_t* table);
+void      flush_tlb_entry(uint64_t* table, uint64_t page);
+
 uint64_t page_of_virtual_address(uint64_t vaddr);
 uint64_t virtual_address_of_page(uint64_t page);
 
@@ -1501,6 +1724,8 @@ uint64_t* translate_virtual_to_physical(uint64_t* table, uint64_t vaddr);
 uint64_t load_virtual_memory(uint64_t* table, uint64_t vaddr);
 void     store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
 
+void copy_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t* buffer, uint64_t words, uint64_t upload);
+
 uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr);
 void     store_cached_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
 
@@ -1528,6 +1753,23 @@ uint64_t PAGETABLETREE = 1; // two-level page table is default
 uint64_t PHYSICALMEMORYSIZE   = 0; // total amount of physical memory available for page frames
 uint64_t PHYSICALMEMORYEXCESS = 2; // tolerate more allocation than physically available
 
+// number of entries in direct-mapped translation lookaside buffer (TLB)
+uint64_t TLBSIZE = 256;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// TLB entry
+// +---+-------+
+// | 0 | page  | virtual page number
+// | 1 | frame | page frame of page, 0 if entry is invalid
+// +---+-------+
+
+uint64_t* tlb       = (uint64_t*) 0; // TLBSIZE entries caching page frames
+uint64_t* tlb_table = (uint64_t*) 0; // page table whose translations are cached in TLB
+
+uint64_t tlb_hits   = 0;
+uint64_t tlb_misses = 0;
+
 // ------------------------- INITIALIZATION ------------------------
 
 void init_memory(uint64_t megabytes) {
@@ -1718,24 +1960,136 @@ void print_register_value(uint64_t reg);
 uint64_t is_valid_segment_read(uint64_t vaddr);
 uint64_t is_valid_segment_write(uint64_t vaddr);
 
+uint64_t is_virtual_address_writable(uint64_t vaddr);
+
 void print_exception(uint64_t exception, uint64_t fault);
 void throw_exception(uint64_t exception, uint64_t fault);
 
+// decoded instruction
+// +---+----------------+
+// | 0 | instruction id | RISC-U instruction id, 0 if not yet decoded
+// | 1 | instruction    | encoded instruction
+// | 2 | rd             | destination register
+// | 3 | rs1            | first source register
+// | 4 | rs2            | second source register
+// | 5 | imm            | immediate value
+// | 6 | block length   | number of instructions of translated basic block starting here, 0 if untranslated
+// +---+----------------+
+
+// number of entries of a decoded instruction
+uint64_t DECODEDENTRIES = 7;
+
+uint64_t get_decoded_is(uint64_t* instruction)  { return *instruction; }
+uint64_t get_decoded_ir(uint64_t* instruction)  { return *(instruction + 1); }
+uint64_t get_decoded_rd(uint64_t* instruction)  { return *(instruction + 2); }
+uint64_t get_decoded_rs1(uint64_t* instruction) { return *(instruction + 3); }
+uint64_t get_decoded_rs2(uint64_t* instruction) { return *(instruction + 4); }
+uint64_t get_decoded_imm(uint64_t* instruction) { return *(instruction + 5); }
+
+uint64_t get_decoded_block_length(uint64_t* instruction) { return *(instruction + 6); }
+
+void set_decoded_is(uint64_t* instruction, uint64_t is)   { *instruction       = is; }
+void set_decoded_ir(uint64_t* instruction, uint64_t ir)   { *(instruction + 1) = ir; }
+void set_decoded_rd(uint64_t* instruction, uint64_t rd)   { *(instruction + 2) = rd; }
+void set_decoded_rs1(uint64_t* instruction, uint64_t rs1) { *(instruction + 3) = rs1; }
+void set_decoded_rs2(uint64_t* instruction, uint64_t rs2) { *(instruction + 4) = rs2; }
+void set_decoded_imm(uint64_t* instruction, uint64_t imm) { *(instruction + 5) = imm; }
+
+void set_decoded_block_length(uint64_t* instruction, uint64_t length) { *(instruction + 6) = length; }
+
+uint64_t* decoded_instruction(uint64_t* context, uint64_t vaddr);
+uint64_t* decoded_instruction_at(uint64_t vaddr);
+void      invalidate_decoded_instructions(uint64_t* context, uint64_t vaddr, uint64_t size);
+void      invalidate_translated_blocks(uint64_t* context, uint64_t vaddr);
+
 void fetch();
 void decode();
 void execute();
 
+void fetch_and_decode();
+
 void execute_record();
 void execute_undo();
 void execute_debug();
 
+void execute_lean();
+
 void interrupt();
 
+uint64_t  is_block_terminator(uint64_t instruction_id);
+uint64_t* translated_block(uint64_t vaddr);
+void      execute_translated_block(uint64_t* block);
+
+void run_translated_until_exception();
+
+void     load_decoded_instructions();
+uint64_t is_batch_stopped();
+uint64_t run_batch(uint64_t budget);
+
 void run_until_exception();
 
-uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max);
-uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max);
-void     print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters);
+uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max, uint64_t opcode);
+uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max, uint64_t opcode);
+void     print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters, uint64_t opcode);
+
+// calling-context tree node
+// +---+----------------+
+// | 0 | parent         | pointer to node of caller, 0 for root node of context
+// | 1 | children       | pointer to first node of callees
+// | 2 | sibling        | pointer to next node of same caller, next root for root node
+// | 3 | name           | name of procedure or context, 0 if unknown
+// | 4 | procedure      | address of procedure
+// | 5 | return address | address to which active call returns
+// | 6 | samples        | number of samples taken while procedure is executing
+// +---+----------------+
+
+uint64_t* allocate_call_node() {
+  return smalloc(4 * sizeof(uint64_t*) + 3 * sizeof(uint64_t));
+}
+
+uint64_t* get_call_parent(uint64_t* node)    { return (uint64_t*) *node; }
+uint64_t* get_call_children(uint64_t* node)  { return (uint64_t*) *(node + 1); }
+uint64_t* get_call_sibling(uint64_t* node)   { return (uint64_t*) *(node + 2); }
+char*     get_call_name(uint64_t* node)      { return (char*)     *(node + 3); }
+uint64_t  get_call_procedure(uint64_t* node) { return             *(node + 4); }
+uint64_t  get_call_return(uint64_t* node)    { return             *(node + 5); }
+uint64_t  get_call_samples(uint64_t* node)   { return             *(node + 6); }
+
+void set_call_parent(uint64_t* node, uint64_t* parent)      { *node       = (uint64_t) parent; }
+void set_call_children(uint64_t* node, uint64_t* children)  { *(node + 1) = (uint64_t) children; }
+void set_call_sibling(uint64_t* node, uint64_t* sibling)    { *(node + 2) = (uint64_t) sibling; }
+void set_call_name(uint64_t* node, char* name)              { *(node + 3) = (uint64_t) name; }
+void set_call_procedure(uint64_t* node, uint64_t procedure) { *(node + 4) = procedure; }
+void set_call_return(uint64_t* node, uint64_t address)      { *(node + 5) = address; }
+void set_call_samples(uint64_t* node, uint64_t samples)     { *(node + 6) = samples; }
+
+uint64_t* create_call_node(uint64_t* parent, char* name, uint64_t procedure);
+uint64_t* create_call_root(uint64_t* context);
+
+void init_procedure_names();
+
+void sample_call_stack();
+void call_procedure(uint64_t procedure, uint64_t return_address);
+void return_from_procedure(uint64_t return_address);
+
+uint64_t print_call_path(uint64_t* node);
+uint64_t print_call_stacks(uint64_t* node);
+void     selfie_print_call_stacks();
+
+void count_per_instruction(uint64_t* counters, uint64_t address);
+void count_execution(uint64_t address);
+
+void flush_annotation_buffer();
+void annotate_byte(uint64_t b);
+void annotate_string(char* s);
+void annotate_counter(uint64_t n);
+void annotate_line(uint64_t line);
+
+void     profile_lines(uint64_t* source_file);
+uint64_t print_line_profile(char* name);
+void     annotate_source_file(uint64_t* source_file);
+void     annotate_source_files(uint64_t* source_file);
+void     selfie_annotate();
 
 void print_access_profile(char* message, char* padding, uint64_t reads, uint64_t writes);
 void print_per_register_profile(uint64_t reg);
@@ -1785,6 +2139,19 @@ uint64_t disassemble_verbose = 0; // flag for disassembling code in more detail
 uint64_t symbolic = 0; // flag for symbolically executing code
 uint64_t model    = 0; // flag for modeling code
 
+uint64_t translate = 0; // flag for executing translated basic blocks
+
+uint64_t lean = 0; // flag for executing code without profiling
+
+// execution loops, selected once per run
+
+uint64_t LOOP_PROFILE = 0; // profiling executed instructions
+uint64_t LOOP_LEAN    = 1; // only counting executed instructions
+uint64_t LOOP_CACHE   = 2; // profiling and simulating L1 caches
+uint64_t LOOP_DEBUG   = 3; // debugging or recording executed instructions
+
+uint64_t execution_loop = 0; // execution loop selected for current run
+
 // number of instructions from context switch to timer interrupt
 // CAUTION: interrupting kernel code may cause race conditions
 // TODO: implement proper interrupt controller to turn interrupts on and off
@@ -1810,6 +2177,10 @@ uint64_t* pt = (uint64_t*) 0; // page table
 uint64_t timer = 0; // counter for timer interrupt
 uint64_t trap  = 0; // flag for creating a trap
 
+// pre-decoded instructions of current context, allocated and filled lazily
+
+uint64_t* decoded_instructions = (uint64_t*) 0;
+
 // effective nop counters
 
 uint64_t nopc_lui   = 0;
@@ -1837,6 +2208,47 @@ uint64_t* iterations_per_loop = (uint64_t*) 0; // number of executed iterations
 uint64_t* loads_per_instruction  = (uint64_t*) 0; // number of executed loads per load instruction
 uint64_t* stores_per_instruction = (uint64_t*) 0; // number of executed stores per store instruction
 
+uint64_t* executions_per_instruction = (uint64_t*) 0; // number of executions per instruction, if annotating
+uint64_t* misses_per_instruction     = (uint64_t*) 0; // number of L1 cache misses per instruction, if annotating
+
+// call-graph profile
+
+char*    stacks_name   = (char*) 0; // file for collapsed call stacks
+uint64_t stacks_fd     = 0;         // file descriptor of open call stacks file
+uint64_t sample_period = 0;         // sample call stack every so many instructions
+
+uint64_t* call_roots = (uint64_t*) 0; // root nodes of calling-context trees of all contexts
+uint64_t* call_node  = (uint64_t*) 0; // node of executing procedure in current context
+
+uint64_t sampled_instructions = 0; // number of executed instructions when last sampled
+
+uint64_t* procedure_names = (uint64_t*) 0; // name of procedure per instruction, if known
+
+// source annotation
+
+uint64_t ANNOTATIONBUFFERSIZE = 4096; // bytes
+
+char*    annotate_name = (char*) 0; // file for per-line profile in JSON
+uint64_t annotate_fd   = 0;         // file descriptor of open per-line profile file
+uint64_t annotating    = 0;         // flag for counting executions and L1 misses per instruction
+
+char*    annotated_name  = (char*) 0; // name of annotated source file
+uint64_t annotated_fd    = 0;         // file descriptor of open annotated source file
+uint64_t annotated_bytes = 0;         // number of bytes written into annotated source file
+
+uint64_t annotated_files      = 0; // number of annotated source files
+uint64_t annotated_characters = 0; // number of characters written into per-line profile file
+
+uint64_t* annotation_buffer       = (uint64_t*) 0; // buffer for annotated source file
+uint64_t  annotation_buffer_bytes = 0;             // number of bytes in annotation buffer
+
+uint64_t  number_of_lines       = 0;             // number of lines of annotated source file
+uint64_t* instructions_per_line = (uint64_t*) 0; // number of instructions per source line
+uint64_t* executions_per_line   = (uint64_t*) 0; // max number of executions of instructions per source line
+uint64_t* loads_per_line        = (uint64_t*) 0; // number of executed loads per source line
+uint64_t* stores_per_line       = (uint64_t*) 0; // number of executed stores per source line
+uint64_t* misses_per_line       = (uint64_t*) 0; // number of L1 cache misses per source line
+
 // registers profile
 
 uint64_t* reads_per_register  = (uint64_t*) 0;
@@ -1891,6 +2303,8 @@ void reset_interpreter() {
   trap = 0;
 
   timer = TIMEROFF;
+
+  decoded_instructions = (uint64_t*) 0;
 }
 
 void reset_nop_counters() {
@@ -1910,20 +2324,49 @@ void reset_nop_counters() {
 }
 
 void reset_source_profile() {
-  calls               = 0;
-  calls_per_procedure = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+  calls      = 0;
+  iterations = 0;
 
-  iterations          = 0;
+  if (execution_loop == LOOP_LEAN)
+    // source is not profiled, saving memory in nested runs
+    return;
+
+  calls_per_procedure = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
   iterations_per_loop = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
 
-  loads_per_instruction  = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
-  stores_per_instruction = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+  loads_per_instruction = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+
+  if (code_binary != (uint64_t*) 0)
+    // no instruction both loads and stores, so loads and stores
+    // are counted in one array to save memory in nested runs
+    stores_per_instruction = loads_per_instruction;
+  else
+    stores_per_instruction = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+
+  if (annotate_name != (char*) 0) {
+    // only allocated if needed to save memory in nested runs
+    executions_per_instruction = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+    misses_per_instruction     = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
+  }
 }
 
 void reset_registers_profile() {
+  uint64_t i;
+
   reads_per_register  = zmalloc(NUMBEROFREGISTERS * sizeof(uint64_t));
   writes_per_register = zmalloc(NUMBEROFREGISTERS * sizeof(uint64_t));
 
+  if (execution_loop == LOOP_LEAN) {
+    i = 0;
+
+    // registers are not checked for initialization in lean loop
+    while (i < NUMBEROFREGISTERS) {
+      *(writes_per_register + i) = 1;
+
+      i = i + 1;
+    }
+  }
+
   // zero register is initialized by definition
   *(writes_per_register + REG_ZR) = 1;
 
@@ -1955,6 +2398,16 @@ void reset_profiler() {
   reset_registers_profile();
   reset_segments_profile();
   reset_all_cache_counters();
+
+  tlb_hits   = 0;
+  tlb_misses = 0;
+
+  sc_read_calls   = 0;
+  sc_read_bytes   = 0;
+  sc_write_calls  = 0;
+  sc_write_bytes  = 0;
+  sc_openat_calls = 0;
+  sc_openat_bytes = 0;
 }
 
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
@@ -2004,11 +2457,27 @@ void reset_profiler() {
 // | 30 | gcs counter     | number of gc runs in gc period
 // | 31 | gc enabled      | flag indicating whether to use gc or not
 // +----+-----------------+
+// | 32 | decoded instrs  | pointer to pre-decoded instructions of code segment
+// +----+-----------------+
+// | 33 | L1 dcache hits  | number of L1 data-cache hits
+// | 34 | L1 dcache misses| number of L1 data-cache misses
+// | 35 | L1 icache hits  | number of L1 instruction-cache hits
+// | 36 | L1 icache misses| number of L1 instruction-cache misses
+// +----+-----------------+
+// | 37 | call node       | pointer to node of executing procedure in calling-context tree
+// +----+-----------------+
+// | 38 | next runnable   | pointer to next context in run queue
+// | 39 | priority        | scheduling priority, higher runs first
+// | 40 | dispatches      | number of times context was scheduled to run
+// | 41 | turnaround      | number of instructions executed in total when context exited
+// +----+-----------------+
+// | 42 | shared image    | pointer to image whose code and data pages are shared with other contexts
+// +----+-----------------+
 
 // number of entries of a machine context:
-// 14 uint64_t + 6 uint64_t* + 1 char* + 7 uint64_t + 2 uint64_t* + 2 uint64_t entries
+// 14 uint64_t + 6 uint64_t* + 1 char* + 7 uint64_t + 2 uint64_t* + 2 uint64_t + 1 uint64_t* + 4 uint64_t + 2 uint64_t* + 3 uint64_t + 1 uint64_t* entries
 // extended in the symbolic execution engine and the Boehm garbage collector
-uint64_t CONTEXTENTRIES = 32;
+uint64_t CONTEXTENTRIES = 43;
 
 uint64_t* allocate_context(); // declaration avoids warning in the Boehm garbage collector
 
@@ -2087,6 +2556,22 @@ uint64_t* get_free_list_head(uint64_t* context) { return (uint64_t*) *(context +
 uint64_t  get_gcs_in_period(uint64_t* context)  { return             *(context + 30); }
 uint64_t  get_use_gc_kernel(uint64_t* context)  { return             *(context + 31); }
 
+uint64_t* get_decoded_instructions(uint64_t* context) { return (uint64_t*) *(context + 32); }
+
+uint64_t get_L1_dcache_hits(uint64_t* context)   { return *(context + 33); }
+uint64_t get_L1_dcache_misses(uint64_t* context) { return *(context + 34); }
+uint64_t get_L1_icache_hits(uint64_t* context)   { return *(context + 35); }
+uint64_t get_L1_icache_misses(uint64_t* context) { return *(context + 36); }
+
+uint64_t* get_call_node(uint64_t* context) { return (uint64_t*) *(context + 37); }
+
+uint64_t* get_next_runnable(uint64_t* context) { return (uint64_t*) *(context + 38); }
+uint64_t  get_priority(uint64_t* context)      { return             *(context + 39); }
+uint64_t  get_dispatches(uint64_t* context)    { return             *(context + 40); }
+uint64_t  get_turnaround(uint64_t* context)    { return             *(context + 41); }
+
+uint64_t* get_shared_image(uint64_t* context) { return (uint64_t*) *(context + 42); }
+
 void set_next_context(uint64_t* context, uint64_t* next)     { *context        = (uint64_t) next; }
 void set_prev_context(uint64_t* context, uint64_t* prev)     { *(context + 1)  = (uint64_t) prev; }
 void set_pc(uint64_t* context, uint64_t pc)                  { *(context + 2)  = pc; }
@@ -2122,6 +2607,22 @@ void set_free_list_head(uint64_t* context, uint64_t* free_list_head) { *(context
 void set_gcs_in_period(uint64_t* context, uint64_t gcs)              { *(context + 30) = gcs; }
 void set_use_gc_kernel(uint64_t* context, uint64_t use)              { *(context + 31) = use; }
 
+void set_decoded_instructions(uint64_t* context, uint64_t* decoded) { *(context + 32) = (uint64_t) decoded; }
+
+void set_L1_dcache_hits(uint64_t* context, uint64_t hits)     { *(context + 33) = hits; }
+void set_L1_dcache_misses(uint64_t* context, uint64_t misses) { *(context + 34) = misses; }
+void set_L1_icache_hits(uint64_t* context, uint64_t hits)     { *(context + 35) = hits; }
+void set_L1_icache_misses(uint64_t* context, uint64_t misses) { *(context + 36) = misses; }
+
+void set_call_node(uint64_t* context, uint64_t* node) { *(context + 37) = (uint64_t) node; }
+
+void set_next_runnable(uint64_t* context, uint64_t* next)   { *(context + 38) = (uint64_t) next; }
+void set_priority(uint64_t* context, uint64_t priority)     { *(context + 39) = priority; }
+void set_dispatches(uint64_t* context, uint64_t dispatches) { *(context + 40) = dispatches; }
+void set_turnaround(uint64_t* context, uint64_t turnaround) { *(context + 41) = turnaround; }
+
+void set_shared_image(uint64_t* context, uint64_t* image) { *(context + 42) = (uint64_t) image; }
+
 // -----------------------------------------------------------------
 // ---------------------------- MEMORY -----------------------------
 // -----------------------------------------------------------------
@@ -2134,6 +2635,8 @@ uint64_t is_heap_address(uint64_t* context, uint64_t vaddr);
 uint64_t is_address_between_stack_and_heap(uint64_t* context, uint64_t vaddr);
 uint64_t is_data_stack_heap_address(uint64_t* context, uint64_t vaddr);
 
+uint64_t words_in_page_run(uint64_t* context, uint64_t vaddr);
+
 // -----------------------------------------------------------------
 // ---------------------- GARBAGE COLLECTOR ------------------------
 // -----------------------------------------------------------------
@@ -2320,6 +2823,8 @@ uint64_t* create_context(uint64_t* parent, uint64_t* vctxt);
 uint64_t* find_context(uint64_t* parent, uint64_t* vctxt);
 uint64_t* cache_context(uint64_t* vctxt);
 
+void profile_L1_caches(uint64_t* context);
+
 void save_context(uint64_t* context);
 
 uint64_t lowest_page(uint64_t page, uint64_t lo);
@@ -2336,8 +2841,46 @@ uint64_t pused();
 uint64_t* palloc();
 void      pfree(uint64_t* frame);
 
+void reclaim_page_frames(uint64_t* context);
+
 void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data);
 
+uint64_t  load_image_word(uint64_t* image, uint64_t vaddr);
+uint64_t  is_image_of_binary(uint64_t* image);
+uint64_t* find_shared_image();
+void      share_image(uint64_t* context, uint64_t* image);
+void      create_shared_image(uint64_t* context);
+void      release_shared_image(uint64_t* context);
+
+uint64_t is_page_shared(uint64_t* context, uint64_t page);
+void     copy_on_write(uint64_t* context, uint64_t page);
+void     unshare_page(uint64_t* context, uint64_t vaddr);
+
+uint64_t* allocate_page_descriptor();
+void      free_page_descriptor(uint64_t* descriptor);
+
+void      register_resident_page(uint64_t* context, uint64_t page);
+uint64_t  is_page_referenced(uint64_t* descriptor);
+uint64_t* select_victim();
+void      page_out();
+uint64_t  page_in(uint64_t* context, uint64_t page);
+void      release_paged_pages(uint64_t* context);
+
+void     unshare_pages(uint64_t* context, uint64_t vaddr, uint64_t bytes);
+void     count_saved_frame();
+void     release_page_frame(uint64_t frame);
+
+uint64_t* find_merged_frame(uint64_t frame);
+void      reference_merged_frame(uint64_t frame);
+uint64_t  release_merged_frame(uint64_t frame);
+
+uint64_t hash_frame(uint64_t* frame);
+uint64_t is_frame_equal(uint64_t* frame1, uint64_t* frame2);
+uint64_t is_frame_stable(uint64_t frame, uint64_t hash);
+void     merge_page(uint64_t* context, uint64_t page, uint64_t frame, uint64_t hash);
+void     merge_pages(uint64_t* context, uint64_t lo, uint64_t hi);
+void     merge_identical_pages();
+
 void map_unmapped_pages(uint64_t* context);
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
@@ -2354,9 +2897,135 @@ uint64_t* free_contexts = (uint64_t*) 0; // singly-linked list of free contexts
 
 uint64_t allocated_page_frame_memory = 0;
 uint64_t free_page_frame_memory      = 0;
+uint64_t freed_page_frame_memory     = 0;
 
 uint64_t next_page_frame = 0;
 
+uint64_t* free_page_frames = (uint64_t*) 0; // singly-linked list of freed page frames
+
+// shared image
+// +---+------------+
+// | 0 | next       | pointer to next shared image
+// | 1 | code start | start of code segment
+// | 2 | code size  | size of code segment
+// | 3 | data start | start of data segment
+// | 4 | data size  | size of data segment
+// | 5 | pages      | number of code and data pages, starting at page of code start
+// | 6 | frames     | pointer to page frames of code and data pages, 0 if unmapped
+// | 7 | contexts   | number of contexts sharing image
+// +---+------------+
+
+uint64_t* allocate_shared_image() {
+  return smalloc(2 * sizeof(uint64_t*) + 6 * sizeof(uint64_t));
+}
+
+uint64_t* get_next_image(uint64_t* image)       { return (uint64_t*) *image; }
+uint64_t  get_image_code_start(uint64_t* image) { return             *(image + 1); }
+uint64_t  get_image_code_size(uint64_t* image)  { return             *(image + 2); }
+uint64_t  get_image_data_start(uint64_t* image) { return             *(image + 3); }
+uint64_t  get_image_data_size(uint64_t* image)  { return             *(image + 4); }
+uint64_t  get_image_pages(uint64_t* image)      { return             *(image + 5); }
+uint64_t* get_image_frames(uint64_t* image)     { return (uint64_t*) *(image + 6); }
+uint64_t  get_image_contexts(uint64_t* image)   { return             *(image + 7); }
+
+void set_next_image(uint64_t* image, uint64_t* next)          { *image       = (uint64_t) next; }
+void set_image_code_start(uint64_t* image, uint64_t start)    { *(image + 1) = start; }
+void set_image_code_size(uint64_t* image, uint64_t size)      { *(image + 2) = size; }
+void set_image_data_start(uint64_t* image, uint64_t start)    { *(image + 3) = start; }
+void set_image_data_size(uint64_t* image, uint64_t size)      { *(image + 4) = size; }
+void set_image_pages(uint64_t* image, uint64_t pages)         { *(image + 5) = pages; }
+void set_image_frames(uint64_t* image, uint64_t* frames)      { *(image + 6) = (uint64_t) frames; }
+void set_image_contexts(uint64_t* image, uint64_t contexts)   { *(image + 7) = contexts; }
+
+uint64_t* shared_images = (uint64_t*) 0; // list of images with page frames shared by contexts
+
+uint64_t share_images = 0; // flag for sharing code and data pages among contexts running the same binary
+
+// sharing profile
+
+uint64_t shared_pages = 0; // number of pages mapped to frames of shared images instead of loaded
+uint64_t cow_pages    = 0; // number of shared pages copied on write
+
+// page descriptor
+// +---+---------+
+// | 0 | next    | pointer to next descriptor on clock or in swap bucket
+// | 1 | context | context that mapped page
+// | 2 | page    | virtual page number
+// | 3 | state   | referenced flag while page is resident, pointer to swap slot while page is swapped out
+// +---+---------+
+
+uint64_t* get_next_descriptor(uint64_t* descriptor) { return (uint64_t*) *descriptor; }
+uint64_t* get_paged_context(uint64_t* descriptor)   { return (uint64_t*) *(descriptor + 1); }
+uint64_t  get_paged_page(uint64_t* descriptor)      { return             *(descriptor + 2); }
+uint64_t  get_referenced(uint64_t* descriptor)      { return             *(descriptor + 3); }
+uint64_t* get_swap_slot(uint64_t* descriptor)       { return (uint64_t*) *(descriptor + 3); }
+
+void set_next_descriptor(uint64_t* descriptor, uint64_t* next)    { *descriptor       = (uint64_t) next; }
+void set_paged_context(uint64_t* descriptor, uint64_t* context)   { *(descriptor + 1) = (uint64_t) context; }
+void set_paged_page(uint64_t* descriptor, uint64_t page)          { *(descriptor + 2) = page; }
+void set_referenced(uint64_t* descriptor, uint64_t referenced)    { *(descriptor + 3) = referenced; }
+void set_swap_slot(uint64_t* descriptor, uint64_t* slot)          { *(descriptor + 3) = (uint64_t) slot; }
+
+uint64_t SWAPBUCKETS = 1024; // number of buckets for finding swapped out pages
+
+uint64_t swap_size = 0; // swap space in bytes, no swapping if 0
+
+uint64_t* clock_hand = (uint64_t*) 0; // descriptor preceding next candidate for eviction on circular list of resident pages
+
+uint64_t* swap_buckets = (uint64_t*) 0; // hash table of descriptors of swapped out pages
+
+uint64_t* free_descriptors = (uint64_t*) 0; // singly-linked list of free page descriptors
+uint64_t* free_swap_slots  = (uint64_t*) 0; // singly-linked list of free swap slots
+
+uint64_t resident_pages = 0; // number of pages on clock
+uint64_t used_swap      = 0; // amount of swap space in use in bytes
+
+// paging profile
+
+uint64_t page_ins     = 0; // number of pages swapped in
+uint64_t page_outs    = 0; // number of pages swapped out
+uint64_t clock_sweeps = 0; // number of pages inspected by clock hand
+
+uint64_t zero_frame = 0; // read-only page frame of zeros mapped by pages until written, no zero pages if 0
+
+// merged frame
+// +---+------------+
+// | 0 | next       | pointer to next merged frame in bucket
+// | 1 | frame      | page frame shared by identical pages
+// | 2 | references | number of pages mapped to frame
+// +---+------------+
+
+uint64_t* allocate_merged_frame() {
+  return smalloc(sizeof(uint64_t*) + 2 * sizeof(uint64_t));
+}
+
+uint64_t* get_next_merged(uint64_t* merged)  { return (uint64_t*) *merged; }
+uint64_t  get_merged_frame(uint64_t* merged) { return             *(merged + 1); }
+uint64_t  get_references(uint64_t* merged)   { return             *(merged + 2); }
+
+void set_next_merged(uint64_t* merged, uint64_t* next)         { *merged       = (uint64_t) next; }
+void set_merged_frame(uint64_t* merged, uint64_t frame)        { *(merged + 1) = frame; }
+void set_references(uint64_t* merged, uint64_t references)     { *(merged + 2) = references; }
+
+uint64_t MERGEBUCKETS = 1024; // number of buckets for finding merged frames
+uint64_t DEDUPSLOTS   = 4096; // number of page frames remembered by content during a scan
+
+uint64_t dedup_period = 0; // number of timer interrupts between scans for identical pages, no scans if 0
+uint64_t dedup_timer  = 0; // number of timer interrupts since last scan
+
+uint64_t* merged_frames = (uint64_t*) 0; // hash table of page frames shared by merged pages
+uint64_t* free_merged   = (uint64_t*) 0; // singly-linked list of free merged frame records
+uint64_t* dedup_slots   = (uint64_t*) 0; // page frames by hash of their content during a scan
+uint64_t* dedup_hashes  = (uint64_t*) 0; // page frames and hash of their content in previous scans
+
+// deduplication profile
+
+uint64_t zero_pages        = 0; // number of pages mapped to the zero frame
+uint64_t merged_pages      = 0; // number of pages merged with identical pages
+uint64_t dedup_scans       = 0; // number of scans for identical pages
+uint64_t saved_frames      = 0; // number of page frames currently saved by zero and merged pages
+uint64_t peak_saved_frames = 0; // peak number of saved page frames
+
 // ------------------------- INITIALIZATION ------------------------
 
 void reset_microkernel() {
@@ -2364,6 +3033,32 @@ void reset_microkernel() {
 
   while (used_contexts != (uint64_t*) 0)
     used_contexts = delete_context(used_contexts, used_contexts);
+
+  // assert: deleting contexts released all shared images
+  shared_images = (uint64_t*) 0;
+
+  shared_pages = 0;
+  cow_pages    = 0;
+
+  // assert: deleting contexts released all paged pages
+  clock_hand   = (uint64_t*) 0;
+  swap_buckets = (uint64_t*) 0;
+
+  page_ins     = 0;
+  page_outs    = 0;
+  clock_sweeps = 0;
+
+  zero_frame    = 0;
+  merged_frames = (uint64_t*) 0;
+  dedup_slots   = (uint64_t*) 0;
+  dedup_hashes  = (uint64_t*) 0;
+  dedup_timer   = 0;
+
+  zero_pages        = 0;
+  merged_pages      = 0;
+  dedup_scans       = 0;
+  saved_frames      = 0;
+  peak_saved_frames = 0;
 }
 
 // -----------------------------------------------------------------
@@ -2382,12 +3077,56 @@ char* increment_boot_level_prefix(char* s, char* t);
 
 void boot_loader(uint64_t* context);
 
+uint64_t is_io_system_call(uint64_t a7);
+
+uint64_t write_snapshot(uint64_t* context, char* filename);
+void     save_snapshot(uint64_t* context);
+void     selfie_resume(char* filename);
+void     resume_loader(uint64_t* context);
+
+char* checkpoint_name(char* filename, uint64_t checkpoint);
+
+void flush_log_buffer();
+void log_byte(uint64_t b);
+void log_number(uint64_t n);
+
+void start_logging(uint64_t* context);
+void take_checkpoint(uint64_t* context);
+void log_system_call(uint64_t* context, uint64_t a7);
+void stop_logging();
+
+uint64_t replay_byte();
+uint64_t replay_number();
+void     open_execution_log(char* filename);
+uint64_t next_log_record();
+
+void     selfie_replay(char* filename, uint64_t target);
+void     start_replay();
+uint64_t replay_timeout(uint64_t* context, uint64_t timeout);
+uint64_t replay_divergence(uint64_t* context);
+uint64_t replay_system_call(uint64_t* context, uint64_t a7);
+void     stop_replay();
+
 uint64_t handle_system_call(uint64_t* context);
 uint64_t handle_page_fault(uint64_t* context);
 uint64_t handle_division_by_zero(uint64_t* context);
 uint64_t handle_timer(uint64_t* context);
 uint64_t handle_exception(uint64_t* context);
 
+void      enqueue_context(uint64_t* context);
+uint64_t* dequeue_context();
+uint64_t* select_context(uint64_t* from_context);
+void      reset_scheduler();
+uint64_t* init_run_queue(uint64_t* context);
+uint64_t* schedule(uint64_t* from_context);
+uint64_t* terminate(uint64_t* context);
+uint64_t  time_slice(uint64_t* from_context, uint64_t* to_context);
+
+void      selfie_batch(char* filename, uint64_t workers);
+void      boot_job(uint64_t* job);
+uint64_t* init_batch();
+void      print_batch_results();
+
 uint64_t mipster(uint64_t* to_context);
 uint64_t hypster(uint64_t* to_context);
 
@@ -2438,6 +3177,156 @@ uint64_t* MACHINES; // named machines
 uint64_t DIPSTER = 5;
 uint64_t RIPSTER = 6;
 uint64_t CAPSTER = 7;
+uint64_t JITSTER = 8;
+
+// snapshot image header
+// +----+-----------------+
+// |  0 | magic           | IMAGEMAGIC identifying snapshot images
+// |  1 | word size       | WORDSIZE of snapshot context
+// |  2 | page frame size | PAGEFRAMESIZE of snapshot context
+// |  3 | program counter | program counter
+// |  4 | code start      | start of code segment
+// |  5 | code size       | size of code segment
+// |  6 | data start      | start of data segment
+// |  7 | data size       | size of data segment
+// |  8 | heap start      | start of heap segment
+// |  9 | program break   | program break
+// | 10 | number of pages | number of mapped pages
+// +----+-----------------+
+// followed by the values of all registers, the numbers of
+// all mapped pages, and the contents of their page frames
+
+uint64_t IMAGEHEADERENTRIES = 11;
+
+uint64_t IMAGEMAGIC = 1885433459; // "snap" in little-endian ASCII
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* snapshot_name = (char*) 0; // image file for snapshot at first I/O system call
+
+char*     image_name      = (char*) 0;     // image file to resume from
+uint64_t* image_header    = (uint64_t*) 0; // header of image
+uint64_t* image_registers = (uint64_t*) 0; // register values of image
+uint64_t* image_pages     = (uint64_t*) 0; // mapped pages of image
+uint64_t* image_frames    = (uint64_t*) 0; // PAGEFRAMESIZE-aligned page frames of image
+
+// execution log header
+// +---+-----------+
+// | 0 | magic     | LOGMAGIC identifying execution logs
+// | 1 | word size | WORDSIZE of logged context
+// +---+-----------+
+// followed by checkpoint and system call records of the form
+// checkpoint:  LOG_CHECKPOINT, instruction count, checkpoint number
+// system call: LOG_SYSCALL, instruction count, a7, a0, [ bytes ]
+// where all fields are encoded as variable-length integers (7 bits per
+// byte, least significant first, high bit set if more bytes follow),
+// a0 is the value after handling the system call, and bytes are those
+// read into memory by read system calls returning a positive a0.
+// the state of the context at each checkpoint is saved in a separate
+// snapshot image named after the execution log and checkpoint number
+
+uint64_t LOGHEADERENTRIES = 2;
+
+uint64_t LOGMAGIC = 1868850546; // "redo" in little-endian ASCII
+
+uint64_t LOGBUFFERSIZE = 65536; // bytes
+
+uint64_t LOG_END        = 0; // end of execution log
+uint64_t LOG_CHECKPOINT = 1;
+uint64_t LOG_SYSCALL    = 2;
+
+char*    log_name = (char*) 0; // file for execution log
+uint64_t log_fd   = 0;         // file descriptor of open execution log
+uint64_t logging  = 0;         // flag for logging execution
+
+uint64_t checkpoint_period = 0; // take checkpoint every so many instructions, only at start if 0
+uint64_t next_checkpoint   = 0; // number of executed instructions after which next checkpoint is taken
+
+uint64_t* log_buffer       = (uint64_t*) 0; // buffer for writing and reading execution log
+uint64_t  log_buffer_bytes = 0;             // number of bytes in log buffer
+uint64_t  log_cursor       = 0;             // number of bytes already read from log buffer
+
+uint64_t log_bytes        = 0; // number of bytes written into or read from execution log
+uint64_t log_syscalls     = 0; // number of logged or replayed system calls
+uint64_t log_checkpoints  = 0; // number of checkpoints taken
+uint64_t checkpoint_bytes = 0; // number of bytes written into checkpoint images
+
+uint64_t log_instructions = 0; // instruction count of most recently read log record
+uint64_t log_value        = 0; // checkpoint number or a7 of most recently read log record
+uint64_t log_a0           = 0; // a0 of most recently read system call record
+
+char*    replay_name       = (char*) 0; // execution log to replay
+uint64_t replaying         = 0;         // flag for replaying execution log
+uint64_t replay_target     = 0;         // number of instructions to replay
+uint64_t replay_checkpoint = 0;         // checkpoint from which replay starts
+uint64_t replay_base       = 0;         // number of instructions executed before checkpoint
+
+// debugging modes that are turned on once replay target is reached
+
+uint64_t replay_debug          = 0;
+uint64_t replay_debug_syscalls = 0;
+uint64_t replay_record         = 0;
+
+// scheduling policies
+
+uint64_t SCHEDULE_ROUND_ROBIN = 0; // run contexts in turn, one time slice each
+uint64_t SCHEDULE_PRIORITY    = 1; // run contexts with highest priority first, in turn if equal
+
+uint64_t* SCHEDULERS; // named scheduling policies
+
+uint64_t PRIORITIES = 4; // number of priority levels
+
+uint64_t SCHEDULER = 0; // round-robin is default
+
+uint64_t number_of_contexts = 1; // number of contexts booted from the same binary and arguments
+
+uint64_t* run_queue_head = (uint64_t*) 0; // singly-linked list of runnable contexts, head is running
+uint64_t* run_queue_tail = (uint64_t*) 0;
+
+uint64_t time_slice_expired = 0; // flag set by timer interrupts for preempting running context
+
+uint64_t scheduled_exit_code = 0; // exit code of first context exiting with an error, if any
+
+// scheduler profile
+
+uint64_t scheduling_decisions = 0;
+uint64_t context_switches     = 0;
+uint64_t run_queue_scans      = 0; // number of contexts inspected when selecting by priority
+
+// batch job
+// +---+---------+
+// | 0 | next    | pointer to next job
+// | 1 | number  | job number in batch file, starting at 1
+// | 2 | argc    | number of arguments, including binary
+// | 3 | argv    | pointer to arguments, starting with binary
+// | 4 | context | context running job, null if job has not started
+// +---+---------+
+
+uint64_t* allocate_job() {
+  return smalloc(3 * sizeof(uint64_t*) + 2 * sizeof(uint64_t));
+}
+
+uint64_t* get_next_job(uint64_t* job)    { return (uint64_t*) *job; }
+uint64_t  get_job_number(uint64_t* job)  { return             *(job + 1); }
+uint64_t  get_job_argc(uint64_t* job)    { return             *(job + 2); }
+uint64_t* get_job_argv(uint64_t* job)    { return (uint64_t*) *(job + 3); }
+uint64_t* get_job_context(uint64_t* job) { return (uint64_t*) *(job + 4); }
+
+void set_next_job(uint64_t* job, uint64_t* next)        { *job       = (uint64_t) next; }
+void set_job_number(uint64_t* job, uint64_t number)     { *(job + 1) = number; }
+void set_job_argc(uint64_t* job, uint64_t argc)         { *(job + 2) = argc; }
+void set_job_argv(uint64_t* job, uint64_t* argv)        { *(job + 3) = (uint64_t) argv; }
+void set_job_context(uint64_t* job, uint64_t* context)  { *(job + 4) = (uint64_t) context; }
+
+uint64_t MAX_JOB_ARGUMENTS = 64;
+
+char*     batch_name     = (char*) 0;     // file with one job per line: binary and arguments
+uint64_t* batch_jobs     = (uint64_t*) 0; // list of jobs in batch file order
+uint64_t* next_job       = (uint64_t*) 0; // next job to be started
+uint64_t  number_of_jobs = 0;
+
+uint64_t batch_workers  = 1; // number of jobs running concurrently
+uint64_t batch_wordsize = 0; // word size of first job, all jobs must match
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -2449,6 +3338,11 @@ void init_kernel () {
   *(MACHINES + MINSTER) = (uint64_t) "minster";
   *(MACHINES + MOBSTER) = (uint64_t) "mobster";
   *(MACHINES + MIXTER) = (uint64_t) "mixter";
+
+  SCHEDULERS = smalloc((SCHEDULE_PRIORITY + 1) * sizeof(char*));
+
+  *(SCHEDULERS + SCHEDULE_ROUND_ROBIN) = (uint64_t) "rr";
+  *(SCHEDULERS + SCHEDULE_PRIORITY)    = (uint64_t) "priority";
 }
 
 // -----------------------------------------------------------------
@@ -2496,6 +3390,8 @@ uint64_t BAREMETAL = 4;
 
 uint64_t OS = 0; // default host operating system is selfie
 
+uint64_t malloc_zeroes = 0; // flag indicating that malloc returns zeroed memory, only on selfie
+
 // ------------------------- INITIALIZATION ------------------------
 
 void init_selfie(uint64_t argc, uint64_t* argv) {
@@ -2540,9 +3436,13 @@ void init_system() {
       else
         OS = WINDOWS;
     }
-  } else
+  } else {
     OS = SELFIE;
 
+    // on boot level 1 or above mallocated memory is zeroed
+    malloc_zeroes = 1;
+  }
+
   if (OS == MACOS)
     O_CREAT_TRUNC_WRONLY = MAC_O_CREAT_TRUNC_WRONLY;
   else if (OS == WINDOWS)
@@ -3497,7 +4397,10 @@ uint64_t* zalloc(uint64_t size) {
 
   memory = smalloc(size);
 
-  zero_memory(memory, size);
+  if (malloc_zeroes == 0)
+    // zeroing memory on selfie would only map
+    // pages that may otherwise never be touched
+    zero_memory(memory, size);
 
   return memory;
 }
@@ -3771,9 +4674,6 @@ void get_symbol() {
       // start state of finite state machine
       // for recognizing C* symbols is here
       if (is_letter(character)) {
-        // accommodate identifier and null for termination
-        identifier = string_alloc(MAX_IDENTIFIER_LENGTH);
-
         i = 0;
 
         while (is_character_letter_or_digit_or_underscore()) {
@@ -3783,14 +4683,17 @@ void get_symbol() {
             exit(EXITCODE_SCANNERERROR);
           }
 
-          store_character(identifier, i, character);
+          store_character(identifier_buffer, i, character);
 
           i = i + 1;
 
           get_character();
         }
 
-        store_character(identifier, i, 0); // null-terminated string
+        store_character(identifier_buffer, i, 0); // null-terminated string
+
+        // most identifiers are short, allocate only what is needed
+        identifier = string_copy(identifier_buffer);
 
         symbol = identifier_or_keyword();
       } else if (is_digit(character)) {
@@ -6274,6 +7177,7 @@ uint64_t open_read_only(char* name) {
 void selfie_compile() {
   uint64_t link;
   uint64_t number_of_source_files;
+  uint64_t* source_file;
   uint64_t fetch_dss_code_location;
 
   fetch_dss_code_location = 0;
@@ -6362,8 +7266,19 @@ void selfie_compile() {
       reset_scanner();
       reset_parser();
 
+      // remember which code is compiled from which source file
+      source_file = allocate_source_file();
+
+      set_next_source_file(source_file, source_files);
+      set_source_name(source_file, source_name);
+      set_source_code_start(source_file, code_size);
+
+      source_files = source_file;
+
       compile_cstar();
 
+      set_source_code_end(source_file, code_size);
+
       printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
       printf("%s: %lu characters read in %lu lines and %lu comments\n", selfie_name,
         number_of_read_characters,
@@ -7538,8 +8453,14 @@ void selfie_load(char* filename) {
   // no source line numbers in binaries
   reset_binary();
 
+  // binary replaces any loaded snapshot image
+  image_name = (char*) 0;
+
   // allocate and map (on all boot levels) memory for reading into it
-  ELF_file_header = touch(smalloc(MAX_BINARY_SIZE), MAX_BINARY_SIZE);
+  if (ELF_file_buffer == (uint64_t*) 0)
+    ELF_file_buffer = touch(smalloc(MAX_BINARY_SIZE), MAX_BINARY_SIZE);
+
+  ELF_file_header = ELF_file_buffer;
 
   number_of_read_bytes = read(fd, ELF_file_header, 8);
 
@@ -7709,6 +8630,8 @@ void emit_read() {
 uint64_t copy_buffer(uint64_t* context, uint64_t vbuffer, uint64_t* buffer, uint64_t size, uint64_t upload) {
   uint64_t is_string;
   uint64_t vaddr;
+  uint64_t words;
+  uint64_t* paddr;
   uint64_t i;
 
   if (size == 0) {
@@ -7725,41 +8648,63 @@ uint64_t copy_buffer(uint64_t* context, uint64_t vbuffer, uint64_t* buffer, uint
   while (vaddr - vbuffer < size) {
     if (is_virtual_address_valid(vaddr, WORDSIZE))
       if (is_data_stack_heap_address(context, vaddr)) {
+        // swapped out pages are swapped in first
+        page_in(context, page_of_virtual_address(vaddr));
+
         if (is_virtual_address_mapped(get_pt(context), vaddr)) {
-          if (upload)
-            store_virtual_memory(get_pt(context), vaddr, load_word(buffer, vaddr - vbuffer, 1));
-          else
-            store_word(buffer, vaddr - vbuffer, 1, load_virtual_memory(get_pt(context), vaddr));
-        } else {
-          printf("%s: virtual address 0x%08lX is unmapped\n", selfie_name, vaddr);
+          // validate and translate only once for all words
+          // up to the end of the page, segment, or buffer
+          words = words_in_page_run(context, vaddr);
 
-          return 0;
-        }
+          if ((size - (vaddr - vbuffer) + WORDSIZE - 1) / WORDSIZE < words)
+            words = (size - (vaddr - vbuffer) + WORDSIZE - 1) / WORDSIZE;
 
-        if (is_string) {
-          i = 0;
+          if (upload)
+            unshare_page(context, vaddr);
 
-          // check if string ends in the current word
-          // WORDSIZE may be less than sizeof(uint64_t)
-          while (i < WORDSIZE) {
-            if (load_character((char*) buffer, vaddr - vbuffer + i) == 0)
-              return 1;
+          paddr = translate_virtual_to_physical(get_pt(context), vaddr);
 
-            i = i + 1;
-          }
-        }
+          while (words > 0) {
+            if (upload) {
+              invalidate_cached_word(vaddr, (uint64_t) paddr);
 
-        // advance to the next word in virtual memory
-        vaddr = vaddr + WORDSIZE;
-      } else {
-        printf("%s: virtual address 0x%08lX is in an invalid segment\n", selfie_name, vaddr);
+              store_physical_memory(paddr, load_word(buffer, vaddr - vbuffer, 1));
+            } else
+              store_word(buffer, vaddr - vbuffer, 1, load_physical_memory(paddr));
 
-        return 0;
-      }
-    else {
-      printf("%s: virtual address 0x%08lX is invalid\n", selfie_name, vaddr);
+            if (is_string) {
+              i = 0;
 
-      return 0;
+              // check if string ends in the current word
+              // WORDSIZE may be less than sizeof(uint64_t)
+              while (i < WORDSIZE) {
+                if (load_character((char*) buffer, vaddr - vbuffer + i) == 0)
+                  return 1;
+
+                i = i + 1;
+              }
+            }
+
+            // advance to the next word in virtual and physical memory
+            vaddr = vaddr + WORDSIZE;
+            paddr = paddr + 1;
+
+            words = words - 1;
+          }
+        } else {
+          printf("%s: virtual address 0x%08lX is unmapped\n", selfie_name, vaddr);
+
+          return 0;
+        }
+      } else {
+        printf("%s: virtual address 0x%08lX is in an invalid segment\n", selfie_name, vaddr);
+
+        return 0;
+      }
+    else {
+      printf("%s: virtual address 0x%08lX is invalid\n", selfie_name, vaddr);
+
+      return 0;
     }
   }
 
@@ -7806,16 +8751,24 @@ void implement_read(uint64_t* context) {
   }
 
   // read syscall may read less than size bytes
-  // zero buffer up to integer-aligned size
-  zero_memory(IO_buffer, round_up(size, sizeof(uint64_t)));
-
   *(get_regs(context) + REG_A0) = read(fd, IO_buffer, size);
 
   size = sign_extend(*(get_regs(context) + REG_A0), SYSCALL_BITWIDTH);
 
-  if (signed_less_than(0, size))
-    if (not(copy_buffer(context, vbuffer, IO_buffer, size, 1)))
+  sc_read_calls = sc_read_calls + 1;
+
+  if (signed_less_than(0, size)) {
+    if (size % sizeof(uint64_t) != 0)
+      // instead of zeroing the whole buffer before reading, only zero
+      // the bytes that were not read in the last, partially read integer
+      *(IO_buffer + size / sizeof(uint64_t)) =
+        get_bits(*(IO_buffer + size / sizeof(uint64_t)), 0, (size % sizeof(uint64_t)) * 8);
+
+    if (copy_buffer(context, vbuffer, IO_buffer, size, 1))
+      sc_read_bytes = sc_read_bytes + size;
+    else
       *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
+  }
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
@@ -7886,9 +8839,13 @@ void implement_write(uint64_t* context) {
   // null-terminate buffer
   *(IO_buffer + size / sizeof(uint64_t)) = 0;
 
-  if (copy_buffer(context, vbuffer, IO_buffer, size, 0))
+  sc_write_calls = sc_write_calls + 1;
+
+  if (copy_buffer(context, vbuffer, IO_buffer, size, 0)) {
     *(get_regs(context) + REG_A0) = sign_shrink(write_to_printf(fd, IO_buffer, size), SYSCALL_BITWIDTH);
-  else
+
+    sc_write_bytes = sc_write_bytes + size;
+  } else
     *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
@@ -7960,7 +8917,12 @@ void implement_openat(uint64_t* context) {
   flags     = *(get_regs(context) + REG_A2);
   mode      = *(get_regs(context) + REG_A3);
 
+  sc_openat_calls = sc_openat_calls + 1;
+
   if (down_load_string(context, vfilename, filename_buffer)) {
+    // include null terminator
+    sc_openat_bytes = sc_openat_bytes + string_length(filename_buffer) + 1;
+
     if (flags == LINUX_O_CREAT_TRUNC_WRONLY)
       // use correct flags for host operating system
       flags = O_CREAT_TRUNC_WRONLY;
@@ -8138,6 +9100,14 @@ uint64_t is_boot_level_zero() {
   return 0;
 }
 
+void print_syscall_io_profile(char* syscall_name, uint64_t calls, uint64_t bytes) {
+  if (calls > 0)
+    printf("%s: %s%lu,%lu[%lu.%.2lu]\n", selfie_name, syscall_name,
+      calls, bytes,
+      ratio_format_integral_2(bytes, calls),
+      ratio_format_fractional_2(bytes, calls));
+}
+
 // -----------------------------------------------------------------
 // ------------------------ HYPSTER SYSCALL ------------------------
 // -----------------------------------------------------------------
@@ -8214,6 +9184,9 @@ void implement_switch() {
 
   do_switch(to_context, timeout);
 
+  // switched-to context continues running in the same interpreter loop
+  load_decoded_instructions();
+
   if (debug_syscalls) {
     printf(" -> ");
     print_register_hexadecimal(REG_A6);
@@ -8248,15 +9221,67 @@ uint64_t* hypster_switch(uint64_t* to_context, uint64_t timeout) {
 // ----------------------------- CACHE -----------------------------
 // -----------------------------------------------------------------
 
+void init_caches() {
+  REPLACEMENT_POLICIES = smalloc((REPLACE_RANDOM + 1) * sizeof(char*));
+
+  *(REPLACEMENT_POLICIES + REPLACE_LRU)    = (uint64_t) "lru";
+  *(REPLACEMENT_POLICIES + REPLACE_PLRU)   = (uint64_t) "plru";
+  *(REPLACEMENT_POLICIES + REPLACE_FIFO)   = (uint64_t) "fifo";
+  *(REPLACEMENT_POLICIES + REPLACE_RANDOM) = (uint64_t) "random";
+
+  WRITE_POLICIES = smalloc((WRITE_BACK + 1) * sizeof(char*));
+
+  *(WRITE_POLICIES + WRITE_THROUGH) = (uint64_t) "through";
+  *(WRITE_POLICIES + WRITE_BACK)    = (uint64_t) "back";
+
+  PREFETCHERS = smalloc((PREFETCH_STRIDE + 1) * sizeof(char*));
+
+  *(PREFETCHERS + PREFETCH_NONE)      = (uint64_t) "none";
+  *(PREFETCHERS + PREFETCH_NEXT_LINE) = (uint64_t) "next";
+  *(PREFETCHERS + PREFETCH_STRIDE)    = (uint64_t) "stride";
+}
+
+uint64_t select_policy(char* name, uint64_t* policies, uint64_t number_of_policies) {
+  uint64_t i;
+
+  i = 0;
+
+  while (i < number_of_policies) {
+    if (string_compare(name, (char*) *(policies + i)))
+      return i;
+
+    i = i + 1;
+  }
+
+  printf("%s: unknown policy %s\n", selfie_name, name);
+
+  return number_of_policies;
+}
+
 void reset_cache_counters(uint64_t* cache) {
   set_cache_hits(cache, 0);
   set_cache_misses(cache, 0);
+  set_shared_hits(cache, 0);
+
+  set_write_throughs(cache, 0);
+  set_write_backs(cache, 0);
+
+  set_prefetches(cache, 0);
+  set_useful_prefetches(cache, 0);
 }
 
 void reset_all_cache_counters() {
   if (L1_CACHE_ENABLED) {
     reset_cache_counters(L1_DCACHE);
     reset_cache_counters(L1_ICACHE);
+
+    if (CACHE_LEVELS > 1)
+      reset_cache_counters(L2_CACHE);
+    if (CACHE_LEVELS > 2)
+      reset_cache_counters(L3_CACHE);
+
+    L1_icache_coherency_invalidations = 0;
+    L1_kernel_invalidations           = 0;
   }
 }
 
@@ -8277,45 +9302,77 @@ void init_cache_memory(uint64_t* cache) {
   while (i < number_of_cache_blocks) {
     cache_block = allocate_cache_block();
 
-    // valid bit and timestamp are already initialized to 0
+    // valid bit, timestamp, dirty bit, and prefetched bit are already initialized to 0
 
     *(cache_memory + i) = (uint64_t) cache_block;
 
-    set_block_memory(cache_block, smalloc(get_cache_block_size(cache)));
+    if (get_cache_level(cache) == 1)
+      // only L1 caches hold data, L2 and L3 caches just keep tags
+      set_block_memory(cache_block, smalloc(get_cache_block_size(cache)));
 
     i = i + 1;
   }
+
+  // one set state of associativity many entries per set
+  set_set_states(cache, zmalloc(number_of_cache_blocks * sizeof(uint64_t)));
 }
 
-void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size) {
+void init_cache(uint64_t* cache, uint64_t level, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size) {
   set_cache_size(cache, cache_size);
   set_associativity(cache, associativity);
   set_cache_block_size(cache, cache_block_size);
 
+  set_cache_level(cache, level);
+  set_next_level(cache, (uint64_t*) 0);
+
   init_cache_memory(cache);
 
+  set_cache_timer(cache, 0);
+
+  set_last_miss(cache, 0);
+  set_last_stride(cache, 0);
+
   reset_cache_counters(cache);
 }
 
 void init_all_caches() {
   L1_DCACHE = allocate_cache();
 
-  init_cache(L1_DCACHE, L1_DCACHE_SIZE, L1_DCACHE_ASSOCIATIVITY, L1_DCACHE_BLOCK_SIZE);
+  init_cache(L1_DCACHE, 1, L1_DCACHE_SIZE, L1_DCACHE_ASSOCIATIVITY, L1_DCACHE_BLOCK_SIZE);
 
   L1_ICACHE = allocate_cache();
 
-  init_cache(L1_ICACHE, L1_ICACHE_SIZE, L1_ICACHE_ASSOCIATIVITY, L1_ICACHE_BLOCK_SIZE);
+  init_cache(L1_ICACHE, 1, L1_ICACHE_SIZE, L1_ICACHE_ASSOCIATIVITY, L1_ICACHE_BLOCK_SIZE);
+
+  if (CACHE_LEVELS > 1) {
+    L2_CACHE = allocate_cache();
+
+    init_cache(L2_CACHE, 2, L2_CACHE_SIZE, L2_CACHE_ASSOCIATIVITY, L2_CACHE_BLOCK_SIZE);
+
+    set_next_level(L1_DCACHE, L2_CACHE);
+    set_next_level(L1_ICACHE, L2_CACHE);
+
+    if (CACHE_LEVELS > 2) {
+      L3_CACHE = allocate_cache();
+
+      init_cache(L3_CACHE, 3, L3_CACHE_SIZE, L3_CACHE_ASSOCIATIVITY, L3_CACHE_BLOCK_SIZE);
+
+      set_next_level(L2_CACHE, L3_CACHE);
+    }
+  }
 }
 
 void flush_cache(uint64_t* cache) {
   uint64_t number_of_cache_blocks;
   uint64_t* cache_memory;
+  uint64_t* set_states;
   uint64_t i;
   uint64_t* cache_block;
 
   number_of_cache_blocks = get_cache_size(cache) / get_cache_block_size(cache);
 
   cache_memory = get_cache_memory(cache);
+  set_states   = get_set_states(cache);
 
   i = 0;
 
@@ -8324,6 +9381,10 @@ void flush_cache(uint64_t* cache) {
 
     set_valid_flag(cache_block, 0);
     set_timestamp(cache_block, 0);
+    set_dirty_flag(cache_block, 0);
+    set_prefetched_flag(cache_block, 0);
+
+    *(set_states + i) = 0;
 
     i = i + 1;
   }
@@ -8335,6 +9396,11 @@ void flush_all_caches() {
   if (L1_CACHE_ENABLED) {
     flush_cache(L1_DCACHE);
     flush_cache(L1_ICACHE);
+
+    if (CACHE_LEVELS > 1)
+      flush_cache(L2_CACHE);
+    if (CACHE_LEVELS > 2)
+      flush_cache(L3_CACHE);
   }
 }
 
@@ -8358,6 +9424,8 @@ uint64_t cache_set_size(uint64_t* cache) {
 // +-----+---------------------+
 // | tag |                     |
 // +-----+---------------------+
+//
+// (L2 and L3 caches use paddr for both index and tag)
 
 uint64_t cache_tag(uint64_t* cache, uint64_t address) {
   return address / cache_set_size(cache);
@@ -8389,47 +9457,193 @@ uint64_t get_new_timestamp(uint64_t* cache) {
   return timestamp;
 }
 
+uint64_t cache_random() {
+  // linear congruential generator with constants from Numerical Recipes
+  cache_random_state = cache_random_state * 1664525 + 1013904223;
+
+  // discard low-order bits which have short periods
+  return cache_random_state / 65536;
+}
+
+void update_plru_tree(uint64_t* state, uint64_t associativity, uint64_t way) {
+  uint64_t node;
+  uint64_t first_way;
+  uint64_t half;
+
+  // nodes of the binary tree are stored as heap starting at index 1,
+  // each node points to the half of its ways not accessed most recently
+  node      = 1;
+  first_way = 0;
+  half      = associativity / 2;
+
+  while (half > 0) {
+    if (way < first_way + half) {
+      // way is in lower half, point to upper half
+      *(state + node) = 1;
+
+      node = 2 * node;
+    } else {
+      // way is in upper half, point to lower half
+      *(state + node) = 0;
+
+      node = 2 * node + 1;
+
+      first_way = first_way + half;
+    }
+
+    half = half / 2;
+  }
+}
+
+uint64_t plru_victim(uint64_t* state, uint64_t associativity) {
+  uint64_t node;
+  uint64_t first_way;
+  uint64_t half;
+
+  node      = 1;
+  first_way = 0;
+  half      = associativity / 2;
+
+  // follow the nodes down to the pseudo least-recently used way
+  while (half > 0) {
+    if (*(state + node)) {
+      node = 2 * node + 1;
+
+      first_way = first_way + half;
+    } else
+      node = 2 * node;
+
+    half = half / 2;
+  }
+
+  return first_way;
+}
+
+uint64_t find_victim(uint64_t* cache, uint64_t* set, uint64_t* state) {
+  uint64_t i;
+  uint64_t victim;
+
+  i = 0;
+
+  // prefer invalid blocks over any replacement policy
+  while (i < get_associativity(cache)) {
+    if (get_valid_flag((uint64_t*) *(set + i)) == 0)
+      return i;
+
+    i = i + 1;
+  }
+
+  if (CACHE_REPLACEMENT == REPLACE_PLRU)
+    return plru_victim(state, get_associativity(cache));
+  else if (CACHE_REPLACEMENT == REPLACE_RANDOM)
+    return cache_random() % get_associativity(cache);
+
+  // LRU and FIFO: block with oldest timestamp, which is set
+  // upon every access (LRU) or only when filling the block (FIFO)
+
+  victim = 0;
+
+  i = 1;
+
+  while (i < get_associativity(cache)) {
+    if (get_timestamp((uint64_t*) *(set + i)) < get_timestamp((uint64_t*) *(set + victim)))
+      victim = i;
+
+    i = i + 1;
+  }
+
+  return victim;
+}
+
+uint64_t is_cache_hit(uint64_t* cache_block, uint64_t tag) {
+  if (get_valid_flag(cache_block))
+    if (get_tag(cache_block) == tag)
+      return 1;
+
+  return 0;
+}
+
+uint64_t find_way(uint64_t* cache, uint64_t* set, uint64_t tag) {
+  uint64_t i;
+
+  i = 0;
+
+  while (i < get_associativity(cache)) {
+    if (is_cache_hit((uint64_t*) *(set + i), tag))
+      return i;
+
+    i = i + 1;
+  }
+
+  // cache miss
+  return get_associativity(cache);
+}
+
 uint64_t* cache_lookup(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access) {
   uint64_t tag;
+  uint64_t index;
   uint64_t* set;
-  uint64_t i;
-  uint64_t* lru_block;
+  uint64_t* state;
+  uint64_t way;
   uint64_t* cache_block;
 
   tag = cache_tag(cache, paddr);
-  set = cache_set(cache, vaddr);
 
-  i = 0;
+  // set and set state are at the same index
+  index = cache_index(cache, vaddr) * get_associativity(cache);
 
-  lru_block = (uint64_t*) *set;
+  set   = get_cache_memory(cache) + index;
+  state = get_set_states(cache) + index;
 
-  while (i < get_associativity(cache)) {
-    cache_block = (uint64_t*) *(set + i);
+  // look up most recently used block first which makes
+  // lookups O(1) for accesses with temporal locality
+  way = *state;
 
-    if (get_timestamp(cache_block) < get_timestamp(lru_block))
-      lru_block = cache_block;
+  if (is_cache_hit((uint64_t*) *(set + way), tag) == 0)
+    way = find_way(cache, set, tag);
 
-    if (get_valid_flag(cache_block))
-      if (get_tag(cache_block) == tag) {
-        // cache hit
+  if (way < get_associativity(cache)) {
+    // cache hit
 
-        if (is_access) {
-          set_cache_hits(cache, get_cache_hits(cache) + 1);
+    cache_block = (uint64_t*) *(set + way);
 
-          set_timestamp(cache_block, get_new_timestamp(cache));
-        }
+    if (is_access) {
+      set_cache_hits(cache, get_cache_hits(cache) + 1);
+
+      if (get_asid(cache_block) != L1_asid)
+        set_shared_hits(cache, get_shared_hits(cache) + 1);
+
+      if (get_prefetched_flag(cache_block)) {
+        set_useful_prefetches(cache, get_useful_prefetches(cache) + 1);
 
-        return cache_block;
+        set_prefetched_flag(cache_block, 0);
       }
 
-    i = i + 1;
+      if (CACHE_REPLACEMENT == REPLACE_PLRU)
+        update_plru_tree(state, get_associativity(cache), way);
+      else if (CACHE_REPLACEMENT != REPLACE_FIFO)
+        set_timestamp(cache_block, get_new_timestamp(cache));
+
+      *state = way;
+    }
+
+    return cache_block;
   }
 
-  // cache miss
+  // cache miss, the victim block is about to be filled
+
+  way = find_victim(cache, set, state);
+
+  cache_block = (uint64_t*) *(set + way);
 
-  set_valid_flag(lru_block, 0);
+  if (CACHE_REPLACEMENT == REPLACE_PLRU)
+    update_plru_tree(state, get_associativity(cache), way);
 
-  return lru_block;
+  *state = way;
+
+  set_valid_flag(cache_block, 0);
+
+  return cache_block;
 }
 
 void fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
@@ -8454,34 +9668,147 @@ void fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
   }
 }
 
-uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr, uint64_t is_access) {
-  if (is_access) {
-    set_cache_misses(cache, get_cache_misses(cache) + 1);
+uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
+  if (get_dirty_flag(cache_block)) {
+    // write back victim block
+    set_write_backs(cache, get_write_backs(cache) + 1);
+
+    access_next_level(cache, get_block_address(cache_block), 1);
 
+    set_dirty_flag(cache_block, 0);
+  }
+
+  access_next_level(cache, paddr, 0);
+
+  if (get_block_memory(cache_block) != (uint64_t*) 0)
     // make sure the entire cache block contains valid data
     fill_cache_block(cache, cache_block, paddr);
 
-    set_tag(cache_block, cache_tag(cache, paddr));
+  set_tag(cache_block, cache_tag(cache, paddr));
+  set_asid(cache_block, L1_asid);
+  set_block_address(cache_block, cache_block_address(cache, paddr));
 
-    set_timestamp(cache_block, get_new_timestamp(cache));
+  set_timestamp(cache_block, get_new_timestamp(cache));
 
-    set_valid_flag(cache_block, 1);
+  set_prefetched_flag(cache_block, 0);
 
-    return cache_block;
-  } else
-    return (uint64_t*) 0;
+  set_valid_flag(cache_block, 1);
+
+  return cache_block;
 }
 
-uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access) {
+uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
   uint64_t* cache_block;
 
-  cache_block = cache_lookup(cache, vaddr, paddr, is_access);
+  cache_block = cache_lookup(cache, vaddr, paddr, 1);
 
   if (get_valid_flag(cache_block))
     // cache hit
     return cache_block;
-  else
-    return handle_cache_miss(cache, cache_block, paddr, is_access);
+  else {
+    set_cache_misses(cache, get_cache_misses(cache) + 1);
+
+    return handle_cache_miss(cache, cache_block, paddr);
+  }
+}
+
+void access_next_level(uint64_t* cache, uint64_t paddr, uint64_t is_store) {
+  if (get_next_level(cache) != (uint64_t*) 0)
+    access_cache(get_next_level(cache), paddr, is_store);
+}
+
+void access_cache(uint64_t* cache, uint64_t paddr, uint64_t is_store) {
+  uint64_t* cache_block;
+
+  // L2 and L3 caches are physically indexed
+  cache_block = retrieve_cache_block(cache, paddr, paddr);
+
+  if (is_store)
+    write_cache_block(cache, cache_block, paddr);
+}
+
+void write_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
+  if (CACHE_WRITE_POLICY == WRITE_BACK)
+    set_dirty_flag(cache_block, 1);
+  else {
+    set_write_throughs(cache, get_write_throughs(cache) + 1);
+
+    access_next_level(cache, paddr, 1);
+  }
+}
+
+void prefetch_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
+  uint64_t stride;
+  uint64_t* cache_block;
+
+  if (CACHE_PREFETCHER == PREFETCH_NEXT_LINE)
+    stride = get_cache_block_size(cache);
+  else if (CACHE_PREFETCHER == PREFETCH_STRIDE) {
+    stride = cache_block_address(cache, vaddr) - get_last_miss(cache);
+
+    set_last_miss(cache, cache_block_address(cache, vaddr));
+
+    if (stride != get_last_stride(cache)) {
+      set_last_stride(cache, stride);
+
+      // prefetch only after seeing the same stride twice
+      stride = 0;
+    }
+  } else
+    stride = 0;
+
+  if (stride != 0)
+    // the next page may not be mapped or may be mapped to a non-contiguous page frame
+    if (page_of_virtual_address(vaddr + stride) == page_of_virtual_address(vaddr)) {
+      vaddr = vaddr + stride;
+
+      // physical memory uses sizeof(uint64_t) bytes per word, also with 32-bit targets
+      paddr = paddr + stride * (sizeof(uint64_t) / WORDSIZE);
+
+      cache_block = cache_lookup(cache, vaddr, paddr, 0);
+
+      if (get_valid_flag(cache_block) == 0) {
+        handle_cache_miss(cache, cache_block, paddr);
+
+        set_prefetched_flag(cache_block, 1);
+
+        set_prefetches(cache, get_prefetches(cache) + 1);
+      }
+    }
+}
+
+uint64_t invalidate_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
+  uint64_t tag;
+  uint64_t* set;
+  uint64_t i;
+  uint64_t* cache_block;
+
+  tag = cache_tag(cache, paddr);
+  set = cache_set(cache, vaddr);
+
+  i = find_way(cache, set, tag);
+
+  if (i < get_associativity(cache)) {
+    cache_block = (uint64_t*) *(set + i);
+
+    set_valid_flag(cache_block, 0);
+    set_timestamp(cache_block, 0);
+
+    // memory has just been written anyway
+    set_dirty_flag(cache_block, 0);
+
+    return 1;
+  } else
+    return 0;
+}
+
+void invalidate_cached_word(uint64_t vaddr, uint64_t paddr) {
+  // the kernel writes to physical memory without going through the caches,
+  // invalidating stale copies keeps the caches coherent across context switches
+  if (L1_CACHE_ENABLED)
+    L1_kernel_invalidations = L1_kernel_invalidations
+      + invalidate_cache_block(L1_DCACHE, vaddr, paddr)
+      + invalidate_cache_block(L1_ICACHE, vaddr, paddr);
 }
 
 void flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
@@ -8507,27 +9834,57 @@ void flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
 }
 
 uint64_t load_from_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
+  uint64_t misses;
   uint64_t* cache_block;
   uint64_t* block_memory;
+  uint64_t data;
 
-  cache_block = retrieve_cache_block(cache, vaddr, paddr, 1);
+  misses = get_cache_misses(cache);
+
+  cache_block = retrieve_cache_block(cache, vaddr, paddr);
 
   block_memory = get_block_memory(cache_block);
 
-  return *(block_memory + cache_byte_offset(cache, vaddr) / sizeof(uint64_t));
+  data = *(block_memory + cache_byte_offset(cache, vaddr) / sizeof(uint64_t));
+
+  if (get_cache_misses(cache) != misses) {
+    if (annotating)
+      // miss is caused by the executing instruction
+      count_per_instruction(misses_per_instruction, pc);
+
+    // prefetch only after accessing missed block which may otherwise be evicted
+    prefetch_cache_block(cache, vaddr, paddr);
+  }
+
+  return data;
 }
 
 void store_in_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t data) {
+  uint64_t misses;
   uint64_t* cache_block;
   uint64_t* block_memory;
 
-  cache_block = retrieve_cache_block(cache, vaddr, paddr, 1);
+  misses = get_cache_misses(cache);
+
+  cache_block = retrieve_cache_block(cache, vaddr, paddr);
 
   block_memory = get_block_memory(cache_block);
 
   *(block_memory + cache_byte_offset(cache, vaddr) / sizeof(uint64_t)) = data;
 
+  // memory is always up to date, the write policy only affects the next level
   flush_cache_block(cache, cache_block, paddr);
+
+  write_cache_block(cache, cache_block, paddr);
+
+  if (get_cache_misses(cache) != misses) {
+    if (annotating)
+      // miss is caused by the executing instruction
+      count_per_instruction(misses_per_instruction, pc);
+
+    // prefetch only after accessing missed block which may otherwise be evicted
+    prefetch_cache_block(cache, vaddr, paddr);
+  }
 }
 
 uint64_t load_instruction_from_cache(uint64_t vaddr, uint64_t paddr) {
@@ -8543,26 +9900,17 @@ uint64_t load_data_from_cache(uint64_t vaddr, uint64_t paddr) {
 }
 
 void store_data_in_cache(uint64_t vaddr, uint64_t paddr, uint64_t data) {
-  uint64_t* cache_block;
-
   // assert: is_valid_virtual_address(vaddr) == 1
 
   store_in_cache(L1_DCACHE, vaddr, paddr, data);
 
-  if (L1_CACHE_COHERENCY) {
-    cache_block = retrieve_cache_block(L1_ICACHE, vaddr, paddr, 0);
-
+  if (L1_CACHE_COHERENCY)
     // mimicking x86 behavior (see Intel 64 and IA-32 Architectures Software Developer's
     // Manual Volume 3, Chapter 11.6 Self-Modifying Code: "A write to a memory location in
     // a code segment that is currently cached in the processor causes the associated
     // cache line (or lines) to be invalidated")
-    if (cache_block != (uint64_t*) 0) {
-      set_valid_flag(cache_block, 0);
-      set_timestamp(cache_block, 0);
-
-      L1_icache_coherency_invalidations = L1_icache_coherency_invalidations + 1;
-    }
-  }
+    L1_icache_coherency_invalidations = L1_icache_coherency_invalidations
+      + invalidate_cache_block(L1_ICACHE, vaddr, paddr);
 }
 
 void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name) {
@@ -8580,30 +9928,221 @@ void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name) {
     percentage_format_fractional_2(accesses, misses));
 }
 
-// -----------------------------------------------------------------
-// ---------------------------- MEMORY -----------------------------
-// -----------------------------------------------------------------
-
-uint64_t load_physical_memory(uint64_t* paddr) {
-  return *paddr;
+void print_cache_writes(uint64_t* cache, char* cache_name) {
+  printf("%s: %s%lu,%lu\n", selfie_name, cache_name,
+    get_write_throughs(cache),
+    get_write_backs(cache));
 }
 
-void store_physical_memory(uint64_t* paddr, uint64_t data) {
-  *paddr = data;
+void print_cache_prefetches(uint64_t* cache, char* cache_name) {
+  printf("%s: %s%lu,%lu(%lu.%.2lu%%)\n", selfie_name, cache_name,
+    get_prefetches(cache),
+    get_useful_prefetches(cache),
+    percentage_format_integral_2(get_prefetches(cache), get_useful_prefetches(cache)),
+    percentage_format_fractional_2(get_prefetches(cache), get_useful_prefetches(cache)));
 }
 
-uint64_t root_PDE_offset(uint64_t page) {
-  // with 4GB (2^32B) virtual memory there are 2^(32-12) 4KB (2^12B) pages;
-  // in a two-level page table with 4KB (2^12B) pages as leaf nodes and
-  // 64-bit pointers (2^3B), each leaf node accommodates 2^(12-3) PTEs;
-  // thus bits 9 through 19 encode the root PDE (page directory entry) offset
-  return page / NUMBEROFLEAFPTES; // right shift by 9 bits
-}
+void print_all_cache_profiles() {
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  printf("%s: L1 caches:     accesses,hits,misses\n", selfie_name);
 
-uint64_t leaf_PTE_offset(uint64_t page) {
-  // bits 0 through 8 encode the leaf PTE (page table entry) offset
-  return page - root_PDE_offset(page) * NUMBEROFLEAFPTES; // extract the 9 LSBs
-}
+  print_cache_profile(get_cache_hits(L1_DCACHE), get_cache_misses(L1_DCACHE), "data:          ");
+  printf(" (shared hits: %lu)", get_shared_hits(L1_DCACHE));
+  println();
+
+  print_cache_profile(get_cache_hits(L1_ICACHE), get_cache_misses(L1_ICACHE), "instruction:   ");
+  printf(" (shared hits: %lu)", get_shared_hits(L1_ICACHE));
+  if (L1_CACHE_COHERENCY)
+    printf(" (coherency invalidations: %lu)", L1_icache_coherency_invalidations);
+  println();
+
+  printf("%s: kernel invalidations: %lu\n", selfie_name, L1_kernel_invalidations);
+
+  if (CACHE_LEVELS > 1) {
+    printf("%s: L2, L3 caches: accesses,hits,misses\n", selfie_name);
+
+    print_cache_profile(get_cache_hits(L2_CACHE), get_cache_misses(L2_CACHE), "L2 unified:    ");
+    println();
+
+    if (CACHE_LEVELS > 2) {
+      print_cache_profile(get_cache_hits(L3_CACHE), get_cache_misses(L3_CACHE), "L3 shared:     ");
+      println();
+    }
+  }
+
+  printf("%s: policies:      %s replacement, write-%s, prefetch %s\n", selfie_name,
+    (char*) *(REPLACEMENT_POLICIES + CACHE_REPLACEMENT),
+    (char*) *(WRITE_POLICIES + CACHE_WRITE_POLICY),
+    (char*) *(PREFETCHERS + CACHE_PREFETCHER));
+
+  printf("%s: cache writes:  write-throughs,write-backs\n", selfie_name);
+
+  print_cache_writes(L1_DCACHE, "data:          ");
+
+  if (CACHE_LEVELS > 1)
+    print_cache_writes(L2_CACHE, "L2 unified:    ");
+  if (CACHE_LEVELS > 2)
+    print_cache_writes(L3_CACHE, "L3 shared:     ");
+
+  if (CACHE_PREFETCHER != PREFETCH_NONE) {
+    printf("%s: prefetches:    prefetched,useful\n", selfie_name);
+
+    print_cache_prefetches(L1_DCACHE, "data:          ");
+    print_cache_prefetches(L1_ICACHE, "instruction:   ");
+  }
+}
+
+void start_trace() {
+  // assert: trace_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  trace_fd = open_write_only(trace_name, S_IRUSR_IWUSR_IRGRP_IROTH);
+
+  if (signed_less_than(trace_fd, 0)) {
+    printf("%s: could not create memory access trace file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  trace_buffer = smalloc(TRACEBUFFERSIZE);
+
+  *trace_buffer       = TRACEMAGIC;
+  *(trace_buffer + 1) = TRACEBLOCKSIZE;
+
+  trace_buffer_bytes = TRACEHEADERENTRIES * sizeof(uint64_t);
+
+  trace_blocks   = zmalloc(2 * sizeof(uint64_t));
+  trace_counts   = zmalloc(2 * sizeof(uint64_t));
+  trace_previous = zmalloc(2 * sizeof(uint64_t));
+
+  trace_accesses = 0;
+  trace_runs     = 0;
+  trace_bytes    = 0;
+
+  tracing = 1;
+}
+
+void flush_trace_buffer() {
+  if (write(trace_fd, trace_buffer, trace_buffer_bytes) != trace_buffer_bytes) {
+    printf("%s: could not write memory access trace file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  trace_bytes = trace_bytes + trace_buffer_bytes;
+
+  trace_buffer_bytes = 0;
+}
+
+void trace_byte(uint64_t b) {
+  // store_character is not used since it requires b < 128 on hosts with signed characters
+  if (trace_buffer_bytes % sizeof(uint64_t) == 0)
+    *(trace_buffer + trace_buffer_bytes / sizeof(uint64_t)) = b;
+  else
+    *(trace_buffer + trace_buffer_bytes / sizeof(uint64_t)) =
+      *(trace_buffer + trace_buffer_bytes / sizeof(uint64_t))
+        + left_shift(b, (trace_buffer_bytes % sizeof(uint64_t)) * 8);
+
+  trace_buffer_bytes = trace_buffer_bytes + 1;
+
+  if (trace_buffer_bytes == TRACEBUFFERSIZE)
+    flush_trace_buffer();
+}
+
+void trace_number(uint64_t n) {
+  while (n >= 128) {
+    trace_byte(n % 128 + 128);
+
+    n = n / 128;
+  }
+
+  trace_byte(n);
+}
+
+void trace_run(uint64_t cache) {
+  uint64_t distance;
+
+  distance = *(trace_blocks + cache) - *(trace_previous + cache);
+
+  // zigzag encoding keeps small backward distances small
+  if (distance < INT64_MIN)
+    distance = distance * 2;
+  else
+    distance = (0 - distance) * 2 - 1;
+
+  trace_number(distance * 2 + cache);
+  trace_number(*(trace_counts + cache) - 1);
+
+  *(trace_previous + cache) = *(trace_blocks + cache);
+
+  trace_runs = trace_runs + 1;
+}
+
+void trace_access(uint64_t cache, uint64_t vaddr) {
+  uint64_t block;
+
+  block = vaddr / TRACEBLOCKSIZE;
+
+  trace_accesses = trace_accesses + 1;
+
+  if (*(trace_counts + cache) > 0) {
+    if (*(trace_blocks + cache) == block) {
+      // access extends current run
+      *(trace_counts + cache) = *(trace_counts + cache) + 1;
+
+      return;
+    }
+
+    trace_run(cache);
+  }
+
+  *(trace_blocks + cache) = block;
+  *(trace_counts + cache) = 1;
+}
+
+void stop_trace() {
+  if (*(trace_counts + TRACE_INSTRUCTION) > 0)
+    trace_run(TRACE_INSTRUCTION);
+  if (*(trace_counts + TRACE_DATA) > 0)
+    trace_run(TRACE_DATA);
+
+  flush_trace_buffer();
+
+  tracing = 0;
+
+  printf("%s: %lu memory accesses in %lu runs traced into %lu bytes of %s\n", selfie_name,
+    trace_accesses,
+    trace_runs,
+    trace_bytes,
+    trace_name);
+
+  // trace is only recorded once
+  trace_name = (char*) 0;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- MEMORY -----------------------------
+// -----------------------------------------------------------------
+
+uint64_t load_physical_memory(uint64_t* paddr) {
+  return *paddr;
+}
+
+void store_physical_memory(uint64_t* paddr, uint64_t data) {
+  *paddr = data;
+}
+
+uint64_t root_PDE_offset(uint64_t page) {
+  // with 4GB (2^32B) virtual memory there are 2^(32-12) 4KB (2^12B) pages;
+  // in a two-level page table with 4KB (2^12B) pages as leaf nodes and
+  // 64-bit pointers (2^3B), each leaf node accommodates 2^(12-3) PTEs;
+  // thus bits 9 through 19 encode the root PDE (page directory entry) offset
+  return page / NUMBEROFLEAFPTES; // right shift by 9 bits
+}
+
+uint64_t leaf_PTE_offset(uint64_t page) {
+  // bits 0 through 8 encode the leaf PTE (page table entry) offset
+  return page - root_PDE_offset(page) * NUMBEROFLEAFPTES; // extract the 9 LSBs
+}
 
 uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page) {
   uint64_t* leaf_pt;
@@ -8631,15 +10170,40 @@ uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page
 
 uint64_t get_page_frame(uint64_t* table, uint64_t page) {
   uint64_t* PTE_address;
+  uint64_t* entry;
+  uint64_t frame;
+
+  entry = (uint64_t*) 0;
+
+  if (table == tlb_table) {
+    // only translations of the page table of the current context are cached
+    entry = tlb_entry(page);
 
-  // TODO: translation lookaside buffer (TLB)
+    if (*(entry + 1) != 0)
+      if (*entry == page) {
+        tlb_hits = tlb_hits + 1;
+
+        return *(entry + 1);
+      }
+
+    tlb_misses = tlb_misses + 1;
+  }
 
   PTE_address = get_PTE_address(0, table, page);
 
   if (PTE_address == (uint64_t*) 0)
     return 0;
-  else
-    return (uint64_t) *PTE_address;
+
+  frame = *PTE_address;
+
+  if (entry != (uint64_t*) 0)
+    if (frame != 0) {
+      // only cache mapped pages
+      *entry       = page;
+      *(entry + 1) = frame;
+    }
+
+  return frame;
 }
 
 uint64_t is_page_mapped(uint64_t* table, uint64_t page) {
@@ -8649,6 +10213,21 @@ uint64_t is_page_mapped(uint64_t* table, uint64_t page) {
     return 0;
 }
 
+uint64_t next_mapped_page(uint64_t* table, uint64_t page) {
+  // returns first mapped page at or after page, or NUMBEROFPAGES if there is none
+  while (page < NUMBEROFPAGES) {
+    if (get_PTE_address(0, table, page) == (uint64_t*) 0)
+      // skip all pages of unallocated leaf page table
+      page = (root_PDE_offset(page) + 1) * NUMBEROFLEAFPTES;
+    else if (*(get_PTE_address(0, table, page)) != 0)
+      return page;
+    else
+      page = page + 1;
+  }
+
+  return NUMBEROFPAGES;
+}
+
 void set_page_frame(uint64_t* table, uint64_t page, uint64_t frame) {
   uint64_t* leaf_pt;
 
@@ -8669,6 +10248,24 @@ void set_page_frame(uint64_t* table, uint64_t page, uint64_t frame) {
   }
 }
 
+uint64_t* tlb_entry(uint64_t page) {
+  return tlb + page % TLBSIZE * 2;
+}
+
+void flush_tlb(uint64_t* table) {
+  if (tlb == (uint64_t*) 0)
+    tlb = smalloc(TLBSIZE * 2 * sizeof(uint64_t));
+
+  zero_memory(tlb, TLBSIZE * 2 * sizeof(uint64_t));
+
+  tlb_table = table;
+}
+
+void flush_tlb_entry(uint64_t* table, uint64_t page) {
+  if (table == tlb_table)
+    *(tlb_entry(page) + 1) = 0;
+}
+
 uint64_t page_of_virtual_address(uint64_t vaddr) {
   return vaddr / PAGESIZE;
 }
@@ -8728,13 +10325,54 @@ uint64_t load_virtual_memory(uint64_t* table, uint64_t vaddr) {
 }
 
 void store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data) {
+  uint64_t* paddr;
+
   // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
   // assert: is_virtual_address_mapped(table, vaddr) == 1
 
-  store_physical_memory(translate_virtual_to_physical(table, vaddr), data);
+  paddr = translate_virtual_to_physical(table, vaddr);
+
+  invalidate_cached_word(vaddr, (uint64_t) paddr);
+
+  store_physical_memory(paddr, data);
+}
+
+void copy_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t* buffer, uint64_t words, uint64_t upload) {
+  uint64_t* paddr;
+
+  // assert: all words from vaddr on are at valid and mapped virtual addresses
+
+  paddr = (uint64_t*) 0;
+
+  while (words > 0) {
+    if (paddr == (uint64_t*) 0)
+      // translate only once per page
+      paddr = translate_virtual_to_physical(table, vaddr);
+
+    if (upload) {
+      invalidate_cached_word(vaddr, (uint64_t) paddr);
+
+      store_physical_memory(paddr, *buffer);
+    } else
+      *buffer = load_physical_memory(paddr);
+
+    buffer = buffer + 1;
+    vaddr  = vaddr + sizeof(uint64_t);
+
+    if (vaddr % PAGESIZE == 0)
+      // next word is on another page
+      paddr = (uint64_t*) 0;
+    else
+      paddr = paddr + 1;
+
+    words = words - 1;
+  }
 }
 
 uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr) {
+  if (tracing)
+    trace_access(TRACE_DATA, vaddr);
+
   if (L1_CACHE_ENABLED)
     // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
     // assert: is_virtual_address_mapped(table, vaddr) == 1
@@ -8744,6 +10382,9 @@ uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr) {
 }
 
 void store_cached_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data) {
+  if (tracing)
+    trace_access(TRACE_DATA, vaddr);
+
   if (L1_CACHE_ENABLED)
     // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
     // assert: is_virtual_address_mapped(table, vaddr) == 1
@@ -8753,6 +10394,9 @@ void store_cached_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data)
 }
 
 uint64_t load_cached_instruction_word(uint64_t* table, uint64_t vaddr) {
+  if (tracing)
+    trace_access(TRACE_INSTRUCTION, vaddr);
+
   if (L1_CACHE_ENABLED)
     // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
     // assert: is_virtual_address_mapped(table, vaddr) == 1
@@ -9207,7 +10851,7 @@ void print_store_before() {
 void print_store_after(uint64_t vaddr) {
   if (is_virtual_address_valid(vaddr, WORDSIZE))
     if (is_valid_segment_write(vaddr))
-      if (is_virtual_address_mapped(pt, vaddr)) {
+      if (is_virtual_address_writable(vaddr)) {
         printf(" -> mem[0x%lX]==", vaddr);
         print_register_value(rs2);
       }
@@ -9220,7 +10864,7 @@ void record_store() {
 
   if (is_virtual_address_valid(vaddr, WORDSIZE))
     if (is_valid_segment_write(vaddr))
-      if (is_virtual_address_mapped(pt, vaddr))
+      if (is_virtual_address_writable(vaddr))
         record_state(load_virtual_memory(pt, vaddr));
 }
 
@@ -9236,7 +10880,7 @@ uint64_t do_store() {
 
   if (is_virtual_address_valid(vaddr, WORDSIZE)) {
     if (is_valid_segment_write(vaddr)) {
-      if (is_virtual_address_mapped(pt, vaddr)) {
+      if (is_virtual_address_writable(vaddr)) {
         // tolerate storing unwrapped values
         read_register_check_wrap(rs2, 0);
 
@@ -9249,6 +10893,9 @@ uint64_t do_store() {
           if (L1_CACHE_ENABLED)
             // effective nop still changes the cache state
             store_cached_virtual_memory(pt, vaddr, *(registers + rs2));
+          else if (tracing)
+            // and is still traced as memory access
+            trace_access(TRACE_DATA, vaddr);
         }
 
         // keep track of instruction address for profiling stores
@@ -9375,6 +11022,9 @@ void do_jal() {
 
     // and individually
     *(calls_per_procedure + a) = *(calls_per_procedure + a) + 1;
+
+    if (call_node != (uint64_t*) 0)
+      call_procedure(pc, *(registers + rd));
   } else if (signed_less_than(imm, 0)) {
     // just jump backward (to check loop condition again)
     pc = pc + imm;
@@ -9434,6 +11084,9 @@ void do_jalr() {
       nopc_jalr = nopc_jalr + 1;
 
     pc = next_pc;
+
+    if (call_node != (uint64_t*) 0)
+      return_from_procedure(pc);
   } else {
     // first link, then jump
 
@@ -9442,6 +11095,9 @@ void do_jalr() {
 
     // jump
     pc = next_pc;
+
+    if (call_node != (uint64_t*) 0)
+      call_procedure(pc, *(registers + rd));
   }
 
   write_register(rd);
@@ -9484,6 +11140,10 @@ void do_ecall() {
     } else if (symbolic) {
       printf("%s: context switching during symbolic execution is unsupported\n", selfie_name);
 
+      exit(EXITCODE_UNSUPPORTEDSYSCALL);
+    } else if (logging) {
+      printf("%s: context switching during logging is unsupported\n", selfie_name);
+
       exit(EXITCODE_UNSUPPORTEDSYSCALL);
     } else {
       pc = pc + INSTRUCTIONSIZE;
@@ -9768,6 +11428,15 @@ uint64_t is_valid_segment_write(uint64_t vaddr) {
     return 0;
 }
 
+uint64_t is_virtual_address_writable(uint64_t vaddr) {
+  // pages shared with other contexts are mapped but copied on write
+  if (is_virtual_address_mapped(pt, vaddr))
+    if (is_page_shared(current_context, page_of_virtual_address(vaddr)) == 0)
+      return 1;
+
+  return 0;
+}
+
 void print_exception(uint64_t exception, uint64_t fault) {
   printf("%s", (char*) *(EXCEPTIONS + exception));
 
@@ -9920,16 +11589,107 @@ void decode() {
   }
 }
 
-void execute() {
-  if (debug) {
-    if (record)
-      execute_record();
-    else
-      execute_debug();
+uint64_t* decoded_instruction(uint64_t* context, uint64_t vaddr) {
+  // assert: is_code_address(context, vaddr) == 1
+  // assert: vaddr % INSTRUCTIONSIZE == 0
+  return get_decoded_instructions(context)
+    + (vaddr - get_code_seg_start(context)) / INSTRUCTIONSIZE * DECODEDENTRIES;
+}
+
+uint64_t* decoded_instruction_at(uint64_t vaddr) {
+  uint64_t offset;
+
+  offset = vaddr - get_code_seg_start(current_context);
+
+  // vaddr below code segment wraps around to a large offset
+  if (offset < get_code_seg_size(current_context))
+    if (offset % INSTRUCTIONSIZE == 0)
+      return decoded_instructions + offset / INSTRUCTIONSIZE * DECODEDENTRIES;
+
+  return (uint64_t*) 0;
+}
+
+void invalidate_decoded_instructions(uint64_t* context, uint64_t vaddr, uint64_t size) {
+  if (get_decoded_instructions(context) != (uint64_t*) 0)
+    while (size > 0) {
+      if (is_code_address(context, vaddr)) {
+        set_decoded_is(decoded_instruction(context, vaddr), 0);
+
+        invalidate_translated_blocks(context, vaddr);
+      }
+
+      vaddr = vaddr + INSTRUCTIONSIZE;
+      size  = size - INSTRUCTIONSIZE;
+    }
+}
+
+void invalidate_translated_blocks(uint64_t* context, uint64_t vaddr) {
+  uint64_t* instruction;
+
+  set_decoded_block_length(decoded_instruction(context, vaddr), 0);
+
+  // translated basic blocks containing vaddr start after the closest preceding terminator
+  while (vaddr > get_code_seg_start(context)) {
+    vaddr = vaddr - INSTRUCTIONSIZE;
+
+    instruction = decoded_instruction(context, vaddr);
+
+    if (get_decoded_is(instruction) == 0)
+      return;
+    else if (is_block_terminator(get_decoded_is(instruction)))
+      return;
+
+    set_decoded_block_length(instruction, 0);
+  }
+}
+
+void fetch_and_decode() {
+  uint64_t* instruction;
+
+  instruction = decoded_instruction_at(pc);
+
+  if (instruction != (uint64_t*) 0) {
+    if (get_decoded_is(instruction) != 0) {
+      if (tracing)
+        trace_access(TRACE_INSTRUCTION, pc);
+
+      is  = get_decoded_is(instruction);
+      ir  = get_decoded_ir(instruction);
+      rd  = get_decoded_rd(instruction);
+      rs1 = get_decoded_rs1(instruction);
+      rs2 = get_decoded_rs2(instruction);
+      imm = get_decoded_imm(instruction);
+
+      return;
+    }
+
+    fetch();
+    decode();
+
+    // only cache successfully decoded instructions
+    if (not(trap)) {
+      set_decoded_is(instruction, is);
+      set_decoded_ir(instruction, ir);
+      set_decoded_rd(instruction, rd);
+      set_decoded_rs1(instruction, rs1);
+      set_decoded_rs2(instruction, rs2);
+      set_decoded_imm(instruction, imm);
+    }
 
     return;
   }
 
+  // fetch and decode throw the appropriate exception
+  fetch();
+  decode();
+}
+
+void execute() {
+  uint64_t a;
+
+  // keep track of instruction address for annotating source
+  a = pc;
+
   // assert: 1 <= is <= number of RISC-U instructions
   if (is == ADDI)
     do_addi();
@@ -9959,36 +11719,176 @@ void execute() {
     do_lui();
   else if (is == ECALL)
     do_ecall();
+
+  if (annotating)
+    count_execution(a);
 }
 
-void execute_record() {
+void execute_lean() {
+  // same semantics as execute on 64-bit targets, without
+  // profiling and without checking register initialization
+  uint64_t vaddr;
+  uint64_t next_pc;
+
   // assert: 1 <= is <= number of RISC-U instructions
   if (is == ADDI) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_addi();
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) + imm;
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_addi = ic_addi + 1;
   } else if (is == LOAD) {
-    record_load();
-    do_load();
+    vaddr = *(registers + rs1) + imm;
+
+    if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+      if (is_valid_segment_read(vaddr)) {
+        if (is_virtual_address_mapped(pt, vaddr)) {
+          if (rd != REG_ZR)
+            *(registers + rd) = load_virtual_memory(pt, vaddr);
+
+          pc = pc + INSTRUCTIONSIZE;
+
+          ic_load = ic_load + 1;
+        } else
+          throw_exception(EXCEPTION_PAGEFAULT, page_of_virtual_address(vaddr));
+      } else
+        throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+    } else
+      throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
   } else if (is == STORE) {
-    record_store();
-    do_store();
+    vaddr = *(registers + rs1) + imm;
+
+    if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+      if (is_valid_segment_write(vaddr)) {
+        if (is_virtual_address_writable(vaddr)) {
+          store_virtual_memory(pt, vaddr, *(registers + rs2));
+
+          pc = pc + INSTRUCTIONSIZE;
+
+          ic_store = ic_store + 1;
+        } else
+          throw_exception(EXCEPTION_PAGEFAULT, page_of_virtual_address(vaddr));
+      } else
+        throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+    } else
+      throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
   } else if (is == ADD) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_add();
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) + *(registers + rs2);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_add = ic_add + 1;
   } else if (is == SUB) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_sub();
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) - *(registers + rs2);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_sub = ic_sub + 1;
   } else if (is == MUL) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_mul();
+    if (rd != REG_ZR)
+      *(registers + rd) = *(registers + rs1) * *(registers + rs2);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_mul = ic_mul + 1;
   } else if (is == DIVU) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_divu();
+    if (*(registers + rs2) != 0) {
+      if (rd != REG_ZR)
+        *(registers + rd) = *(registers + rs1) / *(registers + rs2);
+
+      pc = pc + INSTRUCTIONSIZE;
+    } else
+      throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
+
+    ic_divu = ic_divu + 1;
   } else if (is == REMU) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
-    do_remu();
-  } else if (is == SLTU) {
-    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    if (*(registers + rs2) != 0) {
+      if (rd != REG_ZR)
+        *(registers + rd) = *(registers + rs1) % *(registers + rs2);
+
+      pc = pc + INSTRUCTIONSIZE;
+    } else
+      throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
+
+    ic_remu = ic_remu + 1;
+  } else if (is == SLTU) {
+    if (rd != REG_ZR) {
+      if (*(registers + rs1) < *(registers + rs2))
+        *(registers + rd) = 1;
+      else
+        *(registers + rd) = 0;
+    }
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_sltu = ic_sltu + 1;
+  } else if (is == BEQ) {
+    if (*(registers + rs1) == *(registers + rs2))
+      pc = pc + imm;
+    else
+      pc = pc + INSTRUCTIONSIZE;
+
+    ic_beq = ic_beq + 1;
+  } else if (is == JAL) {
+    if (rd != REG_ZR)
+      *(registers + rd) = pc + INSTRUCTIONSIZE;
+
+    pc = pc + imm;
+
+    ic_jal = ic_jal + 1;
+  } else if (is == JALR) {
+    next_pc = left_shift(right_shift(*(registers + rs1) + imm, 1), 1);
+
+    // link to next instruction (works even if rd == rs1)
+    if (rd != REG_ZR)
+      *(registers + rd) = pc + INSTRUCTIONSIZE;
+
+    pc = next_pc;
+
+    ic_jalr = ic_jalr + 1;
+  } else if (is == LUI) {
+    if (rd != REG_ZR)
+      *(registers + rd) = left_shift(imm, 12);
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_lui = ic_lui + 1;
+  } else if (is == ECALL)
+    // system calls are rare enough to go through the profiling path
+    do_ecall();
+}
+
+void execute_record() {
+  // assert: 1 <= is <= number of RISC-U instructions
+  if (is == ADDI) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_addi();
+  } else if (is == LOAD) {
+    record_load();
+    do_load();
+  } else if (is == STORE) {
+    record_store();
+    do_store();
+  } else if (is == ADD) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_add();
+  } else if (is == SUB) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_sub();
+  } else if (is == MUL) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_mul();
+  } else if (is == DIVU) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_divu();
+  } else if (is == REMU) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
+    do_remu();
+  } else if (is == SLTU) {
+    record_lui_addi_add_sub_mul_divu_remu_sltu_jal_jalr();
     do_sltu();
   } else if (is == BEQ) {
     record_beq();
@@ -10100,21 +12000,256 @@ void interrupt() {
   }
 }
 
+uint64_t is_block_terminator(uint64_t instruction_id) {
+  if (instruction_id == BEQ)
+    return 1;
+  else if (instruction_id == JAL)
+    return 1;
+  else if (instruction_id == JALR)
+    return 1;
+  else if (instruction_id == ECALL)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t* translated_block(uint64_t vaddr) {
+  uint64_t* block;
+
+  block = decoded_instruction_at(vaddr);
+
+  if (block != (uint64_t*) 0)
+    if (get_decoded_block_length(block) > 0) {
+      if (timer == TIMEROFF)
+        return block;
+      else if (timer > get_decoded_block_length(block))
+        // timer does not expire within block
+        return block;
+    }
+
+  return (uint64_t*) 0;
+}
+
+void execute_translated_block(uint64_t* block) {
+  uint64_t length;
+  uint64_t n;
+
+  length = get_decoded_block_length(block);
+
+  n = 0;
+
+  while (n < length) {
+    is  = get_decoded_is(block);
+    ir  = get_decoded_ir(block);
+    rd  = get_decoded_rd(block);
+    rs1 = get_decoded_rs1(block);
+    rs2 = get_decoded_rs2(block);
+    imm = get_decoded_imm(block);
+
+    if (tracing)
+      trace_access(TRACE_INSTRUCTION, pc);
+
+    execute();
+
+    n = n + 1;
+
+    if (trap)
+      // instructions after exception are not executed
+      length = n;
+    else
+      block = block + DECODEDENTRIES;
+  }
+
+  if (trap) {
+    if (timer != TIMEROFF)
+      // assert: timer > n
+      timer = timer - n;
+  } else if (is == ECALL)
+    // timer was reset by context switch which
+    // is charged to the switched-to context
+    interrupt();
+  else if (timer != TIMEROFF)
+    // assert: timer > n
+    timer = timer - n;
+}
+
+void run_translated_until_exception() {
+  uint64_t* block;
+  uint64_t* head;
+  uint64_t length;
+  uint64_t faulted;
+
+  // basic blocks are translated by interpreting them once
+  head   = (uint64_t*) 0;
+  length = 0;
+
+  trap = 0;
+
+  while (not(trap)) {
+    block = (uint64_t*) 0;
+
+    if (head == (uint64_t*) 0)
+      block = translated_block(pc);
+
+    if (block != (uint64_t*) 0)
+      execute_translated_block(block);
+    else {
+      if (head == (uint64_t*) 0) {
+        head   = decoded_instruction_at(pc);
+        length = 0;
+      }
+
+      fetch_and_decode();
+      execute();
+
+      faulted = trap;
+
+      interrupt();
+
+      length = length + 1;
+
+      if (head != (uint64_t*) 0) {
+        if (faulted) {
+          if (is == ECALL)
+            // system calls always trap but complete the basic block
+            set_decoded_block_length(head, length);
+
+          head = (uint64_t*) 0;
+        } else if (is_block_terminator(is)) {
+          set_decoded_block_length(head, length);
+
+          head = (uint64_t*) 0;
+        }
+      }
+    }
+  }
+
+  trap = 0;
+}
+
+void load_decoded_instructions() {
+  decoded_instructions = get_decoded_instructions(current_context);
+
+  if (decoded_instructions == (uint64_t*) 0) {
+    // allocate zeroed memory for pre-decoded instructions on first run
+    decoded_instructions = zmalloc(get_code_seg_size(current_context) / INSTRUCTIONSIZE * DECODEDENTRIES * sizeof(uint64_t));
+
+    set_decoded_instructions(current_context, decoded_instructions);
+  }
+}
+
+uint64_t is_batch_stopped() {
+  if (trap)
+    // stop at instruction that raised an exception
+    return 1;
+  else if (is == ECALL)
+    // stop at context switch which resets the timer
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t run_batch(uint64_t budget) {
+  uint64_t n;
+
+  // execute up to budget many instructions without timer interrupts
+  // in the execution loop selected for the run, rather than checking
+  // for profiling, caching, and debugging per instruction
+  n = 0;
+
+  if (execution_loop == LOOP_LEAN)
+    while (n < budget) {
+      fetch_and_decode();
+      execute_lean();
+
+      n = n + 1;
+
+      if (is_batch_stopped())
+        budget = n;
+    }
+  else if (execution_loop == LOOP_CACHE)
+    while (n < budget) {
+      // always fetch to keep instruction cache profile
+      fetch();
+      decode();
+      execute();
+
+      n = n + 1;
+
+      if (is_batch_stopped())
+        budget = n;
+    }
+  else if (execution_loop == LOOP_DEBUG)
+    while (n < budget) {
+      fetch_and_decode();
+
+      if (record)
+        execute_record();
+      else
+        execute_debug();
+
+      n = n + 1;
+
+      if (is_batch_stopped())
+        budget = n;
+    }
+  else
+    while (n < budget) {
+      fetch_and_decode();
+      execute();
+
+      n = n + 1;
+
+      if (is_batch_stopped())
+        budget = n;
+    }
+
+  return n;
+}
+
 void run_until_exception() {
+  uint64_t n;
+
+  load_decoded_instructions();
+
+  if (translate) {
+    run_translated_until_exception();
+
+    return;
+  }
+
   trap = 0;
 
   while (not(trap)) {
-    fetch();
-    decode();
-    execute();
+    // the timer does not expire in the first timer - 1 instructions,
+    // so they are charged at once after executing them as a batch
+    if (timer == TIMEROFF)
+      n = run_batch(UINT64_MAX);
+    else
+      n = run_batch(timer - 1);
+
+    if (trap) {
+      if (timer != TIMEROFF)
+        timer = timer - n;
+    } else if (is == ECALL)
+      // timer was reset by context switch which
+      // is charged to the switched-to context
+      interrupt();
+    else {
+      timer = timer - n;
 
-    interrupt();
+      // the timer expires with the next instruction unless
+      // an exception is pending which defers it to the next one
+      run_batch(1);
+
+      interrupt();
+    }
   }
 
   trap = 0;
 }
 
-uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max) {
+uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max, uint64_t opcode) {
   uint64_t a;
   uint64_t n;
   uint64_t i;
@@ -10128,6 +12263,12 @@ uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max) {
   while (i < code_size / INSTRUCTIONSIZE) {
     c = *(counters + i);
 
+    if (opcode != 0)
+      if (loads_per_instruction == stores_per_instruction)
+        // loads and stores are counted in one array
+        if (get_opcode(load_instruction(i * INSTRUCTIONSIZE)) != opcode)
+          c = 0;
+
     if (n < c) {
       if (c < max) {
         n = c;
@@ -10145,11 +12286,11 @@ uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max) {
     return UINT64_MAX;
 }
 
-uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max) {
+uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max, uint64_t opcode) {
   uint64_t a;
   uint64_t c;
 
-  a = instruction_with_max_counter(counters, max);
+  a = instruction_with_max_counter(counters, max, opcode);
 
   if (a != UINT64_MAX) {
     c = *(counters + a / INSTRUCTIONSIZE);
@@ -10171,1722 +12312,4505 @@ uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint6
   }
 }
 
-void print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters) {
+void print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters, uint64_t opcode) {
   printf("%s: %s%lu", selfie_name, message, total);
-  print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, UINT64_MAX)));
+  print_per_instruction_counter(total, counters,
+    print_per_instruction_counter(total, counters,
+      print_per_instruction_counter(total, counters, UINT64_MAX, opcode), opcode), opcode);
   println();
 }
 
-void print_access_profile(char* message, char* padding, uint64_t reads, uint64_t writes) {
-  if (reads + writes > 0) {
-    if (writes == 0)
-      // may happen in read-only memory segments
-      writes = 1;
+uint64_t* create_call_node(uint64_t* parent, char* name, uint64_t procedure) {
+  uint64_t* node;
 
-    printf("%s: %s%s%lu,%lu,%lu[%lu.%.2lu]\n", selfie_name, message, padding,
-      reads + writes, reads, writes,
-      ratio_format_integral_2(reads, writes),
-      ratio_format_fractional_2(reads, writes));
+  node = allocate_call_node();
+
+  set_call_parent(node, parent);
+  set_call_children(node, (uint64_t*) 0);
+  set_call_name(node, name);
+  set_call_procedure(node, procedure);
+  set_call_return(node, 0);
+  set_call_samples(node, 0);
+
+  if (parent != (uint64_t*) 0) {
+    set_call_sibling(node, get_call_children(parent));
+    set_call_children(parent, node);
+  } else {
+    set_call_sibling(node, call_roots);
+    call_roots = node;
   }
+
+  return node;
 }
 
-void print_per_register_profile(uint64_t reg) {
-  print_access_profile(get_register_name(reg), " register:   ", *(reads_per_register + reg), *(writes_per_register + reg));
+uint64_t* create_call_root(uint64_t* context) {
+  return create_call_node((uint64_t*) 0, get_name(context), get_pc(context));
 }
 
-void print_register_memory_profile() {
-  uint64_t reg;
+void init_procedure_names() {
+  uint64_t i;
+  uint64_t* entry;
 
-  printf("%s: CPU+memory:    reads+writes,reads,writes[reads/writes]\n", selfie_name);
+  procedure_names = (uint64_t*) 0;
 
-  print_access_profile("heap segment:  ", "", heap_reads, heap_writes);
+  // symbols are only known if binary has just been compiled
+  if (code_line_number == (uint64_t*) 0)
+    return;
 
-  print_per_register_profile(REG_GP);
-  print_access_profile("data segment:  ", "", data_reads, data_writes);
+  procedure_names = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(char*));
 
-  reg = 1;
+  i = 0;
 
-  while (reg < NUMBEROFREGISTERS) {
-    if (is_stack_register(reg)) {
-      stack_register_reads  = stack_register_reads + *(reads_per_register + reg);
-      stack_register_writes = stack_register_writes + *(writes_per_register + reg);
+  while (i < HASH_TABLE_SIZE) {
+    entry = (uint64_t*) *(global_symbol_table + i);
 
-      print_per_register_profile(reg);
+    while (entry != (uint64_t*) 0) {
+      if (get_class(entry) == PROCEDURE)
+        if (get_address(entry) < code_size)
+          if (is_undefined_procedure(entry) == 0)
+            *(procedure_names + get_address(entry) / INSTRUCTIONSIZE) = (uint64_t) get_string(entry);
+
+      entry = get_next_entry(entry);
     }
 
-    reg = reg + 1;
+    i = i + 1;
   }
+}
 
-  print_access_profile("stack total:   ", "", stack_register_reads, stack_register_writes);
-  print_access_profile("stack segment: ", "", stack_reads, stack_writes);
+void sample_call_stack() {
+  uint64_t instructions;
 
-  reg = 1;
+  instructions = get_total_number_of_instructions();
 
-  while (reg < NUMBEROFREGISTERS) {
-    if (is_argument_register(reg)) {
-      argument_register_reads  = argument_register_reads + *(reads_per_register + reg);
-      argument_register_writes = argument_register_writes + *(writes_per_register + reg);
+  // credit executing procedure with all samples since last call or return
+  set_call_samples(call_node, get_call_samples(call_node)
+    + instructions / sample_period - sampled_instructions / sample_period);
 
-      print_per_register_profile(reg);
-    }
+  sampled_instructions = instructions;
+}
 
-    reg = reg + 1;
-  }
+void call_procedure(uint64_t procedure, uint64_t return_address) {
+  uint64_t* node;
+  char* name;
 
-  print_access_profile("args total:    ", "", argument_register_reads, argument_register_writes);
+  sample_call_stack();
 
-  reg = 1;
+  node = get_call_children(call_node);
 
-  while (reg < NUMBEROFREGISTERS) {
-    if (is_temporary_register(reg)) {
-      temporary_register_reads  = temporary_register_reads + *(reads_per_register + reg);
-      temporary_register_writes = temporary_register_writes + *(writes_per_register + reg);
+  while (node != (uint64_t*) 0) {
+    if (get_call_procedure(node) == procedure) {
+      set_call_return(node, return_address);
 
-      print_per_register_profile(reg);
+      call_node = node;
+
+      return;
     }
 
-    reg = reg + 1;
+    node = get_call_sibling(node);
   }
 
-  print_access_profile("temps total:   ", "", temporary_register_reads, temporary_register_writes);
+  name = (char*) 0;
+
+  if (procedure_names != (uint64_t*) 0)
+    // procedure names are only known for the compiled binary
+    if (get_parent(current_context) == MY_CONTEXT)
+      if (procedure - code_start < code_size)
+        name = (char*) *(procedure_names + (procedure - code_start) / INSTRUCTIONSIZE);
+
+  call_node = create_call_node(call_node, name, procedure);
+
+  set_call_return(call_node, return_address);
 }
 
-void down_load_profiles() {
-  uint64_t* context;
-  uint64_t* parent_table;
-  uint64_t* vctxt;
+void return_from_procedure(uint64_t return_address) {
+  uint64_t* node;
 
-  context = used_contexts;
+  node = call_node;
 
-  while (context != (uint64_t*) 0) {
-    if (get_parent(context) != MY_CONTEXT) {
-      parent_table = get_pt(get_parent(context));
-      vctxt        = get_virtual_context(context);
+  // callees that never returned are popped as well
+  while (get_call_parent(node) != (uint64_t*) 0) {
+    if (get_call_return(node) == return_address) {
+      sample_call_stack();
 
-      set_lc_malloc(context, load_virtual_memory(parent_table, lc_malloc(vctxt)));
-      set_mc_mapped_heap(context, load_virtual_memory(parent_table, mc_mapped_heap(vctxt)));
-      set_ec_syscall(context, load_virtual_memory(parent_table, ec_syscall(vctxt)));
-      set_ec_page_fault(context, load_virtual_memory(parent_table, ec_page_fault(vctxt)));
-      set_ec_timer(context, load_virtual_memory(parent_table, ec_timer(vctxt)));
+      call_node = get_call_parent(node);
+
+      return;
     }
 
-    context = get_next_context(context);
+    node = get_call_parent(node);
   }
+
+  // jump is not a return
 }
 
-void print_instruction_versus_exception_profile(uint64_t* parent_context) {
-  uint64_t ic_count;
-  uint64_t ec_count;
-  uint64_t* context;
+uint64_t print_call_path(uint64_t* node) {
+  uint64_t number_of_written_characters;
 
-  printf("%s:          %lu executed instructions [%lu.%.2lu%% share, factor %lu.%.2lu]\n", selfie_name,
-    get_ic_all(parent_context),
-    percentage_format_integral_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
-    percentage_format_fractional_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
-    ratio_format_integral_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
-    ratio_format_fractional_2(get_total_number_of_instructions(), get_ic_all(parent_context)));
+  number_of_written_characters = 0;
 
-  ic_count = 0;
-  ec_count = 0;
+  if (get_call_parent(node) != (uint64_t*) 0)
+    number_of_written_characters = print_call_path(get_call_parent(node)) + dprintf(stacks_fd, ";");
 
-  context = used_contexts;
+  if (get_call_name(node) != (char*) 0)
+    return number_of_written_characters + dprintf(stacks_fd, "%s", get_call_name(node));
+  else
+    return number_of_written_characters + dprintf(stacks_fd, "0x%lX", get_call_procedure(node));
+}
 
-  while (context != (uint64_t*) 0) {
-    if (get_parent(context) == parent_context) {
-      ic_count = ic_count + get_ic_all(context);
-      ec_count = ec_count +
-        get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context);
-    }
+uint64_t print_call_stacks(uint64_t* node) {
+  uint64_t number_of_written_characters;
 
-    context = get_next_context(context);
-  }
+  number_of_written_characters = 0;
 
-  if (ec_count > 0)
-    // assert: get_ic_all(parent_context) > 0
-    printf("%s:          %lu exceptions handled by %lu instructions each [%lu.%.2lu%% overhead, factor %lu.%.2lu]\n", selfie_name,
-      ec_count,
-      ratio_format_integral_2(get_ic_all(parent_context), ec_count),
-      percentage_format_integral_2(ic_count, get_ic_all(parent_context)),
-      percentage_format_fractional_2(ic_count, get_ic_all(parent_context)),
-      ratio_format_integral_2(get_ic_all(parent_context), ic_count) + 1,
-      ratio_format_fractional_2(get_ic_all(parent_context), ic_count));
-}
+  while (node != (uint64_t*) 0) {
+    if (get_call_samples(node) > 0)
+      // collapsed call stack, one per line, followed by number of samples
+      number_of_written_characters = number_of_written_characters
+        + print_call_path(node)
+        + dprintf(stacks_fd, " %lu\n", get_call_samples(node));
 
-void print_profile() {
-  uint64_t* context;
+    number_of_written_characters = number_of_written_characters
+      + print_call_stacks(get_call_children(node));
 
-  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-  printf("%s: summary: ", selfie_name);
-  if (get_total_number_of_instructions() > 0) {
-    printf("%lu executed instructions in total [%lu.%.2lu%% nops]\n",
-      get_total_number_of_instructions(),
-      percentage_format_integral_2(get_total_number_of_instructions(), get_total_number_of_nops()),
-      percentage_format_fractional_2(get_total_number_of_instructions(), get_total_number_of_nops()));
-    printf("%s:          ", selfie_name);
+    node = get_call_sibling(node);
   }
-  printf("%lu.%.2luMB mapped memory [%lu.%.2lu%% of %luMB physical memory]\n",
-    ratio_format_integral_2(pused(), MEGABYTE),
-    ratio_format_fractional_2(pused(), MEGABYTE),
-    percentage_format_integral_2(PHYSICALMEMORYSIZE, pused()),
-    percentage_format_fractional_2(PHYSICALMEMORYSIZE, pused()),
-    PHYSICALMEMORYSIZE / MEGABYTE);
 
-  down_load_profiles();
+  return number_of_written_characters;
+}
 
-  context = used_contexts;
+void selfie_print_call_stacks() {
+  uint64_t number_of_written_characters;
 
-  while (context != (uint64_t*) 0) {
-    printf("%s: ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n", selfie_name);
-    printf("%s: context: %s\n", selfie_name, get_name(context));
-    if (get_ic_all(context) > 0) {
-      print_instruction_versus_exception_profile(context);
-      printf("%s:          %lu.%.2luKB peak stack size\n", selfie_name,
-        ratio_format_integral_2(get_mc_stack_peak(context), KILOBYTE),
-        ratio_format_fractional_2(get_mc_stack_peak(context), KILOBYTE));
-      printf("%s:          %lu.%.2luMB allocated in %lu mallocs (%lu.%.2luMB or %lu.%.2lu%% actually accessed)\n", selfie_name,
-        ratio_format_integral_2(get_program_break(context) - get_heap_seg_start(context), MEGABYTE),
-        ratio_format_fractional_2(get_program_break(context) - get_heap_seg_start(context), MEGABYTE),
-        get_lc_malloc(context),
-        ratio_format_integral_2(get_mc_mapped_heap(context), MEGABYTE),
-        ratio_format_fractional_2(get_mc_mapped_heap(context), MEGABYTE),
-        percentage_format_integral_2(round_up(get_program_break(context) - get_heap_seg_start(context), PAGESIZE),
-          get_mc_mapped_heap(context)),
-        percentage_format_fractional_2(round_up(get_program_break(context) - get_heap_seg_start(context), PAGESIZE),
-            get_mc_mapped_heap(context)));
-    }
-    if (get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context) > 0) {
-      printf("%s:          %lu exceptions handled by ", selfie_name,
-        get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context));
-      if (get_parent(context) == MY_CONTEXT) printf("%s", selfie_name);
-      else printf("%s", get_name(get_parent(context)));
-      if (get_ic_all(context) > 0)
-        printf(", one every %lu executed instructions",
-          ratio_format_integral_2(get_ic_all(context),
-            get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context)));
-      println();
-      printf("%s:          %lu syscalls, %lu page faults, %lu timer interrupts\n", selfie_name,
-        get_ec_syscall(context),
-        get_ec_page_fault(context),
-        get_ec_timer(context));
-    }
+  // assert: stacks_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-    context = get_next_context(context);
-  }
+  stacks_fd = open_write_only(stacks_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-  if (GC_ON) {
-    printf("%s: ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n", selfie_name);
-    print_gc_profile(1);
+  if (signed_less_than(stacks_fd, 0)) {
+    printf("%s: could not create call stacks output file %s\n", selfie_name, stacks_name);
+
+    exit(EXITCODE_IOERROR);
   }
 
-  if (get_total_number_of_instructions() > 0) {
-    print_instruction_counters();
+  output_name = stacks_name;
+  output_fd   = stacks_fd;
 
-    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    if (code_line_number != (uint64_t*) 0)
-      printf("%s: profile: total,max(ratio%%)@address(line#),2ndmax,3rdmax\n", selfie_name);
-    else
-      printf("%s: profile: total,max(ratio%%)@address,2ndmax,3rdmax\n", selfie_name);
-    print_per_instruction_profile("calls:   ", calls, calls_per_procedure);
-    print_per_instruction_profile("loops:   ", iterations, iterations_per_loop);
-    print_per_instruction_profile("loads:   ", ic_load, loads_per_instruction);
-    print_per_instruction_profile("stores:  ", ic_store, stores_per_instruction);
+  number_of_written_characters = print_call_stacks(call_roots);
 
-    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    print_register_memory_profile();
-  }
+  output_name = (char*) 0;
+  output_fd   = STDOUT_FD;
 
-  if (L1_CACHE_ENABLED) {
-    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    printf("%s: L1 caches:     accesses,hits,misses\n", selfie_name);
+  printf("%s: %lu characters of call stacks sampled every %lu instructions written into %s\n", selfie_name,
+    number_of_written_characters,
+    sample_period,
+    stacks_name);
 
-    print_cache_profile(get_cache_hits(L1_DCACHE), get_cache_misses(L1_DCACHE), "data:          ");
-    println();
+  call_roots = (uint64_t*) 0;
+  call_node  = (uint64_t*) 0;
 
-    print_cache_profile(get_cache_hits(L1_ICACHE), get_cache_misses(L1_ICACHE), "instruction:   ");
-    if (L1_CACHE_COHERENCY)
-      printf(" (coherency invalidations: %lu)", L1_icache_coherency_invalidations);
-    println();
-  }
+  // call stacks are only sampled once
+  stacks_name = (char*) 0;
 }
 
-void print_host_os() {
-  if (OS == SELFIE)
-    printf("selfie");
-  else if (OS == LINUX)
-    printf("Linux");
-  else if (OS == MACOS)
-    printf("macOS");
-  else if (OS == WINDOWS)
-    printf("Windows");
-  else if (OS == BAREMETAL)
-    printf("bare metal");
-  else
-    printf("unknown");
+void count_per_instruction(uint64_t* counters, uint64_t address) {
+  // only instructions of the loaded binary are counted
+  if (address - code_start < code_size)
+    *(counters + (address - code_start) / INSTRUCTIONSIZE) =
+      *(counters + (address - code_start) / INSTRUCTIONSIZE) + 1;
 }
 
-// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
-// -----------------------------------------------------------------
-// ----------------------    R U N T I M E    ----------------------
-// -----------------------------------------------------------------
-// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+void count_execution(uint64_t address) {
+  if (trap)
+    if (is != ECALL)
+      // instruction is executed again after handling the exception
+      return;
 
-// -----------------------------------------------------------------
-// ---------------------------- MEMORY -----------------------------
-// -----------------------------------------------------------------
+  count_per_instruction(executions_per_instruction, address);
+}
 
-uint64_t is_code_address(uint64_t* context, uint64_t vaddr) {
-  // is address in code segment?
-  if (vaddr >= get_code_seg_start(context))
-    if (vaddr < get_code_seg_start(context) + get_code_seg_size(context))
-      return 1;
+void flush_annotation_buffer() {
+  if (write(annotated_fd, annotation_buffer, annotation_buffer_bytes) != annotation_buffer_bytes) {
+    printf("%s: could not write annotated source file %s\n", selfie_name, annotated_name);
 
-  return 0;
-}
+    exit(EXITCODE_IOERROR);
+  }
 
-uint64_t is_data_address(uint64_t* context, uint64_t vaddr) {
-  // is address in data segment?
-  if (vaddr >= get_data_seg_start(context))
-    if (vaddr < get_data_seg_start(context) + get_data_seg_size(context))
-      return 1;
+  annotated_bytes = annotated_bytes + annotation_buffer_bytes;
 
-  return 0;
+  annotation_buffer_bytes = 0;
 }
 
-uint64_t is_stack_address(uint64_t* context, uint64_t vaddr) {
-  // is address in stack segment?
-  if (vaddr >= *(get_regs(context) + REG_SP))
-    if (vaddr <= HIGHESTVIRTUALADDRESS)
-      return 1;
+void annotate_byte(uint64_t b) {
+  // store_character is not used since it requires b < 128 on hosts with signed characters
+  if (annotation_buffer_bytes % sizeof(uint64_t) == 0)
+    *(annotation_buffer + annotation_buffer_bytes / sizeof(uint64_t)) = b;
+  else
+    *(annotation_buffer + annotation_buffer_bytes / sizeof(uint64_t)) =
+      *(annotation_buffer + annotation_buffer_bytes / sizeof(uint64_t))
+        + left_shift(b, (annotation_buffer_bytes % sizeof(uint64_t)) * 8);
 
-  return 0;
+  annotation_buffer_bytes = annotation_buffer_bytes + 1;
+
+  if (annotation_buffer_bytes == ANNOTATIONBUFFERSIZE)
+    flush_annotation_buffer();
 }
 
-uint64_t is_heap_address(uint64_t* context, uint64_t vaddr) {
-  // is address in heap segment?
-  if (vaddr >= get_heap_seg_start(context))
-    if (vaddr < get_program_break(context))
-      return 1;
+void annotate_string(char* s) {
+  uint64_t i;
 
-  return 0;
-}
+  i = 0;
 
-uint64_t is_address_between_stack_and_heap(uint64_t* context, uint64_t vaddr) {
-  // is address between heap and stack segments?
-  if (vaddr >= get_program_break(context))
-    if (vaddr < *(get_regs(context) + REG_SP))
-      return 1;
+  while (load_character(s, i) != 0) {
+    annotate_byte(load_character(s, i));
 
-  return 0;
+    i = i + 1;
+  }
 }
 
-uint64_t is_data_stack_heap_address(uint64_t* context, uint64_t vaddr) {
-  if (is_data_address(context, vaddr))
-    return 1;
-  else if (is_stack_address(context, vaddr))
-    return 1;
-  else if (is_heap_address(context, vaddr))
-    return 1;
-  else
-    return 0;
+void annotate_counter(uint64_t n) {
+  annotate_string(itoa(n, integer_buffer, 10, 0, 9));
+  annotate_byte(':');
 }
 
-// -----------------------------------------------------------------
-// ---------------------- GARBAGE COLLECTOR ------------------------
-// -----------------------------------------------------------------
+void annotate_line(uint64_t line) {
+  if (line > 0)
+    if (line < number_of_lines)
+      if (*(instructions_per_line + line) > 0) {
+        if (*(executions_per_line + line) > 0)
+          annotate_counter(*(executions_per_line + line));
+        else
+          // like gcov, code that was never executed stands out
+          annotate_string("    #####:");
 
-void emit_fetch_stack_pointer() {
-  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_stack_pointer"),
-    0, PROCEDURE, UINT64_T, 0, code_size);
+        annotate_counter(*(loads_per_line + line));
+        annotate_counter(*(stores_per_line + line));
+        annotate_counter(*(misses_per_line + line));
+        annotate_string(itoa(line, integer_buffer, 10, 0, 5));
+        annotate_byte(':');
 
-  emit_add(REG_A0, REG_ZR, REG_SP);
+        return;
+      }
 
-  emit_jalr(REG_ZR, REG_RA, 0);
+  // line without code
+  annotate_string("        -:        -:        -:        -:");
+  annotate_string(itoa(line, integer_buffer, 10, 0, 5));
+  annotate_byte(':');
 }
 
-void emit_fetch_global_pointer() {
-  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_global_pointer"),
-    0, PROCEDURE, UINT64_T, 0, code_size);
-
-  emit_add(REG_A0, REG_ZR, REG_GP);
+void profile_lines(uint64_t* source_file) {
+  uint64_t i;
+  uint64_t line;
 
-  emit_jalr(REG_ZR, REG_RA, 0);
-}
+  number_of_lines = 0;
 
-void emit_fetch_data_segment_size_interface() {
-  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_data_segment_size"),
-    0, PROCEDURE, UINT64_T, 0, code_size);
+  i = get_source_code_start(source_file) / INSTRUCTIONSIZE;
 
-  // up to three instructions needed to load data segment size but is not yet known
+  while (i < get_source_code_end(source_file) / INSTRUCTIONSIZE) {
+    if (*(code_line_number + i) >= number_of_lines)
+      number_of_lines = *(code_line_number + i) + 1;
 
-  emit_nop();
-  emit_nop();
-  emit_nop();
+    i = i + 1;
+  }
 
-  emit_jalr(REG_ZR, REG_RA, 0);
-}
+  instructions_per_line = zmalloc(number_of_lines * sizeof(uint64_t));
+  executions_per_line   = zmalloc(number_of_lines * sizeof(uint64_t));
+  loads_per_line        = zmalloc(number_of_lines * sizeof(uint64_t));
+  stores_per_line       = zmalloc(number_of_lines * sizeof(uint64_t));
+  misses_per_line       = zmalloc(number_of_lines * sizeof(uint64_t));
 
-void emit_fetch_data_segment_size_implementation(uint64_t fetch_dss_code_location) {
-  uint64_t saved_code_size;
+  i = get_source_code_start(source_file) / INSTRUCTIONSIZE;
 
-  // set code emission to fetch_data_segment_size
-  saved_code_size = code_size;
-  code_size       = fetch_dss_code_location;
+  while (i < get_source_code_end(source_file) / INSTRUCTIONSIZE) {
+    line = *(code_line_number + i);
 
-  // assert: emitting no more than 3 instructions
+    *(instructions_per_line + line) = *(instructions_per_line + line) + 1;
 
-  // load data segment size into A0 (size is independent of entry point)
-  load_small_and_medium_integer(REG_A0, data_size);
+    // a line is executed as often as its most often executed instruction
+    if (*(executions_per_instruction + i) > *(executions_per_line + line))
+      *(executions_per_line + line) = *(executions_per_instruction + i);
 
-  // discount NOPs in profile that were generated for fetch_data_segment_size
-  ic_addi = ic_addi - (code_size - fetch_dss_code_location) / INSTRUCTIONSIZE;
+    if (loads_per_instruction != stores_per_instruction) {
+      *(loads_per_line + line)  = *(loads_per_line + line) + *(loads_per_instruction + i);
+      *(stores_per_line + line) = *(stores_per_line + line) + *(stores_per_instruction + i);
+    } else if (get_opcode(load_instruction(i * INSTRUCTIONSIZE)) == OP_LOAD)
+      *(loads_per_line + line) = *(loads_per_line + line) + *(loads_per_instruction + i);
+    else
+      *(stores_per_line + line) = *(stores_per_line + line) + *(stores_per_instruction + i);
+    *(misses_per_line + line) = *(misses_per_line + line) + *(misses_per_instruction + i);
 
-  // restore original code size
-  code_size = saved_code_size;
+    i = i + 1;
+  }
 }
 
-void implement_gc_brk(uint64_t* context) {
-  // parameter
-  uint64_t new_program_break;
+uint64_t print_line_profile(char* name) {
+  uint64_t number_of_written_characters;
+  uint64_t line;
+  uint64_t first;
 
-  // local variable
-  uint64_t size;
+  number_of_written_characters = dprintf(annotate_fd, "{\"source\":\"%s\",\"annotated\":\"%s\",\"lines\":[", name, annotated_name);
 
-  new_program_break = *(get_regs(context) + REG_A0);
+  line  = 1;
+  first = 1;
 
-  // check if brk is actually asked for more memory
-  // if not, fall back to the default brk syscall
-  if (new_program_break > get_program_break(context)) {
-    if (debug_syscalls) {
-      printf("(gc_brk): ");
-      print_register_hexadecimal(REG_A0);
+  while (line < number_of_lines) {
+    if (*(instructions_per_line + line) > 0) {
+      if (first)
+        first = 0;
+      else
+        number_of_written_characters = number_of_written_characters + dprintf(annotate_fd, ",");
+
+      // one line of source code with code per line of output
+      number_of_written_characters = number_of_written_characters
+        + dprintf(annotate_fd, "\n{\"line\":%lu,\"instructions\":%lu,\"executions\":%lu,", line,
+            *(instructions_per_line + line),
+            *(executions_per_line + line))
+        + dprintf(annotate_fd, "\"loads\":%lu,\"stores\":%lu,\"misses\":%lu}",
+            *(loads_per_line + line),
+            *(stores_per_line + line),
+            *(misses_per_line + line));
     }
 
-    // calculate size by subtracting the current from the new program break
-    size = new_program_break - get_program_break(context);
+    line = line + 1;
+  }
 
-    if (debug_syscalls) {
-      printf(" |- ");
-      print_register_hexadecimal(REG_A0);
-    }
+  return number_of_written_characters + dprintf(annotate_fd, "]}");
+}
 
-    // yields pointer to new/reused memory (or 0 if failed)
-    *(get_regs(context) + REG_A0) = (uint64_t) gc_malloc_implementation(context, size);
+void annotate_source_file(uint64_t* source_file) {
+  char* name;
+  uint64_t* buffer;
+  uint64_t number_of_read_bytes;
+  uint64_t i;
+  uint64_t c;
+  uint64_t line;
+  uint64_t new_line;
 
-    if (debug_syscalls) {
-      printf(" -> ");
-      print_register_hexadecimal(REG_A0);
-      println();
-    }
+  name = get_source_name(source_file);
 
-    // assert: _bump pointer is last entry in data segment
+  profile_lines(source_file);
 
-    // tracking the program break with the _bump pointer of the program
-    store_virtual_memory(get_pt(context), get_data_seg_end_gc(context) - WORDSIZE, get_program_break(context));
+  // assert: string_length(name) + 5 < MAX_FILENAME_LENGTH
 
-    // assert: gc_brk syscall is invoked by selfie's malloc
+  annotated_name = string_alloc(string_length(name) + 5);
 
-    set_lc_malloc(context, get_lc_malloc(context) + 1);
+  sprintf(annotated_name, "%s.gcov", name);
 
-    // skip next seven instructions of selfie's malloc
-    // to avoid using its bump pointer allocator
-    set_pc(context, get_pc(context) + 8 * INSTRUCTIONSIZE);
-  } else
-    implement_brk(context);
-}
+  source_fd = open_read_only(name);
 
-uint64_t is_gc_library(uint64_t* context) {
-  if (context == (uint64_t*) 0)
-    return 1;
-  else
-    return 0;
-}
+  if (signed_less_than(source_fd, 0)) {
+    printf("%s: could not open input file %s\n", selfie_name, name);
 
-uint64_t* allocate_metadata(uint64_t* context) {
-  if (is_gc_library(context))
-    return allocate_new_memory(context, GC_METADATA_SIZE);
-  else
-    return smalloc(GC_METADATA_SIZE);
-}
+    exit(EXITCODE_IOERROR);
+  }
 
-uint64_t get_stack_seg_start_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return fetch_stack_pointer();
-  else
-    return *(get_regs(context) + REG_SP);
-}
+  annotated_fd = open_write_only(annotated_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-uint64_t get_data_seg_start_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_data_seg_start;
-  else
-    return get_data_seg_start(context);
-}
+  if (signed_less_than(annotated_fd, 0)) {
+    printf("%s: could not create annotated source file %s\n", selfie_name, annotated_name);
 
-uint64_t get_data_seg_end_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_data_seg_end;
-  else
-    return get_data_seg_start(context) + get_data_seg_size(context);
-}
+    exit(EXITCODE_IOERROR);
+  }
 
-uint64_t get_heap_seg_start_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_heap_seg_start;
-  else
-    return get_heap_seg_start(context);
-}
+  buffer = smalloc(ANNOTATIONBUFFERSIZE);
 
-uint64_t get_heap_seg_end_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_heap_seg_end;
-  else
-    return get_program_break(context);
-}
+  annotated_bytes = 0;
 
-uint64_t* get_used_list_head_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_used_list;
-  else
-    return get_used_list_head(context);
-}
+  annotate_line(0);
+  annotate_string("Source:");
+  annotate_string(name);
+  annotate_byte(CHAR_LF);
+  annotate_line(0);
+  annotate_string("Columns:executions:loads:stores:L1 misses:line:source");
+  annotate_byte(CHAR_LF);
 
-uint64_t* get_free_list_head_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_free_list;
-  else
-    return get_free_list_head(context);
-}
+  line     = 0;
+  new_line = 1;
 
-uint64_t get_gcs_in_period_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return gc_num_gcs_in_period;
-  else
-    return get_gcs_in_period(context);
-}
+  number_of_read_bytes = read(source_fd, buffer, ANNOTATIONBUFFERSIZE);
 
-uint64_t get_gc_enabled_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    return USE_GC_LIBRARY;
-  else
-    return get_use_gc_kernel(context);
-}
+  while (signed_less_than(0, number_of_read_bytes)) {
+    i = 0;
 
-void set_data_and_heap_segments_gc(uint64_t* context) {
-  if (is_gc_library(context)) {
-    // we use fetch_global_pointer rather than smalloc_system(0)
-    // to be accurate even if smalloc has been called before
-    gc_data_seg_end   = fetch_global_pointer();
-    gc_data_seg_start = gc_data_seg_end - fetch_data_segment_size();
+    while (i < number_of_read_bytes) {
+      if (new_line) {
+        line = line + 1;
 
-    // assert: smalloc_system(0) returns program break
-    gc_heap_seg_start = (uint64_t) smalloc_system(0);
-    gc_heap_seg_end   = gc_heap_seg_start;
-  }
-}
+        annotate_line(line);
 
-void set_used_list_head_gc(uint64_t* context, uint64_t* used_list_head){
-  if (is_gc_library(context))
-    gc_used_list = used_list_head;
-  else
-    set_used_list_head(context, used_list_head);
-}
+        new_line = 0;
+      }
 
-void set_free_list_head_gc(uint64_t* context, uint64_t* free_list_head) {
-  if (is_gc_library(context))
-    gc_free_list = free_list_head;
-  else
-    set_free_list_head(context, free_list_head);
-}
+      // bytes are not loaded as characters which may be signed on the host
+      c = get_bits(*(buffer + i / sizeof(uint64_t)), (i % sizeof(uint64_t)) * 8, 8);
 
-void set_gcs_in_period_gc(uint64_t* context, uint64_t gcs) {
-  if (is_gc_library(context))
-    gc_num_gcs_in_period = gcs;
-  else
-    set_gcs_in_period(context, gcs);
-}
+      annotate_byte(c);
 
-void set_gc_enabled_gc(uint64_t* context) {
-  if (is_gc_library(context))
-    USE_GC_LIBRARY = GC_ENABLED;
-  else
-    set_use_gc_kernel(context, GC_ENABLED);
-}
+      if (c == (uint64_t) CHAR_LF)
+        new_line = 1;
 
-uint64_t is_gc_enabled(uint64_t* context) {
-  return get_gc_enabled_gc(context) == GC_ENABLED;
-}
+      i = i + 1;
+    }
 
-void gc_init(uint64_t* context) {
-  gc_init_selfie(context);
-}
+    number_of_read_bytes = read(source_fd, buffer, ANNOTATIONBUFFERSIZE);
+  }
 
-void gc_init_selfie(uint64_t* context) {
-  reset_gc_counters();
+  if (new_line == 0)
+    // last line is not terminated
+    annotate_byte(CHAR_LF);
 
-  // calculate metadata size using actual size of pointers and integers
-  GC_METADATA_SIZE = 2 * sizeof(uint64_t*) + 2 * sizeof(uint64_t);
+  flush_annotation_buffer();
 
-  if (is_gc_library(context))
-    GC_WORDSIZE = sizeof(uint64_t);
-  else
-    GC_WORDSIZE = WORDSIZE;
+  printf("%s: %lu characters of %lu annotated lines of %s written into %s\n", selfie_name,
+    annotated_bytes,
+    line,
+    name,
+    annotated_name);
 
-  set_data_and_heap_segments_gc(context);
+  if (annotated_files > 0)
+    annotated_characters = annotated_characters + dprintf(annotate_fd, ",\n");
 
-  set_used_list_head_gc(context, (uint64_t*) 0);
-  set_free_list_head_gc(context, (uint64_t*) 0);
-  set_gcs_in_period_gc(context, 0);
-  set_gc_enabled_gc(context);
+  annotated_characters = annotated_characters + print_line_profile(name);
+
+  annotated_files = annotated_files + 1;
 }
 
-uint64_t* retrieve_from_free_list(uint64_t* context, uint64_t size) {
-  uint64_t* prev_node;
-  uint64_t* node;
+void annotate_source_files(uint64_t* source_file) {
+  if (source_file != (uint64_t*) 0) {
+    // annotate source files in the order in which they were compiled
+    annotate_source_files(get_next_source_file(source_file));
 
-  prev_node = (uint64_t*) 0;
+    annotate_source_file(source_file);
+  }
+}
 
-  node = get_free_list_head_gc(context);
+void selfie_annotate() {
+  annotating = 0;
 
-  while (node != (uint64_t*) 0) {
-    if (get_metadata_size(node) == size) {
-      if (prev_node == (uint64_t*) 0)
-        set_free_list_head_gc(context, get_metadata_next(node));
-      else
-        set_metadata_next(prev_node, get_metadata_next(node));
+  if (source_files == (uint64_t*) 0)
+    printf("%s: nothing to annotate, only binaries compiled in this run can be annotated\n", selfie_name);
+  else {
+    // assert: annotate_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-      set_metadata_next(node, get_used_list_head_gc(context));
+    annotate_fd = open_write_only(annotate_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-      set_used_list_head_gc(context, node);
+    if (signed_less_than(annotate_fd, 0)) {
+      printf("%s: could not create per-line profile output file %s\n", selfie_name, annotate_name);
 
-      return node;
+      exit(EXITCODE_IOERROR);
     }
 
-    prev_node = node;
+    output_name = annotate_name;
+    output_fd   = annotate_fd;
 
-    node = get_metadata_next(node);
-  }
+    annotation_buffer = smalloc(ANNOTATIONBUFFERSIZE);
 
-  return (uint64_t*) 0;
-}
+    annotated_files      = 0;
+    annotated_characters = dprintf(annotate_fd, "{\"files\":[\n");
 
-uint64_t gc_load_memory(uint64_t* context, uint64_t address) {
-  if (is_gc_library(context))
-    return *((uint64_t*) address);
-  else
-    // assert: is_virtual_address_valid(address, WORDSIZE) == 1
-    if (is_virtual_address_mapped(get_pt(context), address))
-      return load_virtual_memory(get_pt(context), address);
-    else
-      return 0;
-}
+    annotate_source_files(source_files);
 
-void gc_store_memory(uint64_t* context, uint64_t address, uint64_t value) {
-  if (is_gc_library(context))
-    *((uint64_t*) address) = value;
-  else
-    // assert: is_virtual_address_valid(address, WORDSIZE) == 1
-    if (is_virtual_address_mapped(get_pt(context), address))
-      store_virtual_memory(get_pt(context), address, value);
-}
+    annotated_characters = annotated_characters + dprintf(annotate_fd, "\n]}\n");
 
-void zero_block(uint64_t* context, uint64_t* metadata) {
-  uint64_t block_start;
-  uint64_t block_end;
+    output_name = (char*) 0;
+    output_fd   = STDOUT_FD;
 
-  // zero block memory
-  block_start = (uint64_t) get_metadata_memory(metadata);
-  block_end   = block_start + get_metadata_size(metadata);
+    printf("%s: %lu characters of per-line profile of %lu source files written into %s\n", selfie_name,
+      annotated_characters,
+      annotated_files,
+      annotate_name);
+  }
 
-  while (block_start < block_end) {
-    gc_store_memory(context, block_start, 0);
+  // source files are only annotated once
+  annotate_name = (char*) 0;
+}
 
-    block_start = block_start + GC_WORDSIZE;
+void print_access_profile(char* message, char* padding, uint64_t reads, uint64_t writes) {
+  if (reads + writes > 0) {
+    if (writes == 0)
+      // may happen in read-only memory segments
+      writes = 1;
+
+    printf("%s: %s%s%lu,%lu,%lu[%lu.%.2lu]\n", selfie_name, message, padding,
+      reads + writes, reads, writes,
+      ratio_format_integral_2(reads, writes),
+      ratio_format_fractional_2(reads, writes));
   }
 }
 
-uint64_t* allocate_new_memory(uint64_t* context, uint64_t size) {
-  uint64_t block_start;
-  uint64_t new_program_break;
+void print_per_register_profile(uint64_t reg) {
+  print_access_profile(get_register_name(reg), " register:   ", *(reads_per_register + reg), *(writes_per_register + reg));
+}
 
-  if (is_gc_library(context)) {
-    block_start = (uint64_t) smalloc_system(size);
+void print_register_memory_profile() {
+  uint64_t reg;
 
-    // assert: smalloc_system is a bump pointer allocator that may reuse memory
+  printf("%s: CPU+memory:    reads+writes,reads,writes[reads/writes]\n", selfie_name);
 
-    if (block_start + size > gc_heap_seg_end)
-      gc_heap_seg_end = block_start + size;
+  print_access_profile("heap segment:  ", "", heap_reads, heap_writes);
 
-    return (uint64_t*) block_start;
-  } else {
-    block_start = get_program_break(context);
+  print_per_register_profile(REG_GP);
+  print_access_profile("data segment:  ", "", data_reads, data_writes);
 
-    // attempt to update program break
+  reg = 1;
 
-    new_program_break = try_brk(context, block_start + size);
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_stack_register(reg)) {
+      stack_register_reads  = stack_register_reads + *(reads_per_register + reg);
+      stack_register_writes = stack_register_writes + *(writes_per_register + reg);
 
-    if (new_program_break == block_start + size)
-      // attempt to update program break succeeded
-      return (uint64_t*) block_start;
-  }
+      print_per_register_profile(reg);
+    }
 
-  return (uint64_t*) 0;
-}
+    reg = reg + 1;
+  }
 
-uint64_t* reuse_memory(uint64_t* context, uint64_t size) {
-  uint64_t* metadata;
+  print_access_profile("stack total:   ", "", stack_register_reads, stack_register_writes);
+  print_access_profile("stack segment: ", "", stack_reads, stack_writes);
 
-  // check if reusable memory is available in free list
-  metadata = retrieve_from_free_list(context, size);
+  reg = 1;
 
-  if (metadata != (uint64_t*) 0) {
-    // zeroing reused memory is optional!
-    zero_block(context, metadata);
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_argument_register(reg)) {
+      argument_register_reads  = argument_register_reads + *(reads_per_register + reg);
+      argument_register_writes = argument_register_writes + *(writes_per_register + reg);
+
+      print_per_register_profile(reg);
+    }
+
+    reg = reg + 1;
+  }
+
+  print_access_profile("args total:    ", "", argument_register_reads, argument_register_writes);
+
+  reg = 1;
+
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_temporary_register(reg)) {
+      temporary_register_reads  = temporary_register_reads + *(reads_per_register + reg);
+      temporary_register_writes = temporary_register_writes + *(writes_per_register + reg);
+
+      print_per_register_profile(reg);
+    }
+
+    reg = reg + 1;
+  }
+
+  print_access_profile("temps total:   ", "", temporary_register_reads, temporary_register_writes);
+}
+
+void down_load_profiles() {
+  uint64_t* context;
+  uint64_t* parent_table;
+  uint64_t* vctxt;
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) != MY_CONTEXT) {
+      parent_table = get_pt(get_parent(context));
+      vctxt        = get_virtual_context(context);
+
+      set_lc_malloc(context, load_virtual_memory(parent_table, lc_malloc(vctxt)));
+      set_mc_mapped_heap(context, load_virtual_memory(parent_table, mc_mapped_heap(vctxt)));
+      set_ec_syscall(context, load_virtual_memory(parent_table, ec_syscall(vctxt)));
+      set_ec_page_fault(context, load_virtual_memory(parent_table, ec_page_fault(vctxt)));
+      set_ec_timer(context, load_virtual_memory(parent_table, ec_timer(vctxt)));
+    }
+
+    context = get_next_context(context);
+  }
+}
+
+void print_instruction_versus_exception_profile(uint64_t* parent_context) {
+  uint64_t ic_count;
+  uint64_t ec_count;
+  uint64_t* context;
+
+  printf("%s:          %lu executed instructions [%lu.%.2lu%% share, factor %lu.%.2lu]\n", selfie_name,
+    get_ic_all(parent_context),
+    percentage_format_integral_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
+    percentage_format_fractional_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
+    ratio_format_integral_2(get_total_number_of_instructions(), get_ic_all(parent_context)),
+    ratio_format_fractional_2(get_total_number_of_instructions(), get_ic_all(parent_context)));
+
+  ic_count = 0;
+  ec_count = 0;
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) == parent_context) {
+      ic_count = ic_count + get_ic_all(context);
+      ec_count = ec_count +
+        get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context);
+    }
+
+    context = get_next_context(context);
+  }
+
+  if (ec_count > 0)
+    // assert: get_ic_all(parent_context) > 0
+    printf("%s:          %lu exceptions handled by %lu instructions each [%lu.%.2lu%% overhead, factor %lu.%.2lu]\n", selfie_name,
+      ec_count,
+      ratio_format_integral_2(get_ic_all(parent_context), ec_count),
+      percentage_format_integral_2(ic_count, get_ic_all(parent_context)),
+      percentage_format_fractional_2(ic_count, get_ic_all(parent_context)),
+      ratio_format_integral_2(get_ic_all(parent_context), ic_count) + 1,
+      ratio_format_fractional_2(get_ic_all(parent_context), ic_count));
+}
+
+void print_profile() {
+  uint64_t* context;
+
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  printf("%s: summary: ", selfie_name);
+  if (get_total_number_of_instructions() > 0) {
+    printf("%lu executed instructions in total", get_total_number_of_instructions());
+    if (execution_loop != LOOP_LEAN)
+      // nops are not counted in lean loop
+      printf(" [%lu.%.2lu%% nops]",
+        percentage_format_integral_2(get_total_number_of_instructions(), get_total_number_of_nops()),
+        percentage_format_fractional_2(get_total_number_of_instructions(), get_total_number_of_nops()));
+    printf("\n%s:          ", selfie_name);
+  }
+  printf("%lu.%.2luMB mapped memory [%lu.%.2lu%% of %luMB physical memory]\n",
+    ratio_format_integral_2(pused(), MEGABYTE),
+    ratio_format_fractional_2(pused(), MEGABYTE),
+    percentage_format_integral_2(PHYSICALMEMORYSIZE, pused()),
+    percentage_format_fractional_2(PHYSICALMEMORYSIZE, pused()),
+    PHYSICALMEMORYSIZE / MEGABYTE);
+
+  if (number_of_contexts > 1) {
+    printf("%s:          %lu contexts scheduled %s with %lu context switches in %lu scheduling decisions", selfie_name,
+      number_of_contexts,
+      (char*) *(SCHEDULERS + SCHEDULER),
+      context_switches,
+      scheduling_decisions);
+    if (SCHEDULER == SCHEDULE_PRIORITY)
+      printf(" scanning %lu contexts", run_queue_scans);
+    println();
+  }
+  if (shared_pages > 0)
+    printf("%s:          %lu code and data pages shared by contexts instead of loaded, %lu copied on write\n", selfie_name,
+      shared_pages,
+      cow_pages);
+  if (swap_size > 0)
+    printf("%s:          %lu pages swapped in, %lu swapped out, %lu inspected by clock, %lu.%.2luMB of %luMB swap space in use\n", selfie_name,
+      page_ins,
+      page_outs,
+      clock_sweeps,
+      ratio_format_integral_2(used_swap, MEGABYTE),
+      ratio_format_fractional_2(used_swap, MEGABYTE),
+      swap_size / MEGABYTE);
+  if (zero_pages + merged_pages > 0)
+    printf("%s:          %lu pages mapped to zero frame, %lu merged in %lu scans, %lu page frames saved (%lu at peak)\n", selfie_name,
+      zero_pages,
+      merged_pages,
+      dedup_scans,
+      saved_frames,
+      peak_saved_frames);
+
+  down_load_profiles();
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    printf("%s: ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n", selfie_name);
+    printf("%s: context: %s\n", selfie_name, get_name(context));
+    if (get_ic_all(context) > 0) {
+      print_instruction_versus_exception_profile(context);
+      printf("%s:          %lu.%.2luKB peak stack size\n", selfie_name,
+        ratio_format_integral_2(get_mc_stack_peak(context), KILOBYTE),
+        ratio_format_fractional_2(get_mc_stack_peak(context), KILOBYTE));
+      printf("%s:          %lu.%.2luMB allocated in %lu mallocs (%lu.%.2luMB or %lu.%.2lu%% actually accessed)\n", selfie_name,
+        ratio_format_integral_2(get_program_break(context) - get_heap_seg_start(context), MEGABYTE),
+        ratio_format_fractional_2(get_program_break(context) - get_heap_seg_start(context), MEGABYTE),
+        get_lc_malloc(context),
+        ratio_format_integral_2(get_mc_mapped_heap(context), MEGABYTE),
+        ratio_format_fractional_2(get_mc_mapped_heap(context), MEGABYTE),
+        percentage_format_integral_2(round_up(get_program_break(context) - get_heap_seg_start(context), PAGESIZE),
+          get_mc_mapped_heap(context)),
+        percentage_format_fractional_2(round_up(get_program_break(context) - get_heap_seg_start(context), PAGESIZE),
+            get_mc_mapped_heap(context)));
+    }
+    if (get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context) > 0) {
+      printf("%s:          %lu exceptions handled by ", selfie_name,
+        get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context));
+      if (get_parent(context) == MY_CONTEXT) printf("%s", selfie_name);
+      else printf("%s", get_name(get_parent(context)));
+      if (get_ic_all(context) > 0)
+        printf(", one every %lu executed instructions",
+          ratio_format_integral_2(get_ic_all(context),
+            get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context)));
+      println();
+      printf("%s:          %lu syscalls, %lu page faults, %lu timer interrupts\n", selfie_name,
+        get_ec_syscall(context),
+        get_ec_page_fault(context),
+        get_ec_timer(context));
+    }
+    if (number_of_contexts > 1)
+      if (get_dispatches(context) > 0) {
+        printf("%s:          %lu dispatches at priority %lu", selfie_name,
+          get_dispatches(context),
+          get_priority(context));
+        if (get_turnaround(context) > 0)
+          // assert: get_turnaround(context) >= get_ic_all(context)
+          printf(", exited after %lu executed instructions in total (%lu waiting)",
+            get_turnaround(context),
+            get_turnaround(context) - get_ic_all(context));
+        println();
+      }
+    if (L1_CACHE_ENABLED)
+      if (get_L1_dcache_hits(context) + get_L1_dcache_misses(context) + get_L1_icache_hits(context) + get_L1_icache_misses(context) > 0) {
+        print_cache_profile(get_L1_dcache_hits(context), get_L1_dcache_misses(context), "         L1 data:        ");
+        println();
+        print_cache_profile(get_L1_icache_hits(context), get_L1_icache_misses(context), "         L1 instruction: ");
+        println();
+      }
+
+    context = get_next_context(context);
+  }
+
+  if (GC_ON) {
+    printf("%s: ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n", selfie_name);
+    print_gc_profile(1);
+  }
+
+  if (execution_loop != LOOP_LEAN)
+    // lean loop only counts instructions
+    if (get_total_number_of_instructions() > 0) {
+      print_instruction_counters();
+
+      printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+      if (code_line_number != (uint64_t*) 0)
+        printf("%s: profile: total,max(ratio%%)@address(line#),2ndmax,3rdmax\n", selfie_name);
+      else
+        printf("%s: profile: total,max(ratio%%)@address,2ndmax,3rdmax\n", selfie_name);
+      print_per_instruction_profile("calls:   ", calls, calls_per_procedure, 0);
+      print_per_instruction_profile("loops:   ", iterations, iterations_per_loop, 0);
+      print_per_instruction_profile("loads:   ", ic_load, loads_per_instruction, OP_LOAD);
+      print_per_instruction_profile("stores:  ", ic_store, stores_per_instruction, OP_STORE);
+
+      printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+      print_register_memory_profile();
+    }
+
+  if (sc_read_calls + sc_write_calls + sc_openat_calls > 0) {
+    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+    printf("%s: syscall I/O:   calls,bytes[bytes/call]\n", selfie_name);
+
+    print_syscall_io_profile("read:          ", sc_read_calls, sc_read_bytes);
+    print_syscall_io_profile("write:         ", sc_write_calls, sc_write_bytes);
+    print_syscall_io_profile("openat:        ", sc_openat_calls, sc_openat_bytes);
+  }
+
+  if (tlb_hits + tlb_misses > 0) {
+    printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+    printf("%s: TLB:           accesses,hits,misses\n", selfie_name);
+
+    print_cache_profile(tlb_hits, tlb_misses, "translations:  ");
+    println();
+  }
+
+  if (L1_CACHE_ENABLED)
+    print_all_cache_profiles();
+}
+
+void print_host_os() {
+  if (OS == SELFIE)
+    printf("selfie");
+  else if (OS == LINUX)
+    printf("Linux");
+  else if (OS == MACOS)
+    printf("macOS");
+  else if (OS == WINDOWS)
+    printf("Windows");
+  else if (OS == BAREMETAL)
+    printf("bare metal");
+  else
+    printf("unknown");
+}
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------    R U N T I M E    ----------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// ---------------------------- MEMORY -----------------------------
+// -----------------------------------------------------------------
+
+uint64_t is_code_address(uint64_t* context, uint64_t vaddr) {
+  // is address in code segment?
+  if (vaddr >= get_code_seg_start(context))
+    if (vaddr < get_code_seg_start(context) + get_code_seg_size(context))
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_data_address(uint64_t* context, uint64_t vaddr) {
+  // is address in data segment?
+  if (vaddr >= get_data_seg_start(context))
+    if (vaddr < get_data_seg_start(context) + get_data_seg_size(context))
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_stack_address(uint64_t* context, uint64_t vaddr) {
+  // is address in stack segment?
+  if (vaddr >= *(get_regs(context) + REG_SP))
+    if (vaddr <= HIGHESTVIRTUALADDRESS)
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_heap_address(uint64_t* context, uint64_t vaddr) {
+  // is address in heap segment?
+  if (vaddr >= get_heap_seg_start(context))
+    if (vaddr < get_program_break(context))
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_address_between_stack_and_heap(uint64_t* context, uint64_t vaddr) {
+  // is address between heap and stack segments?
+  if (vaddr >= get_program_break(context))
+    if (vaddr < *(get_regs(context) + REG_SP))
+      return 1;
+
+  return 0;
+}
+
+uint64_t is_data_stack_heap_address(uint64_t* context, uint64_t vaddr) {
+  if (is_data_address(context, vaddr))
+    return 1;
+  else if (is_stack_address(context, vaddr))
+    return 1;
+  else if (is_heap_address(context, vaddr))
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t words_in_page_run(uint64_t* context, uint64_t vaddr) {
+  uint64_t words;
+  uint64_t segment_end;
+
+  // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+  // assert: is_data_stack_heap_address(context, vaddr) == 1
+
+  // number of words from vaddr to the end of its page
+  words = (PAGESIZE - vaddr % PAGESIZE) / WORDSIZE;
+
+  if (is_data_address(context, vaddr))
+    segment_end = get_data_seg_start(context) + get_data_seg_size(context);
+  else if (is_stack_address(context, vaddr))
+    // stack segment ends at the end of virtual memory
+    return words;
+  else
+    segment_end = get_program_break(context);
+
+  // number of words from vaddr to the end of its segment
+  segment_end = (segment_end - vaddr + WORDSIZE - 1) / WORDSIZE;
+
+  if (segment_end < words)
+    return segment_end;
+  else
+    return words;
+}
+
+// -----------------------------------------------------------------
+// ---------------------- GARBAGE COLLECTOR ------------------------
+// -----------------------------------------------------------------
+
+void emit_fetch_stack_pointer() {
+  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_stack_pointer"),
+    0, PROCEDURE, UINT64_T, 0, code_size);
+
+  emit_add(REG_A0, REG_ZR, REG_SP);
+
+  emit_jalr(REG_ZR, REG_RA, 0);
+}
+
+void emit_fetch_global_pointer() {
+  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_global_pointer"),
+    0, PROCEDURE, UINT64_T, 0, code_size);
+
+  emit_add(REG_A0, REG_ZR, REG_GP);
+
+  emit_jalr(REG_ZR, REG_RA, 0);
+}
+
+void emit_fetch_data_segment_size_interface() {
+  create_symbol_table_entry(GLOBAL_TABLE, string_copy("fetch_data_segment_size"),
+    0, PROCEDURE, UINT64_T, 0, code_size);
+
+  // up to three instructions needed to load data segment size but is not yet known
+
+  emit_nop();
+  emit_nop();
+  emit_nop();
+
+  emit_jalr(REG_ZR, REG_RA, 0);
+}
+
+void emit_fetch_data_segment_size_implementation(uint64_t fetch_dss_code_location) {
+  uint64_t saved_code_size;
+
+  // set code emission to fetch_data_segment_size
+  saved_code_size = code_size;
+  code_size       = fetch_dss_code_location;
+
+  // assert: emitting no more than 3 instructions
+
+  // load data segment size into A0 (size is independent of entry point)
+  load_small_and_medium_integer(REG_A0, data_size);
+
+  // discount NOPs in profile that were generated for fetch_data_segment_size
+  ic_addi = ic_addi - (code_size - fetch_dss_code_location) / INSTRUCTIONSIZE;
+
+  // restore original code size
+  code_size = saved_code_size;
+}
+
+void implement_gc_brk(uint64_t* context) {
+  // parameter
+  uint64_t new_program_break;
+
+  // local variable
+  uint64_t size;
+
+  new_program_break = *(get_regs(context) + REG_A0);
+
+  // check if brk is actually asked for more memory
+  // if not, fall back to the default brk syscall
+  if (new_program_break > get_program_break(context)) {
+    if (debug_syscalls) {
+      printf("(gc_brk): ");
+      print_register_hexadecimal(REG_A0);
+    }
+
+    // calculate size by subtracting the current from the new program break
+    size = new_program_break - get_program_break(context);
+
+    if (debug_syscalls) {
+      printf(" |- ");
+      print_register_hexadecimal(REG_A0);
+    }
+
+    // yields pointer to new/reused memory (or 0 if failed)
+    *(get_regs(context) + REG_A0) = (uint64_t) gc_malloc_implementation(context, size);
+
+    if (debug_syscalls) {
+      printf(" -> ");
+      print_register_hexadecimal(REG_A0);
+      println();
+    }
+
+    // assert: _bump pointer is last entry in data segment
+
+    // tracking the program break with the _bump pointer of the program
+    unshare_page(context, get_data_seg_end_gc(context) - WORDSIZE);
+
+    store_virtual_memory(get_pt(context), get_data_seg_end_gc(context) - WORDSIZE, get_program_break(context));
+
+    // assert: gc_brk syscall is invoked by selfie's malloc
+
+    set_lc_malloc(context, get_lc_malloc(context) + 1);
+
+    // skip next seven instructions of selfie's malloc
+    // to avoid using its bump pointer allocator
+    set_pc(context, get_pc(context) + 8 * INSTRUCTIONSIZE);
+  } else
+    implement_brk(context);
+}
+
+uint64_t is_gc_library(uint64_t* context) {
+  if (context == (uint64_t*) 0)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t* allocate_metadata(uint64_t* context) {
+  if (is_gc_library(context))
+    return allocate_new_memory(context, GC_METADATA_SIZE);
+  else
+    return smalloc(GC_METADATA_SIZE);
+}
+
+uint64_t get_stack_seg_start_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return fetch_stack_pointer();
+  else
+    return *(get_regs(context) + REG_SP);
+}
+
+uint64_t get_data_seg_start_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_data_seg_start;
+  else
+    return get_data_seg_start(context);
+}
+
+uint64_t get_data_seg_end_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_data_seg_end;
+  else
+    return get_data_seg_start(context) + get_data_seg_size(context);
+}
+
+uint64_t get_heap_seg_start_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_heap_seg_start;
+  else
+    return get_heap_seg_start(context);
+}
+
+uint64_t get_heap_seg_end_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_heap_seg_end;
+  else
+    return get_program_break(context);
+}
+
+uint64_t* get_used_list_head_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_used_list;
+  else
+    return get_used_list_head(context);
+}
+
+uint64_t* get_free_list_head_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_free_list;
+  else
+    return get_free_list_head(context);
+}
+
+uint64_t get_gcs_in_period_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return gc_num_gcs_in_period;
+  else
+    return get_gcs_in_period(context);
+}
+
+uint64_t get_gc_enabled_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    return USE_GC_LIBRARY;
+  else
+    return get_use_gc_kernel(context);
+}
+
+void set_data_and_heap_segments_gc(uint64_t* context) {
+  if (is_gc_library(context)) {
+    // we use fetch_global_pointer rather than smalloc_system(0)
+    // to be accurate even if smalloc has been called before
+    gc_data_seg_end   = fetch_global_pointer();
+    gc_data_seg_start = gc_data_seg_end - fetch_data_segment_size();
+
+    // assert: smalloc_system(0) returns program break
+    gc_heap_seg_start = (uint64_t) smalloc_system(0);
+    gc_heap_seg_end   = gc_heap_seg_start;
+  }
+}
+
+void set_used_list_head_gc(uint64_t* context, uint64_t* used_list_head){
+  if (is_gc_library(context))
+    gc_used_list = used_list_head;
+  else
+    set_used_list_head(context, used_list_head);
+}
+
+void set_free_list_head_gc(uint64_t* context, uint64_t* free_list_head) {
+  if (is_gc_library(context))
+    gc_free_list = free_list_head;
+  else
+    set_free_list_head(context, free_list_head);
+}
+
+void set_gcs_in_period_gc(uint64_t* context, uint64_t gcs) {
+  if (is_gc_library(context))
+    gc_num_gcs_in_period = gcs;
+  else
+    set_gcs_in_period(context, gcs);
+}
+
+void set_gc_enabled_gc(uint64_t* context) {
+  if (is_gc_library(context))
+    USE_GC_LIBRARY = GC_ENABLED;
+  else
+    set_use_gc_kernel(context, GC_ENABLED);
+}
+
+uint64_t is_gc_enabled(uint64_t* context) {
+  return get_gc_enabled_gc(context) == GC_ENABLED;
+}
+
+void gc_init(uint64_t* context) {
+  gc_init_selfie(context);
+}
+
+void gc_init_selfie(uint64_t* context) {
+  reset_gc_counters();
+
+  // calculate metadata size using actual size of pointers and integers
+  GC_METADATA_SIZE = 2 * sizeof(uint64_t*) + 2 * sizeof(uint64_t);
+
+  if (is_gc_library(context))
+    GC_WORDSIZE = sizeof(uint64_t);
+  else
+    GC_WORDSIZE = WORDSIZE;
+
+  set_data_and_heap_segments_gc(context);
+
+  set_used_list_head_gc(context, (uint64_t*) 0);
+  set_free_list_head_gc(context, (uint64_t*) 0);
+  set_gcs_in_period_gc(context, 0);
+  set_gc_enabled_gc(context);
+}
+
+uint64_t* retrieve_from_free_list(uint64_t* context, uint64_t size) {
+  uint64_t* prev_node;
+  uint64_t* node;
+
+  prev_node = (uint64_t*) 0;
+
+  node = get_free_list_head_gc(context);
+
+  while (node != (uint64_t*) 0) {
+    if (get_metadata_size(node) == size) {
+      if (prev_node == (uint64_t*) 0)
+        set_free_list_head_gc(context, get_metadata_next(node));
+      else
+        set_metadata_next(prev_node, get_metadata_next(node));
+
+      set_metadata_next(node, get_used_list_head_gc(context));
+
+      set_used_list_head_gc(context, node);
+
+      return node;
+    }
+
+    prev_node = node;
+
+    node = get_metadata_next(node);
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t gc_load_memory(uint64_t* context, uint64_t address) {
+  if (is_gc_library(context))
+    return *((uint64_t*) address);
+  else
+    // assert: is_virtual_address_valid(address, WORDSIZE) == 1
+    if (is_virtual_address_mapped(get_pt(context), address))
+      return load_virtual_memory(get_pt(context), address);
+    else
+      return 0;
+}
+
+void gc_store_memory(uint64_t* context, uint64_t address, uint64_t value) {
+  if (is_gc_library(context))
+    *((uint64_t*) address) = value;
+  else
+    // assert: is_virtual_address_valid(address, WORDSIZE) == 1
+    if (is_virtual_address_mapped(get_pt(context), address)) {
+      unshare_page(context, address);
+
+      store_virtual_memory(get_pt(context), address, value);
+    }
+}
+
+void zero_block(uint64_t* context, uint64_t* metadata) {
+  uint64_t block_start;
+  uint64_t block_end;
+
+  // zero block memory
+  block_start = (uint64_t) get_metadata_memory(metadata);
+  block_end   = block_start + get_metadata_size(metadata);
+
+  while (block_start < block_end) {
+    gc_store_memory(context, block_start, 0);
+
+    block_start = block_start + GC_WORDSIZE;
+  }
+}
+
+uint64_t* allocate_new_memory(uint64_t* context, uint64_t size) {
+  uint64_t block_start;
+  uint64_t new_program_break;
+
+  if (is_gc_library(context)) {
+    block_start = (uint64_t) smalloc_system(size);
+
+    // assert: smalloc_system is a bump pointer allocator that may reuse memory
+
+    if (block_start + size > gc_heap_seg_end)
+      gc_heap_seg_end = block_start + size;
+
+    return (uint64_t*) block_start;
+  } else {
+    block_start = get_program_break(context);
+
+    // attempt to update program break
+
+    new_program_break = try_brk(context, block_start + size);
+
+    if (new_program_break == block_start + size)
+      // attempt to update program break succeeded
+      return (uint64_t*) block_start;
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t* reuse_memory(uint64_t* context, uint64_t size) {
+  uint64_t* metadata;
+
+  // check if reusable memory is available in free list
+  metadata = retrieve_from_free_list(context, size);
+
+  if (metadata != (uint64_t*) 0) {
+    // zeroing reused memory is optional!
+    zero_block(context, metadata);
 
     return get_metadata_memory(metadata);
   }
 
-  return (uint64_t*) 0;
+  return (uint64_t*) 0;
+}
+
+uint64_t* allocate_memory(uint64_t* context, uint64_t size) {
+  return allocate_memory_selfie(context, size);
+}
+
+uint64_t* allocate_memory_selfie(uint64_t* context, uint64_t size) {
+  uint64_t* block;
+  uint64_t* metadata;
+
+  gc_num_mallocated = gc_num_mallocated + 1;
+  gc_mem_mallocated = gc_mem_mallocated + size;
+
+  // try reusing memory first
+  block = reuse_memory(context, size);
+
+  if (block != (uint64_t*) 0) {
+    gc_num_reused_mallocs = gc_num_reused_mallocs + 1;
+    gc_mem_reused         = gc_mem_reused + size;
+
+    return block;
+  }
+
+  // allocate new memory block if there is no reusable memory
+  block = allocate_new_memory(context, size);
+
+  if (block != (uint64_t*) 0) {
+    // allocate metadata for managing memory block
+    metadata = allocate_metadata(context);
+
+    if (metadata != (uint64_t*) 0) {
+      set_metadata_next(metadata, get_used_list_head_gc(context));
+      set_used_list_head_gc(context, metadata);
+
+      set_metadata_memory(metadata, block);
+      set_metadata_size(metadata, size);
+      set_metadata_markbit(metadata, GC_MARKBIT_UNREACHABLE);
+
+      gc_num_gced_mallocs   = gc_num_gced_mallocs + 1;
+      gc_num_ungced_mallocs = gc_num_ungced_mallocs + 1;
+
+      gc_mem_blocks   = gc_mem_blocks + size;
+      gc_mem_metadata = gc_mem_metadata + GC_METADATA_SIZE;
+    } else
+      return (uint64_t*) 0;
+  } else
+    // if memory block allocation failed discount memory from mallocated total
+    gc_mem_mallocated = gc_mem_mallocated - size;
+
+  return block;
+}
+
+uint64_t* gc_malloc_implementation(uint64_t* context, uint64_t size) {
+  // first, garbage collect
+  if (get_gcs_in_period_gc(context) >= GC_PERIOD) {
+    gc_collect(context);
+
+    set_gcs_in_period_gc(context, 0);
+  } else
+    set_gcs_in_period_gc(context, get_gcs_in_period_gc(context) + 1);
+
+  // then, allocate memory
+
+  size = round_up(size, GC_WORDSIZE);
+
+  return allocate_memory(context, size);
+}
+
+uint64_t* get_metadata_if_address_is_valid(uint64_t* context, uint64_t address) {
+  uint64_t* node;
+  uint64_t  block;
+
+  // pointer below gced heap
+  if (address < get_heap_seg_start_gc(context))
+    return (uint64_t*) 0;
+
+  // pointer above gced heap
+  if (address >= get_heap_seg_end_gc(context))
+    return (uint64_t*) 0;
+
+  node = get_used_list_head_gc(context);
+
+  while (node != (uint64_t*) 0) {
+    if (is_gc_library(context))
+      if (address >= (uint64_t) node)
+        if (address < ((uint64_t) node + GC_METADATA_SIZE))
+          // address points to metadata (redundant check but possibly faster)
+          return (uint64_t*) 0;
+
+    block = (uint64_t) get_metadata_memory(node);
+
+    if (address >= block)
+      if (address < block + get_metadata_size(node))
+        // address points into a gced block
+        return node;
+
+    node = get_metadata_next(node);
+  }
+
+  return (uint64_t*) 0;
+}
+
+void mark_block(uint64_t* context, uint64_t address) {
+  uint64_t gc_address;
+
+  gc_address = gc_load_memory(context, address);
+
+  mark_block_selfie(context, gc_address);
+}
+
+void mark_block_selfie(uint64_t* context, uint64_t gc_address) {
+  uint64_t* metadata;
+  uint64_t block_start;
+  uint64_t block_end;
+
+  if (not(is_gc_library(context)))
+    if (not(is_virtual_address_valid(gc_address, WORDSIZE)))
+      return;
+
+  metadata = get_metadata_if_address_is_valid(context, gc_address);
+
+  if (metadata == (uint64_t*) 0)
+    // address is not a pointer to a gced block
+    return;
+  else if (get_metadata_markbit(metadata) == GC_MARKBIT_UNREACHABLE)
+    set_metadata_markbit(metadata, GC_MARKBIT_REACHABLE);
+  else
+    // memory block has already been marked as reachable
+    return;
+
+  block_start = (uint64_t) get_metadata_memory(metadata);
+  block_end   = block_start + get_metadata_size(metadata);
+
+  while (block_start < block_end) {
+    mark_block(context, block_start);
+
+    block_start = block_start + GC_WORDSIZE;
+  }
+}
+
+void mark_segment(uint64_t* context, uint64_t segment_start, uint64_t segment_end) {
+  // assert: segment is not heap, segment_start >= GC_WORDSIZE
+
+  // prevent 32-bit overflow by subtracting GC_WORDSIZE
+  segment_start = segment_start - GC_WORDSIZE;
+  segment_end   = segment_end - GC_WORDSIZE;
+
+  while (segment_start < segment_end) {
+    // undo GC_WORDSIZE index offset before marking address
+    mark_block(context, segment_start + GC_WORDSIZE);
+
+    segment_start = segment_start + GC_WORDSIZE;
+  }
+}
+
+void mark(uint64_t* context) {
+  if (get_used_list_head_gc(context) == (uint64_t*) 0)
+    return; // if there is no used memory skip collection
+
+  // assert: all used temporary registers are saved on stack, see save_temporaries()
+
+  // not traversing registers
+
+  // root segments: call stack and data segment
+
+  // traverse call stack
+  mark_segment(context, get_stack_seg_start_gc(context), VIRTUALMEMORYSIZE * GIGABYTE);
+
+  // traverse data segment
+  mark_segment(context, get_data_seg_start_gc(context), get_data_seg_end_gc(context));
+}
+
+void free_block(uint64_t* context, uint64_t* metadata, uint64_t* prev_metadata) {
+  if (prev_metadata == (uint64_t*) 0)
+    set_used_list_head_gc(context, get_metadata_next(metadata));
+  else
+    set_metadata_next(prev_metadata, get_metadata_next(metadata));
+
+  if (GC_REUSE) {
+    set_metadata_next(metadata, get_free_list_head_gc(context));
+
+    set_free_list_head_gc(context, metadata);
+  }
+
+  gc_mem_collected = gc_mem_collected + get_metadata_size(metadata);
+}
+
+void sweep(uint64_t* context) {
+  sweep_selfie(context);
+}
+
+void sweep_selfie(uint64_t* context) {
+  uint64_t* prev_node;
+  uint64_t* node;
+  uint64_t* next_node;
+
+  prev_node = (uint64_t*) 0;
+
+  node = get_used_list_head_gc(context);
+
+  while (node != (uint64_t*) 0) {
+    // next node changes when memory block is reused
+    next_node = get_metadata_next(node);
+
+    if (get_metadata_markbit(node) == GC_MARKBIT_UNREACHABLE)
+      free_block(context, node, prev_node);
+    else {
+      // clear mark bit for next marking
+      set_metadata_markbit(node, GC_MARKBIT_UNREACHABLE);
+
+      prev_node = node;
+    }
+
+    node = next_node;
+  }
+}
+
+void gc_collect(uint64_t* context) {
+  mark(context);
+  sweep(context);
+
+  gc_num_collects = gc_num_collects + 1;
+}
+
+void print_gc_profile(uint64_t is_gc_kernel) {
+  printf("%s: gc:      %lu.%.2luMB requested in %lu mallocs (%lu gced, %lu reuses)\n", selfie_name,
+    ratio_format_integral_2(gc_mem_mallocated, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_mallocated, MEGABYTE),
+    gc_num_mallocated,
+    gc_num_gced_mallocs,
+    gc_num_reused_mallocs);
+  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) reused in %lu reused mallocs\n", selfie_name,
+    ratio_format_integral_2(gc_mem_reused, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_reused, MEGABYTE),
+    percentage_format_integral_2(gc_mem_mallocated, gc_mem_reused),
+    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_reused),
+    gc_num_reused_mallocs);
+  printf("%s: gc:      %lu.%.2luMB collected in %lu gc runs\n", selfie_name,
+    ratio_format_integral_2(gc_mem_collected, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_collected, MEGABYTE),
+    gc_num_collects);
+  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu mallocs (%lu gced, %lu ungced)\n", selfie_name,
+    ratio_format_integral_2(gc_mem_blocks + gc_mem_metadata, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_blocks + gc_mem_metadata, MEGABYTE),
+    percentage_format_integral_2(gc_mem_mallocated, gc_mem_blocks + gc_mem_metadata),
+    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_blocks + gc_mem_metadata),
+    gc_num_gced_mallocs + gc_num_ungced_mallocs,
+    gc_num_gced_mallocs,
+    gc_num_ungced_mallocs);
+  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu gced mallocs\n", selfie_name,
+    ratio_format_integral_2(gc_mem_blocks, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_blocks, MEGABYTE),
+    percentage_format_integral_2(gc_mem_mallocated, gc_mem_blocks),
+    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_blocks),
+    gc_num_gced_mallocs);
+  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu ungced mallocs", selfie_name,
+    ratio_format_integral_2(gc_mem_metadata, MEGABYTE),
+    ratio_format_fractional_2(gc_mem_metadata, MEGABYTE),
+    percentage_format_integral_2(gc_mem_mallocated, gc_mem_metadata),
+    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_metadata),
+    gc_num_ungced_mallocs);
+  if (is_gc_kernel)
+    printf(" (external)");
+  println();
+}
+
+// -----------------------------------------------------------------
+// -------------------------- MICROKERNEL --------------------------
+// -----------------------------------------------------------------
+
+uint64_t* new_context() {
+  uint64_t* context;
+
+  if (free_contexts == (uint64_t*) 0)
+    context = allocate_context();
+  else {
+    context = free_contexts;
+
+    free_contexts = get_next_context(free_contexts);
+  }
+
+  set_next_context(context, used_contexts);
+  set_prev_context(context, (uint64_t*) 0);
+
+  if (used_contexts != (uint64_t*) 0)
+    set_prev_context(used_contexts, context);
+
+  used_contexts = context;
+
+  return context;
+}
+
+void free_context(uint64_t* context) {
+  set_next_context(context, free_contexts);
+
+  free_contexts = context;
+}
+
+uint64_t* delete_context(uint64_t* context, uint64_t* from) {
+  if (get_next_context(context) != (uint64_t*) 0)
+    set_prev_context(get_next_context(context), get_prev_context(context));
+
+  if (get_prev_context(context) != (uint64_t*) 0) {
+    set_next_context(get_prev_context(context), get_next_context(context));
+    set_prev_context(context, (uint64_t*) 0);
+  } else
+    from = get_next_context(context);
+
+  reclaim_page_frames(context);
+
+  free_context(context);
+
+  return from;
+}
+
+void init_context(uint64_t* context, uint64_t* parent, uint64_t* vctxt) {
+  char* context_name;
+
+  // some fields are set in boot loader or when context switching
+
+  // allocate zeroed memory for general-purpose registers
+  // TODO: reuse memory
+  set_regs(context, zmalloc(NUMBEROFREGISTERS * sizeof(uint64_t)));
+
+  // allocate zeroed memory for page table
+  // TODO: save and reuse memory for page table
+  if (not(PAGETABLETREE))
+    // for a 4GB-virtual-memory page table with
+    // 4KB pages and 64-bit pointers, allocate
+    // 8MB = 2^23 ((2^32 / 2^12) * 2^3) bytes to
+    // accommodate 2^20 (2^32 / 2^12) PTEs
+    set_pt(context, zmalloc(NUMBEROFPAGES * sizeof(uint64_t*)));
+  else
+    // for the root node (page directory), allocate
+    // 16KB = 2^14 (2^32 / 2^12 / 2^9 * 2^3) bytes to
+    // accommodate 2^11 ((2^32 / 2^12) / 2^9) root PDEs
+    // pointing to 4KB leaf nodes (page tables) that
+    // each accommodate 2^9 (2^12 / 2^3) leaf PTEs
+    set_pt(context, zmalloc(NUMBEROFPAGES / NUMBEROFLEAFPTES * sizeof(uint64_t*)));
+
+  // reset page table cache
+  set_lowest_lo_page(context, 0);
+  set_highest_lo_page(context, get_lowest_lo_page(context));
+  set_lowest_hi_page(context, page_of_virtual_address(HIGHESTVIRTUALADDRESS));
+  set_highest_hi_page(context, get_lowest_hi_page(context));
+
+  if (parent != MY_CONTEXT) {
+    set_code_seg_start(context, load_virtual_memory(get_pt(parent), code_seg_start(vctxt)));
+    set_code_seg_size(context, load_virtual_memory(get_pt(parent), code_seg_size(vctxt)));
+    set_data_seg_start(context, load_virtual_memory(get_pt(parent), data_seg_start(vctxt)));
+    set_data_seg_size(context, load_virtual_memory(get_pt(parent), data_seg_size(vctxt)));
+    set_heap_seg_start(context, load_virtual_memory(get_pt(parent), heap_seg_start(vctxt)));
+
+    context_name = string_alloc(MAX_FILENAME_LENGTH);
+
+    down_load_string(parent, load_virtual_memory(get_pt(parent), name(vctxt)), context_name);
+
+    set_name(context, context_name);
+  } else {
+    set_exception(context, EXCEPTION_NOEXCEPTION);
+    set_fault(context, 0);
+
+    set_exit_code(context, EXITCODE_NOERROR);
+  }
+
+  set_parent(context, parent);
+  set_virtual_context(context, vctxt);
+
+  // profile
+  set_ic_all(context, 0);
+  set_lc_malloc(context, 0);
+  set_ec_syscall(context, 0);
+  set_ec_page_fault(context, 0);
+  set_ec_timer(context, 0);
+  set_mc_stack_peak(context, 0);
+  set_mc_mapped_heap(context, 0);
+
+  set_L1_dcache_hits(context, 0);
+  set_L1_dcache_misses(context, 0);
+  set_L1_icache_hits(context, 0);
+  set_L1_icache_misses(context, 0);
+
+  // garbage collector
+  set_used_list_head(context, (uint64_t*) 0);
+  set_free_list_head(context, (uint64_t*) 0);
+  set_gcs_in_period(context, 0);
+  set_use_gc_kernel(context, GC_DISABLED);
+
+  // instructions are decoded when first executed
+  set_decoded_instructions(context, (uint64_t*) 0);
+
+  // calling-context tree is created when first restored
+  set_call_node(context, (uint64_t*) 0);
+
+  // scheduler
+  set_next_runnable(context, (uint64_t*) 0);
+  set_priority(context, 0);
+  set_dispatches(context, 0);
+  set_turnaround(context, 0);
+
+  // code and data pages are shared when binary is loaded
+  set_shared_image(context, (uint64_t*) 0);
+}
+
+uint64_t* create_context(uint64_t* parent, uint64_t* vctxt) {
+  uint64_t* context;
+
+  context = new_context();
+
+  init_context(context, parent, vctxt);
+
+  if (debug_create)
+    printf("%s: parent context %s created child context %s\n", selfie_name,
+      get_name(parent), get_name(used_contexts));
+
+  return context;
+}
+
+uint64_t* find_context(uint64_t* parent, uint64_t* vctxt) {
+  uint64_t* context;
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) == parent)
+      if (get_virtual_context(context) == vctxt)
+        return context;
+
+    context = get_next_context(context);
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t* cache_context(uint64_t* vctxt) {
+  uint64_t* context;
+
+  // find cached context on my boot level
+  context = find_context(current_context, vctxt);
+
+  if (context == (uint64_t*) 0)
+    // create cached context on my boot level
+    context = create_context(current_context, vctxt);
+
+  return context;
+}
+
+void profile_L1_caches(uint64_t* context) {
+  // upon restoring context, counters are set to global counters minus
+  // counts so far, upon saving context, back to counts so far
+  if (L1_CACHE_ENABLED) {
+    set_L1_dcache_hits(context, get_cache_hits(L1_DCACHE) - get_L1_dcache_hits(context));
+    set_L1_dcache_misses(context, get_cache_misses(L1_DCACHE) - get_L1_dcache_misses(context));
+    set_L1_icache_hits(context, get_cache_hits(L1_ICACHE) - get_L1_icache_hits(context));
+    set_L1_icache_misses(context, get_cache_misses(L1_ICACHE) - get_L1_icache_misses(context));
+  }
+}
+
+void save_context(uint64_t* context) {
+  uint64_t* parent_table;
+  uint64_t* vctxt;
+  uint64_t r;
+  uint64_t* vregs;
+
+  // save machine state
+  set_pc(context, pc);
+
+  if (get_parent(context) != MY_CONTEXT) {
+    // upload changes in context to virtual context in parent address space
+    parent_table = get_pt(get_parent(context));
+
+    vctxt = get_virtual_context(context);
+
+    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+
+    // kernel writes to shared pages in parent address space copy them first
+    unshare_pages(get_parent(context), (uint64_t) vctxt, CONTEXTENTRIES * sizeof(uint64_t));
+    unshare_pages(get_parent(context), (uint64_t) vregs, NUMBEROFREGISTERS * sizeof(uint64_t));
+
+    store_virtual_memory(parent_table, program_counter(vctxt), get_pc(context));
+
+    // registers are contiguous in parent address space
+    copy_virtual_memory(parent_table, (uint64_t) vregs, get_regs(context), NUMBEROFREGISTERS, 1);
+
+    // program break, exception, fault, and exit code are contiguous in both contexts
+    copy_virtual_memory(parent_table, program_break(vctxt), (uint64_t*) program_break(context), 4, 1);
+
+    // garbage collector state (only necessary if context is gced by different gcs)
+
+    copy_virtual_memory(parent_table, used_list_head(vctxt), (uint64_t*) used_list_head(context), 4, 1);
+  }
+
+  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+
+  profile_L1_caches(context);
+
+  if (call_node != (uint64_t*) 0) {
+    sample_call_stack();
+
+    set_call_node(context, call_node);
+  }
+
+  // number of bytes currently allocated on stack
+  r = VIRTUALMEMORYSIZE * GIGABYTE - *(get_regs(context) + REG_SP);
+
+  if (r > get_mc_stack_peak(context))
+    // keep track of peak amount of stack allocation
+    set_mc_stack_peak(context, r);
+}
+
+uint64_t lowest_page(uint64_t page, uint64_t lo) {
+  if (page < lo)
+    return page;
+  else
+    return lo;
+}
+
+uint64_t highest_page(uint64_t page, uint64_t hi) {
+  if (page >= hi)
+    // only lo <= page < hi will be cached
+    return page + 1;
+  else
+    return hi;
+}
+
+void map_page(uint64_t* context, uint64_t page, uint64_t frame) {
+  uint64_t* table;
+
+  table = get_pt(context);
+
+  // assert: page is unmapped
+
+  set_page_frame(table, page, frame);
+
+  flush_tlb_entry(table, page);
+
+  // exploit spatial locality in page table caching
+  if (page <= page_of_virtual_address(get_program_break(context) - WORDSIZE)) {
+    set_lowest_lo_page(context, lowest_page(page, get_lowest_lo_page(context)));
+    set_highest_lo_page(context, highest_page(page, get_highest_lo_page(context)));
+  } else {
+    set_lowest_hi_page(context, lowest_page(page, get_lowest_hi_page(context)));
+    set_highest_hi_page(context, highest_page(page, get_highest_hi_page(context)));
+  }
+
+  if (swap_size > 0)
+    // page may be swapped out from now on
+    register_resident_page(context, page);
+
+  if (debug_map)
+    printf("%s: page 0x%04lX mapped to frame 0x%08lX in context %s\n", selfie_name,
+      page, (uint64_t) frame, get_name(context));
+}
+
+void cache_page_table(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t lo, uint64_t hi) {
+  uint64_t PTE_address;
+  uint64_t* PTE;
+  uint64_t next;
+  uint64_t frame;
+
+  // PTEs in page table in parent address space are accessed through
+  // their page frame which is translated only once per page of PTEs
+  PTE = (uint64_t*) 0;
+
+  next = lo;
+
+  while (lo < hi) {
+    if (PTE == (uint64_t*) 0) {
+      // PTE address of lo page in page table in parent address space
+      PTE_address = (uint64_t) get_PTE_address(parent_table, table, lo);
+
+      if (PTE_address == 0)
+        // skip all pages of unallocated leaf page table
+        next = (root_PDE_offset(lo) + 1) * NUMBEROFLEAFPTES;
+      else if (is_virtual_address_mapped(parent_table, PTE_address))
+        PTE = translate_virtual_to_physical(parent_table, PTE_address);
+      else
+        // PTEs in page table in parent address space may be unmapped,
+        // skip all pages with PTEs on the same unmapped page
+        next = lo + (PAGESIZE - PTE_address % PAGESIZE) / sizeof(uint64_t);
+    }
+
+    if (PTE != (uint64_t*) 0) {
+      // page frame of lo page in parent address space
+      frame = load_physical_memory(PTE);
+
+      // page may be unmapped even if PTE of page is mapped
+      if (frame != 0) {
+        // assert: page frame in parent address space is mapped
+        frame = get_page_frame(parent_table, page_of_virtual_address(frame));
+
+        // shadow page table persists, only map pages with changed PTEs
+        if (get_page_frame(get_pt(context), lo) != frame)
+          map_page(context, lo, frame);
+      }
+
+      PTE_address = PTE_address + sizeof(uint64_t);
+
+      if (PTE_address % PAGESIZE == 0)
+        // next PTE is on another page of page table
+        PTE = (uint64_t*) 0;
+      else
+        PTE = PTE + 1;
+
+      next = lo + 1;
+    }
+
+    lo = next;
+  }
+}
+
+void restore_context(uint64_t* context) {
+  uint64_t* parent_table;
+  uint64_t* vctxt;
+  uint64_t* vregs;
+  uint64_t* table;
+  uint64_t lo;
+  uint64_t hi;
+
+  if (get_parent(context) != MY_CONTEXT) {
+    // download changes in virtual context in parent address space to context
+    parent_table = get_pt(get_parent(context));
+
+    vctxt = get_virtual_context(context);
+
+    set_pc(context, load_virtual_memory(parent_table, program_counter(vctxt)));
+
+    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+
+    // registers are contiguous in parent address space
+    copy_virtual_memory(parent_table, (uint64_t) vregs, get_regs(context), NUMBEROFREGISTERS, 0);
+
+    // program break, exception, fault, and exit code are contiguous in both contexts
+    copy_virtual_memory(parent_table, program_break(vctxt), (uint64_t*) program_break(context), 4, 0);
+
+    table = (uint64_t*) load_virtual_memory(parent_table, page_table(vctxt));
+
+    // assert: virtual context page table is only mapped from beginning up and end down
+
+    lo = load_virtual_memory(parent_table, lowest_lo_page(vctxt));
+    hi = load_virtual_memory(parent_table, highest_lo_page(vctxt));
+
+    cache_page_table(context, table, parent_table, lo, hi);
+
+    unshare_pages(get_parent(context), (uint64_t) vctxt, CONTEXTENTRIES * sizeof(uint64_t));
+
+    store_virtual_memory(parent_table, lowest_lo_page(vctxt), hi);
+
+    lo = load_virtual_memory(parent_table, lowest_hi_page(vctxt));
+    hi = load_virtual_memory(parent_table, highest_hi_page(vctxt));
+
+    cache_page_table(context, table, parent_table, lo, hi);
+
+    store_virtual_memory(parent_table, highest_hi_page(vctxt), lo);
+
+    // garbage collector state (only necessary if context is gced by different gcs)
+
+    copy_virtual_memory(parent_table, used_list_head(vctxt), (uint64_t*) used_list_head(context), 4, 0);
+  }
+
+  // restore machine state
+  pc        = get_pc(context);
+  registers = get_regs(context);
+  pt        = get_pt(context);
+
+  flush_tlb(pt);
+
+  // caches are physically tagged, no need to flush them
+  L1_asid = (uint64_t) context;
+
+  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+
+  profile_L1_caches(context);
+
+  if (stacks_name != (char*) 0) {
+    if (get_call_node(context) == (uint64_t*) 0)
+      set_call_node(context, create_call_root(context));
+
+    call_node = get_call_node(context);
+  }
+}
+
+uint64_t pavailable() {
+  if (free_page_frames != (uint64_t*) 0)
+    return 1;
+  else if (free_page_frame_memory > 0)
+    return 1;
+  else if (allocated_page_frame_memory + MEGABYTE <= PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t pused() {
+  return allocated_page_frame_memory - free_page_frame_memory - freed_page_frame_memory;
+}
+
+uint64_t* palloc() {
+  uint64_t block;
+  uint64_t frame;
+
+  // assert: PHYSICALMEMORYSIZE is equal to or a multiple of MEGABYTE
+  // assert: PAGEFRAMESIZE is a factor of MEGABYTE strictly less than MEGABYTE
+
+  if (free_page_frames != (uint64_t*) 0) {
+    // reuse freed page frames first
+    frame = (uint64_t) free_page_frames;
+
+    free_page_frames = (uint64_t*) *free_page_frames;
+
+    freed_page_frame_memory = freed_page_frame_memory - PAGEFRAMESIZE;
+
+    // freed page frames are not zeroed
+    zero_memory((uint64_t*) frame, PAGEFRAMESIZE);
+
+    return (uint64_t*) frame;
+  }
+
+  if (free_page_frame_memory == 0) {
+    if (pavailable()) {
+      // single word on 32-bit target occupies double word on 64-bit system
+      free_page_frame_memory = MEGABYTE * (PAGEFRAMESIZE / PAGESIZE);
+
+      // on boot level 0 allocate zeroed memory
+      block = (uint64_t) zmalloc(free_page_frame_memory);
+
+      allocated_page_frame_memory = allocated_page_frame_memory + free_page_frame_memory;
+
+      // page frames must be PAGEFRAMESIZE-aligned in memory
+      next_page_frame = round_up(block, PAGEFRAMESIZE);
+
+      if (next_page_frame > block)
+        // losing one page frame to alignment
+        free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+    } else if (swap_size > 0) {
+      // make room by swapping out a page
+      page_out();
+
+      return palloc();
+    } else {
+      printf("%s: palloc out of physical memory\n", selfie_name);
+
+      exit(EXITCODE_OUTOFPHYSICALMEMORY);
+    }
+  }
+
+  frame = next_page_frame;
+
+  next_page_frame = next_page_frame + PAGEFRAMESIZE;
+
+  free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+
+  // strictly, writing is only necessary on boot levels higher than 0
+  // where just touching frames may map them to the zero frame below
+  zero_memory((uint64_t*) frame, PAGEFRAMESIZE);
+
+  return (uint64_t*) frame;
+}
+
+void pfree(uint64_t* frame) {
+  // link freed page frames through their first word
+  *frame = (uint64_t) free_page_frames;
+
+  free_page_frames = frame;
+
+  freed_page_frame_memory = freed_page_frame_memory + PAGEFRAMESIZE;
+}
+
+void reclaim_page_frames(uint64_t* context) {
+  uint64_t* table;
+  uint64_t* leaf_pt;
+  uint64_t owner;
+  uint64_t page;
+  uint64_t i;
+
+  table = get_pt(context);
+
+  if (table == (uint64_t*) 0)
+    // no page table or page table is not owned by context
+    return;
+
+  release_shared_image(context);
+  release_paged_pages(context);
+
+  // page frames of cached contexts belong to their parent,
+  // only leaf page tables are allocated on this boot level
+  if (get_parent(context) == MY_CONTEXT)
+    owner = 1;
+  else
+    owner = 0;
+
+  if (not(PAGETABLETREE)) {
+    if (owner) {
+      page = 0;
+
+      while (page < NUMBEROFPAGES) {
+        if (*(table + page) != 0)
+          release_page_frame(*(table + page));
+
+        page = page + 1;
+      }
+    }
+  } else {
+    page = 0;
+
+    while (page < NUMBEROFPAGES) {
+      leaf_pt = (uint64_t*) *(table + root_PDE_offset(page));
+
+      if (leaf_pt != (uint64_t*) 0) {
+        if (owner) {
+          i = 0;
+
+          while (i < NUMBEROFLEAFPTES) {
+            if (*(leaf_pt + i) != 0)
+              release_page_frame(*(leaf_pt + i));
+
+            i = i + 1;
+          }
+        }
+
+        pfree(leaf_pt);
+      }
+
+      page = page + NUMBEROFLEAFPTES;
+    }
+  }
+
+  if (table == tlb_table)
+    flush_tlb((uint64_t*) 0);
+
+  set_pt(context, (uint64_t*) 0);
+}
+
+void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
+  // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+
+  if (not(is_virtual_address_mapped(get_pt(context), vaddr)))
+    if (page_in(context, page_of_virtual_address(vaddr)) == 0)
+      map_page(context, page_of_virtual_address(vaddr), (uint64_t) palloc());
+
+  store_virtual_memory(get_pt(context), vaddr, data);
+
+  // code may be reloaded after it was executed
+  invalidate_decoded_instructions(context, vaddr, WORDSIZE);
+}
+
+uint64_t load_image_word(uint64_t* image, uint64_t vaddr) {
+  uint64_t page;
+  uint64_t frame;
+
+  // assert: vaddr is in code or data segment of image
+
+  page = page_of_virtual_address(vaddr);
+
+  frame = *(get_image_frames(image) + page - page_of_virtual_address(get_image_code_start(image)));
+
+  // same translation as in translate_virtual_to_physical
+  return load_physical_memory((uint64_t*) ((vaddr - page * PAGESIZE) * (PAGEFRAMESIZE / PAGESIZE) + frame));
+}
+
+uint64_t is_image_of_binary(uint64_t* image) {
+  uint64_t baddr;
+
+  if (get_image_code_start(image) != code_start)
+    return 0;
+  else if (get_image_code_size(image) != code_size)
+    return 0;
+  else if (get_image_data_start(image) != data_start)
+    return 0;
+  else if (get_image_data_size(image) != data_size)
+    return 0;
+
+  // frames of shared images are never written,
+  // so identical binaries have identical frames
+
+  baddr = 0;
+
+  while (baddr < code_size) {
+    if (load_image_word(image, code_start + baddr) != load_code(baddr))
+      return 0;
+
+    baddr = baddr + WORDSIZE;
+  }
+
+  baddr = 0;
+
+  while (baddr < data_size) {
+    if (load_image_word(image, data_start + baddr) != load_data(baddr))
+      return 0;
+
+    baddr = baddr + WORDSIZE;
+  }
+
+  return 1;
+}
+
+uint64_t* find_shared_image() {
+  uint64_t* image;
+
+  // finds image of most recently loaded binary, if any
+
+  image = shared_images;
+
+  while (image != (uint64_t*) 0) {
+    if (is_image_of_binary(image))
+      return image;
+
+    image = get_next_image(image);
+  }
+
+  return (uint64_t*) 0;
+}
+
+void share_image(uint64_t* context, uint64_t* image) {
+  uint64_t page;
+  uint64_t i;
+
+  page = page_of_virtual_address(get_image_code_start(image));
+
+  i = 0;
+
+  while (i < get_image_pages(image)) {
+    if (*(get_image_frames(image) + i) != 0) {
+      // map page by reference rather than loading it
+      map_page(context, page + i, *(get_image_frames(image) + i));
+
+      shared_pages = shared_pages + 1;
+    }
+
+    i = i + 1;
+  }
+
+  set_image_contexts(image, get_image_contexts(image) + 1);
+
+  set_shared_image(context, image);
+}
+
+void create_shared_image(uint64_t* context) {
+  uint64_t* image;
+  uint64_t* frames;
+  uint64_t page;
+  uint64_t i;
+
+  // assert: binary has just been loaded into context
+
+  image = allocate_shared_image();
+
+  set_image_code_start(image, code_start);
+  set_image_code_size(image, code_size);
+  set_image_data_start(image, data_start);
+  set_image_data_size(image, data_size);
+
+  // heap starts right after the last data page
+  set_image_pages(image, (get_heap_seg_start(context) - code_start) / PAGESIZE);
+
+  frames = smalloc(get_image_pages(image) * sizeof(uint64_t));
+
+  page = page_of_virtual_address(code_start);
+
+  i = 0;
+
+  while (i < get_image_pages(image)) {
+    // from now on, frames are shared copy-on-write, even by context
+    *(frames + i) = get_page_frame(get_pt(context), page + i);
+
+    i = i + 1;
+  }
+
+  set_image_frames(image, frames);
+  set_image_contexts(image, 1);
+
+  set_next_image(image, shared_images);
+
+  shared_images = image;
+
+  set_shared_image(context, image);
+}
+
+void release_shared_image(uint64_t* context) {
+  uint64_t* image;
+  uint64_t* previous;
+  uint64_t page;
+  uint64_t i;
+
+  image = get_shared_image(context);
+
+  if (image == (uint64_t*) 0)
+    return;
+
+  page = page_of_virtual_address(get_image_code_start(image));
+
+  i = 0;
+
+  while (i < get_image_pages(image)) {
+    if (is_page_shared(context, page + i))
+      // page frames of shared images are freed with the image, not the context
+      set_page_frame(get_pt(context), page + i, 0);
+
+    i = i + 1;
+  }
+
+  set_shared_image(context, (uint64_t*) 0);
+
+  set_image_contexts(image, get_image_contexts(image) - 1);
+
+  if (get_image_contexts(image) == 0) {
+    i = 0;
+
+    while (i < get_image_pages(image)) {
+      if (*(get_image_frames(image) + i) != 0)
+        pfree((uint64_t*) *(get_image_frames(image) + i));
+
+      i = i + 1;
+    }
+
+    if (shared_images == image)
+      shared_images = get_next_image(image);
+    else {
+      previous = shared_images;
+
+      while (get_next_image(previous) != image)
+        previous = get_next_image(previous);
+
+      set_next_image(previous, get_next_image(image));
+    }
+  }
+}
+
+uint64_t is_page_shared(uint64_t* context, uint64_t page) {
+  uint64_t* image;
+  uint64_t first_page;
+  uint64_t frame;
+
+  if (zero_frame != 0) {
+    frame = get_page_frame(get_pt(context), page);
+
+    if (frame == zero_frame)
+      return 1;
+    else if (find_merged_frame(frame) != (uint64_t*) 0)
+      return 1;
+  }
+
+  image = get_shared_image(context);
+
+  if (image == (uint64_t*) 0)
+    return 0;
+
+  first_page = page_of_virtual_address(get_image_code_start(image));
+
+  if (page < first_page)
+    return 0;
+  else if (page >= first_page + get_image_pages(image))
+    return 0;
+
+  frame = *(get_image_frames(image) + page - first_page);
+
+  if (frame == 0)
+    return 0;
+  else if (get_page_frame(get_pt(context), page) != frame)
+    // page has already been copied on write
+    return 0;
+  else
+    return 1;
+}
+
+void copy_on_write(uint64_t* context, uint64_t page) {
+  uint64_t* frame;
+  uint64_t* copy;
+  uint64_t i;
+
+  frame = (uint64_t*) get_page_frame(get_pt(context), page);
+
+  copy = palloc();
+
+  if ((uint64_t) frame == zero_frame)
+    // palloc returns zeroed page frames
+    saved_frames = saved_frames - 1;
+  else {
+    i = 0;
+
+    while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+      *(copy + i) = *(frame + i);
+
+      i = i + 1;
+    }
+
+    release_merged_frame((uint64_t) frame);
+
+    cow_pages = cow_pages + 1;
+  }
+
+  set_page_frame(get_pt(context), page, (uint64_t) copy);
+
+  flush_tlb_entry(get_pt(context), page);
+
+  if (debug_map)
+    printf("%s: page 0x%04lX copied on write from frame 0x%08lX to frame 0x%08lX in context %s\n", selfie_name,
+      page, (uint64_t) frame, (uint64_t) copy, get_name(context));
+}
+
+void unshare_page(uint64_t* context, uint64_t vaddr) {
+  // kernel writes to shared pages copy them first, just like stores
+  if (is_page_shared(context, page_of_virtual_address(vaddr)))
+    copy_on_write(context, page_of_virtual_address(vaddr));
+}
+
+uint64_t* allocate_page_descriptor() {
+  uint64_t* descriptor;
+
+  if (free_descriptors != (uint64_t*) 0) {
+    // descriptors are recycled since pages may be swapped out and in many times
+    descriptor = free_descriptors;
+
+    free_descriptors = get_next_descriptor(descriptor);
+
+    return descriptor;
+  } else
+    return smalloc(2 * sizeof(uint64_t*) + 2 * sizeof(uint64_t));
+}
+
+void free_page_descriptor(uint64_t* descriptor) {
+  set_next_descriptor(descriptor, free_descriptors);
+
+  free_descriptors = descriptor;
+}
+
+void register_resident_page(uint64_t* context, uint64_t page) {
+  uint64_t* descriptor;
+
+  descriptor = allocate_page_descriptor();
+
+  set_paged_context(descriptor, context);
+  set_paged_page(descriptor, page);
+
+  // newly mapped pages get a second chance
+  set_referenced(descriptor, 1);
+
+  if (clock_hand == (uint64_t*) 0)
+    set_next_descriptor(descriptor, descriptor);
+  else {
+    set_next_descriptor(descriptor, get_next_descriptor(clock_hand));
+    set_next_descriptor(clock_hand, descriptor);
+  }
+
+  // newly mapped pages are inspected last
+  clock_hand = descriptor;
+
+  resident_pages = resident_pages + 1;
+}
+
+uint64_t is_page_referenced(uint64_t* descriptor) {
+  uint64_t* entry;
+
+  if (get_referenced(descriptor))
+    return 1;
+
+  // pages accessed by the current context since the clock hand
+  // last passed them are cached in the TLB, acting as reference bit
+  if (get_pt(get_paged_context(descriptor)) == tlb_table) {
+    entry = tlb_entry(get_paged_page(descriptor));
+
+    if (*(entry + 1) != 0)
+      if (*entry == get_paged_page(descriptor))
+        return 1;
+  }
+
+  return 0;
+}
+
+uint64_t* select_victim() {
+  uint64_t* descriptor;
+  uint64_t* context;
+  uint64_t page;
+  uint64_t sweeps;
+
+  // second-chance (clock) page replacement
+
+  sweeps = 0;
+
+  // all pages are inspected at most twice
+  while (sweeps < 2 * resident_pages) {
+    descriptor = get_next_descriptor(clock_hand);
+
+    context = get_paged_context(descriptor);
+    page    = get_paged_page(descriptor);
+
+    clock_sweeps = clock_sweeps + 1;
+
+    if (is_code_address(context, virtual_address_of_page(page)))
+      // code pages are pinned since instruction fetch does not fault
+      clock_hand = descriptor;
+    else if (is_page_referenced(descriptor)) {
+      set_referenced(descriptor, 0);
+
+      // clear reference bit cached in TLB
+      flush_tlb_entry(get_pt(context), page);
+
+      clock_hand = descriptor;
+    } else
+      // assert: clock_hand precedes victim
+      return descriptor;
+
+    sweeps = sweeps + 1;
+  }
+
+  return (uint64_t*) 0;
+}
+
+void page_out() {
+  uint64_t* victim;
+  uint64_t* context;
+  uint64_t page;
+  uint64_t* frame;
+  uint64_t* slot;
+  uint64_t* bucket;
+  uint64_t i;
+
+  victim = (uint64_t*) 0;
+
+  if (clock_hand != (uint64_t*) 0)
+    if (used_swap + PAGEFRAMESIZE <= swap_size)
+      victim = select_victim();
+
+  if (victim == (uint64_t*) 0) {
+    printf("%s: page out failed, out of physical memory and swap space\n", selfie_name);
+
+    exit(EXITCODE_OUTOFPHYSICALMEMORY);
+  }
+
+  context = get_paged_context(victim);
+  page    = get_paged_page(victim);
+
+  frame = (uint64_t*) get_page_frame(get_pt(context), page);
+
+  if (free_swap_slots != (uint64_t*) 0) {
+    slot = free_swap_slots;
+
+    free_swap_slots = (uint64_t*) *slot;
+  } else
+    slot = smalloc(PAGEFRAMESIZE);
+
+  i = 0;
+
+  while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+    *(slot + i) = *(frame + i);
+
+    i = i + 1;
+  }
+
+  set_page_frame(get_pt(context), page, 0);
+
+  flush_tlb_entry(get_pt(context), page);
+
+  // move victim from clock to swap bucket
+
+  if (get_next_descriptor(clock_hand) == clock_hand)
+    clock_hand = (uint64_t*) 0;
+  else
+    set_next_descriptor(clock_hand, get_next_descriptor(victim));
+
+  resident_pages = resident_pages - 1;
+
+  bucket = swap_buckets + page % SWAPBUCKETS;
+
+  set_swap_slot(victim, slot);
+  set_next_descriptor(victim, (uint64_t*) *bucket);
+
+  *bucket = (uint64_t) victim;
+
+  used_swap = used_swap + PAGEFRAMESIZE;
+
+  page_outs = page_outs + 1;
+
+  pfree(frame);
+
+  if (debug_map)
+    printf("%s: page 0x%04lX swapped out from frame 0x%08lX in context %s\n", selfie_name,
+      page, (uint64_t) frame, get_name(context));
+}
+
+uint64_t page_in(uint64_t* context, uint64_t page) {
+  uint64_t* bucket;
+  uint64_t* previous;
+  uint64_t* descriptor;
+  uint64_t* slot;
+  uint64_t* frame;
+  uint64_t i;
+
+  if (swap_size == 0)
+    return 0;
+
+  bucket = swap_buckets + page % SWAPBUCKETS;
+
+  previous   = (uint64_t*) 0;
+  descriptor = (uint64_t*) *bucket;
+
+  while (descriptor != (uint64_t*) 0) {
+    if (get_paged_context(descriptor) == context)
+      if (get_paged_page(descriptor) == page) {
+        // unlink before allocating a frame which may swap out other pages
+        if (previous == (uint64_t*) 0)
+          *bucket = (uint64_t) get_next_descriptor(descriptor);
+        else
+          set_next_descriptor(previous, get_next_descriptor(descriptor));
+
+        slot = get_swap_slot(descriptor);
+
+        free_page_descriptor(descriptor);
+
+        frame = palloc();
+
+        i = 0;
+
+        while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+          *(frame + i) = *(slot + i);
+
+          i = i + 1;
+        }
+
+        // link free swap slots through their first word
+        *slot = (uint64_t) free_swap_slots;
+
+        free_swap_slots = slot;
+
+        used_swap = used_swap - PAGEFRAMESIZE;
+
+        page_ins = page_ins + 1;
+
+        map_page(context, page, (uint64_t) frame);
+
+        return 1;
+      }
+
+    previous   = descriptor;
+    descriptor = get_next_descriptor(descriptor);
+  }
+
+  return 0;
+}
+
+void release_paged_pages(uint64_t* context) {
+  uint64_t* previous;
+  uint64_t* descriptor;
+  uint64_t* bucket;
+  uint64_t* slot;
+  uint64_t i;
+
+  if (swap_size == 0)
+    return;
+
+  // remove resident pages of context from clock
+
+  if (clock_hand != (uint64_t*) 0) {
+    previous = clock_hand;
+
+    i = resident_pages;
+
+    while (i > 0) {
+      descriptor = get_next_descriptor(previous);
+
+      if (get_paged_context(descriptor) == context) {
+        if (descriptor == previous)
+          // last page on clock
+          clock_hand = (uint64_t*) 0;
+        else {
+          set_next_descriptor(previous, get_next_descriptor(descriptor));
+
+          if (descriptor == clock_hand)
+            clock_hand = previous;
+        }
+
+        resident_pages = resident_pages - 1;
+
+        free_page_descriptor(descriptor);
+      } else
+        previous = descriptor;
+
+      i = i - 1;
+    }
+  }
+
+  // free swap slots of swapped out pages of context
+
+  bucket = swap_buckets;
+
+  while (bucket < swap_buckets + SWAPBUCKETS) {
+    previous   = (uint64_t*) 0;
+    descriptor = (uint64_t*) *bucket;
+
+    while (descriptor != (uint64_t*) 0) {
+      if (get_paged_context(descriptor) == context) {
+        if (previous == (uint64_t*) 0)
+          *bucket = (uint64_t) get_next_descriptor(descriptor);
+        else
+          set_next_descriptor(previous, get_next_descriptor(descriptor));
+
+        slot = get_swap_slot(descriptor);
+
+        *slot = (uint64_t) free_swap_slots;
+
+        free_swap_slots = slot;
+
+        used_swap = used_swap - PAGEFRAMESIZE;
+
+        free_page_descriptor(descriptor);
+
+        if (previous == (uint64_t*) 0)
+          descriptor = (uint64_t*) *bucket;
+        else
+          descriptor = get_next_descriptor(previous);
+      } else {
+        previous   = descriptor;
+        descriptor = get_next_descriptor(descriptor);
+      }
+    }
+
+    bucket = bucket + 1;
+  }
+}
+
+void unshare_pages(uint64_t* context, uint64_t vaddr, uint64_t bytes) {
+  uint64_t page;
+
+  // assert: bytes > 0
+
+  page = page_of_virtual_address(vaddr);
+
+  while (page <= page_of_virtual_address(vaddr + bytes - 1)) {
+    unshare_page(context, virtual_address_of_page(page));
+
+    page = page + 1;
+  }
+}
+
+void count_saved_frame() {
+  saved_frames = saved_frames + 1;
+
+  if (saved_frames > peak_saved_frames)
+    peak_saved_frames = saved_frames;
+}
+
+void release_page_frame(uint64_t frame) {
+  if (frame == zero_frame)
+    saved_frames = saved_frames - 1;
+  else if (release_merged_frame(frame) == 0)
+    pfree((uint64_t*) frame);
+}
+
+uint64_t* find_merged_frame(uint64_t frame) {
+  uint64_t* merged;
+
+  if (merged_frames == (uint64_t*) 0)
+    return (uint64_t*) 0;
+
+  merged = (uint64_t*) *(merged_frames + frame / PAGEFRAMESIZE % MERGEBUCKETS);
+
+  while (merged != (uint64_t*) 0) {
+    if (get_merged_frame(merged) == frame)
+      return merged;
+
+    merged = get_next_merged(merged);
+  }
+
+  return (uint64_t*) 0;
+}
+
+void reference_merged_frame(uint64_t frame) {
+  uint64_t* merged;
+  uint64_t* bucket;
+
+  merged = find_merged_frame(frame);
+
+  if (merged == (uint64_t*) 0) {
+    if (free_merged != (uint64_t*) 0) {
+      merged = free_merged;
+
+      free_merged = get_next_merged(merged);
+    } else
+      merged = allocate_merged_frame();
+
+    bucket = merged_frames + frame / PAGEFRAMESIZE % MERGEBUCKETS;
+
+    set_next_merged(merged, (uint64_t*) *bucket);
+    set_merged_frame(merged, frame);
+
+    // frame was mapped by one page only
+    set_references(merged, 1);
+
+    *bucket = (uint64_t) merged;
+  }
+
+  set_references(merged, get_references(merged) + 1);
+}
+
+uint64_t release_merged_frame(uint64_t frame) {
+  uint64_t* merged;
+  uint64_t* bucket;
+  uint64_t* previous;
+
+  // returns 1 if frame is still mapped by other pages
+
+  merged = find_merged_frame(frame);
+
+  if (merged == (uint64_t*) 0)
+    return 0;
+
+  set_references(merged, get_references(merged) - 1);
+
+  saved_frames = saved_frames - 1;
+
+  if (get_references(merged) == 1) {
+    // frame is private again to the one page left
+    bucket = merged_frames + frame / PAGEFRAMESIZE % MERGEBUCKETS;
+
+    if ((uint64_t*) *bucket == merged)
+      *bucket = (uint64_t) get_next_merged(merged);
+    else {
+      previous = (uint64_t*) *bucket;
+
+      while (get_next_merged(previous) != merged)
+        previous = get_next_merged(previous);
+
+      set_next_merged(previous, get_next_merged(merged));
+    }
+
+    set_next_merged(merged, free_merged);
+
+    free_merged = merged;
+  }
+
+  return 1;
+}
+
+uint64_t hash_frame(uint64_t* frame) {
+  uint64_t hash;
+  uint64_t i;
+
+  hash = 0;
+
+  i = 0;
+
+  while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+    hash = hash * 31 + *(frame + i);
+
+    i = i + 1;
+  }
+
+  return hash;
+}
+
+uint64_t is_frame_equal(uint64_t* frame1, uint64_t* frame2) {
+  uint64_t i;
+
+  i = 0;
+
+  while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+    if (*(frame1 + i) != *(frame2 + i))
+      return 0;
+
+    i = i + 1;
+  }
+
+  return 1;
+}
+
+uint64_t is_frame_stable(uint64_t frame, uint64_t hash) {
+  uint64_t* entry;
+
+  // frames are only merged if their content has not
+  // changed since the previous scan, avoiding copy on write
+  // of pages that are written frequently
+
+  entry = dedup_hashes + frame / PAGEFRAMESIZE % DEDUPSLOTS * 2;
+
+  if (*entry == frame)
+    if (*(entry + 1) == hash)
+      return 1;
+
+  *entry       = frame;
+  *(entry + 1) = hash;
+
+  return 0;
+}
+
+void merge_page(uint64_t* context, uint64_t page, uint64_t frame, uint64_t hash) {
+  uint64_t* slot;
+  uint64_t identical;
+
+  // assert: page is mapped to frame and not shared
+
+  identical = 0;
+
+  if (hash == 0)
+    // hash of zeros is 0
+    if (is_frame_equal((uint64_t*) frame, (uint64_t*) zero_frame))
+      identical = zero_frame;
+
+  if (identical == 0) {
+    slot = dedup_slots + hash % DEDUPSLOTS;
+
+    identical = *slot;
+
+    if (identical == 0) {
+      // remember frame for merging identical pages scanned later
+      *slot = frame;
+
+      return;
+    } else if (is_frame_equal((uint64_t*) frame, (uint64_t*) identical) == 0)
+      return;
+
+    reference_merged_frame(identical);
+  }
+
+  set_page_frame(get_pt(context), page, identical);
+
+  flush_tlb_entry(get_pt(context), page);
+
+  pfree((uint64_t*) frame);
+
+  merged_pages = merged_pages + 1;
+
+  count_saved_frame();
+
+  if (debug_map)
+    printf("%s: page 0x%04lX merged from frame 0x%08lX into frame 0x%08lX in context %s\n", selfie_name,
+      page, frame, identical, get_name(context));
+}
+
+void merge_pages(uint64_t* context, uint64_t lo, uint64_t hi) {
+  uint64_t frame;
+  uint64_t hash;
+  uint64_t* slot;
+
+  while (lo <= hi) {
+    frame = get_page_frame(get_pt(context), lo);
+
+    if (frame != 0) {
+      if (is_page_shared(context, lo) == 0) {
+        hash = hash_frame((uint64_t*) frame);
+
+        if (is_frame_stable(frame, hash))
+          merge_page(context, lo, frame, hash);
+      } else if (find_merged_frame(frame) != (uint64_t*) 0) {
+        // pages identical to merged frames are merged as well
+        slot = dedup_slots + hash_frame((uint64_t*) frame) % DEDUPSLOTS;
+
+        if (*slot == 0)
+          *slot = frame;
+      }
+    }
+
+    lo = lo + 1;
+  }
+}
+
+void merge_identical_pages() {
+  uint64_t* context;
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) != MY_CONTEXT)
+      // contexts hosted by hypervisors access page frames
+      // of their parents through cached page tables
+      return;
+
+    context = get_next_context(context);
+  }
+
+  zero_memory(dedup_slots, DEDUPSLOTS * sizeof(uint64_t));
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_pt(context) != (uint64_t*) 0) {
+      merge_pages(context, get_lowest_lo_page(context), get_highest_lo_page(context));
+      merge_pages(context, get_lowest_hi_page(context), get_highest_hi_page(context));
+    }
+
+    context = get_next_context(context);
+  }
+
+  dedup_scans = dedup_scans + 1;
+}
+
+void map_unmapped_pages(uint64_t* context) {
+  uint64_t page;
+  uint64_t frames;
+
+  // assert: page table is only mapped from beginning up and end down
+
+  page = get_lowest_lo_page(context);
+
+  while (is_page_mapped(get_pt(context), page))
+    page = page + 1;
+
+  if (zero_frame != 0) {
+    // map as many pages to the zero frame as page frames are available,
+    // page frames are then only allocated when pages are written
+    frames = (free_page_frame_memory + freed_page_frame_memory) / PAGEFRAMESIZE;
+
+    if (allocated_page_frame_memory < PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
+      frames = frames + (PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS - allocated_page_frame_memory) / PAGEFRAMESIZE;
+
+    while (frames > 0) {
+      map_page(context, page, zero_frame);
+
+      zero_pages = zero_pages + 1;
+
+      count_saved_frame();
+
+      page   = page + 1;
+      frames = frames - 1;
+    }
+  } else
+    while (pavailable()) {
+      map_page(context, page, (uint64_t) palloc());
+
+      page = page + 1;
+    }
+
+  // allowing more palloc for caching tree page tables
+  PHYSICALMEMORYEXCESS = PHYSICALMEMORYEXCESS + PAGEFRAMESIZE / PAGESIZE;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- KERNEL -----------------------------
+// -----------------------------------------------------------------
+
+void up_load_binary(uint64_t* context) {
+  uint64_t baddr;
+  uint64_t* image;
+
+  // assert: e_entry is multiple of PAGESIZE and INSTRUCTIONSIZE
+
+  set_pc(context, e_entry);
+
+  // setting up page table cache
+
+  set_lowest_lo_page(context, page_of_virtual_address(code_start));
+  set_highest_lo_page(context, get_lowest_lo_page(context));
+
+  // setting up memory segments
+
+  set_code_seg_start(context, code_start);
+  set_code_seg_size(context, code_size);
+  set_data_seg_start(context, data_start);
+  set_data_seg_size(context, data_size);
+  set_heap_seg_start(context, round_up(data_start + data_size, PAGESIZE));
+  set_program_break(context, get_heap_seg_start(context));
+
+  if (share_images) {
+    image = find_shared_image();
+
+    if (image != (uint64_t*) 0) {
+      share_image(context, image);
+
+      return;
+    }
+  }
+
+  baddr = 0;
+
+  while (baddr < code_size) {
+    map_and_store(context, get_code_seg_start(context) + baddr, load_code(baddr));
+
+    baddr = baddr + WORDSIZE;
+  }
+
+  baddr = 0;
+
+  while (baddr < data_size) {
+    map_and_store(context, get_data_seg_start(context) + baddr, load_data(baddr));
+
+    baddr = baddr + WORDSIZE;
+  }
+
+  if (share_images)
+    create_shared_image(context);
+}
+
+uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP) {
+  uint64_t bytes;
+  uint64_t i;
+
+  bytes = round_up(string_length(s) + 1, WORDSIZE);
+
+  // allocate memory for storing string
+  SP = SP - bytes;
+
+  i = 0;
+
+  while (i < bytes) {
+    map_and_store(context, SP + i, load_word((uint64_t*) s, i, 1));
+
+    i = i + WORDSIZE;
+  }
+
+  return SP;
 }
 
-uint64_t* allocate_memory(uint64_t* context, uint64_t size) {
-  return allocate_memory_selfie(context, size);
+void up_load_arguments(uint64_t* context, uint64_t argc, uint64_t* argv) {
+  /* upload arguments like a UNIX system
+
+      SP
+      |
+      V
+   | argc | argv[0] | ... | argv[n] | 0 | env[0] | ... | env[m] | 0 |
+
+     with argc > 0, n == argc - 1, and m == 0 (that is, env is empty) */
+  uint64_t SP;
+  uint64_t* vargv;
+  uint64_t i;
+
+  // the call stack grows top down
+  SP = VIRTUALMEMORYSIZE * GIGABYTE;
+
+  vargv = smalloc(argc * sizeof(uint64_t*));
+
+  i = 0;
+
+  // push program parameters onto the stack
+  while (i < argc) {
+    SP = up_load_string(context, (char*) *(argv + i), SP);
+
+    // store pointer in virtual *argv
+    *(vargv + i) = SP;
+
+    i = i + 1;
+  }
+
+  // allocate memory for termination of env table
+  SP = SP - WORDSIZE;
+
+  // push null value to terminate env table
+  map_and_store(context, SP, 0);
+
+  // allocate memory for termination of argv table
+  SP = SP - WORDSIZE;
+
+  // push null value to terminate argv table
+  map_and_store(context, SP, 0);
+
+  // assert: i == argc
+
+  // push argv table onto the stack
+  while (i > 0) {
+    // allocate memory for argv table entry
+    SP = SP - WORDSIZE;
+
+    i = i - 1;
+
+    // push argv table entry
+    map_and_store(context, SP, *(vargv + i));
+  }
+
+  // allocate memory for argc
+  SP = SP - WORDSIZE;
+
+  // push argc
+  map_and_store(context, SP, argc);
+
+  // store stack pointer value in stack pointer register
+  *(get_regs(context) + REG_SP) = SP;
+
+  // initialize frame pointer register for completeness (redundant)
+  *(get_regs(context) + REG_S0) = 0;
 }
 
-uint64_t* allocate_memory_selfie(uint64_t* context, uint64_t size) {
-  uint64_t* block;
-  uint64_t* metadata;
+char* replace_extension(char* filename, char* suffix, char* extension) {
+  char* s;
+  uint64_t i;
+  uint64_t c;
+  char* filename_without_extension;
 
-  gc_num_mallocated = gc_num_mallocated + 1;
-  gc_mem_mallocated = gc_mem_mallocated + size;
+  // assert: string_length(filename) + string_length(suffix) + 1 + string_length(extension) < MAX_FILENAME_LENGTH
+
+  s = string_alloc(string_length(filename) + string_length(suffix) + 1 + string_length(extension));
+
+  // start reading at end of filename
+  i = string_length(filename);
+
+  c = 0;
+
+  // look for extension
+  while (c != '.') {
+    if (c == '/')
+      i = 0;
+
+    if (i > 0) {
+      i = i - 1;
+
+      c = load_character(filename, i);
+    } else
+      c = '.';
+  }
+
+  if (i == 0)
+    // filename has no extension
+    filename_without_extension = filename;
+  else {
+    filename_without_extension = string_alloc(i);
+
+    // assert: filename_without_extension is zeroed and thus null-terminated
+
+    // copy filename without extension and null-terminator into filename_without_extension
+    while (i > 0) {
+      i = i - 1;
+
+      store_character(filename_without_extension, i, load_character(filename, i));
+    }
+  }
+
+  // writing filename_without_extension with suffix dot extension into s
+  sprintf(s, "%s%s.%s", filename_without_extension, suffix, extension);
+
+  return s;
+}
+
+char* boot_level_prefix(char* s) {
+  uint64_t l;
+  char* t;
+  uint64_t i;
+
+  l = string_length(s);
+
+  t = string_alloc(l);
+
+  i = 0;
+
+  while (i < l) {
+    if (load_character(s, i) == '>') {
+      store_character(t, i, '>');
+
+      i = i + 1;
+    } else {
+      store_character(t, i, 0);
+
+      return t;
+    }
+  }
+
+  return t;
+}
+
+char* increment_boot_level_prefix(char* s, char* t) {
+  char* p;
+  char* u;
+
+  p = boot_level_prefix(s);
+
+  u = string_alloc(string_length(p) + 1 + 1 + string_length(t));
+
+  sprintf(u, "%s> %s", p, t);
+
+  return u;
+}
+
+void boot_loader(uint64_t* context) {
+  up_load_binary(context);
+
+  set_name(context, increment_boot_level_prefix(selfie_name, binary_name));
+
+  // pass binary name as first argument by replacing next argument
+  set_argument(get_name(context));
+
+  up_load_arguments(context, number_of_remaining_arguments(), remaining_arguments());
+}
+
+uint64_t is_io_system_call(uint64_t a7) {
+  if (a7 == SYSCALL_READ)
+    return 1;
+  else if (a7 == SYSCALL_WRITE)
+    return 1;
+  else if (a7 == SYSCALL_OPENAT)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t write_snapshot(uint64_t* context, char* filename) {
+  uint64_t fd;
+  uint64_t* header;
+  uint64_t* pages;
+  uint64_t number_of_pages;
+  uint64_t page;
+  uint64_t i;
+
+  // assert: filename is mapped and not longer than MAX_FILENAME_LENGTH
+
+  fd = open_write_only(filename, S_IRUSR_IWUSR_IRGRP_IROTH);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not create snapshot image file %s\n", selfie_name, filename);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  number_of_pages = 0;
+
+  page = next_mapped_page(get_pt(context), 0);
+
+  while (page < NUMBEROFPAGES) {
+    number_of_pages = number_of_pages + 1;
+
+    page = next_mapped_page(get_pt(context), page + 1);
+  }
+
+  pages = smalloc(number_of_pages * sizeof(uint64_t));
+
+  i = 0;
+
+  page = next_mapped_page(get_pt(context), 0);
+
+  while (page < NUMBEROFPAGES) {
+    *(pages + i) = page;
+
+    i = i + 1;
+
+    page = next_mapped_page(get_pt(context), page + 1);
+  }
+
+  header = smalloc(IMAGEHEADERENTRIES * sizeof(uint64_t));
+
+  *header        = IMAGEMAGIC;
+  *(header + 1)  = WORDSIZE;
+  *(header + 2)  = PAGEFRAMESIZE;
+  *(header + 3)  = get_pc(context);
+  *(header + 4)  = get_code_seg_start(context);
+  *(header + 5)  = get_code_seg_size(context);
+  *(header + 6)  = get_data_seg_start(context);
+  *(header + 7)  = get_data_seg_size(context);
+  *(header + 8)  = get_heap_seg_start(context);
+  *(header + 9)  = get_program_break(context);
+  *(header + 10) = number_of_pages;
+
+  if (write(fd, header, IMAGEHEADERENTRIES * sizeof(uint64_t)) == IMAGEHEADERENTRIES * sizeof(uint64_t))
+    if (write(fd, get_regs(context), NUMBEROFREGISTERS * sizeof(uint64_t)) == NUMBEROFREGISTERS * sizeof(uint64_t))
+      if (write(fd, pages, number_of_pages * sizeof(uint64_t)) == number_of_pages * sizeof(uint64_t)) {
+        i = 0;
+
+        while (i < number_of_pages) {
+          // page frames are written as is, only the image header is portable
+          if (write(fd, (uint64_t*) get_page_frame(get_pt(context), *(pages + i)), PAGEFRAMESIZE) != PAGEFRAMESIZE) {
+            printf("%s: could not write page frames into snapshot image file %s\n", selfie_name, filename);
+
+            exit(EXITCODE_IOERROR);
+          }
+
+          i = i + 1;
+        }
+
+        return number_of_pages;
+      }
+
+  printf("%s: could not write snapshot image file %s\n", selfie_name, filename);
+
+  exit(EXITCODE_IOERROR);
+}
+
+void save_snapshot(uint64_t* context) {
+  uint64_t number_of_pages;
+
+  number_of_pages = write_snapshot(context, snapshot_name);
+
+  printf("%s: %lu bytes with %lu mapped pages of context %s written into snapshot image %s\n", selfie_name,
+    (IMAGEHEADERENTRIES + NUMBEROFREGISTERS + number_of_pages) * sizeof(uint64_t) + number_of_pages * PAGEFRAMESIZE,
+    number_of_pages,
+    get_name(context),
+    snapshot_name);
+
+  // snapshot is only taken once
+  snapshot_name = (char*) 0;
+}
+
+void selfie_resume(char* filename) {
+  uint64_t fd;
+  uint64_t number_of_pages;
+
+  image_name = filename;
+
+  // assert: image_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  fd = open_read_only(image_name);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not open snapshot image file %s\n", selfie_name, image_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  // image replaces any loaded binary
+  reset_binary();
+
+  // allocate and map (on all boot levels) memory for reading into it
+  image_header = touch(smalloc(IMAGEHEADERENTRIES * sizeof(uint64_t)), IMAGEHEADERENTRIES * sizeof(uint64_t));
 
-  // try reusing memory first
-  block = reuse_memory(context, size);
+  if (read(fd, image_header, IMAGEHEADERENTRIES * sizeof(uint64_t)) == IMAGEHEADERENTRIES * sizeof(uint64_t))
+    if (*image_header == IMAGEMAGIC)
+      // page frames are only compatible with same target and host
+      if (*(image_header + 1) == WORDSIZE)
+        if (*(image_header + 2) == PAGEFRAMESIZE) {
+          number_of_pages = *(image_header + 10);
 
-  if (block != (uint64_t*) 0) {
-    gc_num_reused_mallocs = gc_num_reused_mallocs + 1;
-    gc_mem_reused         = gc_mem_reused + size;
+          image_registers = touch(smalloc(NUMBEROFREGISTERS * sizeof(uint64_t)), NUMBEROFREGISTERS * sizeof(uint64_t));
+          image_pages     = touch(smalloc(number_of_pages * sizeof(uint64_t)), number_of_pages * sizeof(uint64_t));
 
-    return block;
-  }
+          // page frames must be PAGEFRAMESIZE-aligned in memory
+          image_frames = (uint64_t*) round_up((uint64_t) smalloc((number_of_pages + 1) * PAGEFRAMESIZE), PAGEFRAMESIZE);
 
-  // allocate new memory block if there is no reusable memory
-  block = allocate_new_memory(context, size);
+          touch(image_frames, number_of_pages * PAGEFRAMESIZE);
 
-  if (block != (uint64_t*) 0) {
-    // allocate metadata for managing memory block
-    metadata = allocate_metadata(context);
+          if (read(fd, image_registers, NUMBEROFREGISTERS * sizeof(uint64_t)) == NUMBEROFREGISTERS * sizeof(uint64_t))
+            if (read(fd, image_pages, number_of_pages * sizeof(uint64_t)) == number_of_pages * sizeof(uint64_t))
+              // read all page frames at once to map them without copying
+              if (read(fd, image_frames, number_of_pages * PAGEFRAMESIZE) == number_of_pages * PAGEFRAMESIZE) {
+                // segments of the image replace those of a binary
+                code_start = *(image_header + 4);
+                code_size  = *(image_header + 5);
+                data_start = *(image_header + 6);
+                data_size  = *(image_header + 7);
 
-    if (metadata != (uint64_t*) 0) {
-      set_metadata_next(metadata, get_used_list_head_gc(context));
-      set_used_list_head_gc(context, metadata);
+                binary_name = image_name;
 
-      set_metadata_memory(metadata, block);
-      set_metadata_size(metadata, size);
-      set_metadata_markbit(metadata, GC_MARKBIT_UNREACHABLE);
+                printf("%s: %lu bytes with %lu mapped pages loaded from snapshot image %s\n", selfie_name,
+                  (IMAGEHEADERENTRIES + NUMBEROFREGISTERS + number_of_pages) * sizeof(uint64_t) + number_of_pages * PAGEFRAMESIZE,
+                  number_of_pages,
+                  image_name);
 
-      gc_num_gced_mallocs   = gc_num_gced_mallocs + 1;
-      gc_num_ungced_mallocs = gc_num_ungced_mallocs + 1;
+                return;
+              }
+        }
 
-      gc_mem_blocks   = gc_mem_blocks + size;
-      gc_mem_metadata = gc_mem_metadata + GC_METADATA_SIZE;
-    } else
-      return (uint64_t*) 0;
-  } else
-    // if memory block allocation failed discount memory from mallocated total
-    gc_mem_mallocated = gc_mem_mallocated - size;
+  printf("%s: failed to load snapshot image from input file %s\n", selfie_name, image_name);
 
-  return block;
+  exit(EXITCODE_IOERROR);
 }
 
-uint64_t* gc_malloc_implementation(uint64_t* context, uint64_t size) {
-  // first, garbage collect
-  if (get_gcs_in_period_gc(context) >= GC_PERIOD) {
-    gc_collect(context);
+void resume_loader(uint64_t* context) {
+  uint64_t i;
+  uint64_t page;
 
-    set_gcs_in_period_gc(context, 0);
-  } else
-    set_gcs_in_period_gc(context, get_gcs_in_period_gc(context) + 1);
+  set_pc(context, *(image_header + 3));
 
-  // then, allocate memory
+  i = 0;
 
-  size = round_up(size, GC_WORDSIZE);
+  while (i < NUMBEROFREGISTERS) {
+    *(get_regs(context) + i) = *(image_registers + i);
 
-  return allocate_memory(context, size);
-}
+    // registers are initialized by image
+    *(writes_per_register + i) = 1;
 
-uint64_t* get_metadata_if_address_is_valid(uint64_t* context, uint64_t address) {
-  uint64_t* node;
-  uint64_t  block;
+    i = i + 1;
+  }
 
-  // pointer below gced heap
-  if (address < get_heap_seg_start_gc(context))
-    return (uint64_t*) 0;
+  set_lowest_lo_page(context, page_of_virtual_address(code_start));
+  set_highest_lo_page(context, get_lowest_lo_page(context));
 
-  // pointer above gced heap
-  if (address >= get_heap_seg_end_gc(context))
-    return (uint64_t*) 0;
+  set_code_seg_start(context, code_start);
+  set_code_seg_size(context, code_size);
+  set_data_seg_start(context, data_start);
+  set_data_seg_size(context, data_size);
+  set_heap_seg_start(context, *(image_header + 8));
+  set_program_break(context, *(image_header + 9));
 
-  node = get_used_list_head_gc(context);
+  i = 0;
 
-  while (node != (uint64_t*) 0) {
-    if (is_gc_library(context))
-      if (address >= (uint64_t) node)
-        if (address < ((uint64_t) node + GC_METADATA_SIZE))
-          // address points to metadata (redundant check but possibly faster)
-          return (uint64_t*) 0;
+  while (i < *(image_header + 10)) {
+    page = *(image_pages + i);
 
-    block = (uint64_t) get_metadata_memory(node);
+    // map page frames of image directly rather than copying them
+    map_page(context, page, (uint64_t) (image_frames + i * (PAGEFRAMESIZE / sizeof(uint64_t))));
 
-    if (address >= block)
-      if (address < block + get_metadata_size(node))
-        // address points into a gced block
-        return node;
+    if (is_heap_address(context, virtual_address_of_page(page)))
+      set_mc_mapped_heap(context, get_mc_mapped_heap(context) + PAGESIZE);
 
-    node = get_metadata_next(node);
+    i = i + 1;
   }
 
-  return (uint64_t*) 0;
+  // page frames of image are owned and eventually freed by context
+  allocated_page_frame_memory = allocated_page_frame_memory + *(image_header + 10) * PAGEFRAMESIZE;
+
+  set_name(context, increment_boot_level_prefix(selfie_name, binary_name));
 }
 
-void mark_block(uint64_t* context, uint64_t address) {
-  uint64_t gc_address;
+char* checkpoint_name(char* filename, uint64_t checkpoint) {
+  char* suffix;
 
-  gc_address = gc_load_memory(context, address);
+  // assert: checkpoint has at most 20 digits
+  suffix = string_alloc(21);
 
-  mark_block_selfie(context, gc_address);
+  sprintf(suffix, "-%lu", checkpoint);
+
+  return replace_extension(filename, suffix, "snp");
 }
 
-void mark_block_selfie(uint64_t* context, uint64_t gc_address) {
-  uint64_t* metadata;
-  uint64_t block_start;
-  uint64_t block_end;
+void flush_log_buffer() {
+  if (write(log_fd, log_buffer, log_buffer_bytes) != log_buffer_bytes) {
+    printf("%s: could not write execution log file %s\n", selfie_name, log_name);
 
-  if (not(is_gc_library(context)))
-    if (not(is_virtual_address_valid(gc_address, WORDSIZE)))
-      return;
+    exit(EXITCODE_IOERROR);
+  }
 
-  metadata = get_metadata_if_address_is_valid(context, gc_address);
+  log_bytes = log_bytes + log_buffer_bytes;
 
-  if (metadata == (uint64_t*) 0)
-    // address is not a pointer to a gced block
-    return;
-  else if (get_metadata_markbit(metadata) == GC_MARKBIT_UNREACHABLE)
-    set_metadata_markbit(metadata, GC_MARKBIT_REACHABLE);
+  log_buffer_bytes = 0;
+}
+
+void log_byte(uint64_t b) {
+  // store_character is not used since it requires b < 128 on hosts with signed characters
+  if (log_buffer_bytes % sizeof(uint64_t) == 0)
+    *(log_buffer + log_buffer_bytes / sizeof(uint64_t)) = b;
   else
-    // memory block has already been marked as reachable
-    return;
+    *(log_buffer + log_buffer_bytes / sizeof(uint64_t)) =
+      *(log_buffer + log_buffer_bytes / sizeof(uint64_t))
+        + left_shift(b, (log_buffer_bytes % sizeof(uint64_t)) * 8);
 
-  block_start = (uint64_t) get_metadata_memory(metadata);
-  block_end   = block_start + get_metadata_size(metadata);
+  log_buffer_bytes = log_buffer_bytes + 1;
 
-  while (block_start < block_end) {
-    mark_block(context, block_start);
+  if (log_buffer_bytes == LOGBUFFERSIZE)
+    flush_log_buffer();
+}
 
-    block_start = block_start + GC_WORDSIZE;
+void log_number(uint64_t n) {
+  while (n >= 128) {
+    log_byte(n % 128 + 128);
+
+    n = n / 128;
   }
+
+  log_byte(n);
 }
 
-void mark_segment(uint64_t* context, uint64_t segment_start, uint64_t segment_end) {
-  // assert: segment is not heap, segment_start >= GC_WORDSIZE
+void start_logging(uint64_t* context) {
+  uint64_t* header;
 
-  // prevent 32-bit overflow by subtracting GC_WORDSIZE
-  segment_start = segment_start - GC_WORDSIZE;
-  segment_end   = segment_end - GC_WORDSIZE;
+  // assert: log_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-  while (segment_start < segment_end) {
-    // undo GC_WORDSIZE index offset before marking address
-    mark_block(context, segment_start + GC_WORDSIZE);
+  log_fd = open_write_only(log_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-    segment_start = segment_start + GC_WORDSIZE;
+  if (signed_less_than(log_fd, 0)) {
+    printf("%s: could not create execution log file %s\n", selfie_name, log_name);
+
+    exit(EXITCODE_IOERROR);
   }
-}
 
-void mark(uint64_t* context) {
-  if (get_used_list_head_gc(context) == (uint64_t*) 0)
-    return; // if there is no used memory skip collection
+  header = smalloc(LOGHEADERENTRIES * sizeof(uint64_t));
 
-  // assert: all used temporary registers are saved on stack, see save_temporaries()
+  *header       = LOGMAGIC;
+  *(header + 1) = WORDSIZE;
 
-  // not traversing registers
+  if (write(log_fd, header, LOGHEADERENTRIES * sizeof(uint64_t)) != LOGHEADERENTRIES * sizeof(uint64_t)) {
+    printf("%s: could not write execution log file %s\n", selfie_name, log_name);
 
-  // root segments: call stack and data segment
+    exit(EXITCODE_IOERROR);
+  }
 
-  // traverse call stack
-  mark_segment(context, get_stack_seg_start_gc(context), VIRTUALMEMORYSIZE * GIGABYTE);
+  log_buffer = smalloc(LOGBUFFERSIZE);
 
-  // traverse data segment
-  mark_segment(context, get_data_seg_start_gc(context), get_data_seg_end_gc(context));
+  log_buffer_bytes = 0;
+
+  log_bytes        = LOGHEADERENTRIES * sizeof(uint64_t);
+  log_syscalls     = 0;
+  log_checkpoints  = 0;
+  checkpoint_bytes = 0;
+
+  logging = 1;
+
+  // any instruction count can be replayed from the initial checkpoint
+  take_checkpoint(context);
 }
 
-void free_block(uint64_t* context, uint64_t* metadata, uint64_t* prev_metadata) {
-  if (prev_metadata == (uint64_t*) 0)
-    set_used_list_head_gc(context, get_metadata_next(metadata));
-  else
-    set_metadata_next(prev_metadata, get_metadata_next(metadata));
+void take_checkpoint(uint64_t* context) {
+  uint64_t instructions;
+  uint64_t number_of_pages;
 
-  if (GC_REUSE) {
-    set_metadata_next(metadata, get_free_list_head_gc(context));
+  instructions = get_total_number_of_instructions();
 
-    set_free_list_head_gc(context, metadata);
-  }
+  if (get_exception(context) == EXCEPTION_SYSCALL)
+    // the system call is redone on resume, just like with snapshots
+    instructions = instructions - 1;
 
-  gc_mem_collected = gc_mem_collected + get_metadata_size(metadata);
-}
+  number_of_pages = write_snapshot(context, checkpoint_name(log_name, log_checkpoints));
 
-void sweep(uint64_t* context) {
-  sweep_selfie(context);
+  log_number(LOG_CHECKPOINT);
+  log_number(instructions);
+  log_number(log_checkpoints);
+
+  checkpoint_bytes = checkpoint_bytes
+    + (IMAGEHEADERENTRIES + NUMBEROFREGISTERS + number_of_pages) * sizeof(uint64_t) + number_of_pages * PAGEFRAMESIZE;
+
+  log_checkpoints = log_checkpoints + 1;
+
+  if (checkpoint_period > 0)
+    next_checkpoint = get_total_number_of_instructions() + checkpoint_period;
+  else
+    next_checkpoint = UINT64_MAX;
 }
 
-void sweep_selfie(uint64_t* context) {
-  uint64_t* prev_node;
-  uint64_t* node;
-  uint64_t* next_node;
+void log_system_call(uint64_t* context, uint64_t a7) {
+  uint64_t size;
+  uint64_t i;
 
-  prev_node = (uint64_t*) 0;
+  log_number(LOG_SYSCALL);
+  log_number(get_total_number_of_instructions());
+  log_number(a7);
+  log_number(*(get_regs(context) + REG_A0));
 
-  node = get_used_list_head_gc(context);
+  if (a7 == SYSCALL_READ) {
+    size = sign_extend(*(get_regs(context) + REG_A0), SYSCALL_BITWIDTH);
 
-  while (node != (uint64_t*) 0) {
-    // next node changes when memory block is reused
-    next_node = get_metadata_next(node);
+    if (signed_less_than(0, size)) {
+      i = 0;
 
-    if (get_metadata_markbit(node) == GC_MARKBIT_UNREACHABLE)
-      free_block(context, node, prev_node);
-    else {
-      // clear mark bit for next marking
-      set_metadata_markbit(node, GC_MARKBIT_UNREACHABLE);
+      // the bytes read into memory are still in the I/O buffer
+      while (i < size) {
+        log_byte(get_bits(*(IO_buffer + i / sizeof(uint64_t)), (i % sizeof(uint64_t)) * 8, 8));
 
-      prev_node = node;
+        i = i + 1;
+      }
     }
-
-    node = next_node;
   }
+
+  log_syscalls = log_syscalls + 1;
 }
 
-void gc_collect(uint64_t* context) {
-  mark(context);
-  sweep(context);
+void stop_logging() {
+  flush_log_buffer();
 
-  gc_num_collects = gc_num_collects + 1;
+  printf("%s: %lu bytes of execution log with %lu system calls written into %s\n", selfie_name,
+    log_bytes,
+    log_syscalls,
+    log_name);
+  printf("%s: %lu bytes of %lu checkpoints taken every %lu instructions written into %s to %s\n", selfie_name,
+    checkpoint_bytes,
+    log_checkpoints,
+    checkpoint_period,
+    checkpoint_name(log_name, 0),
+    checkpoint_name(log_name, log_checkpoints - 1));
+
+  logging = 0;
+
+  // execution is only logged once
+  log_name = (char*) 0;
 }
 
-void print_gc_profile(uint64_t is_gc_kernel) {
-  printf("%s: gc:      %lu.%.2luMB requested in %lu mallocs (%lu gced, %lu reuses)\n", selfie_name,
-    ratio_format_integral_2(gc_mem_mallocated, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_mallocated, MEGABYTE),
-    gc_num_mallocated,
-    gc_num_gced_mallocs,
-    gc_num_reused_mallocs);
-  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) reused in %lu reused mallocs\n", selfie_name,
-    ratio_format_integral_2(gc_mem_reused, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_reused, MEGABYTE),
-    percentage_format_integral_2(gc_mem_mallocated, gc_mem_reused),
-    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_reused),
-    gc_num_reused_mallocs);
-  printf("%s: gc:      %lu.%.2luMB collected in %lu gc runs\n", selfie_name,
-    ratio_format_integral_2(gc_mem_collected, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_collected, MEGABYTE),
-    gc_num_collects);
-  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu mallocs (%lu gced, %lu ungced)\n", selfie_name,
-    ratio_format_integral_2(gc_mem_blocks + gc_mem_metadata, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_blocks + gc_mem_metadata, MEGABYTE),
-    percentage_format_integral_2(gc_mem_mallocated, gc_mem_blocks + gc_mem_metadata),
-    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_blocks + gc_mem_metadata),
-    gc_num_gced_mallocs + gc_num_ungced_mallocs,
-    gc_num_gced_mallocs,
-    gc_num_ungced_mallocs);
-  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu gced mallocs\n", selfie_name,
-    ratio_format_integral_2(gc_mem_blocks, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_blocks, MEGABYTE),
-    percentage_format_integral_2(gc_mem_mallocated, gc_mem_blocks),
-    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_blocks),
-    gc_num_gced_mallocs);
-  printf("%s: gc:      %lu.%.2luMB(%lu.%.2lu%%) allocated in %lu ungced mallocs", selfie_name,
-    ratio_format_integral_2(gc_mem_metadata, MEGABYTE),
-    ratio_format_fractional_2(gc_mem_metadata, MEGABYTE),
-    percentage_format_integral_2(gc_mem_mallocated, gc_mem_metadata),
-    percentage_format_fractional_2(gc_mem_mallocated, gc_mem_metadata),
-    gc_num_ungced_mallocs);
-  if (is_gc_kernel)
-    printf(" (external)");
-  println();
+uint64_t replay_byte() {
+  uint64_t b;
+
+  if (log_cursor == log_buffer_bytes) {
+    log_buffer_bytes = read(log_fd, log_buffer, LOGBUFFERSIZE);
+
+    log_cursor = 0;
+
+    if (signed_less_than(0, log_buffer_bytes) == 0) {
+      log_buffer_bytes = 0;
+
+      // reading past the end of the log yields LOG_END
+      return 0;
+    }
+  }
+
+  // bytes are not loaded as characters which may be signed on the host
+  b = get_bits(*(log_buffer + log_cursor / sizeof(uint64_t)), (log_cursor % sizeof(uint64_t)) * 8, 8);
+
+  log_cursor = log_cursor + 1;
+
+  log_bytes = log_bytes + 1;
+
+  return b;
 }
 
-// -----------------------------------------------------------------
-// -------------------------- MICROKERNEL --------------------------
-// -----------------------------------------------------------------
+uint64_t replay_number() {
+  uint64_t n;
+  uint64_t b;
+  uint64_t shift;
 
-uint64_t* new_context() {
-  uint64_t* context;
+  n     = 0;
+  shift = 0;
 
-  if (free_contexts == (uint64_t*) 0)
-    context = allocate_context();
-  else {
-    context = free_contexts;
+  b = replay_byte();
 
-    free_contexts = get_next_context(free_contexts);
+  while (b >= 128) {
+    n = n + left_shift(b - 128, shift);
+
+    shift = shift + 7;
+
+    b = replay_byte();
   }
 
-  set_next_context(context, used_contexts);
-  set_prev_context(context, (uint64_t*) 0);
+  return n + left_shift(b, shift);
+}
+
+void open_execution_log(char* filename) {
+  uint64_t* header;
+
+  // assert: filename is mapped and not longer than MAX_FILENAME_LENGTH
 
-  if (used_contexts != (uint64_t*) 0)
-    set_prev_context(used_contexts, context);
+  log_fd = open_read_only(filename);
 
-  used_contexts = context;
+  if (signed_less_than(log_fd, 0)) {
+    printf("%s: could not open execution log file %s\n", selfie_name, filename);
 
-  return context;
-}
+    exit(EXITCODE_IOERROR);
+  }
 
-void free_context(uint64_t* context) {
-  set_next_context(context, free_contexts);
+  header = smalloc(LOGHEADERENTRIES * sizeof(uint64_t));
 
-  free_contexts = context;
-}
+  if (read(log_fd, header, LOGHEADERENTRIES * sizeof(uint64_t)) == LOGHEADERENTRIES * sizeof(uint64_t))
+    if (*header == LOGMAGIC)
+      if (*(header + 1) == WORDSIZE) {
+        log_buffer = smalloc(LOGBUFFERSIZE);
 
-uint64_t* delete_context(uint64_t* context, uint64_t* from) {
-  if (get_next_context(context) != (uint64_t*) 0)
-    set_prev_context(get_next_context(context), get_prev_context(context));
+        log_buffer_bytes = 0;
+        log_cursor       = 0;
 
-  if (get_prev_context(context) != (uint64_t*) 0) {
-    set_next_context(get_prev_context(context), get_next_context(context));
-    set_prev_context(context, (uint64_t*) 0);
-  } else
-    from = get_next_context(context);
+        log_bytes = LOGHEADERENTRIES * sizeof(uint64_t);
 
-  free_context(context);
+        return;
+      }
 
-  return from;
+  printf("%s: failed to load execution log from input file %s\n", selfie_name, filename);
+
+  exit(EXITCODE_IOERROR);
 }
 
-void init_context(uint64_t* context, uint64_t* parent, uint64_t* vctxt) {
-  char* context_name;
+uint64_t next_log_record() {
+  uint64_t tag;
+  uint64_t size;
+  uint64_t i;
 
-  // some fields are set in boot loader or when context switching
+  tag = replay_number();
 
-  // allocate zeroed memory for general-purpose registers
-  // TODO: reuse memory
-  set_regs(context, zmalloc(NUMBEROFREGISTERS * sizeof(uint64_t)));
+  if (tag != LOG_END) {
+    log_instructions = replay_number();
+    log_value        = replay_number();
 
-  // allocate zeroed memory for page table
-  // TODO: save and reuse memory for page table
-  if (not(PAGETABLETREE))
-    // for a 4GB-virtual-memory page table with
-    // 4KB pages and 64-bit pointers, allocate
-    // 8MB = 2^23 ((2^32 / 2^12) * 2^3) bytes to
-    // accommodate 2^20 (2^32 / 2^12) PTEs
-    set_pt(context, zmalloc(NUMBEROFPAGES * sizeof(uint64_t*)));
-  else
-    // for the root node (page directory), allocate
-    // 16KB = 2^14 (2^32 / 2^12 / 2^9 * 2^3) bytes to
-    // accommodate 2^11 ((2^32 / 2^12) / 2^9) root PDEs
-    // pointing to 4KB leaf nodes (page tables) that
-    // each accommodate 2^9 (2^12 / 2^3) leaf PTEs
-    set_pt(context, zmalloc(NUMBEROFPAGES / NUMBEROFLEAFPTES * sizeof(uint64_t*)));
+    if (tag == LOG_SYSCALL) {
+      log_a0 = replay_number();
 
-  // reset page table cache
-  set_lowest_lo_page(context, 0);
-  set_highest_lo_page(context, get_lowest_lo_page(context));
-  set_lowest_hi_page(context, page_of_virtual_address(HIGHESTVIRTUALADDRESS));
-  set_highest_hi_page(context, get_lowest_hi_page(context));
+      if (log_value == SYSCALL_READ) {
+        size = sign_extend(log_a0, SYSCALL_BITWIDTH);
 
-  if (parent != MY_CONTEXT) {
-    set_code_seg_start(context, load_virtual_memory(get_pt(parent), code_seg_start(vctxt)));
-    set_code_seg_size(context, load_virtual_memory(get_pt(parent), code_seg_size(vctxt)));
-    set_data_seg_start(context, load_virtual_memory(get_pt(parent), data_seg_start(vctxt)));
-    set_data_seg_size(context, load_virtual_memory(get_pt(parent), data_seg_size(vctxt)));
-    set_heap_seg_start(context, load_virtual_memory(get_pt(parent), heap_seg_start(vctxt)));
+        if (signed_less_than(0, size)) {
+          if (round_up(size, sizeof(uint64_t)) > IO_buffer_size) {
+            // accommodate integer-aligned buffer, see implement_read
+            IO_buffer_size = round_up(size, sizeof(uint64_t));
 
-    context_name = string_alloc(MAX_FILENAME_LENGTH);
+            IO_buffer = touch(smalloc(IO_buffer_size), IO_buffer_size);
+          }
 
-    down_load_string(parent, load_virtual_memory(get_pt(parent), name(vctxt)), context_name);
+          i = 0;
 
-    set_name(context, context_name);
-  } else {
-    set_exception(context, EXCEPTION_NOEXCEPTION);
-    set_fault(context, 0);
+          while (i < size) {
+            if (i % sizeof(uint64_t) == 0)
+              *(IO_buffer + i / sizeof(uint64_t)) = replay_byte();
+            else
+              *(IO_buffer + i / sizeof(uint64_t)) = *(IO_buffer + i / sizeof(uint64_t))
+                + left_shift(replay_byte(), (i % sizeof(uint64_t)) * 8);
 
-    set_exit_code(context, EXITCODE_NOERROR);
+            i = i + 1;
+          }
+        }
+      }
+    }
   }
 
-  set_parent(context, parent);
-  set_virtual_context(context, vctxt);
+  return tag;
+}
 
-  // profile
-  set_ic_all(context, 0);
-  set_lc_malloc(context, 0);
-  set_ec_syscall(context, 0);
-  set_ec_page_fault(context, 0);
-  set_ec_timer(context, 0);
-  set_mc_stack_peak(context, 0);
-  set_mc_mapped_heap(context, 0);
+void selfie_replay(char* filename, uint64_t target) {
+  uint64_t tag;
 
-  // garbage collector
-  set_used_list_head(context, (uint64_t*) 0);
-  set_free_list_head(context, (uint64_t*) 0);
-  set_gcs_in_period(context, 0);
-  set_use_gc_kernel(context, GC_DISABLED);
-}
+  replay_name   = filename;
+  replay_target = target;
 
-uint64_t* create_context(uint64_t* parent, uint64_t* vctxt) {
-  uint64_t* context;
+  open_execution_log(replay_name);
 
-  context = new_context();
+  replay_checkpoint = 0;
+  replay_base       = 0;
 
-  init_context(context, parent, vctxt);
+  tag = next_log_record();
 
-  if (debug_create)
-    printf("%s: parent context %s created child context %s\n", selfie_name,
-      get_name(parent), get_name(used_contexts));
+  // find the last checkpoint taken before reaching the target
+  while (tag != LOG_END) {
+    if (tag == LOG_CHECKPOINT)
+      if (log_instructions <= replay_target) {
+        replay_checkpoint = log_value;
+        replay_base       = log_instructions;
+      }
 
-  return context;
+    tag = next_log_record();
+  }
+
+  selfie_resume(checkpoint_name(replay_name, replay_checkpoint));
 }
 
-uint64_t* find_context(uint64_t* parent, uint64_t* vctxt) {
-  uint64_t* context;
+void start_replay() {
+  uint64_t tag;
 
-  context = used_contexts;
+  // rewind by reopening the execution log
+  open_execution_log(replay_name);
 
-  while (context != (uint64_t*) 0) {
-    if (get_parent(context) == parent)
-      if (get_virtual_context(context) == vctxt)
-        return context;
+  tag = next_log_record();
 
-    context = get_next_context(context);
+  while (tag != LOG_END) {
+    if (tag == LOG_CHECKPOINT)
+      if (log_value == replay_checkpoint)
+        // continue reading right after checkpoint
+        tag = LOG_END;
+
+    if (tag != LOG_END)
+      tag = next_log_record();
   }
 
-  return (uint64_t*) 0;
-}
+  printf("%s: replaying %s from checkpoint %lu at instruction %lu to instruction %lu\n", selfie_name,
+    replay_name,
+    replay_checkpoint,
+    replay_base,
+    replay_target);
 
-uint64_t* cache_context(uint64_t* vctxt) {
-  uint64_t* context;
+  // debugging starts once the target is reached
+  replay_debug          = debug;
+  replay_debug_syscalls = debug_syscalls;
+  replay_record         = record;
 
-  // find cached context on my boot level
-  context = find_context(current_context, vctxt);
+  debug          = 0;
+  debug_syscalls = 0;
+  record         = 0;
 
-  if (context == (uint64_t*) 0)
-    // create cached context on my boot level
-    context = create_context(current_context, vctxt);
+  log_syscalls = 0;
 
-  return context;
+  replaying = 1;
 }
 
-void save_context(uint64_t* context) {
-  uint64_t* parent_table;
-  uint64_t* vctxt;
-  uint64_t r;
-  uint64_t* pregs;
-  uint64_t* vregs;
+uint64_t replay_timeout(uint64_t* context, uint64_t timeout) {
+  uint64_t instructions;
 
-  // save machine state
-  set_pc(context, pc);
+  instructions = replay_base + get_total_number_of_instructions();
 
-  if (get_parent(context) != MY_CONTEXT) {
-    // upload changes in context to virtual context in parent address space
-    parent_table = get_pt(get_parent(context));
+  if (instructions < replay_target) {
+    // stop exactly at the target with a timer interrupt
+    if (timeout == TIMEROFF)
+      return replay_target - instructions;
+    else if (replay_target - instructions < timeout)
+      return replay_target - instructions;
+  } else if (replay_target != UINT64_MAX) {
+    printf("%s: replayed %lu instructions, context %s at pc 0x%lX\n", selfie_name,
+      instructions,
+      get_name(context),
+      get_pc(context));
 
-    vctxt = get_virtual_context(context);
+    debug          = replay_debug;
+    debug_syscalls = replay_debug_syscalls;
+    record         = replay_record;
 
-    store_virtual_memory(parent_table, program_counter(vctxt), get_pc(context));
+    // target is only reached once
+    replay_target = UINT64_MAX;
+  }
 
-    r = 0;
+  return timeout;
+}
 
-    pregs = get_regs(context);
-    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+uint64_t replay_divergence(uint64_t* context) {
+  printf("%s: replay diverged from execution log %s at instruction %lu\n", selfie_name,
+    replay_name,
+    replay_base + get_total_number_of_instructions());
 
-    while (r < NUMBEROFREGISTERS) {
-      store_virtual_memory(parent_table, (uint64_t) (vregs + r), *(pregs + r));
+  set_exit_code(context, EXITCODE_IOERROR);
 
-      r = r + 1;
-    }
+  return EXIT;
+}
 
-    store_virtual_memory(parent_table, program_break(vctxt), get_program_break(context));
+uint64_t replay_system_call(uint64_t* context, uint64_t a7) {
+  uint64_t tag;
+  uint64_t size;
 
-    store_virtual_memory(parent_table, exception(vctxt), get_exception(context));
-    store_virtual_memory(parent_table, fault(vctxt), get_fault(context));
-    store_virtual_memory(parent_table, exit_code(vctxt), get_exit_code(context));
+  tag = next_log_record();
 
-    // garbage collector state (only necessary if context is gced by different gcs)
+  // checkpoints are skipped while replaying
+  while (tag == LOG_CHECKPOINT)
+    tag = next_log_record();
 
-    store_virtual_memory(parent_table, used_list_head(vctxt), (uint64_t) get_used_list_head(context));
-    store_virtual_memory(parent_table, free_list_head(vctxt), (uint64_t) get_free_list_head(context));
-    store_virtual_memory(parent_table, gcs_in_period(vctxt), get_gcs_in_period(context));
-    store_virtual_memory(parent_table, use_gc_kernel(vctxt), get_use_gc_kernel(context));
-  }
+  if (tag != LOG_SYSCALL)
+    return replay_divergence(context);
+  else if (log_instructions != replay_base + get_total_number_of_instructions())
+    return replay_divergence(context);
+  else if (log_value != a7)
+    return replay_divergence(context);
 
-  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+  log_syscalls = log_syscalls + 1;
 
-  // number of bytes currently allocated on stack
-  r = VIRTUALMEMORYSIZE * GIGABYTE - *(get_regs(context) + REG_SP);
+  if (a7 == SYSCALL_BRK) {
+    // brk only depends on the state of the context
+    if (is_gc_enabled(context))
+      implement_gc_brk(context);
+    else
+      implement_brk(context);
+  } else if (a7 == SYSCALL_EXIT) {
+    implement_exit(context);
 
-  if (r > get_mc_stack_peak(context))
-    // keep track of peak amount of stack allocation
-    set_mc_stack_peak(context, r);
-}
+    return EXIT;
+  } else {
+    if (a7 == SYSCALL_READ) {
+      size = sign_extend(log_a0, SYSCALL_BITWIDTH);
 
-uint64_t lowest_page(uint64_t page, uint64_t lo) {
-  if (page < lo)
-    return page;
-  else
-    return lo;
-}
+      if (signed_less_than(0, size))
+        // redo the effect of read on memory but not on the host
+        copy_buffer(context, *(get_regs(context) + REG_A1), IO_buffer, size, 1);
+    }
 
-uint64_t highest_page(uint64_t page, uint64_t hi) {
-  if (page >= hi)
-    // only lo <= page < hi will be cached
-    return page + 1;
-  else
-    return hi;
-}
+    *(get_regs(context) + REG_A0) = log_a0;
 
-void map_page(uint64_t* context, uint64_t page, uint64_t frame) {
-  uint64_t* table;
+    set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
-  table = get_pt(context);
+    if (debug_syscalls) {
+      printf("(replayed) -> ");
+      print_register_value(REG_A0);
+      println();
+    }
+  }
 
-  // assert: page is unmapped
+  if (*(get_regs(context) + REG_A0) != log_a0)
+    return replay_divergence(context);
 
-  set_page_frame(table, page, frame);
+  return DONOTEXIT;
+}
 
-  // exploit spatial locality in page table caching
-  if (page <= page_of_virtual_address(get_program_break(context) - WORDSIZE)) {
-    set_lowest_lo_page(context, lowest_page(page, get_lowest_lo_page(context)));
-    set_highest_lo_page(context, highest_page(page, get_highest_lo_page(context)));
-  } else {
-    set_lowest_hi_page(context, lowest_page(page, get_lowest_hi_page(context)));
-    set_highest_hi_page(context, highest_page(page, get_highest_hi_page(context)));
-  }
+void stop_replay() {
+  if (replay_target != UINT64_MAX)
+    printf("%s: execution ended before reaching instruction %lu\n", selfie_name, replay_target);
 
-  if (debug_map)
-    printf("%s: page 0x%04lX mapped to frame 0x%08lX in context %s\n", selfie_name,
-      page, (uint64_t) frame, get_name(context));
+  printf("%s: %lu bytes of execution log with %lu system calls replayed from %s\n", selfie_name,
+    log_bytes,
+    log_syscalls,
+    replay_name);
+
+  replaying = 0;
+
+  // execution log is only replayed once
+  replay_name = (char*) 0;
 }
 
-void cache_page_table(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t lo, uint64_t hi) {
-  uint64_t PTE_address;
-  uint64_t frame;
+uint64_t handle_system_call(uint64_t* context) {
+  uint64_t a7;
 
-  while (lo < hi) {
-    // PTE address of lo page in page table in parent address space
-    PTE_address = (uint64_t) get_PTE_address(parent_table, table, lo);
+  set_exception(context, EXCEPTION_NOEXCEPTION);
 
-    // PTEs in page table in parent address space may be unmapped
-    if (is_virtual_address_mapped(parent_table, PTE_address)) {
-      // page frame of lo page in parent address space
-      frame = load_virtual_memory(parent_table, PTE_address);
+  set_ec_syscall(context, get_ec_syscall(context) + 1);
 
-      // page may be unmapped even if PTE of page is mapped
-      if (frame != 0) {
-        // assert: page frame in parent address space is mapped
-        frame = get_page_frame(parent_table, page_of_virtual_address(frame));
+  a7 = *(get_regs(context) + REG_A7);
 
-        map_page(context, lo, frame);
-      }
-    }
+  if (snapshot_name != (char*) 0)
+    if (is_io_system_call(a7))
+      // snapshot is taken after initialization at first I/O system call,
+      // before handling the system call which is thus redone on resume
+      save_snapshot(context);
 
-    lo = lo + 1;
-  }
-}
+  if (replaying)
+    return replay_system_call(context, a7);
 
-void restore_context(uint64_t* context) {
-  uint64_t* parent_table;
-  uint64_t* vctxt;
-  uint64_t r;
-  uint64_t* pregs;
-  uint64_t* vregs;
-  uint64_t* table;
-  uint64_t lo;
-  uint64_t hi;
+  if (a7 == SYSCALL_BRK) {
+    if (is_gc_enabled(context))
+      implement_gc_brk(context);
+    else
+      implement_brk(context);
+  } else if (a7 == SYSCALL_READ)
+    implement_read(context);
+  else if (a7 == SYSCALL_WRITE)
+    implement_write(context);
+  else if (a7 == SYSCALL_OPENAT)
+    implement_openat(context);
+  else if (a7 == SYSCALL_EXIT)
+    implement_exit(context);
+  else {
+    printf("%s: unknown system call %lu\n", selfie_name, a7);
 
-  if (get_parent(context) != MY_CONTEXT) {
-    // download changes in virtual context in parent address space to context
-    parent_table = get_pt(get_parent(context));
+    set_exit_code(context, EXITCODE_UNKNOWNSYSCALL);
 
-    vctxt = get_virtual_context(context);
+    return EXIT;
+  }
 
-    set_pc(context, load_virtual_memory(parent_table, program_counter(vctxt)));
+  if (logging)
+    log_system_call(context, a7);
+
+  if (a7 == SYSCALL_EXIT)
+    // TODO: exit only if all contexts have exited
+    return EXIT;
 
-    r = 0;
+  return DONOTEXIT;
+}
 
-    pregs = get_regs(context);
-    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+uint64_t handle_page_fault(uint64_t* context) {
+  uint64_t page;
+  uint64_t frame;
 
-    while (r < NUMBEROFREGISTERS) {
-      *(pregs + r) = load_virtual_memory(parent_table, (uint64_t) (vregs + r));
+  set_exception(context, EXCEPTION_NOEXCEPTION);
 
-      r = r + 1;
-    }
+  set_ec_page_fault(context, get_ec_page_fault(context) + 1);
 
-    set_program_break(context, load_virtual_memory(parent_table, program_break(vctxt)));
+  page = get_fault(context);
 
-    set_exception(context, load_virtual_memory(parent_table, exception(vctxt)));
-    set_fault(context, load_virtual_memory(parent_table, fault(vctxt)));
+  if (page_in(context, page))
+    // page was swapped out
+    return DONOTEXIT;
 
-    set_exit_code(context, load_virtual_memory(parent_table, exit_code(vctxt)));
+  if (swap_size > 0)
+    if (pavailable() == 0)
+      // make room by swapping out a page
+      page_out();
 
-    table = (uint64_t*) load_virtual_memory(parent_table, page_table(vctxt));
+  if (pavailable()) {
+    if (is_page_shared(context, page))
+      // store to page shared with other contexts
+      copy_on_write(context, page);
+    else {
+      frame = 0;
 
-    // assert: virtual context page table is only mapped from beginning up and end down
+      if (zero_frame != 0)
+        // the faulting instruction is still in the instruction register
+        if (is == LOAD) {
+          // pages read before written are mapped to the zero frame
+          frame = zero_frame;
 
-    lo = load_virtual_memory(parent_table, lowest_lo_page(vctxt));
-    hi = load_virtual_memory(parent_table, highest_lo_page(vctxt));
+          zero_pages = zero_pages + 1;
 
-    cache_page_table(context, table, parent_table, lo, hi);
+          count_saved_frame();
+        }
 
-    store_virtual_memory(parent_table, lowest_lo_page(vctxt), hi);
+      if (frame == 0)
+        // TODO: reuse frames
+        frame = (uint64_t) palloc();
 
-    lo = load_virtual_memory(parent_table, lowest_hi_page(vctxt));
-    hi = load_virtual_memory(parent_table, highest_hi_page(vctxt));
+      map_page(context, page, frame);
 
-    cache_page_table(context, table, parent_table, lo, hi);
+      if (is_heap_address(context, virtual_address_of_page(page)))
+        set_mc_mapped_heap(context, get_mc_mapped_heap(context) + PAGESIZE);
+    }
 
-    store_virtual_memory(parent_table, highest_hi_page(vctxt), lo);
+    return DONOTEXIT;
+  } else {
+    printf("%s: page fault at 0x%lX out of physical memory\n", selfie_name, page);
 
-    // garbage collector state (only necessary if context is gced by different gcs)
+    set_exit_code(context, EXITCODE_OUTOFPHYSICALMEMORY);
 
-    set_used_list_head(context, (uint64_t*) load_virtual_memory(parent_table, used_list_head(vctxt)));
-    set_free_list_head(context, (uint64_t*) load_virtual_memory(parent_table, free_list_head(vctxt)));
-    set_gcs_in_period(context, load_virtual_memory(parent_table, gcs_in_period(vctxt)));
-    set_use_gc_kernel(context, load_virtual_memory(parent_table, use_gc_kernel(vctxt)));
+    return EXIT;
   }
+}
 
-  // restore machine state
-  pc        = get_pc(context);
-  registers = get_regs(context);
-  pt        = get_pt(context);
-
-  flush_all_caches();
+uint64_t handle_division_by_zero(uint64_t* context) {
+  set_exception(context, EXCEPTION_NOEXCEPTION);
 
-  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
-}
+  if (record) {
+    printf("%s: division by zero, replaying...\n", selfie_name);
 
-uint64_t pavailable() {
-  if (free_page_frame_memory > 0)
-    return 1;
-  else if (allocated_page_frame_memory + MEGABYTE <= PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
-    return 1;
-  else
-    return 0;
-}
+    replay_trace();
 
-uint64_t pused() {
-  return allocated_page_frame_memory - free_page_frame_memory;
-}
+    set_exit_code(context, EXITCODE_NOERROR);
+  } else {
+    printf("%s: division by zero\n", selfie_name);
 
-uint64_t* palloc() {
-  uint64_t block;
-  uint64_t frame;
+    set_exit_code(context, EXITCODE_DIVISIONBYZERO);
+  }
 
-  // assert: PHYSICALMEMORYSIZE is equal to or a multiple of MEGABYTE
-  // assert: PAGEFRAMESIZE is a factor of MEGABYTE strictly less than MEGABYTE
+  return EXIT;
+}
 
-  if (free_page_frame_memory == 0) {
-    if (pavailable()) {
-      // single word on 32-bit target occupies double word on 64-bit system
-      free_page_frame_memory = MEGABYTE * (PAGEFRAMESIZE / PAGESIZE);
+uint64_t handle_timer(uint64_t* context) {
+  set_exception(context, EXCEPTION_NOEXCEPTION);
 
-      // on boot level 0 allocate zeroed memory
-      block = (uint64_t) zmalloc(free_page_frame_memory);
+  set_ec_timer(context, get_ec_timer(context) + 1);
 
-      allocated_page_frame_memory = allocated_page_frame_memory + free_page_frame_memory;
+  time_slice_expired = 1;
 
-      // page frames must be PAGEFRAMESIZE-aligned in memory
-      next_page_frame = round_up(block, PAGEFRAMESIZE);
+  if (dedup_period > 0) {
+    dedup_timer = dedup_timer + 1;
 
-      if (next_page_frame > block)
-        // losing one page frame to alignment
-        free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
-    } else {
-      printf("%s: palloc out of physical memory\n", selfie_name);
+    if (dedup_timer >= dedup_period) {
+      // scan for identical pages in the background of timer interrupts
+      merge_identical_pages();
 
-      exit(EXITCODE_OUTOFPHYSICALMEMORY);
+      dedup_timer = 0;
     }
   }
 
-  frame = next_page_frame;
-
-  next_page_frame = next_page_frame + PAGEFRAMESIZE;
+  return DONOTEXIT;
+}
 
-  free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+uint64_t handle_exception(uint64_t* context) {
+  uint64_t exception;
 
-  // strictly, touching is only necessary on boot levels higher than 0
-  return touch((uint64_t*) frame, PAGEFRAMESIZE);
-}
+  exception = get_exception(context);
 
-void pfree(uint64_t* frame) {
-  // TODO: implement free list of page frames
-  frame = frame + 1;
-}
+  if (logging)
+    if (get_total_number_of_instructions() >= next_checkpoint)
+      take_checkpoint(context);
 
-void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
-  // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+  if (exception == EXCEPTION_SYSCALL)
+    return handle_system_call(context);
+  else if (exception == EXCEPTION_PAGEFAULT)
+    return handle_page_fault(context);
+  else if (exception == EXCEPTION_DIVISIONBYZERO)
+    return handle_division_by_zero(context);
+  else if (exception == EXCEPTION_TIMER)
+    return handle_timer(context);
+  else {
+    printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(context));
+    print_exception(exception, get_fault(context));
+    println();
 
-  if (not(is_virtual_address_mapped(get_pt(context), vaddr)))
-    map_page(context, page_of_virtual_address(vaddr), (uint64_t) palloc());
+    set_exit_code(context, EXITCODE_UNCAUGHTEXCEPTION);
 
-  store_virtual_memory(get_pt(context), vaddr, data);
+    return EXIT;
+  }
 }
 
-void map_unmapped_pages(uint64_t* context) {
-  uint64_t page;
+void enqueue_context(uint64_t* context) {
+  set_next_runnable(context, (uint64_t*) 0);
 
-  // assert: page table is only mapped from beginning up and end down
+  if (run_queue_head == (uint64_t*) 0)
+    run_queue_head = context;
+  else
+    set_next_runnable(run_queue_tail, context);
 
-  page = get_lowest_lo_page(context);
+  run_queue_tail = context;
+}
 
-  while (is_page_mapped(get_pt(context), page))
-    page = page + 1;
+uint64_t* dequeue_context() {
+  uint64_t* context;
 
-  while (pavailable()) {
-    map_page(context, page, (uint64_t) palloc());
+  context = run_queue_head;
 
-    page = page + 1;
+  if (context != (uint64_t*) 0) {
+    run_queue_head = get_next_runnable(context);
+
+    if (run_queue_head == (uint64_t*) 0)
+      run_queue_tail = (uint64_t*) 0;
   }
 
-  // allowing more palloc for caching tree page tables
-  PHYSICALMEMORYEXCESS = PHYSICALMEMORYEXCESS + PAGEFRAMESIZE / PAGESIZE;
+  return context;
 }
 
-// -----------------------------------------------------------------
-// ---------------------------- KERNEL -----------------------------
-// -----------------------------------------------------------------
-
-void up_load_binary(uint64_t* context) {
-  uint64_t baddr;
-
-  // assert: e_entry is multiple of PAGESIZE and INSTRUCTIONSIZE
+uint64_t* select_context(uint64_t* from_context) {
+  uint64_t* selected;
+  uint64_t* selected_prev;
+  uint64_t* context;
+  uint64_t* prev;
 
-  set_pc(context, e_entry);
+  // assert: run queue is not empty
 
-  // setting up page table cache
+  scheduling_decisions = scheduling_decisions + 1;
 
-  set_lowest_lo_page(context, page_of_virtual_address(code_start));
-  set_highest_lo_page(context, get_lowest_lo_page(context));
+  if (SCHEDULER == SCHEDULE_PRIORITY) {
+    // first context with highest priority in run queue order
+    selected      = run_queue_head;
+    selected_prev = (uint64_t*) 0;
 
-  // setting up memory segments
+    prev    = run_queue_head;
+    context = get_next_runnable(run_queue_head);
 
-  set_code_seg_start(context, code_start);
-  set_code_seg_size(context, code_size);
-  set_data_seg_start(context, data_start);
-  set_data_seg_size(context, data_size);
-  set_heap_seg_start(context, round_up(data_start + data_size, PAGESIZE));
-  set_program_break(context, get_heap_seg_start(context));
+    while (context != (uint64_t*) 0) {
+      run_queue_scans = run_queue_scans + 1;
 
-  baddr = 0;
+      if (get_priority(context) > get_priority(selected)) {
+        selected      = context;
+        selected_prev = prev;
+      }
 
-  while (baddr < code_size) {
-    map_and_store(context, get_code_seg_start(context) + baddr, load_code(baddr));
+      prev    = context;
+      context = get_next_runnable(context);
+    }
 
-    baddr = baddr + WORDSIZE;
-  }
+    if (selected_prev != (uint64_t*) 0) {
+      // move selected context to head of run queue
+      set_next_runnable(selected_prev, get_next_runnable(selected));
 
-  baddr = 0;
+      if (selected == run_queue_tail)
+        run_queue_tail = selected_prev;
 
-  while (baddr < data_size) {
-    map_and_store(context, get_data_seg_start(context) + baddr, load_data(baddr));
+      set_next_runnable(selected, run_queue_head);
 
-    baddr = baddr + WORDSIZE;
+      run_queue_head = selected;
+    }
   }
-}
-
-uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP) {
-  uint64_t bytes;
-  uint64_t i;
-
-  bytes = round_up(string_length(s) + 1, WORDSIZE);
-
-  // allocate memory for storing string
-  SP = SP - bytes;
 
-  i = 0;
+  // round-robin runs head of run queue
 
-  while (i < bytes) {
-    map_and_store(context, SP + i, load_word((uint64_t*) s, i, 1));
+  if (run_queue_head != from_context) {
+    set_dispatches(run_queue_head, get_dispatches(run_queue_head) + 1);
 
-    i = i + WORDSIZE;
+    if (from_context != (uint64_t*) 0)
+      context_switches = context_switches + 1;
   }
 
-  return SP;
+  return run_queue_head;
 }
 
-void up_load_arguments(uint64_t* context, uint64_t argc, uint64_t* argv) {
-  /* upload arguments like a UNIX system
+void reset_scheduler() {
+  run_queue_head = (uint64_t*) 0;
+  run_queue_tail = (uint64_t*) 0;
 
-      SP
-      |
-      V
-   | argc | argv[0] | ... | argv[n] | 0 | env[0] | ... | env[m] | 0 |
+  time_slice_expired = 0;
 
-     with argc > 0, n == argc - 1, and m == 0 (that is, env is empty) */
-  uint64_t SP;
-  uint64_t* vargv;
-  uint64_t i;
+  scheduled_exit_code = EXITCODE_NOERROR;
 
-  // the call stack grows top down
-  SP = VIRTUALMEMORYSIZE * GIGABYTE;
+  scheduling_decisions = 0;
+  context_switches     = 0;
+  run_queue_scans      = 0;
+}
 
-  vargv = smalloc(argc * sizeof(uint64_t*));
+uint64_t* init_run_queue(uint64_t* context) {
+  uint64_t i;
+  char* context_name;
 
-  i = 0;
+  reset_scheduler();
 
-  // push program parameters onto the stack
-  while (i < argc) {
-    SP = up_load_string(context, (char*) *(argv + i), SP);
+  enqueue_context(context);
 
-    // store pointer in virtual *argv
-    *(vargv + i) = SP;
+  i = 1;
 
-    i = i + 1;
-  }
+  while (i < number_of_contexts) {
+    // boot more contexts with the same binary and arguments
+    context = create_context(MY_CONTEXT, 0);
 
-  // allocate memory for termination of env table
-  SP = SP - WORDSIZE;
+    boot_loader(context);
 
-  // push null value to terminate env table
-  map_and_store(context, SP, 0);
+    // distinguish contexts by number, after name was passed as first argument
+    context_name = string_alloc(string_length(get_name(context)) + 21);
 
-  // allocate memory for termination of argv table
-  SP = SP - WORDSIZE;
+    sprintf(context_name, "%s#%lu", get_name(context), i);
 
-  // push null value to terminate argv table
-  map_and_store(context, SP, 0);
+    set_name(context, context_name);
 
-  // assert: i == argc
+    set_priority(context, i % PRIORITIES);
 
-  // push argv table onto the stack
-  while (i > 0) {
-    // allocate memory for argv table entry
-    SP = SP - WORDSIZE;
+    if (GC_ON)
+      gc_init(context);
 
-    i = i - 1;
+    enqueue_context(context);
 
-    // push argv table entry
-    map_and_store(context, SP, *(vargv + i));
+    i = i + 1;
   }
 
-  // allocate memory for argc
-  SP = SP - WORDSIZE;
-
-  // push argc
-  map_and_store(context, SP, argc);
-
-  // store stack pointer value in stack pointer register
-  *(get_regs(context) + REG_SP) = SP;
-
-  // initialize frame pointer register for completeness (redundant)
-  *(get_regs(context) + REG_S0) = 0;
+  return select_context((uint64_t*) 0);
 }
 
-char* replace_extension(char* filename, char* suffix, char* extension) {
-  char* s;
-  uint64_t i;
-  uint64_t c;
-  char* filename_without_extension;
-
-  // assert: string_length(filename) + string_length(suffix) + 1 + string_length(extension) < MAX_FILENAME_LENGTH
+uint64_t* schedule(uint64_t* from_context) {
+  if (from_context != run_queue_head)
+    // contexts outside of run queue continue
+    return from_context;
+  else if (time_slice_expired) {
+    time_slice_expired = 0;
 
-  s = string_alloc(string_length(filename) + string_length(suffix) + 1 + string_length(extension));
+    // preempt running context
+    enqueue_context(dequeue_context());
 
-  // start reading at end of filename
-  i = string_length(filename);
+    return select_context(from_context);
+  } else
+    return from_context;
+}
 
-  c = 0;
+uint64_t* terminate(uint64_t* context) {
+  // assert: context is at head of run queue
+  dequeue_context();
 
-  // look for extension
-  while (c != '.') {
-    if (c == '/')
-      i = 0;
+  time_slice_expired = 0;
 
-    if (i > 0) {
-      i = i - 1;
+  set_turnaround(context, get_total_number_of_instructions());
 
-      c = load_character(filename, i);
-    } else
-      c = '.';
-  }
+  if (scheduled_exit_code == EXITCODE_NOERROR)
+    scheduled_exit_code = get_exit_code(context);
 
-  if (i == 0)
-    // filename has no extension
-    filename_without_extension = filename;
-  else {
-    filename_without_extension = string_alloc(i);
+  if (next_job != (uint64_t*) 0) {
+    reclaim_page_frames(context);
 
-    // assert: filename_without_extension is zeroed and thus null-terminated
+    // start next job in place of terminated one
+    boot_job(next_job);
 
-    // copy filename without extension and null-terminator into filename_without_extension
-    while (i > 0) {
-      i = i - 1;
+    next_job = get_next_job(next_job);
+  } else if (run_queue_head == (uint64_t*) 0)
+    return (uint64_t*) 0;
+  else
+    // page frames of last context remain mapped for inspection
+    reclaim_page_frames(context);
 
-      store_character(filename_without_extension, i, load_character(filename, i));
-    }
-  }
+  return select_context(context);
+}
 
-  // writing filename_without_extension with suffix dot extension into s
-  sprintf(s, "%s%s.%s", filename_without_extension, suffix, extension);
+uint64_t time_slice(uint64_t* from_context, uint64_t* to_context) {
+  if (to_context == from_context)
+    if (get_next_runnable(run_queue_head) != (uint64_t*) 0)
+      if (timer != TIMEROFF)
+        // continue time slice of running context while others are waiting
+        return timer;
 
-  return s;
+  return TIMESLICE;
 }
 
-char* boot_level_prefix(char* s) {
-  uint64_t l;
-  char* t;
+void selfie_batch(char* filename, uint64_t workers) {
+  uint64_t* arguments;
+  uint64_t* job;
+  uint64_t* last_job;
+  uint64_t argc;
+  char* argument;
   uint64_t i;
 
-  l = string_length(s);
+  batch_name = filename;
 
-  t = string_alloc(l);
+  if (workers > 0)
+    batch_workers = workers;
+  else
+    batch_workers = 1;
 
-  i = 0;
+  // assert: batch_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-  while (i < l) {
-    if (load_character(s, i) == '>') {
-      store_character(t, i, '>');
+  // use the scanner for reading the batch file character by character
+  source_name = batch_name;
 
-      i = i + 1;
-    } else {
-      store_character(t, i, 0);
+  source_fd = open_read_only(source_name);
 
-      return t;
-    }
+  if (signed_less_than(source_fd, 0)) {
+    printf("%s: could not open batch file %s\n", selfie_name, source_name);
+
+    exit(EXITCODE_IOERROR);
   }
 
-  return t;
-}
+  arguments = smalloc(MAX_JOB_ARGUMENTS * sizeof(char*));
 
-char* increment_boot_level_prefix(char* s, char* t) {
-  char* p;
-  char* u;
+  batch_jobs     = (uint64_t*) 0;
+  last_job       = (uint64_t*) 0;
+  number_of_jobs = 0;
 
-  p = boot_level_prefix(s);
+  get_character();
 
-  u = string_alloc(string_length(p) + 1 + 1 + string_length(t));
+  while (character != CHAR_EOF) {
+    argc = 0;
 
-  sprintf(u, "%s> %s", p, t);
+    // arguments of a job are separated by spaces or tabs
+    while (is_character_new_line() == 0) {
+      if (character == CHAR_EOF)
+        // terminate loop
+        character = CHAR_LF;
+      else if (is_character_whitespace())
+        get_character();
+      else {
+        argument = string_alloc(MAX_FILENAME_LENGTH);
 
-  return u;
-}
+        i = 0;
 
-void boot_loader(uint64_t* context) {
-  up_load_binary(context);
+        while (is_character_whitespace() == 0) {
+          if (character == CHAR_EOF)
+            // terminate loop
+            character = CHAR_LF;
+          else if (i < MAX_FILENAME_LENGTH) {
+            store_character(argument, i, character);
 
-  set_name(context, increment_boot_level_prefix(selfie_name, binary_name));
+            i = i + 1;
 
-  // pass binary name as first argument by replacing next argument
-  set_argument(get_name(context));
+            get_character();
+          } else {
+            printf("%s: argument %s... in batch file %s is too long\n", selfie_name, argument, batch_name);
 
-  up_load_arguments(context, number_of_remaining_arguments(), remaining_arguments());
-}
+            exit(EXITCODE_BADARGUMENTS);
+          }
+        }
 
-uint64_t handle_system_call(uint64_t* context) {
-  uint64_t a7;
+        if (argc < MAX_JOB_ARGUMENTS) {
+          *(arguments + argc) = (uint64_t) argument;
 
-  set_exception(context, EXCEPTION_NOEXCEPTION);
+          argc = argc + 1;
+        } else {
+          printf("%s: job %lu in batch file %s has more than %lu arguments\n", selfie_name,
+            number_of_jobs + 1, batch_name, MAX_JOB_ARGUMENTS);
 
-  set_ec_syscall(context, get_ec_syscall(context) + 1);
+          exit(EXITCODE_BADARGUMENTS);
+        }
+      }
+    }
 
-  a7 = *(get_regs(context) + REG_A7);
+    if (argc > 0) {
+      number_of_jobs = number_of_jobs + 1;
 
-  if (a7 == SYSCALL_BRK) {
-    if (is_gc_enabled(context))
-      implement_gc_brk(context);
-    else
-      implement_brk(context);
-  } else if (a7 == SYSCALL_READ)
-    implement_read(context);
-  else if (a7 == SYSCALL_WRITE)
-    implement_write(context);
-  else if (a7 == SYSCALL_OPENAT)
-    implement_openat(context);
-  else if (a7 == SYSCALL_EXIT) {
-    implement_exit(context);
+      job = allocate_job();
 
-    // TODO: exit only if all contexts have exited
-    return EXIT;
-  } else {
-    printf("%s: unknown system call %lu\n", selfie_name, a7);
+      set_next_job(job, (uint64_t*) 0);
+      set_job_number(job, number_of_jobs);
+      set_job_argc(job, argc);
+      set_job_argv(job, smalloc(argc * sizeof(char*)));
+      set_job_context(job, (uint64_t*) 0);
 
-    set_exit_code(context, EXITCODE_UNKNOWNSYSCALL);
+      i = 0;
 
-    return EXIT;
+      while (i < argc) {
+        *(get_job_argv(job) + i) = *(arguments + i);
+
+        i = i + 1;
+      }
+
+      if (last_job == (uint64_t*) 0)
+        batch_jobs = job;
+      else
+        set_next_job(last_job, job);
+
+      last_job = job;
+    }
+
+    if (character != CHAR_EOF)
+      // skip new line
+      get_character();
   }
 
-  return DONOTEXIT;
+  printf("%s: %lu jobs read from batch file %s to run %lu at a time\n", selfie_name,
+    number_of_jobs,
+    batch_name,
+    batch_workers);
+
+  if (number_of_jobs == 0)
+    batch_name = (char*) 0;
 }
 
-uint64_t handle_page_fault(uint64_t* context) {
-  uint64_t page;
+void boot_job(uint64_t* job) {
+  uint64_t* context;
+  char* context_name;
 
-  set_exception(context, EXCEPTION_NOEXCEPTION);
+  selfie_load((char*) *(get_job_argv(job)));
 
-  set_ec_page_fault(context, get_ec_page_fault(context) + 1);
+  if (WORDSIZE != batch_wordsize) {
+    printf("%s: binary %s of job %lu has a different word size than the binaries of earlier jobs\n", selfie_name,
+      binary_name,
+      get_job_number(job));
 
-  page = get_fault(context);
+    exit(EXITCODE_BADARGUMENTS);
+  }
 
-  if (pavailable()) {
-    // TODO: reuse frames
-    map_page(context, page, (uint64_t) palloc());
+  context = create_context(MY_CONTEXT, 0);
 
-    if (is_heap_address(context, virtual_address_of_page(page)))
-      set_mc_mapped_heap(context, get_mc_mapped_heap(context) + PAGESIZE);
+  up_load_binary(context);
 
-    return DONOTEXIT;
-  } else {
-    printf("%s: page fault at 0x%lX out of physical memory\n", selfie_name, page);
+  context_name = increment_boot_level_prefix(selfie_name, binary_name);
 
-    set_exit_code(context, EXITCODE_OUTOFPHYSICALMEMORY);
+  // distinguish jobs by number
+  set_name(context, string_alloc(string_length(context_name) + 21));
 
-    return EXIT;
-  }
+  sprintf(get_name(context), "%s#%lu", context_name, get_job_number(job));
+
+  // pass context name as first argument
+  *(get_job_argv(job)) = (uint64_t) get_name(context);
+
+  up_load_arguments(context, get_job_argc(job), get_job_argv(job));
+
+  set_job_context(job, context);
+
+  enqueue_context(context);
+
+  // batch is running in place of any binary
+  binary_name = batch_name;
 }
 
-uint64_t handle_division_by_zero(uint64_t* context) {
-  set_exception(context, EXCEPTION_NOEXCEPTION);
+uint64_t* init_batch() {
+  uint64_t i;
 
-  if (record) {
-    printf("%s: division by zero, replaying...\n", selfie_name);
+  reset_scheduler();
 
-    replay_trace();
+  batch_wordsize = WORDSIZE;
 
-    set_exit_code(context, EXITCODE_NOERROR);
-  } else {
-    printf("%s: division by zero\n", selfie_name);
+  next_job = batch_jobs;
 
-    set_exit_code(context, EXITCODE_DIVISIONBYZERO);
+  i = 0;
+
+  while (i < batch_workers) {
+    if (next_job != (uint64_t*) 0) {
+      boot_job(next_job);
+
+      next_job = get_next_job(next_job);
+    }
+
+    i = i + 1;
   }
 
-  return EXIT;
+  return select_context((uint64_t*) 0);
 }
 
-uint64_t handle_timer(uint64_t* context) {
-  set_exception(context, EXCEPTION_NOEXCEPTION);
+void print_batch_results() {
+  uint64_t* job;
+  uint64_t* context;
+  uint64_t failed_jobs;
+  uint64_t turnarounds;
+  uint64_t i;
 
-  set_ec_timer(context, get_ec_timer(context) + 1);
+  failed_jobs = 0;
+  turnarounds = 0;
 
-  return DONOTEXIT;
-}
+  job = batch_jobs;
 
-uint64_t handle_exception(uint64_t* context) {
-  uint64_t exception;
+  while (job != (uint64_t*) 0) {
+    context = get_job_context(job);
 
-  exception = get_exception(context);
+    printf("%s: job %lu: %s", selfie_name, get_job_number(job), get_name(context));
 
-  if (exception == EXCEPTION_SYSCALL)
-    return handle_system_call(context);
-  else if (exception == EXCEPTION_PAGEFAULT)
-    return handle_page_fault(context);
-  else if (exception == EXCEPTION_DIVISIONBYZERO)
-    return handle_division_by_zero(context);
-  else if (exception == EXCEPTION_TIMER)
-    return handle_timer(context);
-  else {
-    printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(context));
-    print_exception(exception, get_fault(context));
+    i = 1;
+
+    while (i < get_job_argc(job)) {
+      printf(" %s", (char*) *(get_job_argv(job) + i));
+
+      i = i + 1;
+    }
+
+    printf(" exited with exit code %ld", sign_extend(get_exit_code(context), SYSCALL_BITWIDTH));
+    if (get_turnaround(context) > 0)
+      printf(" after %lu executed instructions, %lu in total", get_ic_all(context), get_turnaround(context));
     println();
 
-    set_exit_code(context, EXITCODE_UNCAUGHTEXCEPTION);
+    if (get_exit_code(context) != EXITCODE_NOERROR)
+      failed_jobs = failed_jobs + 1;
 
-    return EXIT;
+    turnarounds = turnarounds + get_turnaround(context);
+
+    job = get_next_job(job);
   }
+
+  // assert: number_of_jobs > 0
+  printf("%s: %lu jobs with %lu failures", selfie_name, number_of_jobs, failed_jobs);
+  if (turnarounds > 0)
+    printf(", %lu executed instructions per job, %lu in total on average until exit",
+      get_total_number_of_instructions() / number_of_jobs,
+      turnarounds / number_of_jobs);
+  println();
 }
 
 uint64_t mipster(uint64_t* to_context) {
@@ -11896,6 +16820,9 @@ uint64_t mipster(uint64_t* to_context) {
   timeout = TIMESLICE;
 
   while (1) {
+    if (replaying)
+      timeout = replay_timeout(to_context, timeout);
+
     from_context = mipster_switch(to_context, timeout);
 
     if (get_parent(from_context) != MY_CONTEXT) {
@@ -11903,13 +16830,17 @@ uint64_t mipster(uint64_t* to_context) {
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
-    } else if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else {
-      // TODO: scheduler should go here
-      to_context = from_context;
+    } else if (handle_exception(from_context) == EXIT) {
+      to_context = terminate(from_context);
+
+      if (to_context == (uint64_t*) 0)
+        return scheduled_exit_code;
 
       timeout = TIMESLICE;
+    } else {
+      to_context = schedule(from_context);
+
+      timeout = time_slice(from_context, to_context);
     }
   }
 }
@@ -11918,13 +16849,17 @@ uint64_t hypster(uint64_t* to_context) {
   uint64_t* from_context;
 
   while (1) {
+    // time slices restart after each exception since the
+    // remaining time is only known on the hosting mipster
     from_context = hypster_switch(to_context, TIMESLICE);
 
-    if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else
-      // TODO: scheduler should go here
-      to_context = from_context;
+    if (handle_exception(from_context) == EXIT) {
+      to_context = terminate(from_context);
+
+      if (to_context == (uint64_t*) 0)
+        return scheduled_exit_code;
+    } else
+      to_context = schedule(from_context);
   }
 }
 
@@ -11964,11 +16899,18 @@ uint64_t mixter(uint64_t* to_context, uint64_t mix) {
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
-    } else if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else {
-      // TODO: scheduler should go here
-      to_context = from_context;
+    } else if (handle_exception(from_context) == EXIT) {
+      to_context = terminate(from_context);
+
+      if (to_context == (uint64_t*) 0)
+        return scheduled_exit_code;
+
+      if (mix)
+        timeout = mslice;
+      else
+        timeout = TIMESLICE - mslice;
+    } else {
+      to_context = schedule(from_context);
 
       if (mix) {
         if (mslice != TIMESLICE) {
@@ -12000,14 +16942,18 @@ uint64_t minmob(uint64_t* to_context) {
 
       timeout = TIMEROFF;
     } else {
-      // minster and mobster do not handle page faults
-      if (get_exception(from_context) == EXCEPTION_PAGEFAULT) {
-        printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(from_context));
-        print_exception(get_exception(from_context), get_fault(from_context));
-        println();
+      // minster and mobster do not handle page faults,
+      // except for writes to pages mapped to the zero frame
+      if (get_exception(from_context) == EXCEPTION_PAGEFAULT)
+        if (is_page_shared(from_context, get_fault(from_context)) == 0) {
+          printf("%s: context %s threw uncaught exception: ", selfie_name, get_name(from_context));
+          print_exception(get_exception(from_context), get_fault(from_context));
+          println();
+
+          return EXITCODE_UNCAUGHTEXCEPTION;
+        }
 
-        return EXITCODE_UNCAUGHTEXCEPTION;
-      } else if (handle_exception(from_context) == EXIT)
+      if (handle_exception(from_context) == EXIT)
         return get_exit_code(from_context);
 
       // TODO: scheduler should go here
@@ -12036,6 +16982,14 @@ uint64_t mobster(uint64_t* to_context) {
 uint64_t selfie_run(uint64_t machine) {
   uint64_t exit_code;
 
+  if (batch_name != (char*) 0) {
+    // binaries of jobs are loaded when jobs start,
+    // per-instruction profiles cover all binaries
+    code_size = MAX_CODE_SIZE;
+
+    number_of_contexts = number_of_jobs;
+  }
+
   if (code_size == 0) {
     printf("%s: nothing to run, debug, or host\n", selfie_name);
 
@@ -12063,20 +17017,172 @@ uint64_t selfie_run(uint64_t machine) {
 
     L1_CACHE_ENABLED = 1;
 
+    machine = MIPSTER;
+  } else if (machine == JITSTER) {
+    translate = 1;
+
     machine = MIPSTER;
   }
 
+  if (number_of_contexts > 1) {
+    if (machine == MINSTER)
+      number_of_contexts = 0;
+    else if (machine == MOBSTER)
+      number_of_contexts = 0;
+    else if (image_name != (char*) 0)
+      number_of_contexts = 0;
+    else if (log_name != (char*) 0)
+      number_of_contexts = 0;
+    else if (replay_name != (char*) 0)
+      number_of_contexts = 0;
+    else if (batch_name != (char*) 0)
+      if (GC_ON)
+        number_of_contexts = 0;
+
+    if (number_of_contexts == 0) {
+      printf("%s: scheduling multiple contexts is unsupported on minster, mobster, and with images, logs, replay, or batch gc\n", selfie_name);
+
+      return EXITCODE_BADARGUMENTS;
+    }
+  }
+
+  share_images = 0;
+
+  if (number_of_contexts > 1)
+    if (machine == MIPSTER)
+      // stores of contexts hosted by hypster are executed
+      // on the boot level below, bypassing copy-on-write
+      share_images = 1;
+
+  if (swap_size > 0) {
+    if (machine != MIPSTER)
+      swap_size = 0;
+    else if (record)
+      swap_size = 0;
+    else if (L1_CACHE_ENABLED)
+      swap_size = 0;
+    else if (GC_ON)
+      swap_size = 0;
+    else if (snapshot_name != (char*) 0)
+      swap_size = 0;
+    else if (image_name != (char*) 0)
+      swap_size = 0;
+    else if (log_name != (char*) 0)
+      swap_size = 0;
+    else if (replay_name != (char*) 0)
+      swap_size = 0;
+
+    if (swap_size == 0) {
+      printf("%s: swapping is only supported on mipster without recording, caches, gc, snapshots, images, logs, or replay\n", selfie_name);
+
+      return EXITCODE_BADARGUMENTS;
+    }
+
+    // shared images are created from resident pages only
+    share_images = 0;
+  }
+
+  if (dedup_period > 0) {
+    if (machine != MIPSTER)
+      dedup_period = 0;
+    else if (swap_size > 0)
+      dedup_period = 0;
+    else if (record)
+      dedup_period = 0;
+    else if (L1_CACHE_ENABLED)
+      dedup_period = 0;
+    else if (image_name != (char*) 0)
+      dedup_period = 0;
+    else if (log_name != (char*) 0)
+      dedup_period = 0;
+    else if (replay_name != (char*) 0)
+      dedup_period = 0;
+
+    if (dedup_period == 0) {
+      printf("%s: merging pages is only supported on mipster without swapping, recording, caches, images, logs, or replay\n", selfie_name);
+
+      return EXITCODE_BADARGUMENTS;
+    }
+  }
+
+  if (lean) {
+    if (machine != MIPSTER)
+      lean = 0;
+    else if (SIZEOFUINT64INBITS != WORDSIZEINBITS)
+      lean = 0;
+    else if (debug)
+      lean = 0;
+    else if (L1_CACHE_ENABLED)
+      lean = 0;
+    else if (translate)
+      lean = 0;
+    else if (trace_name != (char*) 0)
+      lean = 0;
+    else if (stacks_name != (char*) 0)
+      lean = 0;
+    else if (annotate_name != (char*) 0)
+      lean = 0;
+    else if (log_name != (char*) 0)
+      lean = 0;
+    else if (replay_name != (char*) 0)
+      lean = 0;
+
+    if (lean == 0) {
+      printf("%s: lean execution is only supported on mipster without debugging, caches, jit, traces, stacks, annotation, logs, or replay\n", selfie_name);
+
+      return EXITCODE_BADARGUMENTS;
+    }
+  }
+
+  // execution loop is selected once rather than per instruction
+  if (lean)
+    execution_loop = LOOP_LEAN;
+  else if (debug)
+    execution_loop = LOOP_DEBUG;
+  else if (L1_CACHE_ENABLED)
+    execution_loop = LOOP_CACHE;
+  else
+    execution_loop = LOOP_PROFILE;
+
   reset_interpreter();
   reset_profiler();
   reset_microkernel();
 
+  if (swap_size > 0)
+    swap_buckets = zmalloc(SWAPBUCKETS * sizeof(uint64_t*));
+
   init_memory(atoi(peek_argument(0)));
 
-  current_context = create_context(MY_CONTEXT, 0);
+  if (swap_size == 0) {
+    // stores of contexts hosted by hypster and mobster do not fault on the zero frame
+    if (machine == MIPSTER)
+      zero_frame = (uint64_t) palloc();
+    else if (machine == MINSTER)
+      zero_frame = (uint64_t) palloc();
+  }
+
+  if (dedup_period > 0) {
+    merged_frames = zmalloc(MERGEBUCKETS * sizeof(uint64_t*));
+    dedup_slots   = zmalloc(DEDUPSLOTS * sizeof(uint64_t));
+    dedup_hashes  = zmalloc(DEDUPSLOTS * 2 * sizeof(uint64_t));
+  }
+
+  if (batch_name != (char*) 0)
+    // jobs bring their own arguments, remaining arguments are ignored
+    current_context = init_batch();
+  else {
+    current_context = create_context(MY_CONTEXT, 0);
+
+    // assert: number_of_remaining_arguments() > 0
 
-  // assert: number_of_remaining_arguments() > 0
+    if (image_name != (char*) 0)
+      // arguments of resumed context are part of image, remaining arguments are ignored
+      resume_loader(current_context);
+    else
+      boot_loader(current_context);
 
-  boot_loader(current_context);
+    current_context = init_run_queue(current_context);
+  }
 
   // current_context is ready to run
 
@@ -12089,6 +17195,15 @@ uint64_t selfie_run(uint64_t machine) {
     binary_name,
     PHYSICALMEMORYSIZE / MEGABYTE);
 
+  if (number_of_contexts > 1)
+    printf(" in %lu contexts scheduled %s", number_of_contexts, (char*) *(SCHEDULERS + SCHEDULER));
+
+  if (swap_size > 0)
+    printf(" and %luMB swap space", swap_size / MEGABYTE);
+
+  if (dedup_period > 0)
+    printf(", merging identical pages every %lu timer interrupts", dedup_period);
+
   if (GC_ON) {
     gc_init(current_context);
 
@@ -12101,10 +17216,31 @@ uint64_t selfie_run(uint64_t machine) {
       printf(", and replay");
     else
       printf(", and debugger");
-  }
+  } else if (translate)
+    printf(", and basic-block translation");
+  else if (lean)
+    printf(", and lean execution");
 
   printf("\n%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n\n", selfie_name);
 
+  if (trace_name != (char*) 0)
+    start_trace();
+
+  if (stacks_name != (char*) 0) {
+    init_procedure_names();
+
+    sampled_instructions = 0;
+  }
+
+  if (annotate_name != (char*) 0)
+    annotating = 1;
+
+  if (log_name != (char*) 0)
+    start_logging(current_context);
+
+  if (replay_name != (char*) 0)
+    start_replay();
+
   if (machine == MIPSTER)
     exit_code = mipster(current_context);
   else if (machine == HYPSTER)
@@ -12128,6 +17264,24 @@ uint64_t selfie_run(uint64_t machine) {
     binary_name,
     sign_extend(exit_code, SYSCALL_BITWIDTH));
 
+  if (tracing)
+    stop_trace();
+
+  if (stacks_name != (char*) 0)
+    selfie_print_call_stacks();
+
+  if (annotate_name != (char*) 0)
+    selfie_annotate();
+
+  if (logging)
+    stop_logging();
+
+  if (replaying)
+    stop_replay();
+
+  if (batch_name != (char*) 0)
+    print_batch_results();
+
   print_profile();
 
   run = 0;
@@ -12188,7 +17342,9 @@ uint64_t no_or_bad_or_more_arguments(uint64_t exit_code) {
 }
 
 void print_synopsis(char* extras) {
-  printf("%s { -c { source } | -o binary | ( -s | -S ) assembly | -l binary }%s\n", selfie_name, extras);
+  printf("%s { -c { source } | -o binary | ( -s | -S ) assembly | -l binary | -snap image | -resume image", selfie_name);
+  printf(" | -trace file | -stacks period file | -annotate file | -log file period | -replay file count");
+  printf(" | -batch file workers }%s\n", extras);
 }
 
 // -----------------------------------------------------------------
@@ -12234,7 +17390,46 @@ uint64_t selfie(uint64_t extras) {
         selfie_disassemble(1);
       else if (string_compare(argument, "-l"))
         selfie_load(get_argument());
-      else if (not(extras)) {
+      else if (string_compare(argument, "-snap"))
+        snapshot_name = get_argument();
+      else if (string_compare(argument, "-resume"))
+        selfie_resume(get_argument());
+      else if (string_compare(argument, "-trace"))
+        trace_name = get_argument();
+      else if (string_compare(argument, "-stacks")) {
+        sample_period = atoi(get_argument());
+
+        if (sample_period == 0)
+          sample_period = 1;
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        stacks_name = get_argument();
+      } else if (string_compare(argument, "-annotate"))
+        annotate_name = get_argument();
+      else if (string_compare(argument, "-log")) {
+        log_name = get_argument();
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        checkpoint_period = atoi(get_argument());
+      } else if (string_compare(argument, "-replay")) {
+        replay_name = get_argument();
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        selfie_replay(replay_name, atoi(get_argument()));
+      } else if (string_compare(argument, "-batch")) {
+        batch_name = get_argument();
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        selfie_batch(batch_name, atoi(get_argument()));
+      }      else if (not(extras)) {
         if (string_compare(argument, "-m"))
           return selfie_run(MIPSTER);
         else if (string_compare(argument, "-d"))
@@ -12249,6 +17444,49 @@ uint64_t selfie(uint64_t extras) {
           return selfie_run(MOBSTER);
         else if (string_compare(argument, "-L1"))
           return selfie_run(CAPSTER);
+        else if (string_compare(argument, "-jit"))
+          return selfie_run(JITSTER);
+        else if (string_compare(argument, "-L2")) {
+          CACHE_LEVELS = 2;
+
+          return selfie_run(CAPSTER);
+        } else if (string_compare(argument, "-L3")) {
+          CACHE_LEVELS = 3;
+
+          return selfie_run(CAPSTER);
+        } else if (string_compare(argument, "-replace")) {
+          CACHE_REPLACEMENT = select_policy(get_argument(), REPLACEMENT_POLICIES, REPLACE_RANDOM + 1);
+
+          if (CACHE_REPLACEMENT > REPLACE_RANDOM)
+            return EXITCODE_BADARGUMENTS;
+        } else if (string_compare(argument, "-write")) {
+          CACHE_WRITE_POLICY = select_policy(get_argument(), WRITE_POLICIES, WRITE_BACK + 1);
+
+          if (CACHE_WRITE_POLICY > WRITE_BACK)
+            return EXITCODE_BADARGUMENTS;
+        } else if (string_compare(argument, "-prefetch")) {
+          CACHE_PREFETCHER = select_policy(get_argument(), PREFETCHERS, PREFETCH_STRIDE + 1);
+
+          if (CACHE_PREFETCHER > PREFETCH_STRIDE)
+            return EXITCODE_BADARGUMENTS;
+        } else if (string_compare(argument, "-schedule")) {
+          SCHEDULER = select_policy(get_argument(), SCHEDULERS, SCHEDULE_PRIORITY + 1);
+
+          if (SCHEDULER > SCHEDULE_PRIORITY)
+            return EXITCODE_BADARGUMENTS;
+          else if (number_of_remaining_arguments() == 0)
+            return EXITCODE_BADARGUMENTS;
+
+          number_of_contexts = atoi(get_argument());
+
+          if (number_of_contexts == 0)
+            number_of_contexts = 1;
+        } else if (string_compare(argument, "-lean"))
+          lean = 1;
+        else if (string_compare(argument, "-swap"))
+          swap_size = atoi(get_argument()) * MEGABYTE;
+        else if (string_compare(argument, "-dedup"))
+          dedup_period = atoi(get_argument());
         else
           return EXITCODE_BADARGUMENTS;
       } else
@@ -12325,6 +17563,7 @@ int main(int argc, char** argv) {
   init_system();
   init_target();
   init_kernel();
+  init_caches();
 
   exit_code = selfie(0);
 
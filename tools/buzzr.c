@@ -120,6 +120,7 @@ void implement_buzzed_read(uint64_t* context) {
   uint64_t bytes_to_read;
   uint64_t failed;
   uint64_t* buffer;
+  uint64_t words;
   uint64_t actually_read;
 
   if (debug_syscalls) {
@@ -149,50 +150,57 @@ void implement_buzzed_read(uint64_t* context) {
 
   failed = 0;
 
+  // number of words left on the current page that are validated and translated
+  words = 0;
+
   while (size > 0) {
     if (size < bytes_to_read)
       bytes_to_read = size;
 
-    if (is_virtual_address_valid(vbuffer, WORDSIZE))
-      if (is_data_stack_heap_address(context, vbuffer))
-        if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
-          buffer = translate_virtual_to_physical(get_pt(context), vbuffer);
+    if (words == 0) {
+      // validate and translate only once per page
+      if (is_virtual_address_valid(vbuffer, WORDSIZE))
+        if (is_data_stack_heap_address(context, vbuffer))
+          if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
+            words = words_in_page_run(context, vbuffer);
+
+            buffer = translate_virtual_to_physical(get_pt(context), vbuffer);
+          } else
+            printf("%s: reading into virtual address 0x%08lX failed because the address is unmapped\n", selfie_name, (uint64_t) vbuffer);
+        else
+          printf("%s: reading into virtual address 0x%08lX failed because the address is in an invalid segment\n", selfie_name, (uint64_t) vbuffer);
+      else
+        printf("%s: reading into virtual address 0x%08lX failed because the address is invalid\n", selfie_name, (uint64_t) vbuffer);
+
+      if (words == 0) {
+        failed = 1;
 
-          actually_read = buzz_read(buffer, bytes_to_read);
+        size = 0;
+      }
+    }
 
-          if (actually_read == bytes_to_read) {
-            read_total = read_total + actually_read;
+    if (words > 0) {
+      actually_read = buzz_read(buffer, bytes_to_read);
 
-            size = size - actually_read;
+      if (actually_read == bytes_to_read) {
+        read_total = read_total + actually_read;
 
-            if (size > 0)
-              vbuffer = vbuffer + WORDSIZE;
-          } else {
-            if (signed_less_than(0, actually_read))
-              read_total = read_total + actually_read;
+        size = size - actually_read;
 
-            size = 0;
-          }
-        } else {
-          failed = 1;
+        if (size > 0) {
+          vbuffer = vbuffer + WORDSIZE;
 
-          size = 0;
+          // next word in physical memory
+          buffer = buffer + 1;
 
-          printf("%s: reading into virtual address 0x%08lX failed because the address is unmapped\n", selfie_name, (uint64_t) vbuffer);
+          words = words - 1;
         }
-      else {
-        failed = 1;
+      } else {
+        if (signed_less_than(0, actually_read))
+          read_total = read_total + actually_read;
 
         size = 0;
-
-        printf("%s: reading into virtual address 0x%08lX failed because the address is in an invalid segment\n", selfie_name, (uint64_t) vbuffer);
       }
-    else {
-      failed = 1;
-
-      size = 0;
-
-      printf("%s: reading into virtual address 0x%08lX failed because the address is invalid\n", selfie_name, (uint64_t) vbuffer);
     }
   }
 
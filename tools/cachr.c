@@ -0,0 +1,430 @@
+/*
+Copyright (c) the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+selfie.cs.uni-salzburg.at
+
+Cachr is a trace-driven cache simulator for educational purposes.
+Cachr reads a memory access trace recorded by selfie with the
+-trace option and computes the miss ratios of LRU caches for
+a whole grid of cache sizes and associativities in a single pass
+over the trace. The key insight is that an LRU cache with n ways
+hits an access if and only if the accessed block is among the n
+most recently used blocks of its set. Cachr therefore maintains
+one LRU stack per set for each number of sets, and counts at
+which stack distance accessed blocks are found. The histogram of
+stack distances for a given number of sets then determines the
+number of hits of all caches with that many sets, no matter
+their associativity.
+
+Cachr is written in C*, and uses code from the selfie system.
+See selfie's Makefile for details on how to build cachr.
+*/
+
+// -----------------------------------------------------------------
+// ------------------------ CACHE SIMULATOR ------------------------
+// -----------------------------------------------------------------
+
+uint64_t* get_stacks(uint64_t cache, uint64_t level);
+uint64_t* get_distances(uint64_t cache, uint64_t level);
+
+void init_stacks();
+
+uint64_t stack_distance(uint64_t* stack, uint64_t tag);
+void     access_block(uint64_t cache, uint64_t block);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t MINCACHESIZE = 1024;    // 1KB
+uint64_t MAXCACHESIZE = 1048576; // 1MB
+
+uint64_t MAXASSOCIATIVITY = 16; // depth of LRU stacks
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t analyzed_block_size = 16; // in bytes, multiple of trace block size
+
+uint64_t min_number_of_sets = 1;
+uint64_t number_of_levels   = 1; // number of sets doubles per level
+
+// per cache and level: number of sets * MAXASSOCIATIVITY blocks,
+// most recently used first, 0 if empty, otherwise block + 1
+uint64_t* cache_stacks = (uint64_t*) 0;
+
+// per cache and level: MAXASSOCIATIVITY + 1 counters of accesses
+// at each stack distance, the last one counts blocks not in stack
+uint64_t* cache_distances = (uint64_t*) 0;
+
+// per cache: number of simulated accesses and of repeated accesses
+// to the same block which hit in any cache
+uint64_t* cache_accesses = (uint64_t*) 0;
+uint64_t* cache_repeats  = (uint64_t*) 0;
+
+// -----------------------------------------------------------------
+// ------------------------- TRACE READER --------------------------
+// -----------------------------------------------------------------
+
+uint64_t next_trace_byte();
+uint64_t next_trace_number();
+
+void selfie_load_trace();
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t trace_read_bytes = 0; // number of bytes read into buffer
+uint64_t trace_position   = 0; // position of next byte in buffer
+
+uint64_t trace_end = 0; // flag for end of trace
+
+// -----------------------------------------------------------------
+// ----------------------------- CACHR -----------------------------
+// -----------------------------------------------------------------
+
+void print_miss_ratios(uint64_t cache, char* cache_name);
+
+void selfie_cachr();
+
+// -----------------------------------------------------------------
+// ------------------------ CACHE SIMULATOR ------------------------
+// -----------------------------------------------------------------
+
+uint64_t* get_stacks(uint64_t cache, uint64_t level) {
+  return (uint64_t*) *(cache_stacks + cache * number_of_levels + level);
+}
+
+uint64_t* get_distances(uint64_t cache, uint64_t level) {
+  return (uint64_t*) *(cache_distances + cache * number_of_levels + level);
+}
+
+void init_stacks() {
+  uint64_t cache;
+  uint64_t level;
+  uint64_t number_of_sets;
+
+  min_number_of_sets = MINCACHESIZE / (MAXASSOCIATIVITY * analyzed_block_size);
+
+  number_of_levels = 1;
+
+  number_of_sets = min_number_of_sets;
+
+  while (number_of_sets < MAXCACHESIZE / analyzed_block_size) {
+    number_of_sets = number_of_sets * 2;
+
+    number_of_levels = number_of_levels + 1;
+  }
+
+  cache_stacks    = smalloc(2 * number_of_levels * sizeof(uint64_t*));
+  cache_distances = smalloc(2 * number_of_levels * sizeof(uint64_t*));
+
+  cache = TRACE_INSTRUCTION;
+
+  while (cache <= TRACE_DATA) {
+    level = 0;
+
+    number_of_sets = min_number_of_sets;
+
+    while (level < number_of_levels) {
+      *(cache_stacks + cache * number_of_levels + level) =
+        (uint64_t) zmalloc(number_of_sets * MAXASSOCIATIVITY * sizeof(uint64_t));
+      *(cache_distances + cache * number_of_levels + level) =
+        (uint64_t) zmalloc((MAXASSOCIATIVITY + 1) * sizeof(uint64_t));
+
+      number_of_sets = number_of_sets * 2;
+
+      level = level + 1;
+    }
+
+    cache = cache + 1;
+  }
+
+  cache_accesses = zmalloc(2 * sizeof(uint64_t));
+  cache_repeats  = zmalloc(2 * sizeof(uint64_t));
+}
+
+uint64_t stack_distance(uint64_t* stack, uint64_t tag) {
+  uint64_t distance;
+
+  distance = 0;
+
+  while (distance < MAXASSOCIATIVITY) {
+    if (*(stack + distance) == tag)
+      return distance;
+
+    distance = distance + 1;
+  }
+
+  return MAXASSOCIATIVITY;
+}
+
+void access_block(uint64_t cache, uint64_t block) {
+  uint64_t level;
+  uint64_t number_of_sets;
+  uint64_t* stack;
+  uint64_t* distances;
+  uint64_t distance;
+
+  *(cache_accesses + cache) = *(cache_accesses + cache) + 1;
+
+  level = 0;
+
+  number_of_sets = min_number_of_sets;
+
+  while (level < number_of_levels) {
+    stack     = get_stacks(cache, level) + block % number_of_sets * MAXASSOCIATIVITY;
+    distances = get_distances(cache, level);
+
+    distance = stack_distance(stack, block + 1);
+
+    *(distances + distance) = *(distances + distance) + 1;
+
+    if (distance == MAXASSOCIATIVITY)
+      // least recently used block drops out of stack
+      distance = MAXASSOCIATIVITY - 1;
+
+    // move block to top of stack
+    while (distance > 0) {
+      *(stack + distance) = *(stack + distance - 1);
+
+      distance = distance - 1;
+    }
+
+    *stack = block + 1;
+
+    number_of_sets = number_of_sets * 2;
+
+    level = level + 1;
+  }
+}
+
+// -----------------------------------------------------------------
+// ------------------------- TRACE READER --------------------------
+// -----------------------------------------------------------------
+
+uint64_t next_trace_byte() {
+  if (trace_position == trace_read_bytes) {
+    trace_read_bytes = read(trace_fd, trace_buffer, TRACEBUFFERSIZE);
+
+    if (signed_less_than(trace_read_bytes, 1)) {
+      trace_read_bytes = 0;
+
+      trace_end = 1;
+    }
+
+    trace_position = 0;
+  }
+
+  if (trace_end)
+    return 0;
+
+  trace_position = trace_position + 1;
+
+  // load_character is not used since it returns signed characters on some hosts
+  return get_bits(*(trace_buffer + (trace_position - 1) / sizeof(uint64_t)),
+    ((trace_position - 1) % sizeof(uint64_t)) * 8, 8);
+}
+
+uint64_t next_trace_number() {
+  uint64_t n;
+  uint64_t factor;
+  uint64_t b;
+
+  n      = 0;
+  factor = 1;
+
+  b = next_trace_byte();
+
+  while (b >= 128) {
+    n = n + (b - 128) * factor;
+
+    factor = factor * 128;
+
+    b = next_trace_byte();
+  }
+
+  return n + b * factor;
+}
+
+void selfie_load_trace() {
+  uint64_t* header;
+
+  trace_name = get_argument();
+
+  // assert: trace_name is mapped and not longer than MAX_FILENAME_LENGTH
+
+  trace_fd = open_read_only(trace_name);
+
+  if (signed_less_than(trace_fd, 0)) {
+    printf("%s: could not open input file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  header = smalloc(TRACEHEADERENTRIES * sizeof(uint64_t));
+
+  if (read(trace_fd, header, TRACEHEADERENTRIES * sizeof(uint64_t)) == TRACEHEADERENTRIES * sizeof(uint64_t))
+    if (*header == TRACEMAGIC)
+      if (*(header + 1) == TRACEBLOCKSIZE) {
+        trace_buffer = smalloc(TRACEBUFFERSIZE);
+
+        return;
+      }
+
+  printf("%s: %s is not a memory access trace with %lu-byte blocks\n", selfie_name, trace_name, TRACEBLOCKSIZE);
+
+  exit(EXITCODE_IOERROR);
+}
+
+// -----------------------------------------------------------------
+// ----------------------------- CACHR -----------------------------
+// -----------------------------------------------------------------
+
+void print_miss_ratios(uint64_t cache, char* cache_name) {
+  uint64_t accesses;
+  uint64_t cache_size;
+  uint64_t associativity;
+  uint64_t level;
+  uint64_t* distances;
+  uint64_t hits;
+  uint64_t distance;
+  uint64_t misses;
+
+  accesses = *(cache_accesses + cache) + *(cache_repeats + cache);
+
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  printf("%s: %s cache: %lu accesses, %lu-byte blocks, LRU replacement\n", selfie_name,
+    cache_name,
+    accesses,
+    analyzed_block_size);
+  printf("%s: miss ratios: size,1-way,2-way,4-way,8-way,16-way\n", selfie_name);
+
+  if (accesses == 0)
+    return;
+
+  cache_size = MINCACHESIZE;
+
+  while (cache_size <= MAXCACHESIZE) {
+    printf("%s: %luKB", selfie_name, cache_size / 1024);
+
+    associativity = 1;
+
+    while (associativity <= MAXASSOCIATIVITY) {
+      // level of number of sets cache_size / (associativity * analyzed_block_size)
+      level = 0;
+
+      while (left_shift(min_number_of_sets, level) * associativity * analyzed_block_size < cache_size)
+        level = level + 1;
+
+      distances = get_distances(cache, level);
+
+      hits = *(cache_repeats + cache);
+
+      distance = 0;
+
+      while (distance < associativity) {
+        hits = hits + *(distances + distance);
+
+        distance = distance + 1;
+      }
+
+      misses = accesses - hits;
+
+      printf(",%lu.%.2lu%%",
+        percentage_format_integral_2(accesses, misses),
+        percentage_format_fractional_2(accesses, misses));
+
+      associativity = associativity * 2;
+    }
+
+    println();
+
+    cache_size = cache_size * 2;
+  }
+}
+
+void selfie_cachr() {
+  uint64_t runs;
+  uint64_t* previous;
+  uint64_t number;
+  uint64_t cache;
+  uint64_t distance;
+
+  if (number_of_remaining_arguments() == 0) {
+    printf("synopsis: %s trace [ block size ]\n", selfie_name);
+
+    return;
+  }
+
+  selfie_load_trace();
+
+  if (number_of_remaining_arguments() > 0) {
+    analyzed_block_size = atoi(get_argument());
+
+    if (analyzed_block_size < TRACEBLOCKSIZE) {
+      printf("%s: block size must be at least %lu bytes\n", selfie_name, TRACEBLOCKSIZE);
+
+      exit(EXITCODE_BADARGUMENTS);
+    } else if (analyzed_block_size > MINCACHESIZE / MAXASSOCIATIVITY) {
+      printf("%s: block size must be at most %lu bytes\n", selfie_name, MINCACHESIZE / MAXASSOCIATIVITY);
+
+      exit(EXITCODE_BADARGUMENTS);
+    } else if (analyzed_block_size != left_shift(1, log_two(analyzed_block_size))) {
+      printf("%s: block size must be a power of 2\n", selfie_name);
+
+      exit(EXITCODE_BADARGUMENTS);
+    }
+  }
+
+  init_stacks();
+
+  previous = zmalloc(2 * sizeof(uint64_t));
+
+  runs = 0;
+
+  number = next_trace_number();
+
+  while (trace_end == 0) {
+    cache = number % 2;
+
+    // undo zigzag encoding of block distance
+    distance = number / 2;
+
+    if (distance % 2 == 0)
+      distance = distance / 2;
+    else
+      distance = 0 - (distance + 1) / 2;
+
+    *(previous + cache) = *(previous + cache) + distance;
+
+    access_block(cache, *(previous + cache) / (analyzed_block_size / TRACEBLOCKSIZE));
+
+    *(cache_repeats + cache) = *(cache_repeats + cache) + next_trace_number();
+
+    runs = runs + 1;
+
+    number = next_trace_number();
+  }
+
+  printf("%s: %lu runs of memory accesses analyzed from %s\n", selfie_name, runs, trace_name);
+
+  print_miss_ratios(TRACE_DATA, "data");
+  print_miss_ratios(TRACE_INSTRUCTION, "instruction");
+}
+
+// -----------------------------------------------------------------
+// ----------------------------- MAIN ------------------------------
+// -----------------------------------------------------------------
+
+int main(int argc, char** argv) {
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+
+  selfie_cachr();
+
+  return EXITCODE_NOERROR;
+}
@@ -307,6 +307,7 @@ void implement_symbolic_read(uint64_t* context) {
   uint64_t read_total;
   uint64_t bytes_to_read;
   uint64_t failed;
+  uint64_t words;
 
   vbuffer = *(get_regs(context) + REG_A1);
   size    = *(get_regs(context) + REG_A2);
@@ -317,50 +318,57 @@ void implement_symbolic_read(uint64_t* context) {
 
   failed = 0;
 
+  // number of words left on the current page that are validated
+  words = 0;
+
   while (size > 0) {
     if (size < bytes_to_read)
       bytes_to_read = size;
 
-    if (is_virtual_address_valid(vbuffer, WORDSIZE))
-      if (is_data_stack_heap_address(context, vbuffer))
-        if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
-          store_symbolic_memory(vbuffer, 0, 0, smt_variable("i", bytes_to_read * 8), bytes_to_read * 8);
-
-          // save symbolic memory here since context switching has already happened
-          set_symbolic_memory(context, symbolic_memory);
-
-          read_total = read_total + bytes_to_read;
-
-          size = size - bytes_to_read;
-
-          if (size > 0)
-            vbuffer = vbuffer + WORDSIZE;
-        } else {
-          failed = 1;
-
-          size = 0;
-
+    if (words == 0) {
+      // validate only once per page
+      if (is_virtual_address_valid(vbuffer, WORDSIZE))
+        if (is_data_stack_heap_address(context, vbuffer))
+          if (is_virtual_address_mapped(get_pt(context), vbuffer))
+            words = words_in_page_run(context, vbuffer);
+          else {
+            use_stdout();
+            printf("%s: reading into virtual address 0x%08lX failed because the address is unmapped\n", selfie_name, vbuffer);
+            use_file();
+          }
+        else {
           use_stdout();
-          printf("%s: reading into virtual address 0x%08lX failed because the address is unmapped\n", selfie_name, vbuffer);
+          printf("%s: reading into virtual address 0x%08lX failed because the address is in an invalid segment\n", selfie_name, vbuffer);
           use_file();
         }
       else {
+        use_stdout();
+        printf("%s: reading into virtual address 0x%08lX failed because the address is invalid\n", selfie_name, vbuffer);
+        use_file();
+      }
+
+      if (words == 0) {
         failed = 1;
 
         size = 0;
-
-        use_stdout();
-        printf("%s: reading into virtual address 0x%08lX failed because the address is in an invalid segment\n", selfie_name, vbuffer);
-        use_file();
       }
-    else {
-      failed = 1;
+    }
 
-      size = 0;
+    if (words > 0) {
+      store_symbolic_memory(vbuffer, 0, 0, smt_variable("i", bytes_to_read * 8), bytes_to_read * 8);
 
-      use_stdout();
-      printf("%s: reading into virtual address 0x%08lX failed because the address is invalid\n", selfie_name, vbuffer);
-      use_file();
+      // save symbolic memory here since context switching has already happened
+      set_symbolic_memory(context, symbolic_memory);
+
+      read_total = read_total + bytes_to_read;
+
+      size = size - bytes_to_read;
+
+      if (size > 0) {
+        vbuffer = vbuffer + WORDSIZE;
+
+        words = words - 1;
+      }
     }
   }
 
@@ -1410,6 +1418,9 @@ void merge(uint64_t* active_context, uint64_t* mergeable_context, uint64_t locat
   if (get_beq_counter(mergeable_context) < get_beq_counter(active_context))
     set_beq_counter(active_context, get_beq_counter(mergeable_context));
 
+  // page table is shared among symbolic contexts
+  set_pt(mergeable_context, (uint64_t*) 0);
+
   symbolic_contexts = delete_context(mergeable_context, symbolic_contexts);
 }
 
@@ -1815,7 +1826,9 @@ void monster(uint64_t* to_context) {
         // we need to update the end of the shared symbolic memory of the corresponding context
         update_begin_of_shared_symbolic_memory(get_merge_partner(from_context), from_context);
 
-        // delete exited context
+        // delete exited context but keep page table shared among symbolic contexts
+        set_pt(from_context, (uint64_t*) 0);
+
         symbolic_contexts = delete_context(from_context, symbolic_contexts);
 
         // schedule the context with the highest call stack and the lowest program counter